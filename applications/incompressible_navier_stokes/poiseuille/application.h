@@ -400,8 +400,11 @@ private:
       // inflow
       if(boundary_condition == BoundaryCondition::ParabolicInflow)
       {
+        // stationary inflow profile, evaluated once at the boundary quadrature points
         this->boundary_descriptor->velocity->dirichlet_bc.insert(
-          pair(1, new AnalyticalSolutionVelocity<dim>(max_velocity, H)));
+          pair(1,
+               new SeparableFunction<dim>(
+                 std::make_shared<AnalyticalSolutionVelocity<dim>>(max_velocity, H))));
       }
       else if(boundary_condition == BoundaryCondition::PressureInflow)
       {
@@ -0,0 +1,210 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/structure/material/library/mooney_rivlin.h>
+#include <exadg/structure/material/library/neo_hookean.h>
+#include <exadg/structure/material/library/st_venant_kirchhoff.h>
+#include <exadg/structure/spatial_discretization/operators/continuum_mechanics.h>
+
+/*
+ * Micro-benchmark for the throughput of the material models of the structure module. The 2nd
+ * Piola-Kirchhoff stress tensor and its directional derivative are evaluated for all quadrature
+ * points of all cell batches, once with one virtual function call per quadrature point and once
+ * with one virtual function call per cell batch. The throughput is reported in quadrature points
+ * per second.
+ */
+namespace ExaDG
+{
+template<int dim, typename Number>
+void
+measure_material(std::string const &                     name,
+                 Structure::Material<dim, Number> const & material,
+                 dealii::MatrixFree<dim, Number> const &  matrix_free,
+                 unsigned int const                       n_repetitions)
+{
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  unsigned int const n_cell_batches = matrix_free.n_cell_batches();
+  unsigned int const n_q_points     = matrix_free.get_quadrature().size();
+
+  // displacement gradients and increments of moderate size such that det(F) > 0
+  dealii::AlignedVector<tensor> gradient(n_q_points), increment(n_q_points), F(n_q_points),
+    result(n_q_points);
+  for(unsigned int q = 0; q < n_q_points; ++q)
+  {
+    for(unsigned int i = 0; i < dim; ++i)
+    {
+      for(unsigned int j = 0; j < dim; ++j)
+      {
+        gradient[q][i][j]  = 0.1 * (1.0 + i + dim * j) / (dim * dim) / (1.0 + q);
+        increment[q][i][j] = 0.01 * (1.0 + j + dim * i) / (dim * dim);
+      }
+    }
+    F[q] = Structure::get_F<dim, Number>(gradient[q]);
+  }
+
+  dealii::ArrayView<tensor const> const gradient_view(gradient.begin(), n_q_points);
+  dealii::ArrayView<tensor const> const increment_view(increment.begin(), n_q_points);
+  dealii::ArrayView<tensor const> const F_view(F.begin(), n_q_points);
+  dealii::ArrayView<tensor> const       result_view(result.begin(), n_q_points);
+
+  auto const measure = [&](auto const & cell_kernel) {
+    dealii::Timer timer;
+    for(unsigned int r = 0; r < n_repetitions; ++r)
+      for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+        cell_kernel(cell);
+
+    return static_cast<double>(n_repetitions) * matrix_free.n_physical_cells() * n_q_points /
+           timer.wall_time();
+  };
+
+  double const stress_quadrature_point = measure([&](unsigned int const cell) {
+    for(unsigned int q = 0; q < n_q_points; ++q)
+      result[q] = material.second_piola_kirchhoff_stress(gradient[q], cell, q);
+  });
+
+  double const stress_cell_batch = measure([&](unsigned int const cell) {
+    material.second_piola_kirchhoff_stress(result_view, gradient_view, cell);
+  });
+
+  double const derivative_quadrature_point = measure([&](unsigned int const cell) {
+    for(unsigned int q = 0; q < n_q_points; ++q)
+      result[q] =
+        material.second_piola_kirchhoff_stress_displacement_derivative(increment[q], F[q], cell, q);
+  });
+
+  double const derivative_cell_batch = measure([&](unsigned int const cell) {
+    material.second_piola_kirchhoff_stress_displacement_derivative(result_view,
+                                                                   increment_view,
+                                                                   F_view,
+                                                                   cell);
+  });
+
+  std::cout << std::left << std::setw(20) << name << std::right << std::scientific
+            << std::setprecision(3) << std::setw(14) << stress_quadrature_point << std::setw(14)
+            << stress_cell_batch << std::setw(14) << derivative_quadrature_point << std::setw(14)
+            << derivative_cell_batch << std::endl;
+}
+
+template<int dim, typename Number>
+void
+run(unsigned int const degree, unsigned int const refine_space, unsigned int const n_repetitions)
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(refine_space);
+
+  dealii::FESystem<dim>   fe(dealii::FE_Q<dim>(degree), dim);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<Number> constraints;
+  constraints.close();
+
+  dealii::MappingQ<dim>           mapping(1);
+  dealii::MatrixFree<dim, Number> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     constraints,
+                     dealii::QGauss<1>(degree + 1),
+                     typename dealii::MatrixFree<dim, Number>::AdditionalData());
+
+  std::cout << std::endl
+            << "dim = " << dim << ", Number = " << (sizeof(Number) == 4 ? "float" : "double")
+            << ", degree = " << degree << ", cells = " << triangulation.n_active_cells()
+            << ", vectorization width = " << dealii::VectorizedArray<Number>::size() << std::endl
+            << std::endl
+            << "Throughput in quadrature points per second:" << std::endl
+            << std::left << std::setw(20) << "Material" << std::right << std::setw(14)
+            << "S (q-point)" << std::setw(14) << "S (batch)" << std::setw(14) << "dS (q-point)"
+            << std::setw(14) << "dS (batch)" << std::endl;
+
+  using namespace Structure;
+
+  Type2D const type_two_dim = Type2D::PlaneStrain;
+
+  StVenantKirchhoffData<dim> const data_svk(MaterialType::StVenantKirchhoff,
+                                            1.0,
+                                            0.3,
+                                            type_two_dim);
+  measure_material<dim, Number>("StVenantKirchhoff",
+                                StVenantKirchhoff<dim, Number>(matrix_free, 0, 0, data_svk, true),
+                                matrix_free,
+                                n_repetitions);
+
+  NeoHookeanData const data_nh(MaterialType::NeoHookean, 1.0, 0.3, type_two_dim);
+  measure_material<dim, Number>("NeoHookean",
+                                NeoHookean<dim, Number>(data_nh, true),
+                                matrix_free,
+                                n_repetitions);
+
+  MooneyRivlinData const data_mr(MaterialType::MooneyRivlin, 0.2, 0.05, 0.6, type_two_dim);
+  measure_material<dim, Number>("MooneyRivlin",
+                                MooneyRivlin<dim, Number>(data_mr, true),
+                                matrix_free,
+                                n_repetitions);
+}
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  if(argc >= 2 and std::string(argv[1]) == "--help")
+  {
+    std::cout << "To run the program, use: ./throughput [degree] [refine_space] [n_repetitions]"
+              << std::endl;
+    return 0;
+  }
+
+  unsigned int const degree        = argc >= 2 ? std::stoi(argv[1]) : 3;
+  unsigned int const refine_space  = argc >= 3 ? std::stoi(argv[2]) : 3;
+  unsigned int const n_repetitions = argc >= 4 ? std::stoi(argv[3]) : 100;
+
+  ExaDG::run<2, float>(degree, refine_space, n_repetitions);
+  ExaDG::run<2, double>(degree, refine_space, n_repetitions);
+  ExaDG::run<3, float>(degree, refine_space, n_repetitions);
+  ExaDG::run<3, double>(degree, refine_space, n_repetitions);
+
+  return 0;
+}
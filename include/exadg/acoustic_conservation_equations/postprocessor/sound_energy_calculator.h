@@ -30,6 +30,7 @@
 #include <exadg/utilities/print_functions.h>
 
 #include <fstream>
+#include <mutex>
 
 namespace ExaDG
 {
@@ -237,6 +238,9 @@ private:
         energy += energy_batch[v];
     }
 
+    // the loop may be executed by several threads concurrently
+    std::lock_guard<std::mutex> lock(mutex);
+
     dst += energy;
   }
 
@@ -250,6 +254,9 @@ private:
   unsigned int dof_index_pressure;
   unsigned int dof_index_velocity;
   unsigned int quad_index;
+
+  // protects the accumulation of the results of cell_loop() in task-parallel loops
+  mutable std::mutex mutex;
 };
 
 } // namespace Acoustics
@@ -151,6 +151,8 @@ main(int argc, char ** argv)
   ExaDG::SpatialResolutionParametersMinMax spatial(input_file);
   ExaDG::TemporalResolutionParameters      temporal(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
   {
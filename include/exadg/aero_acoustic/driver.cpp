@@ -19,8 +19,13 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <array>
+#include <cmath>
+
 // ExaDG
 #include <exadg/aero_acoustic/driver.h>
+#include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 
 namespace ExaDG
@@ -32,12 +37,16 @@ Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
                             std::shared_ptr<ApplicationBase<dim, Number>> app,
                             bool const                                    is_test)
   : mpi_comm(comm),
+    mpi_comm_single_field(new MPI_Comm(comm), [](MPI_Comm * comm) { delete comm; }),
+    fluid_on_this_process(true),
+    acoustic_on_this_process(true),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
     is_test(is_test),
     application(app),
     acoustic(std::make_shared<SolverAcoustic<dim, Number>>()),
     fluid(std::make_shared<SolverFluid<dim, Number>>()),
-    time_solvers_side_by_side(std::numeric_limits<double>::min())
+    time_solvers_side_by_side(std::numeric_limits<double>::min()),
+    time_waiting(0.0)
 {
   print_general_info<Number>(pcout, mpi_comm, is_test);
 }
@@ -51,22 +60,47 @@ Driver<dim, Number>::setup()
 
   pcout << std::endl << "Setting up aero-acoustic solver:" << std::endl;
 
-  // setup acoustic solver
+  application->setup_parameters();
+
+  if(application->parameters.run_solvers_concurrently)
   {
+    split_communicator();
+
+    // The timer tree is reduced over all processes and needs the same structure on all
+    // processes. Hence, the setup of the single field solvers is timed with a common name.
     dealii::Timer timer_local;
 
-    acoustic->setup(application->acoustic, mpi_comm, is_test);
+    if(acoustic_on_this_process)
+      acoustic->setup(application->acoustic, *mpi_comm_single_field, is_test);
+    else
+      application->acoustic->setup_parameters();
 
-    timer_tree.insert({"AeroAcoustic", "Setup", "Acoustic"}, timer_local.wall_time());
-  }
+    if(fluid_on_this_process)
+      fluid->setup(application->fluid, *mpi_comm_single_field, is_test);
+    else
+      application->fluid->setup_parameters();
 
-  // setup fluid solver
+    timer_tree.insert({"AeroAcoustic", "Setup", "Single field solver"}, timer_local.wall_time());
+  }
+  else
   {
-    dealii::Timer timer_local;
+    // setup acoustic solver
+    {
+      dealii::Timer timer_local;
 
-    fluid->setup(application->fluid, mpi_comm, is_test);
+      acoustic->setup(application->acoustic, mpi_comm, is_test);
+
+      timer_tree.insert({"AeroAcoustic", "Setup", "Acoustic"}, timer_local.wall_time());
+    }
 
-    timer_tree.insert({"AeroAcoustic", "Setup", "Fluid"}, timer_local.wall_time());
+    // setup fluid solver
+    {
+      dealii::Timer timer_local;
+
+      fluid->setup(application->fluid, mpi_comm, is_test);
+
+      timer_tree.insert({"AeroAcoustic", "Setup", "Fluid"}, timer_local.wall_time());
+    }
   }
 
   // setup application
@@ -77,6 +111,49 @@ Driver<dim, Number>::setup()
   timer_tree.insert({"AeroAcoustic", "Setup"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::split_communicator()
+{
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  AssertThrow(n_processes > 1,
+              dealii::ExcMessage(
+                "Running the solvers concurrently requires at least two MPI processes."));
+
+  // the acoustic solver runs on the last processes, the fluid solver on the first processes
+  int const n_processes_acoustic =
+    std::min<int>(std::max<int>(std::round(application->parameters.fraction_of_processes_acoustic *
+                                           n_processes),
+                                1),
+                  n_processes - 1);
+  int const n_processes_fluid = n_processes - n_processes_acoustic;
+
+  int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  fluid_on_this_process    = rank < n_processes_fluid;
+  acoustic_on_this_process = not fluid_on_this_process;
+
+  MPI_Comm * sub_comm = new MPI_Comm;
+  int const  ierr = MPI_Comm_split(mpi_comm, fluid_on_this_process ? 0 : 1, rank, sub_comm);
+  AssertThrowMPI(ierr);
+
+  mpi_comm_single_field =
+    std::unique_ptr<MPI_Comm, void (*)(MPI_Comm *)>(sub_comm, [](MPI_Comm * comm) {
+      MPI_Comm_free(comm);
+      delete comm;
+    });
+
+  if(fluid_on_this_process)
+    application->fluid->set_mpi_comm(*mpi_comm_single_field);
+  else
+    application->acoustic->set_mpi_comm(*mpi_comm_single_field);
+
+  pcout << std::endl << "Distribution of MPI processes:" << std::endl << std::endl;
+  print_parameter(pcout, "Processes fluid", n_processes_fluid);
+  print_parameter(pcout, "Processes acoustic", n_processes_acoustic);
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::setup_volume_coupling()
@@ -97,7 +174,13 @@ Driver<dim, Number>::setup_volume_coupling()
           "Computing source term from analytical solution requires IncNS::TemporalDiscretization::InterpolateAnalyticalSolution"));
     }
 
-    volume_coupling.setup(application->parameters, acoustic, fluid, application->field_functions);
+    volume_coupling.setup(application->parameters,
+                          acoustic,
+                          fluid,
+                          application->field_functions,
+                          mpi_comm,
+                          fluid_on_this_process,
+                          acoustic_on_this_process);
 
     pcout << std::endl << "... done!" << std::endl;
 
@@ -133,14 +216,24 @@ template<int dim, typename Number>
 void
 Driver<dim, Number>::solve()
 {
-  std::pair<bool, dealii::Timer> timer = std::make_pair(false, dealii::Timer());
-
-  set_start_time();
-
   AssertThrow(std::abs(application->fluid->get_parameters().end_time -
                        application->acoustic->get_parameters().end_time) < 1.0e-12,
               dealii::ExcMessage("Acoustic and fluid simulation need the same end time."));
 
+  if(application->parameters.run_solvers_concurrently)
+    solve_concurrently();
+  else
+    solve_sequentially();
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_sequentially()
+{
+  std::pair<bool, dealii::Timer> timer = std::make_pair(false, dealii::Timer());
+
+  set_start_time();
+
   while(not fluid->time_integrator->finished())
   {
     if(timer.first == false and acoustic->time_integrator->started())
@@ -179,10 +272,169 @@ Driver<dim, Number>::solve()
   time_solvers_side_by_side = timer.second.wall_time();
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::solve_concurrently()
+{
+  // The coupling is one-way: the acoustic solver needs the source term at t^n and the macro time
+  // step size, both of which are known before the fluid solver performs its time step. Hence, the
+  // fluid solver sends this data at the beginning of each time step and continues without
+  // waiting, while the acoustic solver advances to t^(n+1) in the meantime. Control messages
+  // {time or time step size, acoustic starts, finished} are sent from the first fluid process to
+  // all acoustic processes using a communicator of their own.
+  using ControlMessage = std::array<double, 3>;
+
+  MPI_Comm const control_comm = dealii::Utilities::MPI::duplicate_communicator(mpi_comm);
+
+  unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  int const          tag         = 0;
+
+  // the fluid solver runs on the first processes, see split_communicator()
+  unsigned int const n_processes_fluid =
+    dealii::Utilities::MPI::sum(fluid_on_this_process ? 1u : 0u, mpi_comm);
+
+  std::pair<bool, dealii::Timer> timer = std::make_pair(false, dealii::Timer());
+
+  if(fluid_on_this_process)
+  {
+    ControlMessage           control;
+    std::vector<MPI_Request> requests;
+
+    auto const send_control = [&](ControlMessage const & message) {
+      MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      requests.clear();
+
+      if(rank == 0)
+      {
+        control = message;
+        requests.resize(n_processes - n_processes_fluid);
+        for(unsigned int r = n_processes_fluid; r < n_processes; ++r)
+          MPI_Isend(control.data(),
+                    control.size(),
+                    MPI_DOUBLE,
+                    r,
+                    tag,
+                    control_comm,
+                    &requests[r - n_processes_fluid]);
+      }
+    };
+
+    send_control({fluid->time_integrator->get_time(), 0.0, 0.0});
+
+    while(not fluid->time_integrator->finished())
+    {
+      // see solve_sequentially()
+      bool const acoustic_starts_during_present_timestep =
+        fluid->time_integrator->get_next_time() + fluid->time_integrator->get_time_step_size() >
+        application->acoustic->get_parameters().start_time;
+
+      if(timer.first == false and acoustic_starts_during_present_timestep)
+      {
+        timer.first = true;
+        timer.second.restart();
+      }
+
+      if(acoustic_starts_during_present_timestep)
+      {
+        dealii::Timer sub_timer;
+
+        volume_coupling.send_source_term_to_acoustic();
+
+        timer_tree.insert({"AeroAcoustic", "Coupling fluid -> acoustic"}, sub_timer.wall_time());
+      }
+
+      send_control({fluid->time_integrator->get_time_step_size(),
+                    static_cast<double>(acoustic_starts_during_present_timestep),
+                    0.0});
+
+      // see solve_sequentially()
+      bool const acoustic_might_start_during_next_timestep =
+        fluid->time_integrator->get_next_time() + fluid->max_next_time_step_size() >
+        application->acoustic->get_parameters().start_time;
+
+      fluid->advance_one_timestep_and_compute_pressure_time_derivative(
+        acoustic_might_start_during_next_timestep);
+    }
+
+    send_control({0.0, 0.0, 1.0});
+
+    // wait until the acoustic solver has received the last messages
+    dealii::Timer sub_timer;
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    volume_coupling.finish_send_source_term_to_acoustic();
+    time_waiting += sub_timer.wall_time();
+  }
+  else
+  {
+    auto const receive_control = [&]() {
+      dealii::Timer sub_timer;
+
+      ControlMessage message;
+      MPI_Recv(
+        message.data(), message.size(), MPI_DOUBLE, 0, tag, control_comm, MPI_STATUS_IGNORE);
+
+      time_waiting += sub_timer.wall_time();
+
+      return message;
+    };
+
+    // set start time
+    {
+      double const fluid_start_time = receive_control()[0];
+
+      AssertThrow(fluid_start_time - 1e-12 < acoustic->time_integrator->get_time(),
+                  dealii::ExcMessage(
+                    "Acoustic simulation can not be started before fluid simulation."));
+
+      acoustic->time_integrator->reset_time(fluid_start_time);
+    }
+
+    while(true)
+    {
+      ControlMessage const message = receive_control();
+
+      if(message[2] > 0.5)
+        break;
+
+      bool const acoustic_starts_during_present_timestep = message[1] > 0.5;
+
+      if(timer.first == false and acoustic_starts_during_present_timestep)
+      {
+        timer.first = true;
+        timer.second.restart();
+      }
+
+      if(acoustic_starts_during_present_timestep)
+      {
+        dealii::Timer sub_timer;
+
+        volume_coupling.receive_source_term_from_fluid();
+
+        timer_tree.insert({"AeroAcoustic", "Coupling fluid -> acoustic"}, sub_timer.wall_time());
+      }
+
+      acoustic->advance_multiple_timesteps(message[0]);
+    }
+  }
+
+  time_solvers_side_by_side = timer.second.wall_time();
+
+  timer_tree.insert({"AeroAcoustic", "Waiting for other solver"}, time_waiting);
+
+  dealii::Utilities::MPI::free_communicator(control_comm);
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::print_performance_results(double const total_time) const
 {
+  if(application->parameters.run_solvers_concurrently)
+  {
+    print_performance_results_concurrent(total_time);
+    return;
+  }
+
   pcout << std::endl << print_horizontal_line() << std::endl << std::endl;
 
   pcout << "Performance results for aero-acoustic solver:" << std::endl;
@@ -248,6 +500,106 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << print_horizontal_line() << std::endl << std::endl;
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::print_performance_results_concurrent(double const total_time) const
+{
+  pcout << std::endl << print_horizontal_line() << std::endl << std::endl;
+
+  pcout << "Performance results for aero-acoustic solver (solvers running concurrently):"
+        << std::endl;
+
+  // iterations (the first fluid process is the first process of mpi_comm)
+  pcout << std::endl << "Average number of iterations Fluid:" << std::endl;
+  if(fluid_on_this_process)
+    fluid->time_integrator->print_iterations();
+
+  double const sub_dt_per_macro_dt = dealii::Utilities::MPI::max(
+    acoustic_on_this_process ? acoustic->get_average_number_of_sub_time_steps() : 0.0, mpi_comm);
+
+  pcout << std::endl << "Average number of sub-time steps Acoustic:" << std::endl;
+  pcout << "Adams-Bashforth-Moulton    " << sub_dt_per_macro_dt << std::endl;
+
+  // wall times (the timings of the single field solvers are not added to the timer tree since
+  // they are only available on a subset of the processes)
+  pcout << std::endl << "Wall times:" << std::endl;
+
+  timer_tree.insert({"AeroAcoustic"}, total_time);
+
+  pcout << std::endl << "Timings for level 1:" << std::endl;
+  timer_tree.print_level(pcout, 1);
+
+  // load balance between the single field solvers
+  auto const average_over_group = [&](double const value, bool const on_fluid) {
+    double const avg = dealii::Utilities::MPI::min_max_avg(value, *mpi_comm_single_field).avg;
+    return dealii::Utilities::MPI::max(fluid_on_this_process == on_fluid ? avg : 0.0, mpi_comm);
+  };
+
+  double const time_loop_fluid    = average_over_group(time_solvers_side_by_side, true);
+  double const time_loop_acoustic = average_over_group(time_solvers_side_by_side, false);
+  double const time_wait_fluid    = average_over_group(time_waiting, true);
+  double const time_wait_acoustic = average_over_group(time_waiting, false);
+
+  unsigned int const N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int const N_mpi_processes_fluid =
+    dealii::Utilities::MPI::sum(fluid_on_this_process ? 1u : 0u, mpi_comm);
+  unsigned int const N_mpi_processes_acoustic = N_mpi_processes - N_mpi_processes_fluid;
+
+  // work of a single field solver in core-seconds
+  double const work_fluid =
+    std::max(time_loop_fluid - time_wait_fluid, 0.0) * N_mpi_processes_fluid;
+  double const work_acoustic =
+    std::max(time_loop_acoustic - time_wait_acoustic, 0.0) * N_mpi_processes_acoustic;
+
+  pcout << std::endl << "Load balance:" << std::endl << std::endl;
+  print_parameter(pcout, "Processes fluid", N_mpi_processes_fluid);
+  print_parameter(pcout, "Processes acoustic", N_mpi_processes_acoustic);
+  print_parameter(pcout, "Wall time time loop fluid", time_loop_fluid);
+  print_parameter(pcout, "Wall time time loop acoustic", time_loop_acoustic);
+  print_parameter(pcout, "Wall time waiting fluid", time_wait_fluid);
+  print_parameter(pcout, "Wall time waiting acoustic", time_wait_acoustic);
+  if(work_fluid + work_acoustic > 0.0)
+    print_parameter(pcout,
+                    "Recommended FractionOfProcessesAcoustic",
+                    work_acoustic / (work_fluid + work_acoustic));
+
+  // Throughput in DoFs/s per time step per core (during the time both
+  // solvers ran side by side)
+  dealii::types::global_dof_index const DoFs_f = dealii::Utilities::MPI::max(
+    fluid_on_this_process ? fluid->pde_operator->get_number_of_dofs() : 0, mpi_comm);
+  dealii::types::global_dof_index const DoFs_a = dealii::Utilities::MPI::max(
+    acoustic_on_this_process ? acoustic->pde_operator->get_number_of_dofs() : 0, mpi_comm);
+  unsigned int const n_macro_time_steps = dealii::Utilities::MPI::max(
+    acoustic_on_this_process ? acoustic->get_number_of_macro_time_steps() : 0u, mpi_comm);
+  unsigned int const n_sub_time_steps = dealii::Utilities::MPI::max(
+    acoustic_on_this_process ? acoustic->get_number_of_sub_time_steps() : 0u, mpi_comm);
+
+  double const time_solvers_side_by_side_avg = std::max(time_loop_fluid, time_loop_acoustic);
+
+  pcout << std::endl << "Throughput related to one macro time step:";
+  print_throughput_unsteady(pcout,
+                            DoFs_f + DoFs_a,
+                            time_solvers_side_by_side_avg,
+                            n_macro_time_steps,
+                            N_mpi_processes);
+
+  pcout << std::endl << "Throughput related to one sub time step:";
+  print_throughput_unsteady(pcout,
+                            (double)DoFs_f / sub_dt_per_macro_dt + (double)DoFs_a,
+                            time_solvers_side_by_side_avg,
+                            n_sub_time_steps,
+                            N_mpi_processes);
+
+  // computational costs in CPUh
+  dealii::Utilities::MPI::MinMaxAvg total_time_data =
+    dealii::Utilities::MPI::min_max_avg(total_time, mpi_comm);
+  double const total_time_avg = total_time_data.avg;
+
+  print_costs(pcout, total_time_avg, N_mpi_processes);
+
+  pcout << print_horizontal_line() << std::endl << std::endl;
+}
+
 template class Driver<2, float>;
 template class Driver<3, float>;
 
@@ -57,6 +57,9 @@ public:
   print_performance_results(double const total_time) const;
 
 private:
+  void
+  split_communicator();
+
   void
   setup_volume_coupling();
 
@@ -66,8 +69,36 @@ private:
   void
   couple_fluid_to_acoustic();
 
+  /*
+   * Time loop in which the fluid solver and the acoustic solver advance one after another on all
+   * processes.
+   */
+  void
+  solve_sequentially();
+
+  /*
+   * Time loop in which the fluid solver and the acoustic solver advance concurrently on disjoint
+   * sets of processes. The fluid solver sends the source term and the macro time step size to the
+   * acoustic solver at the beginning of each time step.
+   */
+  void
+  solve_concurrently();
+
+  void
+  print_performance_results_concurrent(double const total_time) const;
+
   MPI_Comm const mpi_comm;
 
+  // In case the solvers run concurrently, every process works on exactly one of the single field
+  // solvers using the sub-communicator mpi_comm_single_field. Otherwise, all processes work on
+  // both solvers and mpi_comm_single_field equals mpi_comm. A sub-communicator is freed by a
+  // custom deleter. Since members are destroyed in reverse order, this happens after the single
+  // field solvers have been destroyed.
+  std::unique_ptr<MPI_Comm, void (*)(MPI_Comm *)> mpi_comm_single_field;
+
+  bool fluid_on_this_process;
+  bool acoustic_on_this_process;
+
   dealii::ConditionalOStream pcout;
 
   bool const is_test;
@@ -86,6 +117,9 @@ private:
 
   // wall time fluid and acoustic solvers ran together
   double time_solvers_side_by_side;
+
+  // wall time a process waited for the other solver when running concurrently
+  double time_waiting;
 };
 
 } // namespace AeroAcoustic
@@ -83,8 +83,24 @@ public:
     prm.parse_input(parameter_file, "", true, true);
   }
 
+  /**
+   * Replaces the MPI communicator passed to the constructor. This is needed if the fluid and the
+   * acoustic solver run concurrently on disjoint sub-communicators. Has to be called before
+   * setup().
+   */
   void
-  setup(std::shared_ptr<Grid<dim>> & grid, std::shared_ptr<dealii::Mapping<dim>> & mapping)
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
+  /**
+   * Parses and sets the parameters. This function is called by setup(), but can also be called
+   * separately on processes that need the parameters without setting up the solver.
+   */
+  void
+  setup_parameters()
   {
     parse_parameters();
 
@@ -101,6 +117,12 @@ public:
     AssertThrow(param.aero_acoustic_source_term,
                 dealii::ExcMessage(
                   "aero_acoustic_source_term has to be set true for aero-acoustic computations."));
+  }
+
+  void
+  setup(std::shared_ptr<Grid<dim>> & grid, std::shared_ptr<dealii::Mapping<dim>> & mapping)
+  {
+    setup_parameters();
 
     param.print(pcout, "List of parameters for acoustic conservation equations:");
 
@@ -141,7 +163,7 @@ public:
   create_postprocessor() = 0;
 
 protected:
-  MPI_Comm const mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
@@ -209,10 +231,24 @@ public:
     prm.parse_input(parameter_file, "", true, true);
   }
 
+  /**
+   * Replaces the MPI communicator passed to the constructor. This is needed if the fluid and the
+   * acoustic solver run concurrently on disjoint sub-communicators. Has to be called before
+   * setup().
+   */
   void
-  setup(std::shared_ptr<Grid<dim>> &                      grid,
-        std::shared_ptr<dealii::Mapping<dim>> &           mapping,
-        std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings)
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
+  /**
+   * Parses and sets the parameters. This function is called by setup(), but can also be called
+   * separately on processes that need the parameters without setting up the solver.
+   */
+  void
+  setup_parameters()
   {
     parse_parameters();
 
@@ -221,13 +257,22 @@ public:
     // parameters
     set_parameters();
     param.check(pcout);
-    param.print(pcout, "List of parameters for incompressible flow solver:");
 
     // Some AeroAcoustic specific Asserts
     AssertThrow(param.problem_type == IncNS::ProblemType::Unsteady,
                 dealii::ExcMessage("Invalid parameter in context of aero-acoustic."));
     AssertThrow(param.ale_formulation == false,
                 dealii::ExcMessage("ALE not yet implemented for aero-acoustic."));
+  }
+
+  void
+  setup(std::shared_ptr<Grid<dim>> &                      grid,
+        std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+        std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings)
+  {
+    setup_parameters();
+
+    param.print(pcout, "List of parameters for incompressible flow solver:");
 
     // grid
     grid = std::make_shared<Grid<dim>>();
@@ -266,7 +311,7 @@ public:
   create_postprocessor() = 0;
 
 protected:
-  MPI_Comm const mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
@@ -321,13 +366,22 @@ public:
 
   virtual ~ApplicationBase() = default;
 
+  /**
+   * Parses the aero-acoustic parameters. This function has to be called before the single field
+   * solvers are set up, since the parameters define how the processes are distributed among the
+   * single field solvers.
+   */
   void
-  setup()
+  setup_parameters()
   {
     parse_parameters();
     parameters.check();
     parameters.print(pcout, "List of parameters for aero-acoustic solver");
+  }
 
+  void
+  setup()
+  {
     // field functions
     field_functions = std::make_shared<FieldFunctions<dim>>();
     set_field_functions();
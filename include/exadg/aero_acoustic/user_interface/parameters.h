@@ -59,7 +59,9 @@ public:
       source_term_with_convection(false),
       blend_in_source_term(false),
       fluid_to_acoustic_coupling_strategy(FluidToAcousticCouplingStrategy::Undefined),
-      acoustic_source_term_computation(AcousticSourceTermComputation::Undefined)
+      acoustic_source_term_computation(AcousticSourceTermComputation::Undefined),
+      run_solvers_concurrently(false),
+      fraction_of_processes_acoustic(0.5)
   {
   }
 
@@ -73,6 +75,12 @@ public:
 
     AssertThrow(acoustic_source_term_computation != AcousticSourceTermComputation::Undefined,
                 dealii::ExcMessage("Source term computation has to be set."));
+
+    if(run_solvers_concurrently)
+    {
+      AssertThrow(fraction_of_processes_acoustic > 0.0 and fraction_of_processes_acoustic < 1.0,
+                  dealii::ExcMessage("Fraction of processes for acoustic has to be in (0,1)."));
+    }
   }
 
   void
@@ -84,6 +92,9 @@ public:
     print_parameter(pcout, "Blend in source term", blend_in_source_term);
     print_parameter(pcout, "Fluid to acoustic coupling", fluid_to_acoustic_coupling_strategy);
     print_parameter(pcout, "Acoustic source term compuation", acoustic_source_term_computation);
+    print_parameter(pcout, "Run solvers concurrently", run_solvers_concurrently);
+    if(run_solvers_concurrently)
+      print_parameter(pcout, "Fraction of processes acoustic", fraction_of_processes_acoustic);
   }
 
   void
@@ -117,6 +128,18 @@ public:
                         "How to compute the acustic source term.",
                         Patterns::Enum<AcousticSourceTermComputation>(),
                         true);
+
+      prm.add_parameter("RunSolversConcurrently",
+                        run_solvers_concurrently,
+                        "Run fluid and acoustic solvers on disjoint sets of processes.",
+                        dealii::Patterns::Bool(),
+                        false);
+
+      prm.add_parameter("FractionOfProcessesAcoustic",
+                        fraction_of_processes_acoustic,
+                        "Fraction of processes used by the acoustic solver if run concurrently.",
+                        dealii::Patterns::Double(0.0, 1.0),
+                        false);
     }
     prm.leave_subsection();
   }
@@ -137,6 +160,17 @@ public:
 
   // How to compute the acustic source term
   AcousticSourceTermComputation acoustic_source_term_computation;
+
+  // Run the fluid and the acoustic solver concurrently on disjoint sets of processes instead of
+  // one after another on all processes. Since the coupling is one-way and the source term is
+  // computed at the beginning of a fluid time step, the acoustic solver can advance to t^(n+1)
+  // while the fluid solver performs its time step.
+  bool run_solvers_concurrently;
+
+  // Fraction of processes assigned to the acoustic solver if the solvers run concurrently. This
+  // value should balance the wall times per macro time step of both solvers, see the
+  // recommendation printed at the end of a simulation.
+  double fraction_of_processes_acoustic;
 };
 
 } // namespace AeroAcoustic
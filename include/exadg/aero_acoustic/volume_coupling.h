@@ -22,10 +22,15 @@
 #ifndef INCLUDE_EXADG_AERO_ACOUSTIC_VOLUME_COUPLING_H_
 #define INCLUDE_EXADG_AERO_ACOUSTIC_VOLUME_COUPLING_H_
 
+// deal.II
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+// ExaDG
 #include <exadg/aero_acoustic/calculators/source_term_calculator.h>
 #include <exadg/aero_acoustic/single_field_solvers/acoustics.h>
 #include <exadg/aero_acoustic/single_field_solvers/fluid.h>
 #include <exadg/aero_acoustic/user_interface/parameters.h>
+#include <exadg/functions_and_boundary_conditions/remote_point_evaluation_across_communicators.h>
 
 namespace ExaDG
 {
@@ -33,6 +38,11 @@ namespace AeroAcoustic
 {
 /**
  * A class that handles the volume coupling between fluid and acoustic.
+ *
+ * If the fluid and the acoustic solver run concurrently on disjoint sets of processes, the source
+ * term is sent from the fluid processes to the acoustic processes, see
+ * send_source_term_to_acoustic() and receive_source_term_from_fluid(). Otherwise, all processes
+ * work on both solvers and fluid_to_acoustic() is used.
  */
 template<int dim, typename Number>
 class VolumeCoupling
@@ -40,28 +50,75 @@ class VolumeCoupling
   using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
 
 public:
+  VolumeCoupling() : fluid_on_this_process(true), acoustic_on_this_process(true)
+  {
+  }
+
   void
   setup(Parameters const &                           parameters_in,
         std::shared_ptr<SolverAcoustic<dim, Number>> acoustic_solver_in,
         std::shared_ptr<SolverFluid<dim, Number>>    fluid_solver_in,
-        std::shared_ptr<FieldFunctions<dim>>         field_functions_in)
+        std::shared_ptr<FieldFunctions<dim>>         field_functions_in,
+        MPI_Comm const &                             mpi_comm,
+        bool const                                   fluid_on_this_process_in,
+        bool const                                   acoustic_on_this_process_in)
   {
     parameters      = parameters_in;
     acoustic_solver = acoustic_solver_in;
     fluid_solver    = fluid_solver_in;
     field_functions = field_functions_in;
 
-    acoustic_solver_in->pde_operator->initialize_dof_vector_pressure(source_term_acoustic);
-    fluid_solver_in->pde_operator->initialize_vector_pressure(source_term_fluid);
+    fluid_on_this_process    = fluid_on_this_process_in;
+    acoustic_on_this_process = acoustic_on_this_process_in;
+
+    if(acoustic_on_this_process)
+      acoustic_solver_in->pde_operator->initialize_dof_vector_pressure(source_term_acoustic);
+
+    if(fluid_on_this_process)
+      fluid_solver_in->pde_operator->initialize_vector_pressure(source_term_fluid);
 
     // setup the transfer operator
     if(parameters.fluid_to_acoustic_coupling_strategy ==
        FluidToAcousticCouplingStrategy::ConservativeInterpolation)
     {
-      non_nested_grid_transfer.reinit(fluid_solver_in->pde_operator->get_dof_handler_p(),
-                                      acoustic_solver_in->pde_operator->get_dof_handler_p(),
-                                      *fluid_solver_in->pde_operator->get_mapping(),
-                                      *acoustic_solver_in->pde_operator->get_mapping());
+      if(parameters.run_solvers_concurrently)
+      {
+        AssertThrow(fluid_on_this_process != acoustic_on_this_process,
+                    dealii::ExcMessage("Every process has to work on exactly one solver."));
+
+        std::vector<dealii::Point<dim>> points;
+        if(fluid_on_this_process)
+        {
+          points = collect_locally_owned_support_points(
+            fluid_solver_in->pde_operator->get_dof_handler_p(),
+            *fluid_solver_in->pde_operator->get_mapping());
+        }
+        else
+        {
+          AssertThrow(
+            acoustic_solver_in->pde_operator->get_dof_handler_p().get_fe().n_dofs_per_vertex() ==
+              0,
+            dealii::ExcMessage("Transfer across communicators requires a discontinuous "
+                               "finite element for the acoustic pressure."));
+        }
+
+        transfer_across_communicators.reinit(
+          mpi_comm,
+          fluid_on_this_process,
+          points,
+          acoustic_on_this_process ?
+            &acoustic_solver_in->pde_operator->get_dof_handler_p().get_triangulation() :
+            nullptr,
+          acoustic_on_this_process ? acoustic_solver_in->pde_operator->get_mapping().get() :
+                                     nullptr);
+      }
+      else
+      {
+        non_nested_grid_transfer.reinit(fluid_solver_in->pde_operator->get_dof_handler_p(),
+                                        acoustic_solver_in->pde_operator->get_dof_handler_p(),
+                                        *fluid_solver_in->pde_operator->get_mapping(),
+                                        *acoustic_solver_in->pde_operator->get_mapping());
+      }
     }
     else
     {
@@ -69,45 +126,33 @@ public:
     }
 
     // setup aeroacoustic source term calculator
-    SourceTermCalculatorData<dim> data;
-    data.dof_index_pressure  = fluid_solver_in->pde_operator->get_dof_index_pressure();
-    data.dof_index_velocity  = fluid_solver_in->pde_operator->get_dof_index_velocity();
-    data.quad_index          = fluid_solver_in->pde_operator->get_quad_index_pressure();
-    data.density             = parameters_in.density;
-    data.consider_convection = parameters_in.source_term_with_convection;
-    data.blend_in            = parameters.blend_in_source_term;
-    data.blend_in_function   = field_functions_in->source_term_blend_in;
-
-    source_term_calculator.setup(fluid_solver_in->pde_operator->get_matrix_free(), data);
+    if(fluid_on_this_process)
+    {
+      SourceTermCalculatorData<dim> data;
+      data.dof_index_pressure  = fluid_solver_in->pde_operator->get_dof_index_pressure();
+      data.dof_index_velocity  = fluid_solver_in->pde_operator->get_dof_index_velocity();
+      data.quad_index          = fluid_solver_in->pde_operator->get_quad_index_pressure();
+      data.density             = parameters_in.density;
+      data.consider_convection = parameters_in.source_term_with_convection;
+      data.blend_in            = parameters.blend_in_source_term;
+      data.blend_in_function   = field_functions_in->source_term_blend_in;
+
+      source_term_calculator.setup(fluid_solver_in->pde_operator->get_matrix_free(), data);
+    }
   }
 
   void
   fluid_to_acoustic()
   {
+    AssertThrow(not parameters.run_solvers_concurrently,
+                dealii::ExcMessage("Use send_source_term_to_acoustic() and "
+                                   "receive_source_term_from_fluid() if the solvers run "
+                                   "concurrently."));
+
     if(parameters.fluid_to_acoustic_coupling_strategy ==
        FluidToAcousticCouplingStrategy::ConservativeInterpolation)
     {
-      if(parameters.acoustic_source_term_computation ==
-         AcousticSourceTermComputation::FromAnalyticSourceTerm)
-      {
-        source_term_calculator.evaluate_integrate(
-          source_term_fluid,
-          *field_functions->analytical_aero_acoustic_source_term,
-          fluid_solver->time_integrator->get_time());
-      }
-      else if(parameters.acoustic_source_term_computation ==
-              AcousticSourceTermComputation::FromFluid)
-      {
-        source_term_calculator.evaluate_integrate(source_term_fluid,
-                                                  fluid_solver->time_integrator->get_velocity(),
-                                                  fluid_solver->time_integrator->get_pressure(),
-                                                  fluid_solver->get_pressure_time_derivative(),
-                                                  fluid_solver->time_integrator->get_time());
-      }
-      else
-      {
-        AssertThrow(false, dealii::ExcMessage("AcousticSourceTermComputation not implemented."));
-      }
+      compute_source_term_fluid();
 
       non_nested_grid_transfer.restrict_and_add(source_term_acoustic, source_term_fluid);
     }
@@ -119,13 +164,181 @@ public:
     acoustic_solver->pde_operator->set_aero_acoustic_source_term(source_term_acoustic);
   }
 
+  /*
+   * Computes the source term on the fluid mesh and starts sending it to the acoustic processes.
+   * The function returns without waiting for the acoustic processes to receive the data.
+   */
+  void
+  send_source_term_to_acoustic()
+  {
+    AssertThrow(parameters.run_solvers_concurrently and fluid_on_this_process,
+                dealii::ExcMessage("This function has to be called by the fluid processes."));
+
+    compute_source_term_fluid();
+
+    std::vector<Number> values(fluid_local_dof_indices.size());
+    for(unsigned int i = 0; i < fluid_local_dof_indices.size(); ++i)
+      values[i] = source_term_fluid.local_element(fluid_local_dof_indices[i]);
+
+    transfer_across_communicators.start_send(values);
+  }
+
+  /*
+   * Waits until the last source term sent by send_source_term_to_acoustic() has been received.
+   */
+  void
+  finish_send_source_term_to_acoustic()
+  {
+    transfer_across_communicators.finish_send();
+  }
+
+  /*
+   * Receives the source term sent by the fluid processes and restricts it to the acoustic mesh.
+   * This is the transpose of the interpolation of the acoustic pressure at the support points
+   * of the fluid pressure, i.e., the same operation as
+   * dealii::MGTwoLevelTransferNonNested::restrict_and_add().
+   */
+  void
+  receive_source_term_from_fluid()
+  {
+    AssertThrow(parameters.run_solvers_concurrently and acoustic_on_this_process,
+                dealii::ExcMessage("This function has to be called by the acoustic processes."));
+
+    std::vector<Number> values;
+    transfer_across_communicators.receive(values);
+
+    source_term_acoustic = 0.0;
+
+    dealii::DoFHandler<dim> const & dof_handler =
+      acoustic_solver->pde_operator->get_dof_handler_p();
+
+    dealii::FEPointEvaluation<1, dim, dim, Number> evaluator(
+      *acoustic_solver->pde_operator->get_mapping(),
+      dof_handler.get_fe(),
+      dealii::update_values);
+
+    unsigned int const n_dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+    std::vector<Number>                          local_dof_values(n_dofs_per_cell);
+    std::vector<dealii::types::global_dof_index> dof_indices(n_dofs_per_cell);
+    std::vector<Number>                          buffer;
+
+    auto const integrate = [&](dealii::ArrayView<Number const> const & values_at_points,
+                               typename dealii::Utilities::MPI::RemotePointEvaluation<
+                                 dim>::CellData const & cell_data) {
+      for(unsigned int const i : cell_data.cell_indices())
+      {
+        auto const cell        = cell_data.get_active_cell_iterator(i);
+        auto const unit_points = cell_data.get_unit_points(i);
+        auto const cell_values = cell_data.get_data_view(i, values_at_points);
+
+        evaluator.reinit(cell, unit_points);
+        for(unsigned int q = 0; q < unit_points.size(); ++q)
+          evaluator.submit_value(cell_values[q], q);
+
+        evaluator.test_and_sum(local_dof_values, dealii::EvaluationFlags::values);
+
+        typename dealii::DoFHandler<dim>::active_cell_iterator const cell_dof(
+          &cell->get_triangulation(), cell->level(), cell->index(), &dof_handler);
+        cell_dof->get_dof_indices(dof_indices);
+
+        for(unsigned int j = 0; j < dof_indices.size(); ++j)
+          source_term_acoustic(dof_indices[j]) += local_dof_values[j];
+      }
+    };
+
+    transfer_across_communicators.get_remote_point_evaluation()
+      .template process_and_evaluate<Number>(values, buffer, integrate);
+
+    acoustic_solver->pde_operator->set_aero_acoustic_source_term(source_term_acoustic);
+  }
+
 private:
+  void
+  compute_source_term_fluid()
+  {
+    if(parameters.acoustic_source_term_computation ==
+       AcousticSourceTermComputation::FromAnalyticSourceTerm)
+    {
+      source_term_calculator.evaluate_integrate(
+        source_term_fluid,
+        *field_functions->analytical_aero_acoustic_source_term,
+        fluid_solver->time_integrator->get_time());
+    }
+    else if(parameters.acoustic_source_term_computation ==
+            AcousticSourceTermComputation::FromFluid)
+    {
+      source_term_calculator.evaluate_integrate(source_term_fluid,
+                                                fluid_solver->time_integrator->get_velocity(),
+                                                fluid_solver->time_integrator->get_pressure(),
+                                                fluid_solver->get_pressure_time_derivative(),
+                                                fluid_solver->time_integrator->get_time());
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("AcousticSourceTermComputation not implemented."));
+    }
+  }
+
+  /*
+   * Returns the support points of all locally owned DoFs and stores the local indices of these
+   * DoFs in fluid_local_dof_indices.
+   */
+  std::vector<dealii::Point<dim>>
+  collect_locally_owned_support_points(dealii::DoFHandler<dim> const & dof_handler,
+                                       dealii::Mapping<dim> const &    mapping)
+  {
+    AssertThrow(dof_handler.get_fe().has_support_points(),
+                dealii::ExcMessage("Finite element of the fluid pressure needs support points."));
+
+    dealii::IndexSet const & locally_owned_dofs = dof_handler.locally_owned_dofs();
+
+    std::vector<dealii::Point<dim>> const & unit_support_points =
+      dof_handler.get_fe().get_unit_support_points();
+
+    unsigned int const n_dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+    std::vector<dealii::Point<dim>>              points;
+    std::vector<bool>                            visited(locally_owned_dofs.n_elements(), false);
+    std::vector<dealii::types::global_dof_index> dof_indices(n_dofs_per_cell);
+
+    fluid_local_dof_indices.clear();
+
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+      {
+        cell->get_dof_indices(dof_indices);
+
+        for(unsigned int i = 0; i < dof_indices.size(); ++i)
+        {
+          if(locally_owned_dofs.is_element(dof_indices[i]))
+          {
+            unsigned int const local_index = locally_owned_dofs.index_within_set(dof_indices[i]);
+
+            if(not visited[local_index])
+            {
+              visited[local_index] = true;
+              fluid_local_dof_indices.push_back(local_index);
+              points.push_back(mapping.transform_unit_to_real_cell(cell, unit_support_points[i]));
+            }
+          }
+        }
+      }
+    }
+
+    return points;
+  }
+
   Parameters parameters;
 
   // Single field solvers
   std::shared_ptr<SolverAcoustic<dim, Number>> acoustic_solver;
   std::shared_ptr<SolverFluid<dim, Number>>    fluid_solver;
 
+  // Which single field solvers are set up on this process
+  bool fluid_on_this_process;
+  bool acoustic_on_this_process;
 
   // Field functions
   std::shared_ptr<FieldFunctions<dim>> field_functions;
@@ -136,6 +349,11 @@ private:
   // Transfer operator
   dealii::MGTwoLevelTransferNonNested<dim, VectorType> non_nested_grid_transfer;
 
+  // Transfer operator if the solvers run concurrently on disjoint sets of processes. The fluid
+  // processes provide the support points of their locally owned pressure DoFs.
+  RemotePointEvaluationAcrossCommunicators<dim> transfer_across_communicators;
+  std::vector<unsigned int>                     fluid_local_dof_indices;
+
   // Class that knows how to compute the source term
   SourceTermCalculator<dim, Number> source_term_calculator;
 
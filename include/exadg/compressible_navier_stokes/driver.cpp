@@ -58,9 +58,15 @@ Driver<dim, Number>::setup()
 
   application->setup(grid, mapping);
 
+  // the multigrid preconditioner of the implicit viscous term uses the fine-level mapping on all
+  // multigrid levels
+  multigrid_mappings = std::make_shared<MultigridMappings<dim, Number>>(
+    mapping, std::shared_ptr<dealii::Mapping<dim>>() /* coarse levels */);
+
   // initialize compressible Navier-Stokes operator
   pde_operator = std::make_shared<Operator<dim, Number>>(grid,
                                                          mapping,
+                                                         multigrid_mappings,
                                                          application->get_boundary_descriptor(),
                                                          application->get_field_functions(),
                                                          application->get_parameters(),
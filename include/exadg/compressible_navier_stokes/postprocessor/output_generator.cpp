@@ -44,8 +44,7 @@ write_output(
 {
   std::string folder = output_data.directory, file = output_data.filename;
 
-  dealii::DataOutBase::VtkFlags flags;
-  flags.write_higher_order_cells = output_data.write_higher_order;
+  dealii::DataOutBase::VtkFlags const flags = get_vtk_flags(output_data);
 
   dealii::DataOut<dim> data_out;
   data_out.set_flags(flags);
@@ -95,6 +94,7 @@ write_output(
     }
   }
 
+  select_cells_for_output(data_out, output_data);
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
   data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
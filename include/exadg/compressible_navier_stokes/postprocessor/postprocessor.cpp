@@ -96,43 +96,56 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
 {
   invalidate_derived_fields();
 
+  bool const output_needed = output_generator.time_control.needs_evaluation(time, time_step_number);
+  bool const lift_and_drag_needed =
+    lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number);
+  bool const pressure_difference_needed =
+    pressure_difference_calculator.time_control.needs_evaluation(time, time_step_number);
+  bool const kinetic_energy_needed =
+    kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number);
+  bool const kinetic_energy_spectrum_needed =
+    kinetic_energy_spectrum_calculator.time_control.needs_evaluation(time, time_step_number);
+
+  /*
+   *  compute all derived fields needed in this time step in a single loop over the solution
+   */
+  DerivedVariables<VectorType> derived_variables;
+  if((output_needed and pp_data.output_data.write_pressure) or lift_and_drag_needed or
+     pressure_difference_needed)
+    derived_variables.pressure = &pressure.get_vector_for_external_evaluation();
+  if((output_needed and pp_data.output_data.write_velocity) or lift_and_drag_needed or
+     kinetic_energy_needed or kinetic_energy_spectrum_needed)
+    derived_variables.velocity = &velocity.get_vector_for_external_evaluation();
+  if(output_needed and pp_data.output_data.write_temperature)
+    derived_variables.temperature = &temperature.get_vector_for_external_evaluation();
+  if(output_needed and pp_data.output_data.write_vorticity)
+    derived_variables.vorticity = &vorticity.get_vector_for_external_evaluation();
+  if(output_needed and pp_data.output_data.write_divergence)
+    derived_variables.divergence = &divergence.get_vector_for_external_evaluation();
+  if(output_needed and pp_data.output_data.write_shear_rate)
+    derived_variables.shear_rate = &shear_rate.get_vector_for_external_evaluation();
+
+  navier_stokes_operator->compute_derived_variables(derived_variables, solution);
+
   /*
    *  write output
    */
-  if(output_generator.time_control.needs_evaluation(time, time_step_number))
+  if(output_needed)
   {
     std::vector<dealii::SmartPointer<SolutionField<dim, Number>>> additional_fields_vtu;
 
     if(pp_data.output_data.write_pressure)
-    {
-      pressure.evaluate(solution);
       additional_fields_vtu.push_back(&pressure);
-    }
     if(pp_data.output_data.write_velocity)
-    {
-      velocity.evaluate(solution);
       additional_fields_vtu.push_back(&velocity);
-    }
     if(pp_data.output_data.write_vorticity)
-    {
-      vorticity.evaluate(velocity.evaluate_get(solution));
       additional_fields_vtu.push_back(&vorticity);
-    }
     if(pp_data.output_data.write_divergence)
-    {
-      divergence.evaluate(velocity.evaluate_get(solution));
       additional_fields_vtu.push_back(&divergence);
-    }
     if(pp_data.output_data.write_shear_rate)
-    {
-      shear_rate.evaluate(velocity.evaluate_get(solution));
       additional_fields_vtu.push_back(&shear_rate);
-    }
     if(pp_data.output_data.write_temperature)
-    {
-      temperature.evaluate(solution);
       additional_fields_vtu.push_back(&temperature);
-    }
 
     output_generator.evaluate(solution,
                               additional_fields_vtu,
@@ -158,23 +171,21 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
   /*
    *  calculation of lift and drag coefficients
    */
-  if(lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number))
-    lift_and_drag_calculator.evaluate(velocity.evaluate_get(solution),
-                                      pressure.evaluate_get(solution),
-                                      time);
+  if(lift_and_drag_needed)
+    lift_and_drag_calculator.evaluate(velocity.get(), pressure.get(), time);
 
   /*
    *  calculation of pressure difference
    */
-  if(pressure_difference_calculator.time_control.needs_evaluation(time, time_step_number))
-    pressure_difference_calculator.evaluate(pressure.evaluate_get(solution), time);
+  if(pressure_difference_needed)
+    pressure_difference_calculator.evaluate(pressure.get(), time);
 
   /*
    *  calculation of kinetic energy
    */
-  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
+  if(kinetic_energy_needed)
   {
-    kinetic_energy_calculator.evaluate(velocity.evaluate_get(solution),
+    kinetic_energy_calculator.evaluate(velocity.get(),
                                        time,
                                        Utilities::is_unsteady_timestep(time_step_number));
   }
@@ -182,9 +193,9 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     solution,
   /*
    *  calculation of kinetic energy spectrum
    */
-  if(kinetic_energy_spectrum_calculator.time_control.needs_evaluation(time, time_step_number))
+  if(kinetic_energy_spectrum_needed)
   {
-    kinetic_energy_spectrum_calculator.evaluate(velocity.evaluate_get(solution),
+    kinetic_energy_spectrum_calculator.evaluate(velocity.get(),
                                                 time,
                                                 Utilities::is_unsteady_timestep(time_step_number));
   }
@@ -211,9 +222,7 @@ PostProcessor<dim, Number>::initialize_derived_fields()
   }
 
   // velocity
-  if(pp_data.output_data.write_velocity or pp_data.output_data.write_vorticity or
-     pp_data.output_data.write_divergence or pp_data.output_data.write_shear_rate or
-     pp_data.lift_and_drag_data.time_control_data.is_active or
+  if(pp_data.output_data.write_velocity or pp_data.lift_and_drag_data.time_control_data.is_active or
      pp_data.kinetic_energy_data.time_control_data.is_active or
      pp_data.kinetic_energy_spectrum_data.time_control_data.is_active)
   {
@@ -23,8 +23,10 @@
 #define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_CALCULATORS_H_
 
 // deal.II
+#include <deal.II/base/symmetric_tensor.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
 
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
@@ -33,6 +35,39 @@ namespace ExaDG
 {
 namespace CompNS
 {
+/*
+ *  Vectors of the derived variables to be computed in a single loop over the conserved variables,
+ *  see p_u_T_Calculator::compute_derived_variables(). Derived variables with a null pointer are not
+ *  computed. The velocity and the vorticity are vectors with dim components (the vorticity of a 2D
+ *  flow is stored in the first component), all other variables are scalar.
+ */
+template<typename VectorType>
+struct DerivedVariables
+{
+  DerivedVariables()
+    : pressure(nullptr),
+      velocity(nullptr),
+      temperature(nullptr),
+      vorticity(nullptr),
+      divergence(nullptr),
+      shear_rate(nullptr)
+  {
+  }
+
+  bool
+  needs_velocity_gradient() const
+  {
+    return vorticity != nullptr or divergence != nullptr or shear_rate != nullptr;
+  }
+
+  VectorType * pressure;
+  VectorType * velocity;
+  VectorType * temperature;
+  VectorType * vorticity;
+  VectorType * divergence;
+  VectorType * shear_rate;
+};
+
 /*
  *  The DoF vector contains the vector of conserved quantities (rho, rho u, rho E).
  *  This class allows to transfer these quantities into the derived variables (p, u, T)
@@ -51,6 +86,11 @@ public:
 
   typedef dealii::VectorizedArray<Number>                         scalar;
   typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  // use a template parameter of -1 to select the precompiled version of this operator
+  typedef dealii::MatrixFreeOperators::CellwiseInverseMassMatrix<dim, -1, 1, Number>
+    CellwiseInverseMass;
 
   p_u_T_Calculator()
     : matrix_free(nullptr),
@@ -109,6 +149,160 @@ public:
     matrix_free->cell_loop(&This::local_apply_temperature, this, temperature, solution_conserved);
   }
 
+  /*
+   *  Computes all derived variables requested in derived_variables in a single loop over the cells,
+   *  i.e., the conserved variables are read only once. The L2-projection onto the DG space is
+   *  performed cell by cell within the same loop, and the velocity gradient is obtained from the
+   *  gradients of the conserved variables,
+   *
+   *    grad(u) = (grad(rho u) - u x grad(rho)) / rho .
+   *
+   *  The cell-wise projection is realized as transformation from the values in the quadrature
+   *  points to the nodal basis, which requires tensor-product elements and n_q_points_1d =
+   *  degree + 1.
+   */
+  void
+  compute_derived_variables(DerivedVariables<VectorType> const & derived_variables,
+                            VectorType const &                   solution_conserved) const
+  {
+    AssertThrow(heat_capacity_ratio > 0.0,
+                dealii::ExcMessage("heat capacity ratio has not been set!"));
+    AssertThrow(specific_gas_constant > 0.0,
+                dealii::ExcMessage("specific gas constant has not been set!"));
+
+    // src-vector
+    CellIntegratorScalar density(*matrix_free, dof_index_all, quad_index, 0);
+    CellIntegratorVector momentum(*matrix_free, dof_index_all, quad_index, 1);
+    CellIntegratorScalar energy(*matrix_free, dof_index_all, quad_index, 1 + dim);
+
+    // dst-vectors
+    CellIntegratorScalar integrator_scalar(*matrix_free, dof_index_scalar, quad_index, 0);
+    CellIntegratorVector integrator_vector(*matrix_free, dof_index_vector, quad_index, 0);
+
+    CellwiseInverseMass inverse_mass(integrator_scalar);
+
+    unsigned int const n_q_points = integrator_scalar.n_q_points;
+
+    dealii::EvaluationFlags::EvaluationFlags const evaluation_flags =
+      derived_variables.needs_velocity_gradient() ?
+        (dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients) :
+        dealii::EvaluationFlags::values;
+
+    bool const needs_energy =
+      derived_variables.pressure != nullptr or derived_variables.temperature != nullptr;
+
+    // writes the derived variable computed by the given function in all quadrature points into
+    // the dst-vector
+    auto const project_scalar = [&](VectorType * dst, auto const & function) {
+      if(dst != nullptr)
+      {
+        for(unsigned int q = 0; q < n_q_points; ++q)
+          integrator_scalar.begin_values()[q] = function(q);
+
+        inverse_mass.transform_from_q_points_to_basis(1,
+                                                      integrator_scalar.begin_values(),
+                                                      integrator_scalar.begin_dof_values());
+        integrator_scalar.set_dof_values(*dst);
+      }
+    };
+
+    auto const project_vector = [&](VectorType * dst, auto const & function) {
+      if(dst != nullptr)
+      {
+        for(unsigned int q = 0; q < n_q_points; ++q)
+        {
+          vector const value = function(q);
+          for(unsigned int d = 0; d < dim; ++d)
+            integrator_vector.begin_values()[d * n_q_points + q] = value[d];
+        }
+
+        inverse_mass.transform_from_q_points_to_basis(dim,
+                                                      integrator_vector.begin_values(),
+                                                      integrator_vector.begin_dof_values());
+        integrator_vector.set_dof_values(*dst);
+      }
+    };
+
+    std::vector<vector> u(n_q_points);
+    std::vector<tensor> grad_u(n_q_points);
+
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      // src-vector
+      density.reinit(cell);
+      density.read_dof_values(solution_conserved);
+      density.evaluate(evaluation_flags);
+      momentum.reinit(cell);
+      momentum.read_dof_values(solution_conserved);
+      momentum.evaluate(evaluation_flags);
+      if(needs_energy)
+      {
+        energy.reinit(cell);
+        energy.read_dof_values(solution_conserved);
+        energy.evaluate(dealii::EvaluationFlags::values);
+      }
+
+      // dst-vectors
+      integrator_scalar.reinit(cell);
+      integrator_vector.reinit(cell);
+
+      // velocity and velocity gradient are needed by most of the derived variables
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        scalar const rho = density.get_value(q);
+        u[q]             = momentum.get_value(q) / rho;
+
+        if(derived_variables.needs_velocity_gradient())
+        {
+          vector const grad_rho     = density.get_gradient(q);
+          tensor const grad_rho_u   = momentum.get_gradient(q);
+          scalar const one_over_rho = 1.0 / rho;
+          for(unsigned int i = 0; i < dim; ++i)
+            for(unsigned int j = 0; j < dim; ++j)
+              grad_u[q][i][j] = (grad_rho_u[i][j] - u[q][i] * grad_rho[j]) * one_over_rho;
+        }
+      }
+
+      project_scalar(derived_variables.pressure, [&](unsigned int const q) {
+        return dealii::make_vectorized_array<Number>(heat_capacity_ratio - 1.0) *
+               (energy.get_value(q) - 0.5 * density.get_value(q) * scalar_product(u[q], u[q]));
+      });
+
+      project_vector(derived_variables.velocity, [&](unsigned int const q) { return u[q]; });
+
+      project_scalar(derived_variables.temperature, [&](unsigned int const q) {
+        scalar const E = energy.get_value(q) / density.get_value(q);
+        return dealii::make_vectorized_array<Number>((heat_capacity_ratio - 1.0) /
+                                                     specific_gas_constant) *
+               (E - 0.5 * scalar_product(u[q], u[q]));
+      });
+
+      project_vector(derived_variables.vorticity, [&](unsigned int const q) {
+        vector omega;
+        if(dim == 2)
+        {
+          omega[0] = grad_u[q][1][0] - grad_u[q][0][1];
+        }
+        else if(dim == 3)
+        {
+          omega[0]       = grad_u[q][2][1] - grad_u[q][1][2];
+          omega[1]       = grad_u[q][0][2] - grad_u[q][2][0];
+          omega[dim - 1] = grad_u[q][1][0] - grad_u[q][0][1];
+        }
+        return omega;
+      });
+
+      project_scalar(derived_variables.divergence,
+                     [&](unsigned int const q) { return trace(grad_u[q]); });
+
+      // sqrt(2*trace(sym_grad_u^2)) = sqrt(2*sym_grad_u : sym_grad_u)
+      project_scalar(derived_variables.shear_rate, [&](unsigned int const q) {
+        dealii::SymmetricTensor<2, dim, scalar> const sym_grad_u = dealii::symmetrize(grad_u[q]);
+        return std::sqrt(2.0 * scalar_product(sym_grad_u, sym_grad_u));
+      });
+    }
+  }
+
 private:
   void
   local_apply_pressure(dealii::MatrixFree<dim, Number> const &       matrix_free,
@@ -26,6 +26,9 @@
 #include <iostream>
 
 // deal.II
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -281,6 +284,73 @@ inline DEAL_II_ALWAYS_INLINE //
   return std::max(lambda_m, lambda_p);
 }
 
+/*
+ * Logarithmic mean (a - b) / (log(a) - log(b)) of two positive quantities. For a close to b, a
+ * series expansion is used in order to avoid cancellation, see Ranocha et al. (2021), "Efficient
+ * implementation of modern entropy stable and kinetic energy preserving discontinuous Galerkin
+ * methods for conservation laws".
+ */
+template<typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::VectorizedArray<Number>
+  calculate_logarithmic_mean(dealii::VectorizedArray<Number> const & a,
+                             dealii::VectorizedArray<Number> const & b)
+{
+  // f2 = ((a - b) / (a + b))^2
+  dealii::VectorizedArray<Number> const f2 =
+    (a * (a - 2.0 * b) + b * b) / (a * (a + 2.0 * b) + b * b);
+
+  dealii::VectorizedArray<Number> const series =
+    (a + b) * 52.5 / (105.0 + f2 * (35.0 + f2 * (21.0 + f2 * 15.0)));
+
+  dealii::VectorizedArray<Number> const exact = (b - a) / std::log(b / a);
+
+  return dealii::compare_and_apply_mask<dealii::SIMDComparison::less_than>(
+    f2, dealii::VectorizedArray<Number>(1.0e-4), series, exact);
+}
+
+/*
+ * Entropy conservative and kinetic energy preserving two-point flux by Ranocha (2018), "Generalised
+ * summation-by-parts operators and entropy stability of numerical methods for hyperbolic balance
+ * laws", in direction of the (not necessarily normalized) vector @param normal. The flux is
+ * symmetric in the states M and P and consistent with the physical flux.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  std::tuple<dealii::VectorizedArray<Number>,
+             dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>,
+             dealii::VectorizedArray<Number>>
+  calculate_entropy_conservative_flux(
+    dealii::VectorizedArray<Number> const &                         rho_M,
+    dealii::VectorizedArray<Number> const &                         rho_P,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_M,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_P,
+    dealii::VectorizedArray<Number> const &                         p_M,
+    dealii::VectorizedArray<Number> const &                         p_P,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normal,
+    Number const &                                                  gamma)
+{
+  dealii::VectorizedArray<Number> const rho_mean = calculate_logarithmic_mean(rho_M, rho_P);
+
+  // inverse of the logarithmic mean of rho/p
+  dealii::VectorizedArray<Number> const rho_p_mean_inverse =
+    p_M * p_P / calculate_logarithmic_mean(rho_M * p_P, rho_P * p_M);
+
+  dealii::VectorizedArray<Number> const u_normal_M = u_M * normal;
+  dealii::VectorizedArray<Number> const u_normal_P = u_P * normal;
+
+  dealii::VectorizedArray<Number> const flux_density = rho_mean * 0.5 * (u_normal_M + u_normal_P);
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const flux_momentum =
+    flux_density * 0.5 * (u_M + u_P) + 0.5 * (p_M + p_P) * normal;
+
+  dealii::VectorizedArray<Number> const flux_energy =
+    flux_density * (0.5 * (u_M * u_P) + rho_p_mean_inverse / (gamma - 1.0)) +
+    0.5 * (p_M * u_normal_P + p_P * u_normal_M);
+
+  return std::make_tuple(flux_density, flux_momentum, flux_energy);
+}
+
 template<int dim>
 struct BodyForceOperatorData
 {
@@ -492,13 +562,22 @@ template<int dim>
 struct ConvectiveOperatorData
 {
   ConvectiveOperatorData()
-    : dof_index(0), quad_index(0), heat_capacity_ratio(1.4), specific_gas_constant(287.0)
+    : dof_index(0),
+      quad_index(0),
+      formulation(ConvectiveFormulation::Standard),
+      heat_capacity_ratio(1.4),
+      specific_gas_constant(287.0)
   {
   }
 
   unsigned int dof_index;
+
+  // In case of the split form, the quadrature rule has to consist of the Gauss-Lobatto points
+  // collocated with the nodes of the shape functions.
   unsigned int quad_index;
 
+  ConvectiveFormulation formulation;
+
   std::shared_ptr<BoundaryDescriptor<dim> const> bc;
 
   double heat_capacity_ratio;
@@ -537,6 +616,9 @@ public:
     gamma = data.heat_capacity_ratio;
     R     = data.specific_gas_constant;
     c_v   = R / (gamma - 1.0);
+
+    if(data.formulation == ConvectiveFormulation::EntropyStableSplitForm)
+      initialize_split_form();
   }
 
   void
@@ -551,8 +633,16 @@ public:
   {
     this->eval_time = evaluation_time;
 
-    matrix_free->loop(
-      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    if(data.formulation == ConvectiveFormulation::EntropyStableSplitForm)
+    {
+      matrix_free->loop(
+        &This::cell_loop_split_form, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    }
+    else
+    {
+      matrix_free->loop(
+        &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    }
   }
 
   void
@@ -609,32 +699,8 @@ public:
     scalar p_M = calculate_pressure(rho_u_M, u_M, rho_E_M, gamma);
     scalar p_P = calculate_pressure(rho_u_P, u_P, rho_E_P, gamma);
 
-    // calculate lambda
-    scalar lambda = calculate_lambda(rho_M, rho_P, u_M, u_P, p_M, p_P, gamma);
-
-    // flux density
-    scalar flux_density = calculate_flux(rho_u_M, rho_u_P, rho_M, rho_P, lambda, normal);
-
-    // flux momentum
-    tensor momentum_flux_M = outer_product(rho_u_M, u_M);
-    for(unsigned int d = 0; d < dim; ++d)
-      momentum_flux_M[d][d] += p_M;
-
-    tensor momentum_flux_P = outer_product(rho_u_P, u_P);
-    for(unsigned int d = 0; d < dim; ++d)
-      momentum_flux_P[d][d] += p_P;
-
-    vector flux_momentum =
-      calculate_flux(momentum_flux_M, momentum_flux_P, rho_u_M, rho_u_P, lambda, normal);
-
-    // flux energy
-    vector energy_flux_M = (rho_E_M + p_M) * u_M;
-    vector energy_flux_P = (rho_E_P + p_P) * u_P;
-
-    scalar flux_energy =
-      calculate_flux(energy_flux_M, energy_flux_P, rho_E_M, rho_E_P, lambda, normal);
-
-    return std::make_tuple(flux_density, flux_momentum, flux_energy);
+    return calculate_numerical_flux(
+      rho_M, rho_P, rho_u_M, rho_u_P, u_M, u_P, rho_E_M, rho_E_P, p_M, p_P, normal);
   }
 
   inline DEAL_II_ALWAYS_INLINE //
@@ -713,9 +779,44 @@ public:
     }
     scalar rho_E_P = rho_P * E_P;
 
+    return calculate_numerical_flux(
+      rho_M, rho_P, rho_u_M, rho_u_P, u_M, u_P, rho_E_M, rho_E_P, p_M, p_P, normal);
+  }
+
+private:
+  /*
+   * Numerical flux on faces: Lax-Friedrichs flux for the standard formulation, and the entropy
+   * conservative flux plus Lax-Friedrichs dissipation (entropy stable flux) for the split form.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    std::tuple<scalar, vector, scalar>
+    calculate_numerical_flux(scalar const & rho_M,
+                             scalar const & rho_P,
+                             vector const & rho_u_M,
+                             vector const & rho_u_P,
+                             vector const & u_M,
+                             vector const & u_P,
+                             scalar const & rho_E_M,
+                             scalar const & rho_E_P,
+                             scalar const & p_M,
+                             scalar const & p_P,
+                             vector const & normal) const
+  {
     // calculate lambda
     scalar lambda = calculate_lambda(rho_M, rho_P, u_M, u_P, p_M, p_P, gamma);
 
+    if(data.formulation == ConvectiveFormulation::EntropyStableSplitForm)
+    {
+      std::tuple<scalar, vector, scalar> flux =
+        calculate_entropy_conservative_flux(rho_M, rho_P, u_M, u_P, p_M, p_P, normal, gamma);
+
+      std::get<0>(flux) += 0.5 * lambda * (rho_M - rho_P);
+      std::get<1>(flux) += 0.5 * lambda * (rho_u_M - rho_u_P);
+      std::get<2>(flux) += 0.5 * lambda * (rho_E_M - rho_E_P);
+
+      return flux;
+    }
+
     // flux density
     scalar flux_density = calculate_flux(rho_u_M, rho_u_P, rho_M, rho_P, lambda, normal);
 
@@ -740,7 +841,177 @@ public:
     return std::make_tuple(flux_density, flux_momentum, flux_energy);
   }
 
-private:
+  /*
+   * Sets up the 1D summation-by-parts operator on the Gauss-Lobatto points for the split form.
+   */
+  void
+  initialize_split_form()
+  {
+    auto const & shape_data = matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0];
+
+    unsigned int const n_points_1d = shape_data.n_q_points_1d;
+
+    AssertThrow(n_points_1d == shape_data.fe_degree + 1 and
+                  std::abs(matrix_free->get_quadrature(data.quad_index).point(0)[0]) < 1.0e-12,
+                dealii::ExcMessage("The split form requires Gauss-Lobatto points collocated with "
+                                   "the nodes of the shape functions."));
+
+    dealii::QGaussLobatto<1> const quadrature_1d(n_points_1d);
+
+    std::vector<dealii::Polynomials::Polynomial<double>> const lagrange_basis =
+      dealii::Polynomials::generate_complete_Lagrange_basis(quadrature_1d.get_points());
+
+    // Q_ij = w_i * l_j'(x_i) with the quadrature weights w_i and the Lagrange polynomials l_j
+    dealii::Table<2, double> Q(n_points_1d, n_points_1d);
+    std::vector<double>      values(2);
+    for(unsigned int i = 0; i < n_points_1d; ++i)
+    {
+      for(unsigned int j = 0; j < n_points_1d; ++j)
+      {
+        lagrange_basis[j].value(quadrature_1d.point(i)[0], values);
+        Q(i, j) = quadrature_1d.weight(i) * values[1];
+      }
+    }
+
+    skew_symmetric_derivative_1d.reinit(n_points_1d, n_points_1d);
+    for(unsigned int i = 0; i < n_points_1d; ++i)
+      for(unsigned int j = 0; j < n_points_1d; ++j)
+        skew_symmetric_derivative_1d(i, j) = Q(i, j) - Q(j, i);
+
+    weights_1d.resize(n_points_1d);
+    for(unsigned int i = 0; i < n_points_1d; ++i)
+      weights_1d[i] = quadrature_1d.weight(i);
+
+    // tensor-product weights, ordered lexicographically as the quadrature points of MatrixFree
+    dealii::QGaussLobatto<dim> const quadrature(n_points_1d);
+    weights.resize(quadrature.size());
+    for(unsigned int q = 0; q < quadrature.size(); ++q)
+      weights[q] = quadrature.weight(q);
+  }
+
+  /*
+   * Flux-differencing (split) form of the convective term, see Gassner, Winters, Kopriva (2016),
+   * "Split form nodal discontinuous Galerkin schemes with summation-by-parts property for the
+   * compressible Euler equations". With the 1D summation-by-parts operator Q = W D (quadrature
+   * weights W, derivative matrix D), the volume term of node i on a line of nodes in reference
+   * direction d reads
+   *
+   *   sum_j (Q_ij - Q_ji) W_perp F#(u_i, u_j) * 0.5 (Ja^d_i + Ja^d_j) ,
+   *
+   * with the entropy conservative two-point flux F#, the contravariant basis vectors (metric terms)
+   * Ja^d = det(J) grad(xi_d), and the product W_perp of the weights in the other directions. Since
+   * Q - Q^T is skew-symmetric, the boundary terms of the strong form cancel, so that only the
+   * numerical flux is integrated on faces, and the symmetric two-point flux is evaluated once per
+   * pair of nodes. The values at the quadrature points are the nodal values (collocation), and the
+   * nodal residuals are submitted divided by JxW, so that integrate() returns them unchanged.
+   */
+  void
+  cell_loop_split_form(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                       VectorType &                                  dst,
+                       VectorType const &                            src,
+                       std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
+    CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
+    CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
+
+    unsigned int const n_points_1d = weights_1d.size();
+    unsigned int const n_points    = density.n_q_points;
+
+    // density, velocity, pressure and metric terms at the nodes
+    dealii::AlignedVector<scalar> rho(n_points), p(n_points);
+    dealii::AlignedVector<vector> u(n_points);
+    dealii::AlignedVector<tensor> metric(n_points);
+
+    // nodal residuals
+    dealii::AlignedVector<scalar> residual_density(n_points), residual_energy(n_points);
+    dealii::AlignedVector<vector> residual_momentum(n_points);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      density.reinit(cell);
+      density.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      momentum.reinit(cell);
+      momentum.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      energy.reinit(cell);
+      energy.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < n_points; ++q)
+      {
+        rho[q]       = density.get_value(q);
+        vector rho_u = momentum.get_value(q);
+        u[q]         = rho_u / rho[q];
+        p[q]         = calculate_pressure(rho_u, u[q], energy.get_value(q), gamma);
+
+        // inverse_jacobian() returns J^{-T}, i.e., column d contains grad(xi_d)
+        tensor const inverse_jacobian = density.inverse_jacobian(q);
+        scalar const det_J            = density.JxW(q) / weights[q];
+        for(unsigned int d = 0; d < dim; ++d)
+          for(unsigned int e = 0; e < dim; ++e)
+            metric[q][d][e] = det_J * inverse_jacobian[e][d];
+
+        residual_density[q]  = scalar();
+        residual_momentum[q] = vector();
+        residual_energy[q]   = scalar();
+      }
+
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        unsigned int const stride = dealii::Utilities::pow(n_points_1d, d);
+
+        for(unsigned int q0 = 0; q0 < n_points; ++q0)
+        {
+          // q0 has to be the first node of a line of nodes in direction d
+          if((q0 / stride) % n_points_1d != 0)
+            continue;
+
+          Number const weight_perp = weights[q0] / weights_1d[0];
+
+          for(unsigned int a = 0; a < n_points_1d; ++a)
+          {
+            unsigned int const i = q0 + a * stride;
+
+            for(unsigned int b = a + 1; b < n_points_1d; ++b)
+            {
+              unsigned int const j = q0 + b * stride;
+
+              // the two-point flux is linear in the normal vector, which includes all factors
+              vector const normal = (0.5 * weight_perp * skew_symmetric_derivative_1d(a, b)) *
+                                    (metric[i][d] + metric[j][d]);
+
+              std::tuple<scalar, vector, scalar> const flux = calculate_entropy_conservative_flux(
+                rho[i], rho[j], u[i], u[j], p[i], p[j], normal, gamma);
+
+              residual_density[i] += std::get<0>(flux);
+              residual_density[j] -= std::get<0>(flux);
+
+              residual_momentum[i] += std::get<1>(flux);
+              residual_momentum[j] -= std::get<1>(flux);
+
+              residual_energy[i] += std::get<2>(flux);
+              residual_energy[j] -= std::get<2>(flux);
+            }
+          }
+        }
+      }
+
+      for(unsigned int q = 0; q < n_points; ++q)
+      {
+        scalar const JxW_inverse = 1.0 / density.JxW(q);
+
+        density.submit_value(residual_density[q] * JxW_inverse, q);
+        momentum.submit_value(residual_momentum[q] * JxW_inverse, q);
+        energy.submit_value(residual_energy[q] * JxW_inverse, q);
+      }
+
+      density.integrate_scatter(dealii::EvaluationFlags::values, dst);
+      momentum.integrate_scatter(dealii::EvaluationFlags::values, dst);
+      energy.integrate_scatter(dealii::EvaluationFlags::values, dst);
+    }
+  }
+
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
             VectorType &                                  dst,
@@ -911,6 +1182,11 @@ private:
   // specific heat at constant volume
   Number c_v;
 
+  // split form: skew-symmetric part Q - Q^T of the 1D summation-by-parts operator and quadrature
+  // weights on the Gauss-Lobatto points
+  dealii::Table<2, Number> skew_symmetric_derivative_1d;
+  std::vector<Number>      weights_1d, weights;
+
   mutable Number eval_time;
 };
 
@@ -19,6 +19,9 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <limits>
+
 // deal.II
 #include <deal.II/base/timer.h>
 
@@ -28,6 +31,7 @@
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/grid_related_time_step_restrictions.h>
 #include <exadg/operators/quadrature.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 
 namespace ExaDG
 {
@@ -35,16 +39,18 @@ namespace CompNS
 {
 template<int dim, typename Number>
 Operator<dim, Number>::Operator(
-  std::shared_ptr<Grid<dim> const>               grid_in,
-  std::shared_ptr<dealii::Mapping<dim> const>    mapping_in,
-  std::shared_ptr<BoundaryDescriptor<dim> const> boundary_descriptor_in,
-  std::shared_ptr<FieldFunctions<dim> const>     field_functions_in,
-  Parameters const &                             param_in,
-  std::string const &                            field_in,
-  MPI_Comm const &                               mpi_comm_in)
+  std::shared_ptr<Grid<dim> const>                      grid_in,
+  std::shared_ptr<dealii::Mapping<dim> const>           mapping_in,
+  std::shared_ptr<MultigridMappings<dim, Number>> const multigrid_mappings_in,
+  std::shared_ptr<BoundaryDescriptor<dim> const>        boundary_descriptor_in,
+  std::shared_ptr<FieldFunctions<dim> const>            field_functions_in,
+  Parameters const &                                    param_in,
+  std::string const &                                   field_in,
+  MPI_Comm const &                                      mpi_comm_in)
   : dealii::Subscriptor(),
     grid(grid_in),
     mapping(mapping_in),
+    multigrid_mappings(multigrid_mappings_in),
     boundary_descriptor(boundary_descriptor_in),
     field_functions(field_functions_in),
     param(param_in),
@@ -54,7 +60,10 @@ Operator<dim, Number>::Operator(
     dof_handler_scalar(*grid_in->triangulation),
     mpi_comm(mpi_comm_in),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
-    wall_time_operator_evaluation(0.0)
+    wall_time_operator_evaluation(0.0),
+    time_viscous(0.0),
+    scaling_factor_viscous(1.0),
+    norm_solution_linearization(0.0)
 {
   pcout << std::endl << "Construct compressible Navier-Stokes DG operator ..." << std::endl;
 
@@ -151,6 +160,11 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   std::shared_ptr<dealii::Quadrature<dim>> quadrature_vis =
     create_quadrature<dim>(param.grid.element_type, n_q_points_vis);
   matrix_free_data.insert_quadrature(*quadrature_vis, field + quad_index_overintegration_vis);
+
+  // Gauss-Lobatto points collocated with the nodes of the shape functions for the split form
+  if(param.convective_formulation == ConvectiveFormulation::EntropyStableSplitForm)
+    matrix_free_data.insert_quadrature(dealii::QGaussLobatto<1>(param.degree + 1),
+                                       field + quad_index_collocation);
 }
 
 template<int dim, typename Number>
@@ -160,13 +174,13 @@ Operator<dim, Number>::setup_operators()
   // mass operator
   MassOperatorData mass_operator_data;
   mass_operator_data.dof_index  = get_dof_index_all();
-  mass_operator_data.quad_index = get_quad_index_standard();
+  mass_operator_data.quad_index = get_quad_index_mass();
   mass_operator.initialize(*matrix_free, mass_operator_data);
 
   // inverse mass operator
   InverseMassOperatorData inverse_mass_operator_data_all;
   inverse_mass_operator_data_all.dof_index  = get_dof_index_all();
-  inverse_mass_operator_data_all.quad_index = get_quad_index_standard();
+  inverse_mass_operator_data_all.quad_index = get_quad_index_mass();
   inverse_mass_operator_data_all.parameters = param.inverse_mass_operator;
   inverse_mass_all.initialize(*matrix_free, inverse_mass_operator_data_all);
 
@@ -195,6 +209,9 @@ Operator<dim, Number>::setup_operators()
   ConvectiveOperatorData<dim> convective_operator_data;
   convective_operator_data.dof_index             = get_dof_index_all();
   convective_operator_data.quad_index            = get_quad_index_overintegration_conv();
+  convective_operator_data.formulation           = param.convective_formulation;
+  if(param.convective_formulation == ConvectiveFormulation::EntropyStableSplitForm)
+    convective_operator_data.quad_index = get_quad_index_collocation();
   convective_operator_data.bc                    = boundary_descriptor;
   convective_operator_data.heat_capacity_ratio   = param.heat_capacity_ratio;
   convective_operator_data.specific_gas_constant = param.specific_gas_constant;
@@ -288,9 +305,201 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number> con
   // perform setup of data structures that depend on matrix-free object
   setup_operators();
 
+  if(param.temporal_discretization == TemporalDiscretization::IMEXRK)
+    setup_solver_viscous();
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::setup_solver_viscous()
+{
+  AssertThrow(param.equation_type == EquationType::NavierStokes,
+              dealii::ExcMessage("The implicit treatment of the viscous term requires "
+                                 "EquationType::NavierStokes."));
+
+  initialize_dof_vector(solution_linearization_viscous);
+  initialize_dof_vector(viscous_term_linearization);
+  initialize_dof_vector(temp_all);
+  initialize_dof_vector_scalar(temp_scalar_src);
+  initialize_dof_vector_scalar(temp_scalar_dst);
+
+  nonlinear_operator_viscous.initialize(*this);
+  linear_operator_viscous.initialize(*this);
+
+  // preconditioner
+  if(param.preconditioner_viscous == PreconditionerViscous::Multigrid)
+  {
+    // The viscous terms of the momentum and energy equations are approximated by scalar Laplace
+    // operators with constant diffusivities (evaluated with the reference density).
+    double const diffusivity_momentum = param.dynamic_viscosity / param.reference_density;
+    double const c_v = param.specific_gas_constant / (param.heat_capacity_ratio - 1.0);
+    double const diffusivity_energy =
+      param.thermal_conductivity / (c_v * param.reference_density);
+
+    helmholtz_operator_momentum =
+      create_helmholtz_operator(boundary_descriptor->velocity, diffusivity_momentum);
+    helmholtz_operator_energy =
+      create_helmholtz_operator(boundary_descriptor->energy, diffusivity_energy);
+
+    multigrid_momentum = create_multigrid_preconditioner(*helmholtz_operator_momentum);
+    multigrid_energy   = create_multigrid_preconditioner(*helmholtz_operator_energy);
+
+    preconditioner_viscous = std::make_shared<BlockPreconditionerViscous<dim, Number>>(*this);
+  }
+  else
+  {
+    AssertThrow(param.preconditioner_viscous == PreconditionerViscous::None or
+                  param.preconditioner_viscous == PreconditionerViscous::InverseMassMatrix,
+                dealii::ExcMessage("Specified preconditioner is not implemented!"));
+
+    InverseMassOperatorData inverse_mass_operator_data;
+    inverse_mass_operator_data.dof_index  = get_dof_index_all();
+    inverse_mass_operator_data.quad_index = get_quad_index_mass();
+    inverse_mass_operator_data.parameters = param.inverse_mass_operator;
+    preconditioner_viscous =
+      std::make_shared<InverseMassPreconditioner<dim, dim + 2, Number>>(*matrix_free,
+                                                                        inverse_mass_operator_data);
+  }
+
+  // linear solver
+  Krylov::SolverDataGMRES solver_data;
+  solver_data.max_iter             = param.solver_data_viscous.max_iter;
+  solver_data.solver_tolerance_abs = param.solver_data_viscous.abs_tol;
+  solver_data.solver_tolerance_rel = param.solver_data_viscous.rel_tol;
+  solver_data.max_n_tmp_vectors    = param.solver_data_viscous.max_krylov_size;
+  solver_data.use_preconditioner   = param.preconditioner_viscous != PreconditionerViscous::None;
+
+  typedef Krylov::
+    SolverGMRES<LinearOperatorViscous<dim, Number>, PreconditionerBase<Number>, VectorType>
+      GMRES;
+  linear_solver_viscous = std::make_shared<GMRES>(linear_operator_viscous,
+                                                  *preconditioner_viscous,
+                                                  solver_data,
+                                                  mpi_comm);
+
+  // Newton solver
+  newton_solver_viscous = std::make_shared<Newton::Solver<VectorType,
+                                                          NonlinearOperatorViscous<dim, Number>,
+                                                          LinearOperatorViscous<dim, Number>,
+                                                          Krylov::SolverBase<VectorType>>>(
+    param.newton_solver_data_viscous,
+    nonlinear_operator_viscous,
+    linear_operator_viscous,
+    *linear_solver_viscous);
+}
+
+template<int dim, typename Number>
+std::shared_ptr<ConvDiff::CombinedOperator<dim, Number>>
+Operator<dim, Number>::create_helmholtz_operator(
+  BoundaryDescriptorStd<dim> const & boundary_descriptor_std,
+  double const                       diffusivity) const
+{
+  // Only the homogeneous operator is applied in the preconditioner, so that the boundary values
+  // are not needed.
+  std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> bc =
+    std::make_shared<ConvDiff::BoundaryDescriptor<dim>>();
+  for(auto const & it : boundary_descriptor_std.dirichlet_bc)
+    bc->dirichlet_bc.insert(
+      std::make_pair(it.first, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+  for(auto const & it : boundary_descriptor_std.neumann_bc)
+    bc->neumann_bc.insert(
+      std::make_pair(it.first, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  ConvDiff::CombinedOperatorData<dim> data;
+  data.dof_index                         = get_dof_index_scalar();
+  data.quad_index                        = get_quad_index_standard();
+  data.bc                                = bc;
+  data.unsteady_problem                  = true;
+  data.diffusive_problem                 = true;
+  data.diffusive_kernel_data.IP_factor   = param.IP_factor;
+  data.diffusive_kernel_data.diffusivity = diffusivity;
+
+  std::shared_ptr<ConvDiff::CombinedOperator<dim, Number>> helmholtz_operator =
+    std::make_shared<ConvDiff::CombinedOperator<dim, Number>>();
+  helmholtz_operator->initialize(*matrix_free, constraint, data);
+
+  return helmholtz_operator;
+}
+
+template<int dim, typename Number>
+std::shared_ptr<PreconditionerBase<Number>>
+Operator<dim, Number>::create_multigrid_preconditioner(
+  ConvDiff::CombinedOperator<dim, Number> const & helmholtz_operator) const
+{
+  typedef ConvDiff::MultigridPreconditioner<dim, Number> Multigrid;
+
+  std::shared_ptr<Multigrid> multigrid = std::make_shared<Multigrid>(mpi_comm);
+
+  typedef std::map<dealii::types::boundary_id, dealii::ComponentMask> Map_DBC_ComponentMask;
+  Map_DBC_ComponentMask                                               dirichlet_bc_component_mask;
+
+  multigrid->initialize(param.multigrid_data_viscous,
+                        grid,
+                        multigrid_mappings,
+                        dof_handler_scalar.get_fe(),
+                        helmholtz_operator,
+                        MultigridOperatorType::ReactionDiffusion,
+                        false /* mesh_is_moving */,
+                        helmholtz_operator.get_data().bc->dirichlet_bc,
+                        dirichlet_bc_component_mask);
+
+  return multigrid;
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::extract_component(VectorType &       dst,
+                                         VectorType const & src,
+                                         unsigned int const component) const
+{
+  CellIntegrator<dim, 1, Number> integrator_all(*matrix_free,
+                                                get_dof_index_all(),
+                                                get_quad_index_standard(),
+                                                component);
+  CellIntegrator<dim, 1, Number> integrator_scalar(*matrix_free,
+                                                   get_dof_index_scalar(),
+                                                   get_quad_index_standard());
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator_all.reinit(cell);
+    integrator_all.read_dof_values(src);
+
+    integrator_scalar.reinit(cell);
+    for(unsigned int i = 0; i < integrator_scalar.dofs_per_cell; ++i)
+      integrator_scalar.begin_dof_values()[i] = integrator_all.begin_dof_values()[i];
+    integrator_scalar.set_dof_values(dst);
+  }
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::insert_component(VectorType &       dst,
+                                        VectorType const & src,
+                                        unsigned int const component) const
+{
+  CellIntegrator<dim, 1, Number> integrator_all(*matrix_free,
+                                                get_dof_index_all(),
+                                                get_quad_index_standard(),
+                                                component);
+  CellIntegrator<dim, 1, Number> integrator_scalar(*matrix_free,
+                                                   get_dof_index_scalar(),
+                                                   get_quad_index_standard());
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator_scalar.reinit(cell);
+    integrator_scalar.read_dof_values(src);
+
+    integrator_all.reinit(cell);
+    for(unsigned int i = 0; i < integrator_all.dofs_per_cell; ++i)
+      integrator_all.begin_dof_values()[i] = integrator_scalar.begin_dof_values()[i];
+    integrator_all.set_dof_values(dst);
+  }
+}
+
 template<int dim, typename Number>
 dealii::types::global_dof_index
 Operator<dim, Number>::get_number_of_dofs() const
@@ -407,6 +616,173 @@ Operator<dim, Number>::evaluate_convective_and_viscous(VectorType &       dst,
   }
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_explicit_terms(VectorType &       dst,
+                                               VectorType const & src,
+                                               Number const       time) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  evaluate_convective(dst, src, time);
+
+  // shift convective term to the right-hand side of the equation
+  dst *= -1.0;
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    body_force_operator.evaluate_add(dst, src, time);
+  }
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_implicit_terms(VectorType &       dst,
+                                               VectorType const & src,
+                                               Number const       time) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  viscous_operator.evaluate(dst, src, time);
+
+  // shift viscous term to the right-hand side of the equation
+  dst *= -1.0;
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+std::tuple<unsigned int, unsigned int>
+Operator<dim, Number>::solve_implicit_terms(VectorType &       dst,
+                                            VectorType const & rhs,
+                                            Number const       time,
+                                            Number const       scaling_factor)
+{
+  time_viscous           = time;
+  scaling_factor_viscous = scaling_factor;
+
+  nonlinear_operator_viscous.update(rhs, time, scaling_factor);
+
+  // the preconditioner is updated in every Newton iteration, which is cheap since the multigrid
+  // preconditioners are only updated if the scaling factor of the mass operator changes
+  Newton::UpdateData update;
+  update.do_update = true;
+
+  return newton_solver_viscous->solve(dst, update);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_nonlinear_residual_viscous(VectorType &       dst,
+                                                           VectorType const & src,
+                                                           VectorType const & rhs,
+                                                           double const       time,
+                                                           double const       scaling_factor) const
+{
+  viscous_operator.evaluate(dst, src, time);
+
+  temp_all.equ(1.0 / scaling_factor, src);
+  temp_all.add(-1.0 / scaling_factor, rhs);
+  mass_operator.apply_add(dst, temp_all);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::set_solution_linearization_viscous(
+  VectorType const & solution_linearization) const
+{
+  solution_linearization_viscous = solution_linearization;
+  norm_solution_linearization    = solution_linearization_viscous.l2_norm();
+
+  viscous_operator.evaluate(viscous_term_linearization,
+                            solution_linearization_viscous,
+                            time_viscous);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::apply_linearized_viscous_problem(VectorType &       dst,
+                                                        VectorType const & src) const
+{
+  double const norm_src = src.l2_norm();
+
+  if(norm_src == 0.0)
+  {
+    dst = 0.0;
+    return;
+  }
+
+  // finite difference approximation of the derivative of the viscous operator in direction src
+  double const epsilon = std::sqrt(std::numeric_limits<Number>::epsilon()) *
+                         (1.0 + norm_solution_linearization) / norm_src;
+
+  temp_all = solution_linearization_viscous;
+  temp_all.add(epsilon, src);
+  viscous_operator.evaluate(dst, temp_all, time_viscous);
+  dst.add(-1.0, viscous_term_linearization);
+  dst *= 1.0 / epsilon;
+
+  // mass operator
+  temp_all.equ(1.0 / scaling_factor_viscous, src);
+  mass_operator.apply_add(dst, temp_all);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::update_block_preconditioner_viscous()
+{
+  double const scaling_factor_mass = 1.0 / scaling_factor_viscous;
+
+  // The multigrid preconditioners only depend on the time step size via the scaling factor of the
+  // mass operator. Updating them (smoothers, coarse-grid solver) is expensive and only done if this
+  // scaling factor changes.
+  if(helmholtz_operator_momentum->get_scaling_factor_mass_operator() != scaling_factor_mass)
+  {
+    helmholtz_operator_momentum->set_scaling_factor_mass_operator(scaling_factor_mass);
+    helmholtz_operator_energy->set_scaling_factor_mass_operator(scaling_factor_mass);
+
+    multigrid_momentum->update();
+    multigrid_energy->update();
+  }
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::apply_block_preconditioner_viscous(VectorType &       dst,
+                                                          VectorType const & src) const
+{
+  // The continuity equation does not contain a viscous term, i.e., the density block is the
+  // scaled mass matrix.
+  extract_component(temp_scalar_src, src, 0);
+  inverse_mass_scalar.apply(temp_scalar_dst, temp_scalar_src);
+  temp_scalar_dst *= scaling_factor_viscous;
+  insert_component(dst, temp_scalar_dst, 0);
+
+  // momentum equation: one Helmholtz-type problem per velocity component
+  for(unsigned int d = 0; d < dim; ++d)
+  {
+    extract_component(temp_scalar_src, src, 1 + d);
+    multigrid_momentum->vmult(temp_scalar_dst, temp_scalar_src);
+    insert_component(dst, temp_scalar_dst, 1 + d);
+  }
+
+  // energy equation
+  extract_component(temp_scalar_src, src, dim + 1);
+  multigrid_energy->vmult(temp_scalar_dst, temp_scalar_src);
+  insert_component(dst, temp_scalar_dst, dim + 1);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::apply_inverse_mass(VectorType & dst, VectorType const & src) const
@@ -506,6 +882,25 @@ Operator<dim, Number>::get_quad_index_l2_projections() const
   return matrix_free_data->get_quad_index(field + quad_index_l2_projections);
 }
 
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::get_quad_index_collocation() const
+{
+  return matrix_free_data->get_quad_index(field + quad_index_collocation);
+}
+
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::get_quad_index_mass() const
+{
+  // The summation-by-parts property of the split form requires the mass matrix to be evaluated
+  // with the Gauss-Lobatto quadrature, i.e., the diagonal (lumped) mass matrix.
+  if(param.convective_formulation == ConvectiveFormulation::EntropyStableSplitForm)
+    return get_quad_index_collocation();
+  else
+    return get_quad_index_standard();
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::compute_pressure(VectorType & dst, VectorType const & src) const
@@ -554,6 +949,47 @@ Operator<dim, Number>::compute_shear_rate(VectorType & dst, VectorType const & s
   inverse_mass_scalar.apply(dst, dst);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::compute_derived_variables(DerivedVariables<VectorType> const & dst,
+                                                 VectorType const &                   src) const
+{
+  // The single-loop implementation realizes the L2-projections in the same way as the matrix-free
+  // inverse mass operator, see the restrictions of InverseMassType::MatrixfreeOperator.
+  if(param.inverse_mass_operator.implementation_type == InverseMassType::MatrixfreeOperator and
+     get_quad_index_l2_projections() == get_quad_index_standard())
+  {
+    p_u_T_calculator.compute_derived_variables(dst, src);
+  }
+  else
+  {
+    if(dst.pressure != nullptr)
+      compute_pressure(*dst.pressure, src);
+
+    if(dst.temperature != nullptr)
+      compute_temperature(*dst.temperature, src);
+
+    if(dst.velocity != nullptr or dst.needs_velocity_gradient())
+    {
+      VectorType velocity_temp;
+      if(dst.velocity == nullptr)
+        initialize_dof_vector_dim_components(velocity_temp);
+      VectorType & velocity = (dst.velocity != nullptr) ? *dst.velocity : velocity_temp;
+
+      compute_velocity(velocity, src);
+
+      if(dst.vorticity != nullptr)
+        compute_vorticity(*dst.vorticity, velocity);
+
+      if(dst.divergence != nullptr)
+        compute_divergence(*dst.divergence, velocity);
+
+      if(dst.shear_rate != nullptr)
+        compute_shear_rate(*dst.shear_rate, velocity);
+    }
+  }
+}
+
 template<int dim, typename Number>
 double
 Operator<dim, Number>::get_wall_time_operator_evaluation() const
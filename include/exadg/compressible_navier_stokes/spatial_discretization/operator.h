@@ -34,15 +34,156 @@
 #include <exadg/compressible_navier_stokes/user_interface/boundary_descriptor.h>
 #include <exadg/compressible_navier_stokes/user_interface/field_functions.h>
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
+#include <exadg/convection_diffusion/preconditioners/multigrid_preconditioner.h>
+#include <exadg/convection_diffusion/spatial_discretization/operators/combined_operator.h>
 #include <exadg/grid/grid.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/navier_stokes_calculators.h>
+#include <exadg/solvers_and_preconditioners/newton/newton_solver.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
 
 namespace ExaDG
 {
 namespace CompNS
 {
+// forward declaration
+template<int dim, typename Number>
+class Operator;
+
+/*
+ * Nonlinear operator of the stage equations of IMEX Runge-Kutta methods with implicit treatment
+ * of the viscous term, see Operator::evaluate_nonlinear_residual_viscous().
+ */
+template<int dim, typename Number>
+class NonlinearOperatorViscous
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef Operator<dim, Number> PDEOperator;
+
+public:
+  NonlinearOperatorViscous()
+    : pde_operator(nullptr), rhs_vector(nullptr), time(0.0), scaling_factor(1.0)
+  {
+  }
+
+  void
+  initialize(PDEOperator const & pde_operator)
+  {
+    this->pde_operator = &pde_operator;
+  }
+
+  void
+  update(VectorType const & rhs_vector, double const & time, double const & scaling_factor)
+  {
+    this->rhs_vector     = &rhs_vector;
+    this->time           = time;
+    this->scaling_factor = scaling_factor;
+  }
+
+  /*
+   * The implementation of the Newton solver requires a function called
+   * 'evaluate_residual'.
+   */
+  void
+  evaluate_residual(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->evaluate_nonlinear_residual_viscous(dst, src, *rhs_vector, time, scaling_factor);
+  }
+
+private:
+  PDEOperator const * pde_operator;
+
+  VectorType const * rhs_vector;
+  double             time;
+  double             scaling_factor;
+};
+
+/*
+ * Linearized operator of the stage equations of IMEX Runge-Kutta methods, see
+ * Operator::apply_linearized_viscous_problem().
+ */
+template<int dim, typename Number>
+class LinearOperatorViscous : public dealii::Subscriptor
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef Operator<dim, Number> PDEOperator;
+
+public:
+  LinearOperatorViscous() : dealii::Subscriptor(), pde_operator(nullptr)
+  {
+  }
+
+  void
+  initialize(PDEOperator const & pde_operator)
+  {
+    this->pde_operator = &pde_operator;
+  }
+
+  /*
+   * The implementation of the Newton solver requires a function called
+   * 'set_solution_linearization'.
+   */
+  void
+  set_solution_linearization(VectorType const & solution_linearization) const
+  {
+    pde_operator->set_solution_linearization_viscous(solution_linearization);
+  }
+
+  /*
+   * The implementation of linear solvers in deal.ii requires that a function called 'vmult' is
+   * provided.
+   */
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->apply_linearized_viscous_problem(dst, src);
+  }
+
+private:
+  PDEOperator const * pde_operator;
+};
+
+/*
+ * Block-diagonal preconditioner for the linearized viscous problem, see
+ * Operator::apply_block_preconditioner_viscous().
+ */
+template<int dim, typename Number>
+class BlockPreconditionerViscous : public PreconditionerBase<Number>
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef Operator<dim, Number> PDEOperator;
+
+public:
+  BlockPreconditionerViscous(PDEOperator & pde_operator_in) : pde_operator(&pde_operator_in)
+  {
+  }
+
+  void
+  update() final
+  {
+    pde_operator->update_block_preconditioner_viscous();
+
+    this->update_needed = false;
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const final
+  {
+    pde_operator->apply_block_preconditioner_viscous(dst, src);
+  }
+
+private:
+  PDEOperator * pde_operator;
+};
+
 template<int dim, typename Number>
 class Operator : public dealii::Subscriptor, public Interface::Operator<Number>
 {
@@ -50,13 +191,14 @@ private:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
 public:
-  Operator(std::shared_ptr<Grid<dim> const>               grid,
-           std::shared_ptr<dealii::Mapping<dim> const>    mapping,
-           std::shared_ptr<BoundaryDescriptor<dim> const> boundary_descriptor,
-           std::shared_ptr<FieldFunctions<dim> const>     field_functions,
-           Parameters const &                             param,
-           std::string const &                            field,
-           MPI_Comm const &                               mpi_comm);
+  Operator(std::shared_ptr<Grid<dim> const>                      grid,
+           std::shared_ptr<dealii::Mapping<dim> const>           mapping,
+           std::shared_ptr<MultigridMappings<dim, Number>> const multigrid_mappings,
+           std::shared_ptr<BoundaryDescriptor<dim> const>        boundary_descriptor,
+           std::shared_ptr<FieldFunctions<dim> const>            field_functions,
+           Parameters const &                                    param,
+           std::string const &                                   field,
+           MPI_Comm const &                                      mpi_comm);
 
   void
   fill_matrix_free_data(MatrixFreeData<dim, Number> & matrix_free_data) const;
@@ -114,6 +256,57 @@ public:
                                   VectorType const & src,
                                   Number const       time) const;
 
+  /*
+   *  IMEX time integration: the convective term and the body force are treated explicitly, the
+   *  viscous term implicitly. The functions evaluate these terms on the right-hand side of the
+   *  equations, i.e., including the inverse mass operator.
+   */
+  void
+  evaluate_explicit_terms(VectorType & dst, VectorType const & src, Number const time) const final;
+
+  void
+  evaluate_implicit_terms(VectorType & dst, VectorType const & src, Number const time) const final;
+
+  /*
+   *  Solves the nonlinear stage equation dst - scaling_factor * M^{-1} (- V(dst)) = rhs of IMEX
+   *  Runge-Kutta methods with the viscous operator V by a Newton-Krylov method. The vector dst
+   *  contains the initial guess.
+   */
+  std::tuple<unsigned int, unsigned int>
+  solve_implicit_terms(VectorType &       dst,
+                       VectorType const & rhs,
+                       Number const       time,
+                       Number const       scaling_factor) final;
+
+  /*
+   *  Nonlinear residual of the stage equation, multiplied by M / scaling_factor:
+   *
+   *    (1 / scaling_factor) * M * (src - rhs) + V(src)
+   */
+  void
+  evaluate_nonlinear_residual_viscous(VectorType &       dst,
+                                      VectorType const & src,
+                                      VectorType const & rhs,
+                                      double const       time,
+                                      double const       scaling_factor) const;
+
+  /*
+   *  The derivative of the viscous operator is approximated by finite differences (Jacobian-free
+   *  Newton-Krylov method), which requires the linearization point and the viscous term
+   *  evaluated at the linearization point.
+   */
+  void
+  set_solution_linearization_viscous(VectorType const & solution_linearization) const;
+
+  void
+  apply_linearized_viscous_problem(VectorType & dst, VectorType const & src) const;
+
+  void
+  update_block_preconditioner_viscous();
+
+  void
+  apply_block_preconditioner_viscous(VectorType & dst, VectorType const & src) const;
+
   void
   apply_inverse_mass(VectorType & dst, VectorType const & src) const;
 
@@ -169,6 +362,10 @@ public:
   void
   compute_shear_rate(VectorType & dst, VectorType const & src) const;
 
+  // computes all requested derived variables, if possible in a single loop over the solution
+  void
+  compute_derived_variables(DerivedVariables<VectorType> const & dst, VectorType const & src) const;
+
   double
   get_wall_time_operator_evaluation() const final;
 
@@ -199,6 +396,31 @@ private:
   unsigned int
   get_quad_index_l2_projections() const;
 
+  unsigned int
+  get_quad_index_collocation() const;
+
+  // quadrature used for the mass operator and the inverse mass operator
+  unsigned int
+  get_quad_index_mass() const;
+
+  void
+  setup_solver_viscous();
+
+  std::shared_ptr<ConvDiff::CombinedOperator<dim, Number>>
+  create_helmholtz_operator(BoundaryDescriptorStd<dim> const & boundary_descriptor_std,
+                            double const                       diffusivity) const;
+
+  std::shared_ptr<PreconditionerBase<Number>>
+  create_multigrid_preconditioner(
+    ConvDiff::CombinedOperator<dim, Number> const & helmholtz_operator) const;
+
+  // copies one component of a vector with all (dim+2) components to a scalar vector and vice versa
+  void
+  extract_component(VectorType & dst, VectorType const & src, unsigned int const component) const;
+
+  void
+  insert_component(VectorType & dst, VectorType const & src, unsigned int const component) const;
+
   /*
    * Grid
    */
@@ -209,6 +431,8 @@ private:
    */
   std::shared_ptr<dealii::Mapping<dim> const> mapping;
 
+  std::shared_ptr<MultigridMappings<dim, Number>> const multigrid_mappings;
+
   /*
    * User interface: Boundary conditions and field functions.
    */
@@ -242,6 +466,7 @@ private:
   std::string const quad_index_standard             = "standard";
   std::string const quad_index_overintegration_conv = "overintegration_conv";
   std::string const quad_index_overintegration_vis  = "overintegration_vis";
+  std::string const quad_index_collocation          = "collocation";
 
   std::string const quad_index_l2_projections = quad_index_standard;
   // alternative: use more accurate over-integration strategy
@@ -281,6 +506,37 @@ private:
   DivergenceCalculator<dim, Number> divergence_calculator;
   ShearRateCalculator<dim, Number>  shear_rate_calculator;
 
+  /*
+   * Implicit treatment of the viscous term (IMEX Runge-Kutta methods).
+   */
+  NonlinearOperatorViscous<dim, Number> nonlinear_operator_viscous;
+
+  std::shared_ptr<Newton::Solver<VectorType,
+                                 NonlinearOperatorViscous<dim, Number>,
+                                 LinearOperatorViscous<dim, Number>,
+                                 Krylov::SolverBase<VectorType>>>
+    newton_solver_viscous;
+
+  LinearOperatorViscous<dim, Number> linear_operator_viscous;
+
+  std::shared_ptr<Krylov::SolverBase<VectorType>> linear_solver_viscous;
+
+  std::shared_ptr<PreconditionerBase<Number>> preconditioner_viscous;
+
+  // scalar Helmholtz-type operators and multigrid preconditioners of the momentum and energy
+  // blocks of the block preconditioner
+  std::shared_ptr<ConvDiff::CombinedOperator<dim, Number>> helmholtz_operator_momentum,
+    helmholtz_operator_energy;
+  std::shared_ptr<PreconditionerBase<Number>> multigrid_momentum, multigrid_energy;
+
+  // time and scaling factor of the current stage equation
+  double time_viscous, scaling_factor_viscous;
+
+  // linearization point, viscous term at the linearization point, and temporary vectors
+  VectorType mutable solution_linearization_viscous, viscous_term_linearization;
+  VectorType mutable temp_all, temp_scalar_src, temp_scalar_dst;
+  double mutable norm_solution_linearization;
+
   /*
    * MPI
    */
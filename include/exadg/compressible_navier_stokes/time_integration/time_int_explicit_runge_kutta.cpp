@@ -98,6 +98,11 @@ TimeIntExplRK<Number>::initialize_time_integrator()
                                                                        param.order_time_integrator,
                                                                        param.stages);
   }
+  else if(this->param.temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    rk_time_integrator = std::make_shared<IMEXRungeKuttaTimeIntegrator<Operator, VectorType>>(
+      param.order_time_integrator, pde_operator);
+  }
 }
 
 /*
@@ -248,8 +253,26 @@ TimeIntExplRK<Number>::do_timestep_solve()
 
   if(print_solver_info() and not(this->is_test))
   {
-    this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
-    print_wall_time(this->pcout, timer.wall_time());
+    std::shared_ptr<IMEXRungeKuttaTimeIntegrator<Operator, VectorType>> imex_time_integrator =
+      std::dynamic_pointer_cast<IMEXRungeKuttaTimeIntegrator<Operator, VectorType>>(
+        rk_time_integrator);
+
+    if(imex_time_integrator.get())
+    {
+      auto const iterations = imex_time_integrator->get_iterations();
+
+      this->pcout << std::endl
+                  << "Solve compressible Navier-Stokes equations (implicit viscous term):";
+      print_solver_info_nonlinear(this->pcout,
+                                  std::get<0>(iterations),
+                                  std::get<1>(iterations),
+                                  timer.wall_time());
+    }
+    else
+    {
+      this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
+      print_wall_time(this->pcout, timer.wall_time());
+    }
   }
 
   this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
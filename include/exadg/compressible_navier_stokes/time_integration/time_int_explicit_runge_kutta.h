@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/imex_runge_kutta.h>
 #include <exadg/time_integration/ssp_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
@@ -75,6 +75,10 @@ enum class EnergyBoundaryVariable
  *  Temporal discretization method:
  *
  *    Explicit Runge-Kutta methods
+ *
+ *    IMEXRK: implicit-explicit Runge-Kutta methods of Ascher, Ruuth, Spiteri (ARS) treating the
+ *            viscous term implicitly and the convective term (and the body force) explicitly,
+ *            so that the time step size is restricted by the CFL condition only
  */
 enum class TemporalDiscretization
 {
@@ -86,7 +90,8 @@ enum class TemporalDiscretization
   ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
   ExplRK4Stage5Reg3C,
   ExplRK5Stage9Reg2S,
-  SSPRK // specify order and stages of time integration scheme
+  SSPRK, // specify order and stages of time integration scheme
+  IMEXRK // specify order of time integration scheme (order = 2, 3)
 };
 
 /*
@@ -117,6 +122,24 @@ enum class QuadratureRule
   Overintegration2k
 };
 
+/*
+ *  Formulation of the convective term
+ *
+ *    Standard: weak form with Lax-Friedrichs flux, integrated with the quadrature rule specified
+ *              by n_q_points_convective (over-integration for under-resolved flows)
+ *
+ *    EntropyStableSplitForm: flux-differencing (split) form with the entropy conservative and
+ *              kinetic energy preserving two-point flux by Ranocha on Gauss-Lobatto points
+ *              collocated with the nodes of the shape functions, and an entropy stable numerical
+ *              flux (entropy conservative flux plus Lax-Friedrichs dissipation) on faces. This
+ *              formulation is robust for under-resolved flows without over-integration.
+ */
+enum class ConvectiveFormulation
+{
+  Standard,
+  EntropyStableSplitForm
+};
+
 
 /**************************************************************************************/
 /*                                                                                    */
@@ -124,6 +147,19 @@ enum class QuadratureRule
 /*                                                                                    */
 /**************************************************************************************/
 
+/*
+ *  Preconditioner for the linearized viscous problem of IMEX Runge-Kutta methods
+ *
+ *    Multigrid: the density block is the mass matrix, and the momentum and energy blocks are
+ *               approximated by scalar Helmholtz-type operators (mass matrix plus constant-
+ *               coefficient SIPG Laplace operator) and inverted by multigrid V-cycles
+ */
+enum class PreconditionerViscous
+{
+  None,
+  InverseMassMatrix,
+  Multigrid
+};
 
 
 /**************************************************************************************/
@@ -71,10 +71,17 @@ Parameters::Parameters()
     degree(1),
     n_q_points_convective(QuadratureRule::Standard),
     n_q_points_viscous(QuadratureRule::Standard),
+    convective_formulation(ConvectiveFormulation::Standard),
 
     // viscous term
     IP_factor(1.0),
 
+    // SOLVER
+    newton_solver_data_viscous(Newton::SolverData(1e2, 1.e-12, 1.e-6)),
+    solver_data_viscous(SolverData(1e4, 1.e-12, 1.e-6, 100)),
+    preconditioner_viscous(PreconditionerViscous::InverseMassMatrix),
+    multigrid_data_viscous(MultigridData()),
+
     // NUMERICAL PARAMETERS
     detect_instabilities(true),
     use_combined_operator(false)
@@ -114,6 +121,24 @@ Parameters::check() const
     AssertThrow(stages >= 1, dealii::ExcMessage("Specify number of RK stages!"));
   }
 
+  if(temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    AssertThrow(order_time_integrator >= 2 and order_time_integrator <= 3,
+                dealii::ExcMessage("Specified order of time integrator IMEXRK not implemented!"));
+
+    AssertThrow(equation_type == EquationType::NavierStokes,
+                dealii::ExcMessage("IMEX Runge-Kutta methods require a viscous term."));
+
+    AssertThrow(calculation_of_time_step_size != TimeStepCalculation::Diffusion and
+                  calculation_of_time_step_size != TimeStepCalculation::CFLAndDiffusion,
+                dealii::ExcMessage("The viscous term is treated implicitly and does not restrict "
+                                   "the time step size of IMEX Runge-Kutta methods."));
+
+    AssertThrow(not use_combined_operator,
+                dealii::ExcMessage("IMEX Runge-Kutta methods evaluate the convective and viscous "
+                                   "terms separately. Deactivate the combined operator."));
+  }
+
   if(calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     AssertThrow(max_velocity >= 0.0, dealii::ExcMessage("Invalid parameter max_velocity."));
@@ -135,9 +160,43 @@ Parameters::check() const
         "For the combined operator, both convective and viscous terms have to be integrated with the same number of quadrature points."));
   }
 
+  if(convective_formulation == ConvectiveFormulation::EntropyStableSplitForm)
+  {
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("The split form of the convective term requires hypercube "
+                                   "elements (tensor-product Gauss-Lobatto points)."));
+
+    AssertThrow(n_q_points_convective == QuadratureRule::Standard,
+                dealii::ExcMessage("The split form of the convective term is evaluated on the "
+                                   "Gauss-Lobatto points collocated with the nodes. Use "
+                                   "QuadratureRule::Standard for n_q_points_convective."));
+
+    AssertThrow(not use_combined_operator,
+                dealii::ExcMessage("The combined operator is not implemented for the split form "
+                                   "of the convective term."));
+  }
+
+  // SOLVER
+  if(involves_h_multigrid())
+  {
+    AssertThrow(grid.create_coarse_triangulations,
+                dealii::ExcMessage("Multigrid with h-transfer requires coarse triangulations."));
+  }
+
   // NUMERICAL PARAMETERS
 }
 
+bool
+Parameters::involves_h_multigrid() const
+{
+  if(temporal_discretization == TemporalDiscretization::IMEXRK and
+     preconditioner_viscous == PreconditionerViscous::Multigrid and
+     multigrid_data_viscous.involves_h_transfer())
+    return true;
+  else
+    return false;
+}
+
 
 void
 Parameters::print(dealii::ConditionalOStream const & pcout, std::string const & name) const
@@ -157,7 +216,7 @@ Parameters::print(dealii::ConditionalOStream const & pcout, std::string const &
   print_parameters_spatial_discretization(pcout);
 
   // SOLVER
-  // If a system of equations has to be solved (currently not used)
+  // If a system of equations has to be solved (IMEX Runge-Kutta methods)
   print_parameters_solver(pcout);
 
   // NUMERICAL PARAMETERS
@@ -206,6 +265,11 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Number of stages", stages);
   }
 
+  if(temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    print_parameter(pcout, "Order of time integrator", order_time_integrator);
+  }
+
   print_parameter(pcout, "Calculation of time step size", calculation_of_time_step_size);
 
   // maximum number of time steps
@@ -236,6 +300,7 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
 
   print_parameter(pcout, "Polynomial degree", degree);
 
+  print_parameter(pcout, "Formulation convective term", convective_formulation);
   print_parameter(pcout, "Quadrature rule convective term", n_q_points_convective);
   print_parameter(pcout, "Quadrature rule viscous term", n_q_points_viscous);
 
@@ -243,12 +308,26 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
 }
 
 void
-Parameters::print_parameters_solver(dealii::ConditionalOStream const & /*pcout*/) const
+Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) const
 {
-  /*
-  pcout << std::endl
-        << "Solver:" << std::endl;
-  */
+  if(temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    pcout << std::endl << "Solver:" << std::endl;
+
+    pcout << std::endl << "  Viscous step:" << std::endl;
+
+    pcout << "  Newton solver:" << std::endl;
+    newton_solver_data_viscous.print(pcout);
+
+    pcout << std::endl << "  Linear solver:" << std::endl;
+    print_parameter(pcout, "Solver", "GMRES");
+    solver_data_viscous.print(pcout);
+
+    print_parameter(pcout, "Preconditioner", preconditioner_viscous);
+
+    if(preconditioner_viscous == PreconditionerViscous::Multigrid)
+      multigrid_data_viscous.print(pcout);
+  }
 }
 
 void
@@ -24,6 +24,9 @@
 #include <exadg/compressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/grid/grid_data.h>
 #include <exadg/operators/inverse_mass_parameters.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
+#include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 #include <exadg/utilities/print_functions.h>
@@ -44,6 +47,9 @@ public:
   void
   print(dealii::ConditionalOStream const & pcout, std::string const & name) const;
 
+  bool
+  involves_h_multigrid() const;
+
 private:
   void
   print_parameters_mathematical_model(dealii::ConditionalOStream const & pcout) const;
@@ -178,10 +184,35 @@ public:
 
   QuadratureRule n_q_points_convective, n_q_points_viscous;
 
+  // formulation of the convective term (standard weak form or entropy stable split form)
+  ConvectiveFormulation convective_formulation;
+
   // diffusive term: Symmetric interior penalty Galerkin (SIPG) discretization
   // interior penalty parameter scaling factor: default value is 1.0
   double IP_factor;
 
+  /**************************************************************************************/
+  /*                                                                                    */
+  /*                                       SOLVER                                       */
+  /*                                                                                    */
+  /**************************************************************************************/
+
+  // The following parameters are only relevant for IMEX Runge-Kutta methods, which solve a
+  // nonlinear system of equations for the viscous term in every stage. The Newton solver uses
+  // GMRES to solve the linearized problems.
+
+  // Newton solver
+  Newton::SolverData newton_solver_data_viscous;
+
+  // linear solver
+  SolverData solver_data_viscous;
+
+  // description: see enum declaration
+  PreconditionerViscous preconditioner_viscous;
+
+  // multigrid data of the momentum and energy blocks
+  MultigridData multigrid_data_viscous;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                NUMERICAL PARAMETERS                                */
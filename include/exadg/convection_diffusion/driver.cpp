@@ -27,6 +27,7 @@
 // ExaDG
 #include <exadg/convection_diffusion/driver.h>
 #include <exadg/convection_diffusion/time_integration/create_time_integrator.h>
+#include <exadg/operators/error_indicators.h>
 #include <exadg/operators/throughput_parameters.h>
 #include <exadg/utilities/print_solver_results.h>
 
@@ -134,7 +135,18 @@ Driver<dim, Number>::setup()
     }
   }
 
+  if(application->get_parameters().enable_adaptivity and
+     application->get_parameters().amr_data.cell_cost_model.use_cell_weights)
+  {
+    cell_cost_model =
+      std::make_shared<CellCostModel<dim>>(application->get_parameters().amr_data.cell_cost_model);
+    cell_cost_model->attach(*grid->triangulation);
+  }
+
   timer_tree.insert({"Convection-diffusion", "Setup"}, timer.wall_time());
+
+  if(cell_cost_model.get() and not is_throughput_study)
+    measure_load_imbalance();
 }
 
 template<int dim, typename Number>
@@ -156,14 +168,27 @@ void
 Driver<dim, Number>::mark_cells_coarsening_and_refinement(dealii::Triangulation<dim> & tria,
                                                           VectorType const & solution) const
 {
-  mark_cells_kelly_error_estimator(tria,
-                                   pde_operator->get_dof_handler(),
-                                   pde_operator->get_constraints(),
-                                   *pde_operator->get_mapping(),
-                                   solution,
-                                   application->get_parameters().degree +
-                                     1 /* n_face_quadrature_points */,
-                                   application->get_parameters().amr_data);
+  if(application->get_parameters().amr_data.error_indicator == ErrorIndicator::Kelly)
+  {
+    mark_cells_kelly_error_estimator(tria,
+                                     pde_operator->get_dof_handler(),
+                                     pde_operator->get_constraints(),
+                                     *pde_operator->get_mapping(),
+                                     solution,
+                                     application->get_parameters().degree +
+                                       1 /* n_face_quadrature_points */,
+                                     application->get_parameters().amr_data);
+  }
+  else
+  {
+    mark_cells_matrix_free_error_indicator<dim, 1, Number>(tria,
+                                                           pde_operator->get_matrix_free(),
+                                                           pde_operator->get_constraints(),
+                                                           pde_operator->get_dof_index(),
+                                                           pde_operator->get_quad_index(),
+                                                           solution,
+                                                           application->get_parameters().amr_data);
+  }
 }
 
 template<int dim, typename Number>
@@ -195,6 +220,8 @@ Driver<dim, Number>::do_adaptive_refinement()
 
   if(any_cells_flagged_for_coarsening_or_refinement(*grid->triangulation))
   {
+    dealii::Timer timer;
+
     grid->triangulation->prepare_coarsening_and_refinement();
 
     if(application->get_parameters().problem_type == ProblemType::Unsteady)
@@ -229,9 +256,40 @@ Driver<dim, Number>::do_adaptive_refinement()
     {
       AssertThrow(false, dealii::ExcNotImplemented());
     }
+
+    timer_tree.insert({"Convection-diffusion", "Adaptive mesh refinement"}, timer.wall_time());
+
+    if(cell_cost_model.get())
+      measure_load_imbalance();
   }
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::measure_load_imbalance()
+{
+  double const local_work =
+    cell_cost_model->template measure<1, Number>(pde_operator->get_matrix_free(),
+                                                 pde_operator->get_dof_index(),
+                                                 pde_operator->get_quad_index());
+
+  dealii::Utilities::MPI::MinMaxAvg const work =
+    dealii::Utilities::MPI::min_max_avg(local_work, mpi_comm);
+
+  // The timer tree prints averages over all processes. The average of the idle time (max - local)
+  // is the time lost per loop due to load imbalance.
+  timer_tree.insert({"Convection-diffusion", "Load balance", "Local work per loop"}, local_work);
+  timer_tree.insert({"Convection-diffusion", "Load balance", "Idle time per loop"},
+                    work.max - local_work);
+
+  pcout << std::endl << "Load balance after adaptive mesh refinement:" << std::endl;
+  print_parameter(pcout, "Local work per loop (min)", work.min);
+  print_parameter(pcout, "Local work per loop (max)", work.max);
+  print_parameter(pcout, "Load imbalance (max / avg)", work.avg > 0.0 ? work.max / work.avg : 1.0);
+  print_parameter(pcout, "Cost per boundary face", cell_cost_model->get_cost_boundary_face());
+  print_parameter(pcout, "Cost per hanging face", cell_cost_model->get_cost_hanging_face());
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve()
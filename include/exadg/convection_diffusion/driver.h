@@ -46,6 +46,7 @@
 #include <exadg/grid/mapping_deformation_function.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/adaptive_mesh_refinement.h>
+#include <exadg/operators/cell_cost_model.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
 
@@ -103,6 +104,13 @@ private:
   void
   do_adaptive_refinement();
 
+  /*
+   * Measures the local work of all processes in matrix-free loops, which also calibrates the cell
+   * cost model, and reports the load imbalance.
+   */
+  void
+  measure_load_imbalance();
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
@@ -141,6 +149,9 @@ private:
 
   std::shared_ptr<DriverSteadyProblems<Number>> driver_steady;
 
+  // cell weights for load balancing after adaptive mesh refinement
+  std::shared_ptr<CellCostModel<dim>> cell_cost_model;
+
   // Computation time (wall clock time)
   mutable TimerTree timer_tree;
 };
@@ -22,6 +22,13 @@
 #ifndef INCLUDE_EXADG_CONVECTION_DIFFUSION_SPATIAL_DISCRETIZATION_INTERFACE_H_
 #define INCLUDE_EXADG_CONVECTION_DIFFUSION_SPATIAL_DISCRETIZATION_INTERFACE_H_
 
+// C/C++
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -105,6 +112,73 @@ public:
 };
 } // namespace Interface
 
+/*
+ * Transport velocity interpolated in time that is shared by several convection-diffusion operators
+ * transported by the same velocity field, e.g., several passive scalars. The velocity is
+ * interpolated only once per evaluation time instead of once per operator. The interpolated
+ * velocities remain valid until different velocities or times are set.
+ */
+template<typename Number>
+class SharedTransportVelocity
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  SharedTransportVelocity() : n_valid(0)
+  {
+  }
+
+  void
+  set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
+                           std::vector<double> const &             times_in)
+  {
+    if(velocities_in != velocities or times_in != times)
+    {
+      velocities = velocities_in;
+      times      = times_in;
+      n_valid    = 0;
+    }
+  }
+
+  /*
+   * Returns the velocity interpolated at @param evaluation_time. The vector @param layout defines
+   * the parallel layout of the interpolated velocity.
+   */
+  VectorType const &
+  get_velocity(double const evaluation_time, VectorType const & layout) const
+  {
+    for(unsigned int i = 0; i < n_valid; ++i)
+    {
+      if(std::abs(interpolated[i].first - evaluation_time) <= 1.e-12 * std::abs(evaluation_time))
+        return interpolated[i].second;
+    }
+
+    if(n_valid == interpolated.size())
+    {
+      interpolated.emplace_back();
+      interpolated.back().second.reinit(layout, true /* omit_zeroing_entries */);
+    }
+
+    std::pair<double, VectorType> & entry = interpolated[n_valid++];
+
+    entry.first = evaluation_time;
+    entry.second.zero_out_ghost_values();
+    interpolate(entry.second, evaluation_time, velocities, times);
+    entry.second.update_ghost_values();
+
+    return entry.second;
+  }
+
+private:
+  std::vector<VectorType const *> velocities;
+  std::vector<double>             times;
+
+  // storage is reused once the velocities and times change (a deque does not invalidate references
+  // to existing elements when growing)
+  mutable std::deque<std::pair<double, VectorType>> interpolated;
+  mutable unsigned int                              n_valid;
+};
+
 template<typename Number>
 class OperatorExplRK
 {
@@ -125,12 +199,32 @@ public:
   {
     velocities = velocities_in;
     times      = times_in;
+
+    if(shared_velocity)
+      shared_velocity->set_velocities_and_times(velocities, times);
+  }
+
+  /*
+   * Use a transport velocity that is interpolated once for all operators sharing it.
+   */
+  void
+  set_shared_transport_velocity(std::shared_ptr<SharedTransportVelocity<Number>> shared_velocity_in)
+  {
+    shared_velocity = shared_velocity_in;
   }
 
   void
   evaluate(VectorType & dst, VectorType const & src, double const evaluation_time) const
   {
-    if(numerical_velocity_field)
+    if(numerical_velocity_field and shared_velocity)
+    {
+      pde_operator->evaluate_explicit_time_int(
+        dst,
+        src,
+        evaluation_time,
+        &shared_velocity->get_velocity(evaluation_time, velocity_interpolated));
+    }
+    else if(numerical_velocity_field)
     {
       interpolate(velocity_interpolated, evaluation_time, velocities, times);
 
@@ -161,6 +255,8 @@ private:
   std::vector<VectorType const *> velocities;
   std::vector<double>             times;
   VectorType mutable velocity_interpolated;
+
+  std::shared_ptr<SharedTransportVelocity<Number>> shared_velocity;
 };
 
 } // namespace ConvDiff
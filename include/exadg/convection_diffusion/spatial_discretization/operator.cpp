@@ -28,6 +28,7 @@
 #include <exadg/convection_diffusion/spatial_discretization/project_velocity.h>
 #include <exadg/functions_and_boundary_conditions/interpolate.h>
 #include <exadg/grid/mapping_dof_vector.h>
+#include <exadg/operators/error_indicators.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/grid_related_time_step_restrictions.h>
 #include <exadg/operators/quadrature.h>
@@ -132,6 +133,12 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   flags_cfl.cells = dealii::update_quadrature_points;
   matrix_free_data.append_mapping_flags(flags_cfl);
 
+  // mapping flags required for the matrix-free face-jump error indicator
+  if(param.enable_adaptivity and param.amr_data.error_indicator == ErrorIndicator::FaceJump)
+  {
+    matrix_free_data.append_mapping_flags(get_mapping_flags_face_jump_indicator());
+  }
+
   // dealii::DoFHandler, dealii::AffineConstraints
   matrix_free_data.insert_dof_handler(&dof_handler, get_dof_name());
   matrix_free_data.insert_constraint(&affine_constraints, get_dof_name());
@@ -426,9 +433,15 @@ Operator<dim, Number>::setup_preconditioner()
 
     typedef MultigridPreconditioner<dim, Number> Multigrid;
 
-    preconditioner = std::make_shared<Multigrid>(this->mpi_comm);
+    // After adaptive mesh refinement, the existing multigrid preconditioner is initialized again,
+    // which keeps the data structures of the levels not affected by the refinement.
     std::shared_ptr<Multigrid> mg_preconditioner =
       std::dynamic_pointer_cast<Multigrid>(preconditioner);
+    if(not mg_preconditioner.get())
+    {
+      mg_preconditioner = std::make_shared<Multigrid>(this->mpi_comm);
+      preconditioner    = mg_preconditioner;
+    }
 
     if(param.mg_operator_type == MultigridOperatorType::ReactionConvection or
        param.mg_operator_type == MultigridOperatorType::ReactionConvectionDiffusion)
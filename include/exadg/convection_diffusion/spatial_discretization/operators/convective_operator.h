@@ -26,6 +26,7 @@
 #include <exadg/convection_diffusion/user_interface/parameters.h>
 #include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/matrix_free/thread_local_data.h>
 #include <exadg/operators/operator_base.h>
 
 #include <memory>
@@ -89,18 +90,10 @@ public:
 
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity =
-        std::make_shared<CellIntegratorVelocity>(matrix_free, data.dof_index_velocity, quad_index);
-
-      integrator_velocity_m = std::make_shared<FaceIntegratorVelocity>(matrix_free,
-                                                                       true,
-                                                                       data.dof_index_velocity,
-                                                                       quad_index);
-
-      integrator_velocity_p = std::make_shared<FaceIntegratorVelocity>(matrix_free,
-                                                                       false,
-                                                                       data.dof_index_velocity,
-                                                                       quad_index);
+      unsigned int const dof_index = data.dof_index_velocity;
+      integrators_velocity.initialize([&matrix_free, dof_index, quad_index]() {
+        return std::make_shared<IntegratorsVelocity>(matrix_free, dof_index, quad_index);
+      });
 
       if(use_own_velocity_storage)
       {
@@ -184,8 +177,9 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity->reinit(cell);
-      integrator_velocity->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      CellIntegratorVelocity & integrator = integrators_velocity.get().cell;
+      integrator.reinit(cell);
+      integrator.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
     }
   }
 
@@ -194,11 +188,13 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity_m->reinit(face);
-      integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      IntegratorsVelocity & integrators = integrators_velocity.get();
+
+      integrators.face_m.reinit(face);
+      integrators.face_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
 
-      integrator_velocity_p->reinit(face);
-      integrator_velocity_p->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      integrators.face_p.reinit(face);
+      integrators.face_p.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
     }
   }
 
@@ -207,8 +203,9 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity_m->reinit(face);
-      integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      FaceIntegratorVelocity & integrator_m = integrators_velocity.get().face_m;
+      integrator_m.reinit(face);
+      integrator_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
     }
   }
 
@@ -219,15 +216,17 @@ public:
   {
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      integrator_velocity_m->reinit(cell, face);
-      integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      FaceIntegratorVelocity & integrator_m = integrators_velocity.get().face_m;
+      integrator_m.reinit(cell, face);
+      integrator_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
 
       if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
       {
         // TODO: Matrix-free implementation in deal.II does currently not allow to access data of
         // the neighboring element in case of cell-based face loops.
-        //      integrator_velocity_p->reinit(cell, face);
-        //      integrator_velocity_p->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+        //      integrators_velocity.get().face_p.reinit(cell, face);
+        //      integrators_velocity.get().face_p.gather_evaluate(*velocity,
+        //                                                        dealii::EvaluationFlags::values);
       }
     }
   }
@@ -329,9 +328,11 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      vector velocity_m = integrator_velocity_m->get_value(q);
+      IntegratorsVelocity const & integrators = integrators_velocity.current();
+
+      vector velocity_m = integrators.face_m.get_value(q);
       vector velocity_p =
-        exterior_velocity_available ? integrator_velocity_p->get_value(q) : velocity_m;
+        exterior_velocity_available ? integrators.face_p.get_value(q) : velocity_m;
 
       scalar normal_velocity_m = velocity_m * normal_m;
       scalar normal_velocity_p = velocity_p * normal_m;
@@ -393,9 +394,11 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      vector velocity_m = integrator_velocity_m->get_value(q);
+      IntegratorsVelocity const & integrators = integrators_velocity.current();
+
+      vector velocity_m = integrators.face_m.get_value(q);
       vector velocity_p =
-        exterior_velocity_available ? integrator_velocity_p->get_value(q) : velocity_m;
+        exterior_velocity_available ? integrators.face_p.get_value(q) : velocity_m;
 
       velocity = 0.5 * (velocity_m + velocity_p);
     }
@@ -485,7 +488,7 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      velocity = integrator_velocity->get_value(q);
+      velocity = integrators_velocity.current().cell.get_value(q);
     }
     else
     {
@@ -512,7 +515,7 @@ public:
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
-      velocity = integrator_velocity->get_value(q);
+      velocity = integrators_velocity.current().cell.get_value(q);
     }
     else
     {
@@ -527,9 +530,25 @@ private:
 
   mutable lazy_ptr<VectorType> velocity;
 
-  std::shared_ptr<CellIntegratorVelocity> integrator_velocity;
-  std::shared_ptr<FaceIntegratorVelocity> integrator_velocity_m;
-  std::shared_ptr<FaceIntegratorVelocity> integrator_velocity_p;
+  struct IntegratorsVelocity
+  {
+    IntegratorsVelocity(dealii::MatrixFree<dim, Number> const & matrix_free,
+                        unsigned int const                      dof_index,
+                        unsigned int const                      quad_index)
+      : cell(matrix_free, dof_index, quad_index),
+        face_m(matrix_free, true, dof_index, quad_index),
+        face_p(matrix_free, false, dof_index, quad_index)
+    {
+    }
+
+    CellIntegratorVelocity cell;
+    FaceIntegratorVelocity face_m;
+    FaceIntegratorVelocity face_p;
+  };
+
+  // integrators for the velocity of the current cell/face, one set per thread for task-parallel
+  // matrix-free loops
+  ThreadLocalData<IntegratorsVelocity> integrators_velocity;
 };
 
 } // namespace Operators
@@ -57,7 +57,7 @@ private:
   typedef FaceIntegrator<dim, 1, Number> IntegratorFace;
 
 public:
-  DiffusiveKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  DiffusiveKernel() : degree(1)
   {
   }
 
@@ -208,9 +208,13 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current face, one per thread for task-parallel matrix-free loops
+  static thread_local scalar tau;
 };
 
+template<int dim, typename Number>
+thread_local typename DiffusiveKernel<dim, Number>::scalar DiffusiveKernel<dim, Number>::tau;
+
 } // namespace Operators
 
 
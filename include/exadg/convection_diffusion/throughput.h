@@ -150,6 +150,8 @@ main(int argc, char ** argv)
   ExaDG::HypercubeResolutionParameters                       resolution(input_file, general.dim);
   ExaDG::ThroughputParameters<ExaDG::ConvDiff::OperatorType> throughput(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   auto const lambda_get_dofs_per_element =
     [&](unsigned int const dim, unsigned int const degree, ExaDG::ElementType const element_type) {
       return ExaDG::get_dofs_per_element(
@@ -65,6 +65,14 @@ TimeIntExplRK<Number>::set_velocities_and_times(
   times      = times_in;
 }
 
+template<typename Number>
+void
+TimeIntExplRK<Number>::set_shared_transport_velocity(
+  std::shared_ptr<SharedTransportVelocity<Number>> shared_velocity)
+{
+  shared_transport_velocity = shared_velocity;
+}
+
 template<typename Number>
 void
 TimeIntExplRK<Number>::extrapolate_solution(VectorType & vector)
@@ -266,6 +274,9 @@ TimeIntExplRK<Number>::initialize_time_integrator()
   expl_rk_operator =
     std::make_shared<OperatorExplRK<Number>>(pde_operator, numerical_velocity_field);
 
+  if(shared_transport_velocity)
+    expl_rk_operator->set_shared_transport_velocity(shared_transport_velocity);
+
   if(param.time_integrator_rk == TimeIntegratorRK::ExplRK1Stage1)
   {
     rk_time_integrator =
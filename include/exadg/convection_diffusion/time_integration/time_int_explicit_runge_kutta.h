@@ -49,6 +49,9 @@ class Operator;
 template<typename Number>
 class OperatorExplRK;
 
+template<typename Number>
+class SharedTransportVelocity;
+
 template<typename Number>
 class TimeIntExplRK : public TimeIntExplRKBase<Number>
 {
@@ -65,6 +68,13 @@ public:
   set_velocities_and_times(std::vector<VectorType const *> const & velocities_in,
                            std::vector<double> const &             times_in);
 
+  /*
+   * Shares the transport velocity interpolated in time with other time integrators that are
+   * driven by the same velocity field. Has to be called before setup().
+   */
+  void
+  set_shared_transport_velocity(std::shared_ptr<SharedTransportVelocity<Number>> shared_velocity);
+
   void
   extrapolate_solution(VectorType & vector);
 
@@ -97,6 +107,8 @@ private:
 
   std::shared_ptr<OperatorExplRK<Number>> expl_rk_operator;
 
+  std::shared_ptr<SharedTransportVelocity<Number>> shared_transport_velocity;
+
   std::shared_ptr<ExplicitTimeIntegrator<OperatorExplRK<Number>, VectorType>> rk_time_integrator;
 
   Parameters const & param;
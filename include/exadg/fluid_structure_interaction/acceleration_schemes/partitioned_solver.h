@@ -88,6 +88,17 @@ private:
   // required for quasi-Newton methods
   std::vector<std::shared_ptr<std::vector<VectorType>>> D_history, R_history, Z_history;
 
+  /*
+   * IQN-ILS: QR-decomposition of the residual differences and corresponding differences of the
+   * solution for the current and the reused time steps, ordered from the oldest to the newest
+   * column. The QR-decomposition is updated incrementally so that the history is never copied.
+   */
+  QRDecomposition<VectorType, Number> QR_reuse;
+  std::deque<VectorType>              D_reuse;
+
+  // number of columns of the IQN-ILS history contributed by each time step (oldest first)
+  std::deque<unsigned int> columns_per_time_step;
+
   // Computation time (wall clock time).
   std::shared_ptr<TimerTree> timer_tree;
 
@@ -302,10 +313,6 @@ PartitionedSolver<dim, Number>::solve(
   }
   else if(parameters.acceleration_method == AccelerationMethod::IQN_ILS)
   {
-    std::shared_ptr<std::vector<VectorType>> D, R;
-    D = std::make_shared<std::vector<VectorType>>();
-    R = std::make_shared<std::vector<VectorType>>();
-
     VectorType d, d_tilde, d_tilde_old, r, r_old;
     structure->pde_operator->initialize_dof_vector(d);
     structure->pde_operator->initialize_dof_vector(d_tilde);
@@ -316,6 +323,9 @@ PartitionedSolver<dim, Number>::solve(
     unsigned int const q = parameters.reused_time_steps;
     unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
 
+    // columns of the current time step are appended to the history
+    columns_per_time_step.push_back(0);
+
     bool converged = false;
     while(not(converged) and k < parameters.partitioned_iter_max)
     {
@@ -344,48 +354,60 @@ PartitionedSolver<dim, Number>::solve(
         {
           if(k >= 1)
           {
-            // append D, R matrices
-            VectorType delta_d_tilde = d_tilde;
-            delta_d_tilde.add(-1.0, d_tilde_old);
-            D->push_back(delta_d_tilde);
-
+            // append D, R matrices, where the oldest columns are removed from the
+            // QR-decomposition if the new column of R is linearly dependent on them
             VectorType delta_r = r;
             delta_r.add(-1.0, r_old);
-            R->push_back(delta_r);
+
+            std::vector<unsigned int> removed_columns;
+            bool const                appended =
+              QR_reuse.append_column_and_filter_oldest(delta_r, removed_columns);
+
+            for(unsigned int const m : removed_columns)
+            {
+              D_reuse.erase(D_reuse.begin() + m);
+
+              // decrement the number of columns of the time step that column m belongs to
+              unsigned int first_column = 0;
+              for(unsigned int & n_columns : columns_per_time_step)
+              {
+                if(m < first_column + n_columns)
+                {
+                  --n_columns;
+                  break;
+                }
+                first_column += n_columns;
+              }
+            }
+
+            if(appended)
+            {
+              VectorType delta_d_tilde = d_tilde;
+              delta_d_tilde.add(-1.0, d_tilde_old);
+              D_reuse.push_back(std::move(delta_d_tilde));
+
+              ++columns_per_time_step.back();
+            }
           }
 
-          // fill vectors (including reuse)
-          std::vector<VectorType> Q = *R;
-          for(auto R_q : R_history)
-            for(auto delta_r : *R_q)
-              Q.push_back(delta_r);
-          std::vector<VectorType> D_all = *D;
-          for(auto D_q : D_history)
-            for(auto delta_d : *D_q)
-              D_all.push_back(delta_d);
-
-          AssertThrow(D_all.size() == Q.size(),
+          AssertThrow(D_reuse.size() == QR_reuse.size(),
                       dealii::ExcMessage("D, Q vectors must have same size."));
 
-          unsigned int const k_all = Q.size();
+          unsigned int const k_all = QR_reuse.size();
           if(k_all >= 1)
           {
-            // compute QR-decomposition
-            Matrix<Number> U(k_all);
-            compute_QR_decomposition(Q, U);
-
-            std::vector<Number> rhs(k_all, 0.0);
+            std::vector<Number> rhs = QR_reuse.apply_Q_transpose(r);
             for(unsigned int i = 0; i < k_all; ++i)
-              rhs[i] = -Number(Q[i] * r);
+              rhs[i] = -rhs[i];
 
             // alpha = U^{-1} rhs
             std::vector<Number> alpha(k_all, 0.0);
-            backward_substitution(U, alpha, rhs);
+            backward_substitution(QR_reuse.get_R(), alpha, rhs);
 
             // d_{k+1} = d_tilde_{k} + delta d_tilde
             d = d_tilde;
             for(unsigned int i = 0; i < k_all; ++i)
-              d.add(alpha[i], D_all[i]);
+              d.add(alpha[i], D_reuse[i]);
           }
           else // despite reuse, the vectors might be empty
           {
@@ -408,13 +430,17 @@ PartitionedSolver<dim, Number>::solve(
     dealii::Timer timer;
     timer.restart();
 
-    // Update history
-    D_history.push_back(D);
-    R_history.push_back(R);
-    if(D_history.size() > q)
-      D_history.erase(D_history.begin());
-    if(R_history.size() > q)
-      R_history.erase(R_history.begin());
+    // Update history: remove the columns of the oldest time steps by a downdate of the
+    // QR-decomposition
+    while(columns_per_time_step.size() > q)
+    {
+      for(unsigned int i = 0; i < columns_per_time_step.front(); ++i)
+      {
+        QR_reuse.remove_first_column();
+        D_reuse.pop_front();
+      }
+      columns_per_time_step.pop_front();
+    }
 
     timer_tree->insert({"IQN-ILS"}, timer.wall_time());
   }
@@ -435,8 +461,8 @@ PartitionedSolver<dim, Number>::solve(
     structure->pde_operator->initialize_dof_vector(b);
     structure->pde_operator->initialize_dof_vector(b_old);
 
-    std::shared_ptr<Matrix<Number>> U;
-    std::vector<VectorType>         Q;
+    // QR-decomposition of the residual differences of the current time step
+    QRDecomposition<VectorType, Number> QR_current;
 
     unsigned int const q = parameters.reused_time_steps;
     unsigned int const n = fluid->time_integrator->get_number_of_time_steps();
@@ -475,34 +501,37 @@ PartitionedSolver<dim, Number>::solve(
 
           if(k >= 1)
           {
-            // append D, R, B matrices
-            VectorType delta_d_tilde = d_tilde;
-            delta_d_tilde.add(-1.0, d_tilde_old);
-            D->push_back(delta_d_tilde);
-
+            // append D, R, B matrices, where linearly dependent columns are filtered out
             VectorType delta_r = r;
             delta_r.add(-1.0, r_old);
-            R->push_back(delta_r);
 
-            VectorType delta_b = delta_d_tilde;
-            delta_b.add(1.0, b_old);
-            delta_b.add(-1.0, b);
-            B.push_back(delta_b);
+            if(QR_current.append_column(delta_r))
+            {
+              VectorType delta_d_tilde = d_tilde;
+              delta_d_tilde.add(-1.0, d_tilde_old);
 
-            // compute QR-decomposition
-            U = std::make_shared<Matrix<Number>>(k);
-            Q = *R;
-            compute_QR_decomposition(Q, *U);
+              VectorType delta_b = delta_d_tilde;
+              delta_b.add(1.0, b_old);
+              delta_b.add(-1.0, b);
 
-            std::vector<Number> rhs(k, 0.0);
-            for(unsigned int i = 0; i < k; ++i)
-              rhs[i] = -Number(Q[i] * r);
+              D->push_back(std::move(delta_d_tilde));
+              R->push_back(std::move(delta_r));
+              B.push_back(std::move(delta_b));
+            }
+          }
+
+          unsigned int const k_current = QR_current.size();
+          if(k_current >= 1)
+          {
+            std::vector<Number> rhs = QR_current.apply_Q_transpose(r);
+            for(unsigned int i = 0; i < k_current; ++i)
+              rhs[i] = -rhs[i];
 
             // alpha = U^{-1} rhs
-            std::vector<Number> alpha(k, 0.0);
-            backward_substitution(*U, alpha, rhs);
+            std::vector<Number> alpha(k_current, 0.0);
+            backward_substitution(QR_current.get_R(), alpha, rhs);
 
-            for(unsigned int i = 0; i < k; ++i)
+            for(unsigned int i = 0; i < k_current; ++i)
               d.add(alpha[i], B[i]);
           }
         }
@@ -531,11 +560,11 @@ PartitionedSolver<dim, Number>::solve(
     if(R_history.size() > q)
       R_history.erase(R_history.begin());
 
-    // compute Z and add to Z_history
+    // compute Z = U^{-1} Q^T and add to Z_history
     std::shared_ptr<std::vector<VectorType>> Z;
-    Z  = std::make_shared<std::vector<VectorType>>();
-    *Z = Q; // make sure that Z has correct size
-    backward_substitution_multiple_rhs(*U, *Z, Q);
+    Z = std::make_shared<std::vector<VectorType>>(QR_current.get_Q().begin(),
+                                                  QR_current.get_Q().end());
+    backward_substitution_in_place(QR_current.get_R(), *Z);
     Z_history.push_back(Z);
     if(Z_history.size() > q)
       Z_history.erase(Z_history.begin());
@@ -144,6 +144,8 @@ main(int argc, char ** argv)
 
   ExaDG::GeneralParameters general(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   // run the simulation
   if(general.dim == 2 and general.precision == "double")
     ExaDG::run<2, double>(input_file, mpi_comm, general.is_test);
@@ -19,12 +19,37 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <array>
+
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/interface_coupling.h>
 #include <exadg/postprocessor/write_output.h>
 
 namespace ExaDG
 {
+namespace
+{
+/*
+ * Access to the components of the data stored in ContainerInterfaceData, needed to exchange this
+ * data as a plain array of doubles.
+ */
+template<int dim>
+double &
+component(dealii::Tensor<0, dim, double> & value, unsigned int const c)
+{
+  (void)c;
+  return value;
+}
+
+template<int dim>
+double &
+component(dealii::Tensor<1, dim, double> & value, unsigned int const c)
+{
+  return value[c];
+}
+} // namespace
+
 template<int rank, int dim, typename Number>
 InterfaceCoupling<rank, dim, Number>::InterfaceCoupling() : dof_handler_src(nullptr)
 {
@@ -128,6 +153,119 @@ InterfaceCoupling<rank, dim, Number>::update_data(VectorType const & dof_vector_
   }
 }
 
+template<int rank, int dim, typename Number>
+void
+InterfaceCoupling<rank, dim, Number>::setup_across_communicators(
+  MPI_Comm const &                                           comm,
+  std::shared_ptr<ContainerInterfaceData<rank, dim, double>> interface_data_dst_,
+  dealii::DoFHandler<dim> const *                            dof_handler_src_,
+  dealii::Mapping<dim> const *                               mapping_src_,
+  double const                                               tolerance_)
+{
+  bool const is_dst = interface_data_dst_.get() != nullptr;
+
+  AssertThrow(is_dst != (dof_handler_src_ != nullptr),
+              dealii::ExcMessage("A process has to be either on the dst side or the src side."));
+
+  interface_data_dst = interface_data_dst_;
+  dof_handler_src    = dof_handler_src_;
+
+  // the src side needs to know the quadrature indices of the dst side
+  unsigned int const this_rank = dealii::Utilities::MPI::this_mpi_process(comm);
+  unsigned int const first_dst_rank =
+    dealii::Utilities::MPI::min(is_dst ? this_rank : dealii::numbers::invalid_unsigned_int, comm);
+
+  std::vector<quad_index> quad_indices;
+  if(is_dst)
+    quad_indices = interface_data_dst->get_quad_indices();
+  quad_indices = dealii::Utilities::MPI::broadcast(comm, quad_indices, first_dst_rank);
+
+  for(auto quad_index : quad_indices)
+  {
+    map_evaluator_across_communicators.emplace(
+      quad_index, std::make_unique<RemotePointEvaluationAcrossCommunicators<dim>>());
+
+    std::vector<dealii::Point<dim>> points;
+    if(is_dst)
+      points = interface_data_dst->get_array_q_points(quad_index);
+
+    map_evaluator_across_communicators[quad_index]->reinit(
+      comm,
+      is_dst,
+      points,
+      is_dst ? nullptr : &dof_handler_src_->get_triangulation(),
+      mapping_src_,
+      tolerance_);
+
+    if(not is_dst)
+    {
+      AssertThrow(map_evaluator_across_communicators[quad_index]
+                    ->get_remote_point_evaluation()
+                    .all_points_found(),
+                  dealii::ExcMessage("Setup of InterfaceCoupling was not successful: Not all "
+                                     "points have been found."));
+    }
+  }
+}
+
+template<int rank, int dim, typename Number>
+void
+InterfaceCoupling<rank, dim, Number>::send_data(VectorType const & dof_vector_src)
+{
+  AssertThrow(dof_handler_src != nullptr and not map_evaluator_across_communicators.empty(),
+              dealii::ExcMessage("send_data() has to be called on the src side after "
+                                 "setup_across_communicators()."));
+
+  dof_vector_src.update_ghost_values();
+
+  using data_type = typename ContainerInterfaceData<rank, dim, double>::data_type;
+
+  for(auto & [quadrature, evaluator] : map_evaluator_across_communicators)
+  {
+    auto const result =
+      dealii::VectorTools::point_values<n_components>(evaluator->get_remote_point_evaluation(),
+                                                      *dof_handler_src,
+                                                      dof_vector_src,
+                                                      dealii::VectorTools::EvaluationFlags::avg);
+
+    // RemotePointEvaluationAcrossCommunicators exchanges one trivially copyable value per point
+    std::vector<std::array<double, n_components>> values_per_point(result.size());
+    for(unsigned int i = 0; i < result.size(); ++i)
+    {
+      data_type value;
+      value = result[i];
+      for(unsigned int c = 0; c < n_components; ++c)
+        values_per_point[i][c] = component(value, c);
+    }
+
+    evaluator->start_send(values_per_point);
+  }
+}
+
+template<int rank, int dim, typename Number>
+void
+InterfaceCoupling<rank, dim, Number>::receive_data()
+{
+  AssertThrow(interface_data_dst.get() and not map_evaluator_across_communicators.empty(),
+              dealii::ExcMessage("receive_data() has to be called on the dst side after "
+                                 "setup_across_communicators()."));
+
+  for(auto & [quadrature, evaluator] : map_evaluator_across_communicators)
+  {
+    std::vector<std::array<double, n_components>> values_per_point;
+    evaluator->receive(values_per_point);
+
+    auto & array_solution = interface_data_dst->get_array_solution(quadrature);
+
+    Assert(values_per_point.size() == array_solution.size(),
+           dealii::ExcMessage("Vectors must have the same length."));
+
+    for(unsigned int i = 0; i < values_per_point.size(); ++i)
+      for(unsigned int c = 0; c < n_components; ++c)
+        component(array_solution[i], c) = values_per_point[i][c];
+  }
+}
+
 template class InterfaceCoupling<0, 2, float>;
 template class InterfaceCoupling<1, 2, float>;
 template class InterfaceCoupling<0, 3, float>;
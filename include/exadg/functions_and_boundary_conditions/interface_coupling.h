@@ -27,6 +27,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+#include <exadg/functions_and_boundary_conditions/remote_point_evaluation_across_communicators.h>
 #include <exadg/utilities/tensor_utilities.h>
 
 namespace ExaDG
@@ -64,6 +65,34 @@ public:
   void
   update_data(VectorType const & dof_vector_src);
 
+  /**
+   * Same as setup(), but for the case that the dst side and the src side live on disjoint sets of
+   * processes of @param comm. Processes on the dst side pass nullptr for @param dof_handler_src_
+   * and @param mapping_src_, processes on the src side pass an empty shared pointer for
+   * @param interface_data_dst_. Instead of update_data(), the src side calls send_data() and the
+   * dst side calls receive_data().
+   */
+  void
+  setup_across_communicators(
+    MPI_Comm const &                                           comm,
+    std::shared_ptr<ContainerInterfaceData<rank, dim, double>> interface_data_dst_,
+    dealii::DoFHandler<dim> const *                            dof_handler_src_,
+    dealii::Mapping<dim> const *                               mapping_src_,
+    double const                                               tolerance_);
+
+  /**
+   * Evaluates @param dof_vector_src in the points of the dst side and starts sending the values.
+   * Returns without waiting for the dst side to receive the data.
+   */
+  void
+  send_data(VectorType const & dof_vector_src);
+
+  /**
+   * Receives the data sent by send_data() and stores it in the interface data of the dst side.
+   */
+  void
+  receive_data();
+
 private:
   /*
    * dst-side
@@ -76,6 +105,12 @@ private:
   std::map<quad_index, std::unique_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>>>
     map_evaluator;
 
+  /*
+   * Used instead of map_evaluator if dst-side and src-side live on disjoint sets of processes
+   */
+  std::map<quad_index, std::unique_ptr<RemotePointEvaluationAcrossCommunicators<dim>>>
+    map_evaluator_across_communicators;
+
   /*
    * src-side
    */
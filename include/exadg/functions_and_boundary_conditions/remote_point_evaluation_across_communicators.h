@@ -0,0 +1,299 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_REMOTE_POINT_EVALUATION_ACROSS_COMMUNICATORS_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_REMOTE_POINT_EVALUATION_ACROSS_COMMUNICATORS_H_
+
+// C/C++
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/point.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/tria.h>
+
+namespace ExaDG
+{
+/**
+ * Class to exchange data between points that live on one group of processes (the point side) and
+ * a triangulation that lives on another, disjoint group of processes (the mesh side). Both groups
+ * are part of a common communicator. This allows single field solvers that are set up on
+ * sub-communicators, and that therefore run concurrently, to be coupled.
+ *
+ * Every process on the point side is assigned a partner process on the mesh side, to which it
+ * forwards its points once during reinit(). The mesh side uses all forwarded points to set up a
+ * dealii::Utilities::MPI::RemotePointEvaluation on its triangulation, which takes care of the
+ * communication within the mesh side. During the simulation, only values at the points are
+ * exchanged between the partner processes using non-blocking point-to-point communication.
+ */
+template<int dim>
+class RemotePointEvaluationAcrossCommunicators
+{
+public:
+  RemotePointEvaluationAcrossCommunicators() : comm(MPI_COMM_NULL), is_point_side(false)
+  {
+  }
+
+  ~RemotePointEvaluationAcrossCommunicators()
+  {
+    finish_send();
+
+    if(comm != MPI_COMM_NULL)
+      dealii::Utilities::MPI::free_communicator(comm);
+  }
+
+  /**
+   * Sets up the communication pattern. This function has to be called by all processes of
+   * @param comm_in. Processes on the point side pass their points and nullptr for the
+   * triangulation and mapping, processes on the mesh side pass an empty vector of points and
+   * their triangulation and mapping.
+   */
+  void
+  reinit(MPI_Comm const &                        comm_in,
+         bool const                              is_point_side_in,
+         std::vector<dealii::Point<dim>> const & points,
+         dealii::Triangulation<dim> const *      triangulation,
+         dealii::Mapping<dim> const *            mapping,
+         double const                            tolerance = 1.e-6)
+  {
+    finish_send();
+
+    if(comm != MPI_COMM_NULL)
+      dealii::Utilities::MPI::free_communicator(comm);
+
+    static_assert(sizeof(dealii::Point<dim>) == dim * sizeof(double),
+                  "Points are exchanged as dim doubles each.");
+
+    // use a communicator of its own to separate the messages from those of other objects
+    comm          = dealii::Utilities::MPI::duplicate_communicator(comm_in);
+    is_point_side = is_point_side_in;
+
+    std::vector<int> const is_point_side_all =
+      dealii::Utilities::MPI::all_gather(comm, static_cast<int>(is_point_side));
+
+    std::vector<int> point_ranks, mesh_ranks;
+    for(unsigned int rank = 0; rank < is_point_side_all.size(); ++rank)
+    {
+      if(is_point_side_all[rank])
+        point_ranks.push_back(rank);
+      else
+        mesh_ranks.push_back(rank);
+    }
+
+    AssertThrow(point_ranks.size() > 0 and mesh_ranks.size() > 0,
+                dealii::ExcMessage("Both the point side and the mesh side need processes."));
+
+    int const this_rank = dealii::Utilities::MPI::this_mpi_process(comm);
+
+    partner_ranks.clear();
+    n_points_partner.clear();
+
+    if(is_point_side)
+    {
+      unsigned int const index =
+        std::find(point_ranks.begin(), point_ranks.end(), this_rank) - point_ranks.begin();
+      partner_ranks.push_back(mesh_ranks[index % mesh_ranks.size()]);
+      n_points_partner.push_back(points.size());
+
+      unsigned int const n_points = points.size();
+      MPI_Send(&n_points, 1, MPI_UNSIGNED, partner_ranks[0], tag_setup, comm);
+      MPI_Send(points.data(),
+               get_count(n_points, dim),
+               MPI_DOUBLE,
+               partner_ranks[0],
+               tag_setup,
+               comm);
+    }
+    else
+    {
+      AssertThrow(triangulation != nullptr and mapping != nullptr,
+                  dealii::ExcMessage("The mesh side needs a triangulation and a mapping."));
+
+      unsigned int const index =
+        std::find(mesh_ranks.begin(), mesh_ranks.end(), this_rank) - mesh_ranks.begin();
+      for(unsigned int i = index; i < point_ranks.size(); i += mesh_ranks.size())
+        partner_ranks.push_back(point_ranks[i]);
+
+      // collect the points of all partners
+      std::vector<dealii::Point<dim>> points_partners;
+      for(int const partner : partner_ranks)
+      {
+        unsigned int n_points = 0;
+        MPI_Recv(&n_points, 1, MPI_UNSIGNED, partner, tag_setup, comm, MPI_STATUS_IGNORE);
+
+        std::vector<dealii::Point<dim>> points_partner(n_points);
+        MPI_Recv(points_partner.data(),
+                 get_count(n_points, dim),
+                 MPI_DOUBLE,
+                 partner,
+                 tag_setup,
+                 comm,
+                 MPI_STATUS_IGNORE);
+
+        n_points_partner.push_back(n_points);
+        points_partners.insert(points_partners.end(), points_partner.begin(), points_partner.end());
+      }
+
+      rpe = std::make_shared<dealii::Utilities::MPI::RemotePointEvaluation<dim>>(tolerance);
+      rpe->reinit(points_partners, *triangulation, *mapping);
+    }
+  }
+
+  /**
+   * Returns the dealii::Utilities::MPI::RemotePointEvaluation that has been set up on the mesh
+   * side for the points of all partner processes on the point side.
+   */
+  dealii::Utilities::MPI::RemotePointEvaluation<dim> const &
+  get_remote_point_evaluation() const
+  {
+    AssertThrow(not is_point_side and rpe.get(),
+                dealii::ExcMessage("RemotePointEvaluation only exists on the mesh side."));
+
+    return *rpe;
+  }
+
+  /**
+   * Starts sending @param values to the partner processes without waiting for the message to be
+   * received. On the point side, one value per point is sent. On the mesh side, the values are
+   * ordered as the points of get_remote_point_evaluation(). The type T has to be trivially
+   * copyable.
+   */
+  template<typename T>
+  void
+  start_send(std::vector<T> const & values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Type has to be trivially copyable.");
+
+    // the send buffers might still be in use by a previous message
+    finish_send();
+
+    char const * ptr = reinterpret_cast<char const *>(values.data());
+    send_buffer.assign(ptr, ptr + values.size() * sizeof(T));
+
+    requests.resize(partner_ranks.size());
+    std::size_t offset = 0;
+    for(unsigned int i = 0; i < partner_ranks.size(); ++i)
+    {
+      std::size_t const n_bytes = n_points_partner[i] * sizeof(T);
+      AssertThrow(offset + n_bytes <= send_buffer.size(),
+                  dealii::ExcMessage("Number of values does not match number of points."));
+
+      MPI_Isend(send_buffer.data() + offset,
+                get_count(n_points_partner[i], sizeof(T)),
+                MPI_BYTE,
+                partner_ranks[i],
+                tag_data,
+                comm,
+                &requests[i]);
+
+      offset += n_bytes;
+    }
+  }
+
+  /**
+   * Waits until the messages of the last call to start_send() have been received.
+   */
+  void
+  finish_send()
+  {
+    if(requests.size() > 0)
+    {
+      MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+      requests.clear();
+    }
+  }
+
+  /**
+   * Receives the values sent by the partner processes via start_send(). This function blocks
+   * until all messages have arrived.
+   */
+  template<typename T>
+  void
+  receive(std::vector<T> & values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Type has to be trivially copyable.");
+
+    std::size_t n_values = 0;
+    for(unsigned int const n : n_points_partner)
+      n_values += n;
+    values.resize(n_values);
+
+    std::vector<MPI_Request> receive_requests(partner_ranks.size());
+    std::size_t              offset = 0;
+    for(unsigned int i = 0; i < partner_ranks.size(); ++i)
+    {
+      MPI_Irecv(values.data() + offset,
+                get_count(n_points_partner[i], sizeof(T)),
+                MPI_BYTE,
+                partner_ranks[i],
+                tag_data,
+                comm,
+                &receive_requests[i]);
+
+      offset += n_points_partner[i];
+    }
+
+    MPI_Waitall(receive_requests.size(), receive_requests.data(), MPI_STATUSES_IGNORE);
+  }
+
+private:
+  /**
+   * Returns the count argument of an MPI call for @param n_points points with @param n_entries
+   * entries of the MPI datatype each. MPI counts are of type int, so larger messages are rejected.
+   */
+  static int
+  get_count(std::size_t const n_points, std::size_t const n_entries)
+  {
+    std::size_t const count = n_points * n_entries;
+    AssertThrow(count <= static_cast<std::size_t>(std::numeric_limits<int>::max()),
+                dealii::ExcMessage("Message exceeds the maximum MPI count of type int."));
+
+    return static_cast<int>(count);
+  }
+
+  static int const tag_setup = 1;
+  static int const tag_data  = 2;
+
+  MPI_Comm comm;
+
+  bool is_point_side;
+
+  // partner processes and the number of points exchanged with them
+  std::vector<int>          partner_ranks;
+  std::vector<unsigned int> n_points_partner;
+
+  // mesh side
+  std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>> rpe;
+
+  // non-blocking send
+  std::vector<char>        send_buffer;
+  std::vector<MPI_Request> requests;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_REMOTE_POINT_EVALUATION_ACROSS_COMMUNICATORS_H_ */
@@ -0,0 +1,316 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_SEPARABLE_FUNCTION_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_SEPARABLE_FUNCTION_H_
+
+// C/C++
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/utilities/tensor_utilities.h>
+
+namespace ExaDG
+{
+/**
+ * A function of the form f(x,t) = f_x(x) * f_t(t), i.e., a function that can be separated into a
+ * spatial part f_x and a temporal part f_t. Typical examples are inflow profiles that are ramped
+ * up in time. If no temporal part is given, the function is stationary.
+ *
+ * The class can be used like any other dealii::Function. In addition, boundary conditions of this
+ * type can be evaluated without calling dealii::Function::value() for every quadrature point in
+ * every operator evaluation, see ContainerSeparableData.
+ */
+template<int dim>
+class SeparableFunction : public dealii::Function<dim>
+{
+public:
+  SeparableFunction(std::shared_ptr<dealii::Function<dim>> spatial_part,
+                    std::shared_ptr<dealii::Function<1>>   temporal_part = nullptr)
+    : dealii::Function<dim>(spatial_part->n_components),
+      spatial_part(spatial_part),
+      temporal_part(temporal_part)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    return spatial_part->value(p, component) * compute_time_factor(this->get_time());
+  }
+
+  /**
+   * Returns the time-independent function f_x.
+   */
+  dealii::Function<dim> const &
+  get_spatial_part() const
+  {
+    return *spatial_part;
+  }
+
+  /**
+   * Returns f_t(time), or 1 if the function is stationary.
+   */
+  double
+  compute_time_factor(double const time) const
+  {
+    if(temporal_part.get())
+      return temporal_part->value(dealii::Point<1>(time));
+    else
+      return 1.0;
+  }
+
+private:
+  std::shared_ptr<dealii::Function<dim>> spatial_part;
+  std::shared_ptr<dealii::Function<1>>   temporal_part;
+};
+
+/**
+ * A data structure storing the spatial part of SeparableFunction boundary conditions for each
+ * quadrature point on boundary faces. The values are evaluated once during setup() and are stored
+ * in the vectorized layout of dealii::MatrixFree, so that evaluating the boundary condition during
+ * an operator evaluation reduces to a load and a multiplication with the time factor. Storage is
+ * only allocated for boundary face batches with a SeparableFunction. Boundary IDs with other types
+ * of functions are ignored, i.e., these functions are evaluated as usual.
+ *
+ * The quadrature points have to be re-evaluated by calling setup() again if the mesh changes.
+ */
+template<int rank, int dim>
+class ContainerSeparableData
+{
+private:
+  static unsigned int const n_components = rank_to_n_components<rank, dim>();
+
+  using MapBoundaryFunctions =
+    std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>;
+
+public:
+  ContainerSeparableData() : matrix_free(nullptr), n_lanes(0), n_inner_face_batches(0)
+  {
+  }
+
+  template<typename Number>
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+        unsigned int const                      dof_index,
+        std::vector<unsigned int> const &       quad_indices,
+        MapBoundaryFunctions const &            functions)
+  {
+    matrix_free          = &matrix_free_in;
+    n_lanes              = dealii::VectorizedArray<Number>::size();
+    n_inner_face_batches = matrix_free_in.n_inner_face_batches();
+
+    unsigned int const n_boundary_face_batches = matrix_free_in.n_boundary_face_batches();
+
+    // number the boundary face batches with a separable function consecutively
+    cached_face_index.assign(n_boundary_face_batches, dealii::numbers::invalid_unsigned_int);
+    function_of_face.clear();
+    for(unsigned int face = 0; face < n_boundary_face_batches; ++face)
+    {
+      auto it = functions.find(matrix_free_in.get_boundary_id(n_inner_face_batches + face));
+      if(it != functions.end())
+      {
+        if(auto function = dynamic_cast<SeparableFunction<dim> const *>(it->second.get()))
+        {
+          cached_face_index[face] = function_of_face.size();
+          function_of_face.push_back(function);
+        }
+      }
+    }
+
+    time_factor_of_face.assign(function_of_face.size(),
+                               std::make_pair(std::numeric_limits<double>::quiet_NaN(), 1.0));
+
+    unsigned int max_quad_index = 0;
+    for(unsigned int const quad_index : quad_indices)
+      max_quad_index = std::max(max_quad_index, quad_index);
+
+    n_q_points.assign(max_quad_index + 1, 0);
+    values.clear();
+    values.resize(max_quad_index + 1);
+
+    for(unsigned int const quad_index : quad_indices)
+    {
+      n_q_points[quad_index] = matrix_free_in.get_n_q_points_face(quad_index);
+
+      std::vector<double> & values_quad = values[quad_index];
+      values_quad.resize(function_of_face.size() * n_q_points[quad_index] * n_components * n_lanes);
+
+      FaceIntegrator<dim, n_components, Number> integrator(matrix_free_in,
+                                                           true,
+                                                           dof_index,
+                                                           quad_index);
+
+      for(unsigned int face = 0; face < n_boundary_face_batches; ++face)
+      {
+        unsigned int const cached_face = cached_face_index[face];
+        if(cached_face == dealii::numbers::invalid_unsigned_int)
+          continue;
+
+        integrator.reinit(n_inner_face_batches + face);
+
+        for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        {
+          dealii::Point<dim, dealii::VectorizedArray<Number>> q_points =
+            integrator.quadrature_point(q);
+
+          for(unsigned int v = 0; v < n_lanes; ++v)
+          {
+            dealii::Point<dim> q_point;
+            for(unsigned int d = 0; d < dim; ++d)
+              q_point[d] = q_points[d][v];
+
+            for(unsigned int c = 0; c < n_components; ++c)
+              values_quad[index(quad_index, cached_face, q, c) + v] =
+                function_of_face[cached_face]->get_spatial_part().value(q_point, c);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Returns whether data is available for the face and quadrature rule that @param integrator is
+   * currently evaluating.
+   */
+  template<typename Integrator>
+  bool
+  is_cached(Integrator const & integrator) const
+  {
+    if(static_cast<void const *>(&integrator.get_matrix_free()) != matrix_free)
+      return false;
+
+    unsigned int const quad_index = integrator.get_quadrature_index();
+    unsigned int const face       = integrator.get_current_cell_index();
+
+    if(quad_index >= n_q_points.size() or n_q_points[quad_index] == 0)
+      return false;
+
+    return face >= n_inner_face_batches and
+           face < n_inner_face_batches + cached_face_index.size() and
+           cached_face_index[face - n_inner_face_batches] != dealii::numbers::invalid_unsigned_int;
+  }
+
+  /**
+   * Returns the value of the boundary condition at quadrature point @param q of face batch
+   * @param face. Requires that is_cached() returns true for this face.
+   */
+  template<typename Number>
+  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+  get_data(unsigned int const quad_index,
+           unsigned int const face,
+           unsigned int const q,
+           double const &     time) const
+  {
+    Assert(dealii::VectorizedArray<Number>::size() == n_lanes,
+           dealii::ExcMessage("Data has been set up for a different number type."));
+
+    unsigned int const cached_face = cached_face_index[face - n_inner_face_batches];
+
+    dealii::VectorizedArray<Number> const time_factor = get_time_factor(cached_face, time);
+
+    std::vector<double> const & values_quad = values[quad_index];
+
+    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> value;
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      dealii::VectorizedArray<Number> component;
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        component[v] = values_quad[index(quad_index, cached_face, q, c) + v];
+
+      if constexpr(rank == 0)
+        value = component * time_factor;
+      else
+        value[c] = component * time_factor;
+    }
+
+    return value;
+  }
+
+private:
+  /**
+   * Returns the time factor of the function of a face batch, which is evaluated only if the time
+   * differs from the time of the last call for this face batch. Hence, the time factor is computed
+   * once per face batch and not for every quadrature point. Since a face batch is processed by a
+   * single thread in a matrix-free loop, the entries of different face batches can be written
+   * concurrently.
+   */
+  double
+  get_time_factor(unsigned int const cached_face, double const time) const
+  {
+    std::pair<double, double> & time_factor = time_factor_of_face[cached_face];
+    if(time_factor.first != time)
+      time_factor = std::make_pair(time, function_of_face[cached_face]->compute_time_factor(time));
+
+    return time_factor.second;
+  }
+
+  unsigned int
+  index(unsigned int const quad_index,
+        unsigned int const cached_face,
+        unsigned int const q,
+        unsigned int const c) const
+  {
+    return ((cached_face * n_q_points[quad_index] + q) * n_components + c) * n_lanes;
+  }
+
+  // the MatrixFree object the data has been set up for
+  void const * matrix_free;
+
+  unsigned int n_lanes;
+
+  unsigned int n_inner_face_batches;
+
+  // index into the cached data for each boundary face batch (invalid_unsigned_int for other types
+  // of functions)
+  std::vector<unsigned int> cached_face_index;
+
+  // separable function for each cached face batch
+  std::vector<SeparableFunction<dim> const *> function_of_face;
+
+  // time of the last evaluation and time factor for each cached face batch (initialized with NaN,
+  // which compares unequal to any time)
+  mutable std::vector<std::pair<double, double>> time_factor_of_face;
+
+  // number of quadrature points per face for each quadrature index (0 if not set up)
+  std::vector<unsigned int> n_q_points;
+
+  // spatial part of the function for each quadrature index in the layout (cached face, q,
+  // component, v)
+  std::vector<std::vector<double>> values;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_SEPARABLE_FUNCTION_H_ */
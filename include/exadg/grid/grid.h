@@ -104,6 +104,19 @@ public:
   {
   }
 
+  /**
+   * Replaces the fine-level mapping, e.g. by a mapping caching the support points of the original
+   * mapping. Only allowed if the fine-level mapping is a "normal" dealii::Mapping.
+   */
+  void
+  set_fine_level_mapping(std::shared_ptr<dealii::Mapping<dim>> mapping)
+  {
+    AssertThrow(mapping_fine_level.get(),
+                dealii::ExcMessage("The fine-level mapping is not a standard dealii::Mapping."));
+
+    mapping_fine_level = mapping;
+  }
+
   /**
    * Initializes the multigrid mappings on coarse h levels.
    */
@@ -131,6 +144,16 @@ public:
     }
   }
 
+  /**
+   * Returns true if the fine-level mapping is of type MappingDoFVector. In this case, the mappings
+   * on coarse levels are recreated in every call to initialize_coarse_mappings().
+   */
+  bool
+  involves_mapping_dof_vector() const
+  {
+    return mapping_dof_vector_fine_level.get() != nullptr;
+  }
+
   /**
    * Returns the dealii::Mapping for a given h_level of n_h_levels.
    */
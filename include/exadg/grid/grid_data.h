@@ -90,7 +90,10 @@ struct GridData
     : triangulation_type(TriangulationType::Distributed),
       element_type(ElementType::Hypercube),
       partitioning_type(PartitioningType::Metis),
+      group_size_fully_distributed(1),
+      triangulation_cache_file(),
       n_refine_global(0),
+      mapping_cache_file(),
       file_name(),
       create_coarse_triangulations(false)
   {
@@ -109,13 +112,21 @@ struct GridData
     print_parameter(pcout, "Element type", element_type);
 
     if(triangulation_type == TriangulationType::FullyDistributed)
+    {
       print_parameter(pcout, "Partitioning type (fully-distributed)", partitioning_type);
+      print_parameter(pcout, "Group size (fully-distributed)", group_size_fully_distributed);
+      if(not triangulation_cache_file.empty())
+        print_parameter(pcout, "Triangulation cache file", triangulation_cache_file);
+    }
 
     print_parameter(pcout, "Number of global refinements", n_refine_global);
 
     if(not file_name.empty())
       print_parameter(pcout, "Grid file name", file_name);
 
+    if(not mapping_cache_file.empty())
+      print_parameter(pcout, "Mapping cache file", mapping_cache_file);
+
     print_parameter(pcout, "Create coarse triangulations", create_coarse_triangulations);
   }
 
@@ -126,6 +137,23 @@ struct GridData
   // only relevant for TriangulationType::FullyDistributed
   PartitioningType partitioning_type;
 
+  // Only relevant for TriangulationType::FullyDistributed: the processes are split into groups of
+  // this size, and only the first process of each group creates (e.g. reads from file) and
+  // partitions the serial triangulation and sends the descriptions of the local parts to the other
+  // processes of its group. Use 0 for a single group containing all processes. Large external
+  // grids should be read by one or a few processes only, which requires that the serial
+  // triangulation fits into the memory of these processes. Periodic face pairs are not supported
+  // for group sizes larger than 1.
+  unsigned int group_size_fully_distributed;
+
+  // Only relevant for TriangulationType::FullyDistributed: if not empty, the descriptions of the
+  // partitioned triangulation are written to a binary file with this name (extended by the number
+  // of refinements) after they have been created. Subsequent runs with the same number of
+  // processes read the descriptions from this file instead of creating the serial triangulation.
+  // The file has to be deleted if the grid or its partitioning changes. Periodic face pairs are not
+  // supported for cached triangulations.
+  std::string triangulation_cache_file;
+
   unsigned int n_refine_global;
 
   // path to a grid file
@@ -133,6 +161,14 @@ struct GridData
   // deduce the correct type of the file format
   std::string file_name;
 
+  // If not empty, the support points of the (high-order) mapping are computed only once and stored
+  // in a dealii::MappingQCache, which avoids repeated evaluations of the manifolds for all
+  // MatrixFree objects. The support points are additionally stored in binary files with this name
+  // (extended by the rank) together with a hash of the mesh, so that subsequent runs on the same
+  // mesh skip their computation. Currently only used by the incompressible Navier-Stokes solver
+  // and not supported in combination with coarse triangulations or adaptive mesh refinement.
+  std::string mapping_cache_file;
+
   // In case of a hypercube mesh that is globally refined, i.e. without hanging nodes, the fine
   // triangulation can be used for all multigrid h-levels without the need to create coarse
   // triangulations explicitly. Hence, this parameter is typically set to false for globally-refined
@@ -34,7 +34,9 @@
 #include <exadg/grid/balanced_granularity_partition_policy.h>
 #include <exadg/grid/grid.h>
 #include <exadg/grid/grid_data.h>
+#include <exadg/grid/mapping_support_points_cache.h>
 #include <exadg/grid/perform_local_refinements.h>
+#include <exadg/grid/triangulation_description_cache.h>
 
 namespace ExaDG
 {
@@ -234,7 +236,9 @@ create_triangulation(
       }
     };
 
-    unsigned int const group_size = 1;
+    unsigned int const group_size = data.group_size_fully_distributed == 0 ?
+                                      dealii::Utilities::MPI::n_mpi_processes(mpi_comm) :
+                                      data.group_size_fully_distributed;
 
     typename dealii::TriangulationDescription::Settings triangulation_description_setting =
       dealii::TriangulationDescription::default_setting;
@@ -248,13 +252,47 @@ create_triangulation(
     triangulation =
       std::make_shared<dealii::parallel::fullydistributed::Triangulation<dim>>(mpi_comm);
 
-    auto const description = dealii::TriangulationDescription::Utilities::
-      create_description_from_triangulation_in_groups<dim, dim>(serial_grid_generator,
-                                                                serial_grid_partitioner,
-                                                                triangulation->get_communicator(),
-                                                                group_size,
-                                                                mesh_smoothing,
-                                                                triangulation_description_setting);
+    std::string const cache_file_name =
+      data.triangulation_cache_file.empty() ?
+        std::string() :
+        get_triangulation_cache_file_name(data.triangulation_cache_file,
+                                          global_refinements,
+                                          vector_local_refinements,
+                                          construct_multigrid_hierarchy);
+
+    dealii::TriangulationDescription::Description<dim, dim> description;
+
+    bool const read_from_cache =
+      not cache_file_name.empty() and
+      read_triangulation_description(description, cache_file_name, mpi_comm);
+
+    if(not read_from_cache)
+    {
+      description = dealii::TriangulationDescription::Utilities::
+        create_description_from_triangulation_in_groups<dim, dim>(
+          serial_grid_generator,
+          serial_grid_partitioner,
+          triangulation->get_communicator(),
+          group_size,
+          mesh_smoothing,
+          triangulation_description_setting);
+
+      // If the description is created in groups, the serial triangulation, and hence the periodic
+      // face pairs, are not available on all processes. The cache does not contain the periodic
+      // face pairs either, which is why a triangulation with periodic faces is never written to the
+      // cache. Hence, a triangulation read from the cache has no periodic faces.
+      if(group_size > 1 or not cache_file_name.empty())
+      {
+        AssertThrow(
+          dealii::Utilities::MPI::max(static_cast<unsigned int>(periodic_face_pairs.size()),
+                                      mpi_comm) == 0,
+          dealii::ExcMessage("Periodic face pairs are not supported for fully-distributed "
+                             "triangulations that are cached or created in groups."));
+      }
+
+      if(not cache_file_name.empty())
+        write_triangulation_description(description, cache_file_name, mpi_comm);
+    }
 
     triangulation->create_triangulation(description);
   }
@@ -566,9 +604,40 @@ create_triangulation_with_multigrid(
   }
 }
 
+/**
+ * Returns true if both triangulations consist of the same cells with the same vertices and if the
+ * cells are owned by the same processes. This function has to be called by all processes.
+ */
+template<int dim>
+inline bool
+triangulations_are_equal(dealii::Triangulation<dim> const & triangulation_1,
+                         dealii::Triangulation<dim> const & triangulation_2)
+{
+  auto const get_locally_owned_cells = [](dealii::Triangulation<dim> const & triangulation) {
+    std::vector<dealii::CellId> cells;
+    for(auto const & cell : triangulation.active_cell_iterators())
+      if(cell->is_locally_owned())
+        cells.push_back(cell->id());
+    return cells;
+  };
+
+  bool const locally_equal =
+    triangulation_1.n_global_active_cells() == triangulation_2.n_global_active_cells() and
+    compute_mesh_hash(triangulation_1, 0 /* degree */) ==
+      compute_mesh_hash(triangulation_2, 0 /* degree */) and
+    get_locally_owned_cells(triangulation_1) == get_locally_owned_cells(triangulation_2);
+
+  return dealii::Utilities::MPI::min(static_cast<int>(locally_equal),
+                                     triangulation_1.get_communicator()) == 1;
+}
+
 /**
  * Function to create the coarse_triangulations and coarse_periodic_face_pairs given the
  * fine_triangulation and fine_periodic_face_pairs.
+ *
+ * Coarse triangulations that have not been changed by the adaptive mesh refinement are replaced
+ * by the previous triangulation objects. This allows multigrid to identify and reuse the data
+ * structures set up on these levels, see MultigridPreconditionerBase::initialize().
  */
 template<int dim>
 inline void
@@ -592,11 +661,31 @@ create_coarse_triangulations_after_coarsening_and_refinement(
                     " requires boundary cells to be preserved."));
     }
 
+    std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> const
+      coarse_triangulations_old = coarse_triangulations_const;
+    std::vector<PeriodicFacePairs<dim>> const coarse_periodic_face_pairs_old =
+      coarse_periodic_face_pairs;
+
     create_coarse_triangulations_automatically_from_fine_triangulation(fine_triangulation,
                                                                        fine_periodic_face_pairs,
                                                                        coarse_triangulations_const,
                                                                        coarse_periodic_face_pairs,
                                                                        data);
+
+    // The first entry corresponds to the coarsest level, which is why the levels of the old and
+    // new vectors of triangulations can be compared entry by entry. A kept level also keeps the
+    // periodic face pairs it has been set up with.
+    for(unsigned int level = 0;
+        level < std::min(coarse_triangulations_old.size(), coarse_triangulations_const.size());
+        ++level)
+    {
+      if(triangulations_are_equal(*coarse_triangulations_old[level],
+                                  *coarse_triangulations_const[level]))
+      {
+        coarse_triangulations_const[level] = coarse_triangulations_old[level];
+        coarse_periodic_face_pairs[level]  = coarse_periodic_face_pairs_old[level];
+      }
+    }
   }
   else if(data.triangulation_type == TriangulationType::FullyDistributed)
   {
@@ -613,6 +702,10 @@ create_coarse_triangulations_after_coarsening_and_refinement(
 /**
  * This function reads an external triangulation. The function takes GridData as an argument
  * and stores the external triangulation in "tria".
+ *
+ * For TriangulationType::FullyDistributed, large grids should only be read by few processes, see
+ * GridData::group_size_fully_distributed, and the partitioned triangulation can be cached, see
+ * GridData::triangulation_cache_file.
  */
 template<int dim>
 inline void
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_GRID_MAPPING_DEFORMATION_FUNCTION_H_
 #define INCLUDE_GRID_MAPPING_DEFORMATION_FUNCTION_H_
 
+// deal.II
+#include <deal.II/base/thread_local_storage.h>
+
+// ExaDG
 #include <exadg/grid/grid_data.h>
 #include <exadg/grid/mapping_deformation_base.h>
 
@@ -80,23 +84,31 @@ private:
   do_initialize(dealii::Triangulation<dim> const &     triangulation,
                 std::shared_ptr<dealii::Function<dim>> displacement_function)
   {
-    AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
-
     AssertThrow(get_element_type(triangulation) == ElementType::Hypercube,
                 dealii::ExcMessage("Only implemented for hypercube elements."));
 
     // dummy FE for compatibility with interface of dealii::FEValues
-    dealii::FE_Nothing<dim> dummy_fe;
-    dealii::FEValues<dim>   fe_values(*this->mapping_undeformed,
-                                    dummy_fe,
-                                    dealii::QGaussLobatto<dim>(this->mapping_q_cache->get_degree() +
-                                                               1),
-                                    dealii::update_quadrature_points);
+    dealii::FE_Nothing<dim>          dummy_fe;
+    dealii::QGaussLobatto<dim> const quadrature(this->mapping_q_cache->get_degree() + 1);
+
+    // dealii::MappingQCache::initialize() processes the cells in parallel if several threads are
+    // available, so we need one dealii::FEValues object per thread
+    dealii::Threads::ThreadLocalStorage<std::shared_ptr<dealii::FEValues<dim>>> fe_values_thread;
 
     this->mapping_q_cache->initialize(
       triangulation,
       [&](typename dealii::Triangulation<dim>::cell_iterator const & cell)
         -> std::vector<dealii::Point<dim>> {
+        std::shared_ptr<dealii::FEValues<dim>> & fe_values_ptr = fe_values_thread.get();
+        if(fe_values_ptr.get() == nullptr)
+        {
+          fe_values_ptr = std::make_shared<dealii::FEValues<dim>>(*this->mapping_undeformed,
+                                                                  dummy_fe,
+                                                                  quadrature,
+                                                                  dealii::update_quadrature_points);
+        }
+
+        dealii::FEValues<dim> & fe_values = *fe_values_ptr;
         fe_values.reinit(cell);
 
         // compute displacement and add to original position
@@ -25,7 +25,7 @@
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mg_level_object.h>
-#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/fe/fe_nothing.h>
 #include <deal.II/fe/fe_q.h>
@@ -213,8 +213,6 @@ public:
                                      VectorType const &              displacement_vector,
                                      dealii::DoFHandler<dim> const & dof_handler)
   {
-    AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
-
     AssertThrow(mapping_q_cache.get(),
                 dealii::ExcMessage("Mapping object mapping_q_cache is not initialized."));
 
@@ -233,22 +231,16 @@ public:
     AssertThrow(get_element_type(dof_handler.get_triangulation()) == ElementType::Hypercube,
                 dealii::ExcMessage("Only implemented for hypercube elements."));
 
-    std::shared_ptr<dealii::FEValues<dim>> fe_values;
-
     // Set up dealii::FEValues with FE_Nothing and the Gauss-Lobatto quadrature to
     // reduce setup cost, as we only use the geometry information (this means
     // we need to call fe_values.reinit(cell) with Triangulation::cell_iterator
-    // rather than dealii::DoFHandler::cell_iterator).
-    dealii::FE_Nothing<dim> fe_nothing;
+    // rather than dealii::DoFHandler::cell_iterator). Since dealii::MappingQCache::initialize()
+    // processes the cells in parallel if several threads are available, one dealii::FEValues
+    // object is created per thread.
+    dealii::FE_Nothing<dim>          fe_nothing;
+    dealii::QGaussLobatto<dim> const quadrature(mapping_q_cache->get_degree() + 1);
 
-    if(mapping.get() != 0)
-    {
-      fe_values = std::make_shared<dealii::FEValues<dim>>(*mapping,
-                                                          fe_nothing,
-                                                          dealii::QGaussLobatto<dim>(
-                                                            mapping_q_cache->get_degree() + 1),
-                                                          dealii::update_quadrature_points);
-    }
+    dealii::Threads::ThreadLocalStorage<std::shared_ptr<dealii::FEValues<dim>>> fe_values;
 
     // take the grid coordinates described by mapping and add deformation described by displacement
     // vector
@@ -263,12 +255,19 @@ public:
 
         if(mapping.get() != 0)
         {
-          fe_values->reinit(cell_tria);
+          std::shared_ptr<dealii::FEValues<dim>> & fe_values_thread = fe_values.get();
+          if(fe_values_thread.get() == nullptr)
+          {
+            fe_values_thread = std::make_shared<dealii::FEValues<dim>>(
+              *mapping, fe_nothing, quadrature, dealii::update_quadrature_points);
+          }
+
+          fe_values_thread->reinit(cell_tria);
           // extract displacement and add to original position
           for(unsigned int i = 0; i < scalar_dofs_per_cell; ++i)
           {
             grid_coordinates[i] =
-              fe_values->quadrature_point(this->hierarchic_to_lexicographic_numbering[i]);
+              fe_values_thread->quadrature_point(this->hierarchic_to_lexicographic_numbering[i]);
           }
         }
 
@@ -340,8 +339,6 @@ initialize_coarse_mappings_from_mapping_dof_vector(
   std::shared_ptr<MappingDoFVector<dim, Number> const> const &  fine_mapping,
   dealii::Triangulation<dim> const &                            triangulation)
 {
-  AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
-
   std::shared_ptr<dealii::MappingQCache<dim>> mapping_q_cache = fine_mapping->get_mapping_q_cache();
   AssertThrow(mapping_q_cache.get(),
               dealii::ExcMessage("Shared pointer mapping_q_cache is invalid."));
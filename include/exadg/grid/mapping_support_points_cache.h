@@ -0,0 +1,227 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_MAPPING_SUPPORT_POINTS_CACHE_H_
+#define INCLUDE_EXADG_GRID_MAPPING_SUPPORT_POINTS_CACHE_H_
+
+// C/C++
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
+#include <deal.II/grid/tria.h>
+
+namespace ExaDG
+{
+namespace GridUtilities
+{
+/**
+ * Returns a hash of the locally relevant part of the triangulation, i.e., of the IDs, the vertex
+ * coordinates and the manifold IDs of all cells that are not artificial and of their faces (and
+ * lines in 3D), of the types of the manifolds attached to the triangulation, and of the mapping
+ * degree. The manifold information is needed since the support points of a mapping depend on the
+ * manifolds, which can change while the vertices remain the same.
+ */
+template<int dim>
+std::uint64_t
+compute_mesh_hash(dealii::Triangulation<dim> const & triangulation, unsigned int const degree)
+{
+  // FNV-1a
+  std::uint64_t hash = 14695981039346656037ull;
+
+  auto const add = [&](void const * data, std::size_t const n_bytes) {
+    unsigned char const * bytes = static_cast<unsigned char const *>(data);
+    for(std::size_t i = 0; i < n_bytes; ++i)
+    {
+      hash ^= bytes[i];
+      hash *= 1099511628211ull;
+    }
+  };
+
+  std::set<dealii::types::manifold_id> manifold_ids;
+
+  auto const add_manifold_id = [&](dealii::types::manifold_id const manifold_id) {
+    add(&manifold_id, sizeof(manifold_id));
+    manifold_ids.insert(manifold_id);
+  };
+
+  std::uint64_t const n_global_active_cells = triangulation.n_global_active_cells();
+  add(&n_global_active_cells, sizeof(n_global_active_cells));
+  add(&degree, sizeof(degree));
+
+  for(auto const & cell : triangulation.cell_iterators())
+  {
+    if(cell->is_active() and cell->is_artificial())
+      continue;
+
+    std::string const id = cell->id().to_string();
+    add(id.data(), id.size());
+
+    for(unsigned int const v : cell->vertex_indices())
+      add(&cell->vertex(v), sizeof(dealii::Point<dim>));
+
+    add_manifold_id(cell->manifold_id());
+    for(unsigned int const f : cell->face_indices())
+      add_manifold_id(cell->face(f)->manifold_id());
+    if(dim == 3)
+      for(unsigned int const l : cell->line_indices())
+        add_manifold_id(cell->line(l)->manifold_id());
+  }
+
+  for(dealii::types::manifold_id const manifold_id : manifold_ids)
+  {
+    std::string const type = typeid(triangulation.get_manifold(manifold_id)).name();
+    add(type.data(), type.size());
+  }
+
+  return hash;
+}
+
+/**
+ * Creates a dealii::MappingQCache that stores the support points of @param mapping for all
+ * cells of @param triangulation. Computing the support points of high-order mappings on curved
+ * geometries can be expensive, since it requires to query the manifolds of the triangulation. With
+ * the cached mapping, this is done only once for all MatrixFree objects (quadrature rules,
+ * multigrid levels) instead of once per MatrixFree::reinit().
+ *
+ * In addition, the support points are stored in binary files (one per process, @param file_name
+ * extended by the rank) together with a hash of the mesh. Subsequent runs on the same mesh with
+ * the same number of processes, e.g., parameter studies, read the support points from these files
+ * instead of computing them. The files are rewritten if the mesh has changed.
+ *
+ * The cached mapping is only valid for @param triangulation and has to be recreated if the
+ * triangulation changes.
+ */
+template<int dim>
+std::shared_ptr<dealii::MappingQCache<dim>>
+create_mapping_q_cache(dealii::Mapping<dim> const &       mapping,
+                       dealii::Triangulation<dim> const & triangulation,
+                       std::string const &                file_name)
+{
+  dealii::MappingQ<dim> const * mapping_q = dynamic_cast<dealii::MappingQ<dim> const *>(&mapping);
+
+  AssertThrow(mapping_q != nullptr,
+              dealii::ExcMessage("Caching the mapping is only implemented for dealii::MappingQ."));
+
+  unsigned int const degree = mapping_q->get_degree();
+
+  std::string const file_name_rank =
+    file_name + "." +
+    std::to_string(dealii::Utilities::MPI::this_mpi_process(triangulation.get_communicator()));
+
+  std::uint64_t const hash = compute_mesh_hash(triangulation, degree);
+
+  typedef std::map<std::string, std::vector<dealii::Point<dim>>> SupportPoints;
+
+  // read support points from file if the file has been written for the same mesh
+  SupportPoints support_points_file;
+  {
+    std::ifstream file(file_name_rank, std::ios::binary);
+
+    std::uint64_t hash_file = 0, n_cells = 0;
+    if(file.read(reinterpret_cast<char *>(&hash_file), sizeof(hash_file)) and hash_file == hash and
+       file.read(reinterpret_cast<char *>(&n_cells), sizeof(n_cells)))
+    {
+      for(std::uint64_t c = 0; c < n_cells; ++c)
+      {
+        std::uint32_t n_characters = 0, n_points = 0;
+        file.read(reinterpret_cast<char *>(&n_characters), sizeof(n_characters));
+
+        std::string id(n_characters, ' ');
+        file.read(&id[0], n_characters);
+
+        file.read(reinterpret_cast<char *>(&n_points), sizeof(n_points));
+
+        std::vector<dealii::Point<dim>> points(n_points);
+        file.read(reinterpret_cast<char *>(points.data()), n_points * sizeof(dealii::Point<dim>));
+
+        AssertThrow(file, dealii::ExcMessage("Invalid mapping cache file " + file_name_rank));
+
+        support_points_file.emplace(id, std::move(points));
+      }
+    }
+  }
+
+  // support points of cells not found in the file, possibly computed concurrently
+  SupportPoints support_points_computed;
+  std::mutex    mutex;
+
+  std::shared_ptr<dealii::MappingQCache<dim>> mapping_q_cache =
+    std::make_shared<dealii::MappingQCache<dim>>(degree);
+
+  mapping_q_cache->initialize(
+    triangulation, [&](typename dealii::Triangulation<dim>::cell_iterator const & cell) {
+      std::string const id = cell->id().to_string();
+
+      auto const it = support_points_file.find(id);
+      if(it != support_points_file.end())
+        return it->second;
+
+      std::vector<dealii::Point<dim>> const points =
+        mapping_q->compute_mapping_support_points(cell);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      support_points_computed.emplace(id, points);
+
+      return points;
+    });
+
+  // write the support points of all cells if some of them have been computed
+  if(not support_points_computed.empty())
+  {
+    support_points_file.insert(support_points_computed.begin(), support_points_computed.end());
+
+    std::ofstream file(file_name_rank, std::ios::binary | std::ios::trunc);
+
+    std::uint64_t const n_cells = support_points_file.size();
+    file.write(reinterpret_cast<char const *>(&hash), sizeof(hash));
+    file.write(reinterpret_cast<char const *>(&n_cells), sizeof(n_cells));
+
+    for(auto const & [id, points] : support_points_file)
+    {
+      std::uint32_t const n_characters = id.size(), n_points = points.size();
+      file.write(reinterpret_cast<char const *>(&n_characters), sizeof(n_characters));
+      file.write(id.data(), n_characters);
+      file.write(reinterpret_cast<char const *>(&n_points), sizeof(n_points));
+      file.write(reinterpret_cast<char const *>(points.data()),
+                 n_points * sizeof(dealii::Point<dim>));
+    }
+
+    AssertThrow(file, dealii::ExcMessage("Could not write mapping cache file " + file_name_rank));
+  }
+
+  return mapping_q_cache;
+}
+
+} // namespace GridUtilities
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_MAPPING_SUPPORT_POINTS_CACHE_H_ */
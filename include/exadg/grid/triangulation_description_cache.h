@@ -0,0 +1,250 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_TRIANGULATION_DESCRIPTION_CACHE_H_
+#define INCLUDE_EXADG_GRID_TRIANGULATION_DESCRIPTION_CACHE_H_
+
+// C/C++
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/grid/tria_description.h>
+
+namespace ExaDG
+{
+namespace GridUtilities
+{
+/**
+ * Returns the name of the cache file for a fully-distributed triangulation with the given
+ * refinements. The refinements are part of the name, since the coarse triangulations for multigrid
+ * are created with the same GridData as the fine triangulation.
+ */
+inline std::string
+get_triangulation_cache_file_name(std::string const &               base_name,
+                                  unsigned int const                global_refinements,
+                                  std::vector<unsigned int> const & vector_local_refinements,
+                                  bool const                        construct_multigrid_hierarchy)
+{
+  std::string file_name = base_name + "_refine_" + std::to_string(global_refinements);
+
+  for(unsigned int const local_refinements : vector_local_refinements)
+    file_name += "_" + std::to_string(local_refinements);
+
+  if(construct_multigrid_hierarchy)
+    file_name += "_mg";
+
+  return file_name + ".bin";
+}
+
+/**
+ * The MPI-IO functions take the number of elements as int, which overflows for buffers larger
+ * than 2 GB. The buffers are therefore read and written in chunks. Since the MPI-IO functions
+ * used here are collective, all processes of @param mpi_comm perform the same number of calls.
+ */
+inline std::uint64_t
+get_n_mpi_io_chunks(std::uint64_t const size, MPI_Comm const & mpi_comm)
+{
+  std::uint64_t const max_chunk_size = std::uint64_t(1) << 30;
+
+  return dealii::Utilities::MPI::max((size + max_chunk_size - 1) / max_chunk_size, mpi_comm);
+}
+
+inline void
+write_at_all_in_chunks(MPI_File &                file,
+                       std::uint64_t const       offset,
+                       std::vector<char> const & buffer,
+                       MPI_Comm const &          mpi_comm)
+{
+  std::uint64_t const max_chunk_size = std::uint64_t(1) << 30;
+  std::uint64_t const n_chunks       = get_n_mpi_io_chunks(buffer.size(), mpi_comm);
+
+  for(std::uint64_t chunk = 0; chunk < n_chunks; ++chunk)
+  {
+    std::uint64_t const begin = std::min<std::uint64_t>(chunk * max_chunk_size, buffer.size());
+    std::uint64_t const end   = std::min<std::uint64_t>(begin + max_chunk_size, buffer.size());
+
+    int const ierr = MPI_File_write_at_all(file,
+                                           offset + begin,
+                                           buffer.data() + begin,
+                                           static_cast<int>(end - begin),
+                                           MPI_BYTE,
+                                           MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+}
+
+inline void
+read_at_all_in_chunks(MPI_File &          file,
+                      std::uint64_t const offset,
+                      std::vector<char> & buffer,
+                      MPI_Comm const &    mpi_comm)
+{
+  std::uint64_t const max_chunk_size = std::uint64_t(1) << 30;
+  std::uint64_t const n_chunks       = get_n_mpi_io_chunks(buffer.size(), mpi_comm);
+
+  for(std::uint64_t chunk = 0; chunk < n_chunks; ++chunk)
+  {
+    std::uint64_t const begin = std::min<std::uint64_t>(chunk * max_chunk_size, buffer.size());
+    std::uint64_t const end   = std::min<std::uint64_t>(begin + max_chunk_size, buffer.size());
+
+    int const ierr = MPI_File_read_at_all(file,
+                                          offset + begin,
+                                          buffer.data() + begin,
+                                          static_cast<int>(end - begin),
+                                          MPI_BYTE,
+                                          MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+}
+
+/**
+ * Writes the descriptions of the locally relevant parts of a fully-distributed triangulation of
+ * all processes of @param mpi_comm into a single binary file using MPI-IO. The file starts with
+ * a header containing the dimension, the number of processes and the sizes of the serialized
+ * descriptions of all processes, followed by the serialized descriptions in the order of the
+ * ranks.
+ */
+template<int dim>
+void
+write_triangulation_description(
+  dealii::TriangulationDescription::Description<dim, dim> const & description,
+  std::string const &                                             file_name,
+  MPI_Comm const &                                                mpi_comm)
+{
+  std::vector<char> const buffer = dealii::Utilities::pack(description, false);
+
+  std::vector<std::uint64_t> const sizes =
+    dealii::Utilities::MPI::all_gather(mpi_comm, static_cast<std::uint64_t>(buffer.size()));
+
+  unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  std::vector<std::uint64_t> header = {static_cast<std::uint64_t>(dim),
+                                        static_cast<std::uint64_t>(sizes.size())};
+  header.insert(header.end(), sizes.begin(), sizes.end());
+
+  std::uint64_t offset = header.size() * sizeof(std::uint64_t);
+  for(unsigned int r = 0; r < rank; ++r)
+    offset += sizes[r];
+
+  MPI_File file;
+
+  int ierr = MPI_File_open(
+    mpi_comm, file_name.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+  AssertThrowMPI(ierr);
+
+  // remove the content of a previous file of the same name
+  ierr = MPI_File_set_size(file, 0);
+  AssertThrowMPI(ierr);
+
+  if(rank == 0)
+  {
+    ierr = MPI_File_write_at(file,
+                             0,
+                             header.data(),
+                             header.size() * sizeof(std::uint64_t),
+                             MPI_BYTE,
+                             MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+  }
+
+  write_at_all_in_chunks(file, offset, buffer, mpi_comm);
+
+  ierr = MPI_File_close(&file);
+  AssertThrowMPI(ierr);
+}
+
+/**
+ * Reads the description of the locally relevant part of a fully-distributed triangulation from a
+ * file written by write_triangulation_description(). Returns false if the file does not exist or
+ * if it has been written for a different dimension or number of processes. This function has to
+ * be called by all processes of @param mpi_comm.
+ */
+template<int dim>
+bool
+read_triangulation_description(
+  dealii::TriangulationDescription::Description<dim, dim> & description,
+  std::string const &                                       file_name,
+  MPI_Comm const &                                          mpi_comm)
+{
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  int file_exists = 0;
+  if(rank == 0)
+    file_exists = std::ifstream(file_name).good();
+  if(dealii::Utilities::MPI::max(file_exists, mpi_comm) == 0)
+    return false;
+
+  MPI_File file;
+
+  int ierr = MPI_File_open(mpi_comm, file_name.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+  AssertThrowMPI(ierr);
+
+  // all processes read the same header, so that they take the same decision
+  std::uint64_t dimension_and_n_ranks[2] = {0, 0};
+
+  ierr = MPI_File_read_at_all(
+    file, 0, dimension_and_n_ranks, 2 * sizeof(std::uint64_t), MPI_BYTE, MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  if(dimension_and_n_ranks[0] != dim or dimension_and_n_ranks[1] != n_ranks)
+  {
+    ierr = MPI_File_close(&file);
+    AssertThrowMPI(ierr);
+    return false;
+  }
+
+  std::vector<std::uint64_t> sizes(n_ranks);
+  ierr = MPI_File_read_at_all(file,
+                              2 * sizeof(std::uint64_t),
+                              sizes.data(),
+                              n_ranks * sizeof(std::uint64_t),
+                              MPI_BYTE,
+                              MPI_STATUS_IGNORE);
+  AssertThrowMPI(ierr);
+
+  std::uint64_t offset = (2 + n_ranks) * sizeof(std::uint64_t);
+  for(unsigned int r = 0; r < rank; ++r)
+    offset += sizes[r];
+
+  std::vector<char> buffer(sizes[rank]);
+  read_at_all_in_chunks(file, offset, buffer, mpi_comm);
+
+  ierr = MPI_File_close(&file);
+  AssertThrowMPI(ierr);
+
+  description =
+    dealii::Utilities::unpack<dealii::TriangulationDescription::Description<dim, dim>>(buffer,
+                                                                                        false);
+
+  return true;
+}
+
+} // namespace GridUtilities
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_TRIANGULATION_DESCRIPTION_CACHE_H_ */
@@ -275,6 +275,17 @@ Driver<dim, Number>::setup()
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
 
+  unsigned int n_scalars_explicit_rk = 0;
+  for(unsigned int i = 0; i < n_scalars; ++i)
+  {
+    if(application->scalars[i]->get_parameters().temporal_discretization ==
+       ConvDiff::TemporalDiscretization::ExplRK)
+      ++n_scalars_explicit_rk;
+  }
+
+  if(n_scalars_explicit_rk > 1)
+    shared_transport_velocity = std::make_shared<ConvDiff::SharedTransportVelocity<Number>>();
+
   for(unsigned int i = 0; i < n_scalars; ++i)
   {
     // initialize time integrator
@@ -286,6 +297,15 @@ Driver<dim, Number>::setup()
                                                     mpi_comm,
                                                     is_test);
 
+    if(shared_transport_velocity.get() and
+       application->scalars[i]->get_parameters().temporal_discretization ==
+         ConvDiff::TemporalDiscretization::ExplRK)
+    {
+      std::shared_ptr<ConvDiff::TimeIntExplRK<Number>> time_int_scalar =
+        std::dynamic_pointer_cast<ConvDiff::TimeIntExplRK<Number>>(scalar_time_integrator[i]);
+      time_int_scalar->set_shared_transport_velocity(shared_transport_velocity);
+    }
+
     if(application->scalars[i]->get_parameters().restarted_simulation == false and
        application->scalars[i]->get_parameters().temporal_discretization ==
          ConvDiff::TemporalDiscretization::BDF)
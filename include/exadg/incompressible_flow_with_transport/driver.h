@@ -141,6 +141,10 @@ private:
 
   std::vector<std::shared_ptr<TimeIntBase>> scalar_time_integrator;
 
+  // The velocity interpolated in time is shared by all scalars that use explicit Runge-Kutta
+  // time integration, so that the interpolation is done only once per stage.
+  std::shared_ptr<ConvDiff::SharedTransportVelocity<Number>> shared_transport_velocity;
+
   mutable dealii::LinearAlgebra::distributed::Vector<Number> temperature;
 
   /*
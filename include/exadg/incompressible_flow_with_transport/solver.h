@@ -114,6 +114,8 @@ main(int argc, char ** argv)
 
   ExaDG::GeneralParameters general(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   // run the simulation
   if(general.dim == 2 and general.precision == "float")
   {
@@ -25,9 +25,11 @@
 #endif
 
 // ExaDG
+#include <exadg/grid/mapping_support_points_cache.h>
 #include <exadg/incompressible_navier_stokes/driver.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
+#include <exadg/operators/error_indicators.h>
 #include <exadg/operators/throughput_parameters.h>
 #include <exadg/utilities/print_solver_results.h>
 
@@ -44,7 +46,8 @@ Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
     is_test(is_test),
     is_throughput_study(is_throughput_study),
-    application(app)
+    application(app),
+    timer_tree_setup(new TimerTree())
 {
   print_general_info<Number>(pcout, mpi_comm, is_test);
 }
@@ -58,11 +61,32 @@ Driver<dim, Number>::setup()
 
   pcout << std::endl << "Setting up incompressible Navier-Stokes solver:" << std::endl;
 
+  dealii::Timer sub_timer;
+
   application->setup(grid, mapping, multigrid_mappings);
 
+  // replace the mapping by a mapping with cached support points
+  std::string const & mapping_cache_file = application->get_parameters().grid.mapping_cache_file;
+  if(not mapping_cache_file.empty())
+  {
+    AssertThrow(not application->get_parameters().grid.create_coarse_triangulations,
+                dealii::ExcMessage("Caching the mapping is not implemented for coarse "
+                                   "triangulations."));
+
+    mapping =
+      GridUtilities::create_mapping_q_cache(*mapping, *grid->triangulation, mapping_cache_file);
+
+    if(multigrid_mappings.get())
+      multigrid_mappings->set_fine_level_mapping(mapping);
+  }
+
+  timer_tree_setup->insert({"Setup", "Grid and mapping"}, sub_timer.wall_time());
+
   // moving mesh (ALE formulation)
   bool const ale = application->get_parameters().ale_formulation;
 
+  sub_timer.restart();
+
   if(ale)
   {
     if(application->get_parameters().mesh_movement_type == MeshMovementType::Function)
@@ -145,14 +169,23 @@ Driver<dim, Number>::setup()
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
 
+  if(ale)
+    timer_tree_setup->insert({"Setup", "ALE"}, sub_timer.wall_time());
+
   // setup Navier-Stokes operator
   pde_operator->setup();
 
+  timer_tree_setup->insert({"Setup"}, pde_operator->get_timings_setup());
+
   if(not is_throughput_study)
   {
     // setup postprocessor
+    sub_timer.restart();
     postprocessor = application->create_postprocessor();
     postprocessor->setup(*pde_operator);
+    timer_tree_setup->insert({"Setup", "Postprocessor"}, sub_timer.wall_time());
+
+    sub_timer.restart();
 
     if(application->get_parameters().solver_type == SolverType::Unsteady)
     {
@@ -176,9 +209,11 @@ Driver<dim, Number>::setup()
     {
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
+
+    timer_tree_setup->insert({"Setup", "Time integrator"}, sub_timer.wall_time());
   }
 
-  timer_tree.insert({"Incompressible flow", "Setup"}, timer.wall_time());
+  timer_tree_setup->insert({"Setup"}, timer.wall_time());
 }
 
 template<int dim, typename Number>
@@ -209,6 +244,92 @@ Driver<dim, Number>::ale_update() const
 }
 
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::mark_cells_coarsening_and_refinement(dealii::Triangulation<dim> & tria,
+                                                          VectorType const & velocity) const
+{
+  Parameters const & param = application->get_parameters();
+
+  if(param.amr_data.error_indicator == ErrorIndicator::Kelly)
+  {
+    mark_cells_kelly_error_estimator(tria,
+                                     pde_operator->get_dof_handler_u(),
+                                     pde_operator->get_constraint_u(),
+                                     *pde_operator->get_mapping(),
+                                     velocity,
+                                     param.degree_u + 1 /* n_face_quadrature_points */,
+                                     param.amr_data);
+  }
+  else
+  {
+    mark_cells_matrix_free_error_indicator<dim, dim, Number>(
+      tria,
+      pde_operator->get_matrix_free(),
+      pde_operator->get_constraint_u(),
+      pde_operator->get_dof_index_velocity(),
+      pde_operator->get_quad_index_velocity_standard(),
+      velocity,
+      param.amr_data);
+  }
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_after_coarsening_and_refinement() const
+{
+  // Update mapping
+  AssertThrow(ale_mapping.get() == 0,
+              dealii::ExcMessage(
+                "Combination of adaptive mesh refinement and ALE not implemented."));
+
+  std::shared_ptr<dealii::MappingQCache<dim>> mapping_q_cache =
+    std::dynamic_pointer_cast<dealii::MappingQCache<dim>>(mapping);
+  AssertThrow(
+    mapping_q_cache.get() == 0,
+    dealii::ExcMessage(
+      "Combination of adaptive mesh refinement and dealii::MappingQCache not implemented."));
+
+  pde_operator->setup_after_coarsening_and_refinement();
+
+  postprocessor->setup_after_coarsening_and_refinement();
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::do_adaptive_refinement() const
+{
+  limit_coarsening_and_refinement(*grid->triangulation, application->get_parameters().amr_data);
+
+  if(any_cells_flagged_for_coarsening_or_refinement(*grid->triangulation))
+  {
+    dealii::Timer timer;
+
+    grid->triangulation->prepare_coarsening_and_refinement();
+
+    time_integrator->prepare_coarsening_and_refinement();
+
+    grid->triangulation->execute_coarsening_and_refinement();
+
+    if(application->get_parameters().involves_h_multigrid())
+    {
+      GridUtilities::create_coarse_triangulations_after_coarsening_and_refinement(
+        *grid->triangulation,
+        grid->periodic_face_pairs,
+        grid->coarse_triangulations,
+        grid->coarse_periodic_face_pairs,
+        application->get_parameters().grid,
+        application->get_parameters().amr_data.preserve_boundary_cells);
+    }
+
+    setup_after_coarsening_and_refinement();
+
+    time_integrator->interpolate_after_coarsening_and_refinement();
+
+    timer_tree.insert({"Incompressible flow", "Adaptive mesh refinement"}, timer.wall_time());
+  }
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve() const
@@ -218,7 +339,30 @@ Driver<dim, Number>::solve() const
     // stability analysis (uncomment if desired)
     // time_integrator->postprocessing_stability_analysis();
 
-    if(application->get_parameters().ale_formulation == true)
+    if(application->get_parameters().enable_adaptivity)
+    {
+      do
+      {
+        time_integrator->advance_one_timestep_pre_solve(true);
+
+        time_integrator->advance_one_timestep_solve();
+
+        // Adapt the mesh before post_solve(), in order to recalculate the
+        // time step size based on the new mesh.
+        if(trigger_coarsening_and_refinement_now(
+             application->get_parameters().amr_data.trigger_every_n_time_steps,
+             time_integrator->get_number_of_time_steps()))
+        {
+          mark_cells_coarsening_and_refinement(*grid->triangulation,
+                                               time_integrator->get_velocity_np());
+
+          do_adaptive_refinement();
+        }
+
+        time_integrator->advance_one_timestep_post_solve();
+      } while(not(time_integrator->finished()));
+    }
+    else if(application->get_parameters().ale_formulation == true)
     {
       while(not(time_integrator->finished()))
       {
@@ -280,6 +424,8 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   // Wall times
   timer_tree.insert({"Incompressible flow"}, total_time);
 
+  timer_tree.insert({"Incompressible flow"}, timer_tree_setup);
+
   if(application->get_parameters().solver_type == SolverType::Unsteady)
   {
     timer_tree.insert({"Incompressible flow"}, time_integrator->get_timings());
@@ -295,6 +441,9 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  pcout << std::endl << "Timings of setup:" << std::endl;
+  timer_tree_setup->print_level(pcout, timer_tree_setup->get_max_level());
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -35,6 +35,7 @@
 #include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_pressure_correction.h>
 #include <exadg/incompressible_navier_stokes/user_interface/application_base.h>
 #include <exadg/matrix_free/matrix_free_data.h>
+#include <exadg/operators/adaptive_mesh_refinement.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/utilities/print_general_infos.h>
 
@@ -148,6 +149,16 @@ private:
   void
   ale_update() const;
 
+  void
+  mark_cells_coarsening_and_refinement(dealii::Triangulation<dim> & tria,
+                                       VectorType const &           velocity) const;
+
+  void
+  setup_after_coarsening_and_refinement() const;
+
+  void
+  do_adaptive_refinement() const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
@@ -204,6 +215,9 @@ private:
    * Computation time (wall clock time).
    */
   mutable TimerTree timer_tree;
+
+  // detailed wall times of the setup, inserted into timer_tree when printing the results
+  std::shared_ptr<TimerTree> timer_tree_setup;
 };
 
 } // namespace IncNS
@@ -40,7 +40,9 @@ DivergenceAndMassErrorCalculator<dim, Number>::DivergenceAndMassErrorCalculator(
     mass_sample(0.0),
     matrix_free(nullptr),
     dof_index(0),
-    quad_index(0)
+    quad_index(0),
+    fused_evaluator(nullptr),
+    fused_kernel_index(0)
 {
 }
 
@@ -85,6 +87,17 @@ DivergenceAndMassErrorCalculator<dim, Number>::do_evaluate(
   Number &                                mass_error,
   Number &                                mass_error_reference)
 {
+  if(fused_evaluator != nullptr and fused_evaluator->has_results(fused_kernel_index, velocity))
+  {
+    // the integrals have already been computed together with other postprocessing tools
+    div_error            = fused_evaluator->get_sum(fused_kernel_index, 0);
+    div_error_reference  = fused_evaluator->get_sum(fused_kernel_index, 1);
+    mass_error           = fused_evaluator->get_sum(fused_kernel_index, 2);
+    mass_error_reference = fused_evaluator->get_sum(fused_kernel_index, 3);
+
+    return;
+  }
+
   std::vector<Number> dst(4, 0.0);
   matrix_free.loop(&This::local_compute_div,
                    &This::local_compute_div_face,
@@ -99,6 +112,57 @@ DivergenceAndMassErrorCalculator<dim, Number>::do_evaluate(
   mass_error_reference = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
 }
 
+template<int dim, typename Number>
+unsigned int
+DivergenceAndMassErrorCalculator<dim, Number>::register_fused_integrals(
+  FusedIntegralEvaluator<dim, Number> & evaluator)
+{
+  // the integrals are computed by the loops of this class if the evaluator uses different data,
+  // e.g., a different quadrature rule
+  if(&evaluator.get_matrix_free() != matrix_free or
+     evaluator.get_dof_index_velocity() != dof_index or evaluator.get_quad_index() != quad_index)
+  {
+    fused_evaluator = nullptr;
+    return dealii::numbers::invalid_unsigned_int;
+  }
+
+  // the same integrals as in local_compute_div() and local_compute_div_face()
+  typename FusedIntegralEvaluator<dim, Number>::Kernel kernel;
+  kernel.n_sums = 4;
+
+  kernel.cell_evaluation_flags =
+    dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+  kernel.cell = [&](CellIntegratorU const & integrator, scalar * sums, scalar *) {
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      vector velocity = integrator.get_value(q);
+      sums[0] += integrator.JxW(q) * std::abs(integrator.get_divergence(q)) *
+                 dealii::make_vectorized_array<Number>(data.reference_length_scale);
+      sums[1] += integrator.JxW(q) * velocity.norm();
+    }
+  };
+
+  kernel.face_evaluation_flags = dealii::EvaluationFlags::values;
+  kernel.face = [&](FaceIntegratorU const & integrator_m,
+                    FaceIntegratorU const & integrator_p,
+                    scalar *                sums) {
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      sums[2] +=
+        integrator_m.JxW(q) * std::abs((integrator_m.get_value(q) - integrator_p.get_value(q)) *
+                                       integrator_m.get_normal_vector(q));
+      sums[3] += integrator_m.JxW(q) *
+                 std::abs(0.5 * (integrator_m.get_value(q) + integrator_p.get_value(q)) *
+                          integrator_m.get_normal_vector(q));
+    }
+  };
+
+  fused_evaluator    = &evaluator;
+  fused_kernel_index = evaluator.add_kernel(kernel);
+
+  return fused_kernel_index;
+}
+
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div(
@@ -136,6 +200,9 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div(
     }
   }
 
+  // the loop may be executed by several threads concurrently
+  std::lock_guard<std::mutex> lock(mutex);
+
   dst.at(0) += div * data.reference_length_scale;
   dst.at(1) += ref;
 }
@@ -184,6 +251,9 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_face(
     }
   }
 
+  // the loop may be executed by several threads concurrently
+  std::lock_guard<std::mutex> lock(mutex);
+
   dst.at(2) += diff_mass_flux;
   dst.at(3) += mean_mass_flux;
 }
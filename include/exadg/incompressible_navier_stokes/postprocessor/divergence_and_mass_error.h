@@ -22,11 +22,15 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_DIVERGENCE_AND_MASS_ERROR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_DIVERGENCE_AND_MASS_ERROR_H_
 
+// C/C++
+#include <mutex>
+
 // deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/fused_integral_evaluation.h>
 #include <exadg/postprocessor/time_control.h>
 #include <exadg/utilities/print_functions.h>
 
@@ -84,6 +88,13 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Registers the integrals computed by this class with @param evaluator and returns the index of
+   * the kernel, see KineticEnergyCalculator::register_fused_integrals().
+   */
+  unsigned int
+  register_fused_integrals(FusedIntegralEvaluator<dim, Number> & evaluator);
+
   TimeControl time_control;
 
 private:
@@ -142,6 +153,12 @@ private:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   MassConservationData                    data;
+
+  FusedIntegralEvaluator<dim, Number> const * fused_evaluator;
+  unsigned int                                fused_kernel_index;
+
+  // protects the accumulation of the results of the local loops in task-parallel loops
+  std::mutex mutex;
 };
 
 
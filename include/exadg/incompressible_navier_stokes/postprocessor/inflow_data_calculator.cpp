@@ -22,7 +22,6 @@
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/linear_interpolation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/inflow_data_calculator.h>
-#include <exadg/postprocessor/solution_interpolation.h>
 
 namespace ExaDG
 {
@@ -31,7 +30,7 @@ namespace IncNS
 template<int dim, typename Number>
 InflowDataCalculator<dim, Number>::InflowDataCalculator(InflowData<dim> const & inflow_data_in,
                                                         MPI_Comm const &        comm)
-  : inflow_data(inflow_data_in), inflow_data_has_been_initialized(false), mpi_comm(comm)
+  : inflow_data(inflow_data_in), mpi_comm(comm)
 {
 }
 
@@ -41,110 +40,82 @@ InflowDataCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_han
                                          dealii::Mapping<dim> const &    mapping_in)
 {
   dof_handler_velocity = &dof_handler_velocity_in;
-  mapping              = &mapping_in;
 
-  array_dof_indices_and_shape_values.resize(inflow_data.n_points_y * inflow_data.n_points_z);
-  array_counter.resize(inflow_data.n_points_y * inflow_data.n_points_z);
-}
-
-template<int dim, typename Number>
-void
-InflowDataCalculator<dim, Number>::calculate(
-  dealii::LinearAlgebra::distributed::Vector<Number> const & velocity)
-{
   if(inflow_data.write_inflow_data == true)
   {
-    // initial data: do this expensive step only once at the beginning of the simulation
-    if(inflow_data_has_been_initialized == false)
+    unsigned int const n_points = inflow_data.n_points_y * inflow_data.n_points_z;
+
+    local_range = CachedPointEvaluation<dim>::get_local_range(n_points, mpi_comm);
+
+    // the velocity is evaluated in all points of the 2d grid, where each process evaluates a part
+    // of the points
+    std::vector<dealii::Point<dim>> points;
+    for(unsigned int array_index = local_range.first; array_index < local_range.second;
+        ++array_index)
     {
-      for(unsigned int iy = 0; iy < inflow_data.n_points_y; ++iy)
+      unsigned int const iy = array_index / inflow_data.n_points_z;
+      unsigned int const iz = array_index % inflow_data.n_points_z;
+
+      dealii::Point<dim> point;
+
+      if(inflow_data.inflow_geometry == InflowGeometry::Cartesian)
       {
-        for(unsigned int iz = 0; iz < inflow_data.n_points_z; ++iz)
-        {
-          dealii::Point<dim> point;
-
-          if(inflow_data.inflow_geometry == InflowGeometry::Cartesian)
-          {
-            AssertThrow(inflow_data.normal_direction == 0, dealii::ExcMessage("Not implemented."));
-
-            point = dealii::Point<dim>(inflow_data.normal_coordinate,
-                                       (*inflow_data.y_values)[iy],
-                                       (*inflow_data.z_values)[iz]);
-          }
-          else if(inflow_data.inflow_geometry == InflowGeometry::Cylindrical)
-          {
-            AssertThrow(inflow_data.normal_direction == 2, dealii::ExcMessage("Not implemented."));
-
-            Number const x = (*inflow_data.y_values)[iy] * std::cos((*inflow_data.z_values)[iz]);
-            Number const y = (*inflow_data.y_values)[iy] * std::sin((*inflow_data.z_values)[iz]);
-            point          = dealii::Point<dim>(x, y, inflow_data.normal_coordinate);
-          }
-          else
-          {
-            AssertThrow(false, dealii::ExcMessage("Not implemented."));
-          }
-
-          unsigned int array_index = iy * inflow_data.n_points_z + iz;
-
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            *mapping, dof_handler_velocity->get_triangulation(), point, 1.e-10);
-
-          array_dof_indices_and_shape_values[array_index] = get_dof_indices_and_shape_values(
-            adjacent_cells, *dof_handler_velocity, *mapping, velocity);
-        }
-      }
+        AssertThrow(inflow_data.normal_direction == 0, dealii::ExcMessage("Not implemented."));
 
-      inflow_data_has_been_initialized = true;
-    }
+        point = dealii::Point<dim>(inflow_data.normal_coordinate,
+                                   (*inflow_data.y_values)[iy],
+                                   (*inflow_data.z_values)[iz]);
+      }
+      else if(inflow_data.inflow_geometry == InflowGeometry::Cylindrical)
+      {
+        AssertThrow(inflow_data.normal_direction == 2, dealii::ExcMessage("Not implemented."));
 
-    // evaluate velocity in all points of the 2d grid
-    for(unsigned int iy = 0; iy < inflow_data.n_points_y; ++iy)
-    {
-      for(unsigned int iz = 0; iz < inflow_data.n_points_z; ++iz)
+        double const x = (*inflow_data.y_values)[iy] * std::cos((*inflow_data.z_values)[iz]);
+        double const y = (*inflow_data.y_values)[iy] * std::sin((*inflow_data.z_values)[iz]);
+        point          = dealii::Point<dim>(x, y, inflow_data.normal_coordinate);
+      }
+      else
       {
-        // determine the array index, will be needed several times below
-        unsigned int array_index = iy * inflow_data.n_points_z + iz;
+        AssertThrow(false, dealii::ExcMessage("Not implemented."));
+      }
 
-        // initialize with zeros since we accumulate into these variables
-        (*inflow_data.array)[array_index] = 0.0;
-        array_counter[array_index]        = 0;
+      points.push_back(point);
+    }
 
-        auto & vector(array_dof_indices_and_shape_values[array_index]);
+    point_evaluation.reinit(points, dof_handler_velocity->get_triangulation(), mapping_in);
+  }
+}
+
+template<int dim, typename Number>
+void
+InflowDataCalculator<dim, Number>::calculate(
+  dealii::LinearAlgebra::distributed::Vector<Number> const & velocity)
+{
+  if(inflow_data.write_inflow_data == true)
+  {
+    if(inflow_data.update_points_before_evaluation)
+      point_evaluation.update_after_grid_motion();
 
-        // loop over all adjacent, locally owned cells for the current point
-        for(auto iter = vector.begin(); iter != vector.end(); ++iter)
-        {
-          // increment counter (because this is a locally owned cell)
-          array_counter[array_index] += 1;
+    // evaluate velocity in the points of the 2d grid assigned to this process
+    auto const values =
+      point_evaluation.template evaluate_values<dim>(*dof_handler_velocity, velocity);
 
-          // interpolate solution using the precomputed shape values and the global dof index
-          dealii::Tensor<1, dim, Number> velocity_value = Interpolator<1, dim, Number>::value(
-            *dof_handler_velocity, velocity, iter->first, iter->second);
+    // initialize with zeros since the values of all processes are summed up
+    for(auto & value : *inflow_data.array)
+      value = 0.0;
 
-          // add result to array with velocity inflow data
-          (*inflow_data.array)[array_index] += velocity_value;
-        }
-      }
+    for(unsigned int array_index = local_range.first; array_index < local_range.second;
+        ++array_index)
+    {
+      for(unsigned int d = 0; d < dim; ++d)
+        (*inflow_data.array)[array_index][d] = values[array_index - local_range.first][d];
     }
 
     // sum over all processors
-    dealii::Utilities::MPI::sum(array_counter, mpi_comm, array_counter);
     dealii::Utilities::MPI::sum(
       dealii::ArrayView<double const>(&(*inflow_data.array)[0][0], dim * inflow_data.array->size()),
       mpi_comm,
       dealii::ArrayView<double>(&(*inflow_data.array)[0][0], dim * inflow_data.array->size()));
-
-    // divide by counter in order to get the mean value (averaged over all
-    // adjacent cells for a given point)
-    for(unsigned int iy = 0; iy < inflow_data.n_points_y; ++iy)
-    {
-      for(unsigned int iz = 0; iz < inflow_data.n_points_z; ++iz)
-      {
-        unsigned int array_index = iy * inflow_data.n_points_z + iz;
-        if(array_counter[array_index] >= 1)
-          (*inflow_data.array)[array_index] /= Number(array_counter[array_index]);
-      }
-    }
   }
 }
 
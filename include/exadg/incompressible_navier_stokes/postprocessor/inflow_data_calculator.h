@@ -30,6 +30,7 @@
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
+#include <exadg/postprocessor/cached_point_evaluation.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -58,6 +59,7 @@ struct InflowData
       normal_coordinate(0.0),
       n_points_y(2),
       n_points_z(2),
+      update_points_before_evaluation(false),
       y_values(nullptr),
       z_values(nullptr),
       array(nullptr)
@@ -73,6 +75,7 @@ struct InflowData
       print_parameter(pcout, "Normal coordinate", normal_coordinate);
       print_parameter(pcout, "Number of points in y-direction", n_points_y);
       print_parameter(pcout, "Number of points in z-direction", n_points_z);
+      print_parameter(pcout, "Update points before evaluation", update_points_before_evaluation);
     }
   }
 
@@ -89,6 +92,9 @@ struct InflowData
   unsigned int n_points_y;
   unsigned int n_points_z;
 
+  // the points have to be located again before each evaluation if the mesh moves (ALE)
+  bool update_points_before_evaluation;
+
   // Vectors with the y-coordinates, z-coordinates (in physical space)
   std::vector<double> * y_values;
   std::vector<double> * z_values;
@@ -110,17 +116,15 @@ public:
 
 private:
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
-  dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
   InflowData<dim>                                     inflow_data;
-  bool                                                inflow_data_has_been_initialized;
 
   MPI_Comm const mpi_comm;
 
-  std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>
-    array_dof_indices_and_shape_values;
+  // the points of the 2d grid are distributed over all processes, each process evaluates the
+  // velocity in the points with array indices in the range [local_range.first, local_range.second)
+  std::pair<unsigned int, unsigned int> local_range;
 
-  std::vector<unsigned int> array_counter;
+  CachedPointEvaluation<dim> point_evaluation;
 };
 
 } // namespace IncNS
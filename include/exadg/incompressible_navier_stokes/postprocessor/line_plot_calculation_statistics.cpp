@@ -19,12 +19,8 @@
  *  ______________________________________________________________________
  */
 
-// deal.II
-#include <deal.II/grid/grid_tools.h>
-
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation_statistics.h>
-#include <exadg/postprocessor/solution_interpolation.h>
 #include <exadg/utilities/create_directories.h>
 
 namespace ExaDG
@@ -42,7 +38,8 @@ LinePlotCalculatorStatistics<dim, Number>::LinePlotCalculatorStatistics(
     dof_handler_pressure(dof_handler_pressure_in),
     mapping(mapping_in),
     mpi_comm(mpi_comm_in),
-    cell_data_has_been_initialized(false),
+    velocity_has_to_be_evaluated(false),
+    pressure_has_to_be_evaluated(false),
     number_of_samples(0),
     write_final_output(false)
 {
@@ -68,14 +65,47 @@ LinePlotCalculatorStatistics<dim, Number>::setup(LinePlotDataStatistics<dim> con
     velocity_global.resize(data.lines.size());
     pressure_global.resize(data.lines.size());
     global_points.resize(data.lines.size());
-    cells_global_velocity.resize(data.lines.size());
-    cells_global_pressure.resize(data.lines.size());
+    first_point_of_line.resize(data.lines.size());
+    n_averaging_points.clear();
+
+    // all points in which the solution is evaluated and the index of the point along the lines
+    // they belong to
+    std::vector<dealii::Point<dim>> points;
+    std::vector<unsigned int>       point_to_line_point;
 
     unsigned int line_iterator = 0;
     for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
         line != data.lines.end();
         ++line, ++line_iterator)
     {
+      // make sure that line type is correct
+      std::shared_ptr<LineCircumferentialAveraging<dim>> line_circ =
+        std::dynamic_pointer_cast<LineCircumferentialAveraging<dim>>(*line);
+
+      AssertThrow(line_circ.get() != 0,
+                  dealii::ExcMessage(
+                    "Invalid line type, expected LineCircumferentialAveraging<dim>"));
+
+      // find out which quantities have to be evaluated
+      for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
+            (*line)->quantities.begin();
+          quantity != (*line)->quantities.end();
+          ++quantity)
+      {
+        if((*quantity)->type == QuantityType::Velocity or
+           (*quantity)->type == QuantityType::SkinFriction or
+           (*quantity)->type == QuantityType::ReynoldsStresses)
+        {
+          velocity_has_to_be_evaluated = true;
+        }
+
+        if((*quantity)->type == QuantityType::Pressure or
+           (*quantity)->type == QuantityType::PressureCoefficient)
+        {
+          pressure_has_to_be_evaluated = true;
+        }
+      }
+
       // Resize global variables for number of points on line
       velocity_global[line_iterator].resize((*line)->n_points);
       pressure_global[line_iterator].resize((*line)->n_points);
@@ -88,177 +118,107 @@ LinePlotCalculatorStatistics<dim, Number>::setup(LinePlotDataStatistics<dim> con
         global_points[line_iterator].push_back(point);
       }
 
-      cells_global_velocity[line_iterator].resize((*line)->n_points);
-      cells_global_pressure[line_iterator].resize((*line)->n_points);
-    }
-
-    create_directories(data.directory, mpi_comm);
-  }
-}
-
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatistics<dim, Number>::evaluate(VectorType const & velocity,
-                                                    VectorType const & pressure)
-{
-  do_evaluate(velocity, pressure);
-}
-
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatistics<dim, Number>::write_output() const
-{
-  do_write_output();
-}
-
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatistics<dim, Number>::initialize_cell_data(VectorType const & velocity,
-                                                                VectorType const & pressure)
-{
-  // Save data related to all adjacent cells for a given point along the line.
-  unsigned int line_iterator = 0;
-  for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
-      line != data.lines.end();
-      ++line, ++line_iterator)
-  {
-    // make sure that line type is correct
-    std::shared_ptr<LineCircumferentialAveraging<dim>> line_circ =
-      std::dynamic_pointer_cast<LineCircumferentialAveraging<dim>>(*line);
-
-    AssertThrow(line_circ.get() != 0,
-                dealii::ExcMessage(
-                  "Invalid line type, expected LineCircumferentialAveraging<dim>"));
+      first_point_of_line[line_iterator] = n_averaging_points.size();
 
-    // find out which quantities have to be evaluated
-    bool velocity_has_to_be_evaluated = false;
-    bool pressure_has_to_be_evaluated = false;
-
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      if((*quantity)->type == QuantityType::Velocity or
-         (*quantity)->type == QuantityType::SkinFriction or
-         (*quantity)->type == QuantityType::ReynoldsStresses)
-      {
-        velocity_has_to_be_evaluated = true;
-      }
-
-      if((*quantity)->type == QuantityType::Pressure)
+      // determine two unit vectors defining circumferential plane
+      dealii::Tensor<1, dim, double> normal_vector;
+      dealii::Tensor<1, dim, double> unit_vector_1, unit_vector_2;
+      if(line_circ->average_circumferential == true)
       {
-        pressure_has_to_be_evaluated = true;
-      }
-    }
-
-    // determine two unit vectors defining circumferential plane
-    dealii::Tensor<1, dim, double> normal_vector;
-    dealii::Tensor<1, dim, double> unit_vector_1, unit_vector_2;
-    if(line_circ->average_circumferential == true)
-    {
-      normal_vector = line_circ->normal_vector;
+        normal_vector = line_circ->normal_vector;
 
-      // We assume that line->begin is the center of the circle for circumferential averaging.
+        // We assume that line->begin is the center of the circle for circumferential averaging.
 
-      // Calculate two unit vectors in the plane that is normal to the normal_vector.
-      unit_vector_1       = (*line)->end - (*line)->begin;
-      double const norm_1 = unit_vector_1.norm();
-      AssertThrow(norm_1 > 1.e-12, dealii::ExcMessage("Invalid begin and end points found."));
+        // Calculate two unit vectors in the plane that is normal to the normal_vector.
+        unit_vector_1       = (*line)->end - (*line)->begin;
+        double const norm_1 = unit_vector_1.norm();
+        AssertThrow(norm_1 > 1.e-12, dealii::ExcMessage("Invalid begin and end points found."));
 
-      unit_vector_1 /= norm_1;
+        unit_vector_1 /= norm_1;
 
-      AssertThrow(dim == 3, dealii::ExcMessage("Not implemented."));
+        AssertThrow(dim == 3, dealii::ExcMessage("Not implemented."));
 
-      unit_vector_2       = cross_product_3d(normal_vector, unit_vector_1);
-      double const norm_2 = unit_vector_2.norm();
+        unit_vector_2       = cross_product_3d(normal_vector, unit_vector_1);
+        double const norm_2 = unit_vector_2.norm();
 
-      AssertThrow(norm_2 > 1.e-12, dealii::ExcMessage("Invalid begin and end points found."));
+        AssertThrow(norm_2 > 1.e-12, dealii::ExcMessage("Invalid begin and end points found."));
 
-      unit_vector_2 /= norm_2;
-    }
-
-    // for all points along a line
-    for(unsigned int p = 0; p < (*line)->n_points; ++p)
-    {
-      dealii::Point<dim> point = global_points[line_iterator][p];
-
-      // In case no averaging in circumferential direction is performed, just insert point
-      // "point".
-      std::vector<dealii::Point<dim>> points;
-      points.push_back(point);
+        unit_vector_2 /= norm_2;
+      }
 
-      // If averaging in circumferential direction is used, we insert additional points along
-      // the circle for points p>=1. The first point p=0 lies in the center of the circle
-      // (point(p=0) == line.begin).
-      if(p >= 1 and line_circ->average_circumferential == true)
+      // for all points along a line
+      for(unsigned int p = 0; p < (*line)->n_points; ++p)
       {
-        // begin with 1 since the first point has already been inserted.
-        for(unsigned int i = 1; i < line_circ->n_points_circumferential; ++i)
-        {
-          double cos =
-            std::cos((double(i) / line_circ->n_points_circumferential) * 2.0 * dealii::numbers::PI);
-          double sin =
-            std::sin((double(i) / line_circ->n_points_circumferential) * 2.0 * dealii::numbers::PI);
-          double radius = (point - (*line)->begin).norm();
+        unsigned int const line_point = n_averaging_points.size();
 
-          dealii::Point<dim> new_point;
-          for(unsigned int d = 0; d < dim; ++d)
-          {
-            new_point[d] = ((*line)->begin)[d] + cos * radius * unit_vector_1[d] +
-                           sin * radius * unit_vector_2[d];
-          }
+        dealii::Point<dim> point = global_points[line_iterator][p];
 
-          points.push_back(new_point);
-        }
-      }
+        // In case no averaging in circumferential direction is performed, just insert point
+        // "point".
+        points.push_back(point);
+        point_to_line_point.push_back(line_point);
+        n_averaging_points.push_back(1);
 
-      for(typename std::vector<dealii::Point<dim>>::iterator point_it = points.begin();
-          point_it != points.end();
-          ++point_it)
-      {
-        if(velocity_has_to_be_evaluated == true)
+        // If averaging in circumferential direction is used, we insert additional points along
+        // the circle for points p>=1. The first point p=0 lies in the center of the circle
+        // (point(p=0) == line.begin).
+        if(p >= 1 and line_circ->average_circumferential == true)
         {
-          // find adjacent cells and store data required later for evaluating the solution.
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            mapping, dof_handler_velocity.get_triangulation(), *point_it, 1.e-10);
-
-          auto dof_indices_and_shape_values = get_dof_indices_and_shape_values(adjacent_cells,
-                                                                               dof_handler_velocity,
-                                                                               mapping,
-                                                                               velocity);
-
-          for(auto iter = dof_indices_and_shape_values.begin();
-              iter != dof_indices_and_shape_values.end();
-              ++iter)
+          // begin with 1 since the first point has already been inserted.
+          for(unsigned int i = 1; i < line_circ->n_points_circumferential; ++i)
           {
-            cells_global_velocity[line_iterator][p].push_back(*iter);
-          }
-        }
+            double cos = std::cos((double(i) / line_circ->n_points_circumferential) * 2.0 *
+                                  dealii::numbers::PI);
+            double sin = std::sin((double(i) / line_circ->n_points_circumferential) * 2.0 *
+                                  dealii::numbers::PI);
+            double radius = (point - (*line)->begin).norm();
 
-        if(pressure_has_to_be_evaluated == true)
-        {
-          // find adjacent cells and store data required later for evaluating the solution.
-          auto adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
-            mapping, dof_handler_pressure.get_triangulation(), *point_it, 1.e-10);
-
-          auto dof_indices_and_shape_values = get_dof_indices_and_shape_values(adjacent_cells,
-                                                                               dof_handler_pressure,
-                                                                               mapping,
-                                                                               pressure);
-
-          for(auto iter = dof_indices_and_shape_values.begin();
-              iter != dof_indices_and_shape_values.end();
-              ++iter)
-          {
-            cells_global_pressure[line_iterator][p].push_back(*iter);
+            dealii::Point<dim> new_point;
+            for(unsigned int d = 0; d < dim; ++d)
+            {
+              new_point[d] = ((*line)->begin)[d] + cos * radius * unit_vector_1[d] +
+                             sin * radius * unit_vector_2[d];
+            }
+
+            points.push_back(new_point);
+            point_to_line_point.push_back(line_point);
+            n_averaging_points.back() += 1;
           }
         }
       }
     }
+
+    // The points are distributed over all processes, and every process locates only its own
+    // points in the mesh.
+    std::pair<unsigned int, unsigned int> const local_range =
+      CachedPointEvaluation<dim>::get_local_range(points.size(), mpi_comm);
+
+    std::vector<dealii::Point<dim>> local_points(points.begin() + local_range.first,
+                                                 points.begin() + local_range.second);
+    local_point_to_line_point.assign(point_to_line_point.begin() + local_range.first,
+                                     point_to_line_point.begin() + local_range.second);
+
+    point_evaluation.reinit(local_points, dof_handler_velocity.get_triangulation(), mapping);
+
+    create_directories(data.directory, mpi_comm);
   }
 }
 
+template<int dim, typename Number>
+void
+LinePlotCalculatorStatistics<dim, Number>::evaluate(VectorType const & velocity,
+                                                    VectorType const & pressure)
+{
+  do_evaluate(velocity, pressure);
+}
+
+template<int dim, typename Number>
+void
+LinePlotCalculatorStatistics<dim, Number>::write_output() const
+{
+  do_write_output();
+}
+
 template<int dim, typename Number>
 void
 LinePlotCalculatorStatistics<dim, Number>::do_evaluate(VectorType const & velocity,
@@ -267,184 +227,65 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate(VectorType const & veloci
   // increment number of samples
   number_of_samples++;
 
-  // Make sure that all data has been initialized before evaluating the solution.
-  if(cell_data_has_been_initialized == false)
+  if(data.update_points_before_evaluation)
+    point_evaluation.update_after_grid_motion();
+
+  // For all points along all lines: sum of velocity and pressure over all points the solution is
+  // averaged over, in the layout (velocity components, pressure).
+  unsigned int const  n_values = dim + 1;
+  std::vector<double> sums(n_values * n_averaging_points.size(), 0.0);
+
+  if(velocity_has_to_be_evaluated)
   {
-    initialize_cell_data(velocity, pressure);
+    auto const velocity_values =
+      point_evaluation.template evaluate_values<dim>(dof_handler_velocity, velocity);
 
-    cell_data_has_been_initialized = true;
+    for(unsigned int i = 0; i < velocity_values.size(); ++i)
+      for(unsigned int d = 0; d < dim; ++d)
+        sums[local_point_to_line_point[i] * n_values + d] += velocity_values[i][d];
   }
 
-  // Iterator for lines
+  if(pressure_has_to_be_evaluated)
+  {
+    auto const pressure_values =
+      point_evaluation.template evaluate_values<1>(dof_handler_pressure, pressure);
+
+    for(unsigned int i = 0; i < pressure_values.size(); ++i)
+      sums[local_point_to_line_point[i] * n_values + dim] += pressure_values[i];
+  }
+
+  // The points are distributed over processors, therefore we need to sum the contributions of
+  // every single processor.
+  dealii::Utilities::MPI::sum(sums, mpi_comm, sums);
+
+  // Accumulate instantaneous values into global vectors. When writing the output files, we
+  // calculate the time-averaged values by dividing the global (accumulated) values by the number
+  // of samples.
   unsigned int line_iterator = 0;
   for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
       line != data.lines.end();
       ++line, ++line_iterator)
   {
-    bool evaluate_velocity = false;
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
+    for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
           (*line)->quantities.begin();
         quantity != (*line)->quantities.end();
         ++quantity)
     {
-      // evaluate quantities that involve velocity
-      if((*quantity)->type == QuantityType::Velocity or
-         (*quantity)->type == QuantityType::SkinFriction or
-         (*quantity)->type == QuantityType::ReynoldsStresses)
+      for(unsigned int p = 0; p < (*line)->n_points; ++p)
       {
-        evaluate_velocity = true;
-      }
-    }
-    if(evaluate_velocity == true)
-    {
-      do_evaluate_velocity(velocity, *(*line), line_iterator);
-    }
+        unsigned int const line_point = first_point_of_line[line_iterator] + p;
 
-    bool evaluate_pressure = false;
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      // evaluate quantities that involve velocity
-      if((*quantity)->type == QuantityType::Pressure or
-         (*quantity)->type == QuantityType::PressureCoefficient)
-      {
-        evaluate_pressure = true;
-      }
-    }
-    if(evaluate_pressure == true)
-    {
-      do_evaluate_pressure(pressure, *(*line), line_iterator);
-    }
-  }
-}
-
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatistics<dim, Number>::do_evaluate_velocity(VectorType const & velocity,
-                                                                Line<dim> const &  line,
-                                                                unsigned int const line_iterator)
-{
-  // Local variables for the current line:
-
-  // for all points along the line: velocity vector
-  std::vector<dealii::Tensor<1, dim, Number>> velocity_vector_local(line.n_points);
-  // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
-
-  for(unsigned int p = 0; p < line.n_points; ++p)
-  {
-    auto & adjacent_cells(cells_global_velocity[line_iterator][p]);
-
-    // loop over all adjacent, locally owned cells for the current point
-    for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
-    {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
-      for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            line.quantities.begin();
-          quantity != line.quantities.end();
-          ++quantity)
-      {
+        // take average value over all points in circumferential direction
         if((*quantity)->type == QuantityType::Velocity)
         {
-          // interpolate solution using the precomputed shape values and the global dof index
-          dealii::Tensor<1, dim, Number> velocity_value = Interpolator<1, dim, Number>::value(
-            dof_handler_velocity, velocity, iter->first, iter->second);
-
-          // add result to array with velocity values
-          velocity_vector_local[p] += velocity_value;
-        }
-        else
-        {
-          AssertThrow(false, dealii::ExcMessage("Not implemented."));
-        }
-      }
-    }
-  }
-
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communication as well as averaging for all quantities of the current line.
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
-  {
-    if((*quantity)->type == QuantityType::Velocity)
-    {
-      dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(&velocity_vector_local[0][0],
-                                                                  dim *
-                                                                    velocity_vector_local.size()),
-                                  mpi_comm,
-                                  dealii::ArrayView<Number>(&velocity_vector_local[0][0],
-                                                            dim * velocity_vector_local.size()));
-
-      // Accumulate instantaneous values into global vector.
-      // When writing the output files, we calculate the time-averaged values
-      // by dividing the global (accumulated) values by the number of samples.
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        // Take average value over all adjacent cells for a given point.
-        for(unsigned int d = 0; d < dim; ++d)
-        {
-          if(counter_vector_local[p] > 0)
-          {
+          for(unsigned int d = 0; d < dim; ++d)
             velocity_global[line_iterator][p][d] +=
-              velocity_vector_local[p][d] / counter_vector_local[p];
-          }
+              sums[line_point * n_values + d] / n_averaging_points[line_point];
         }
-      }
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
-  }
-}
-
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const & pressure,
-                                                                Line<dim> const &  line,
-                                                                unsigned int const line_iterator)
-{
-  // Local variables for the current line:
-
-  // for all points along the line: pressure value
-  std::vector<Number> pressure_vector_local(line.n_points);
-  // for all points along the line: counter
-  std::vector<unsigned int> counter_vector_local(line.n_points);
-
-  for(unsigned int p = 0; p < line.n_points; ++p)
-  {
-    auto & adjacent_cells(cells_global_pressure[line_iterator][p]);
-
-    // loop over all adjacent, locally owned cells for the current point
-    for(auto iter = adjacent_cells.begin(); iter != adjacent_cells.end(); ++iter)
-    {
-      // increment counter (because this is a locally owned cell)
-      counter_vector_local[p] += 1;
-
-      for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-            line.quantities.begin();
-          quantity != line.quantities.end();
-          ++quantity)
-      {
-        if((*quantity)->type == QuantityType::Pressure)
+        else if((*quantity)->type == QuantityType::Pressure)
         {
-          // interpolate solution using the precomputed shape values and the global dof index
-          Number pressure_value = Interpolator<0, dim, Number>::value(dof_handler_pressure,
-                                                                      pressure,
-                                                                      iter->first,
-                                                                      iter->second);
-
-          // add result to array with pressure values
-          pressure_vector_local[p] += pressure_value;
+          pressure_global[line_iterator][p] +=
+            sums[line_point * n_values + dim] / n_averaging_points[line_point];
         }
         else
         {
@@ -453,38 +294,6 @@ LinePlotCalculatorStatistics<dim, Number>::do_evaluate_pressure(VectorType const
       }
     }
   }
-
-  // Cells are distributed over processors, therefore we need
-  // to sum the contributions of every single processor.
-  dealii::Utilities::MPI::sum(counter_vector_local, mpi_comm, counter_vector_local);
-
-  // Perform MPI communcation as well as averaging for all quantities of the current line.
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
-  {
-    if((*quantity)->type == QuantityType::Pressure)
-    {
-      dealii::Utilities::MPI::sum(pressure_vector_local, mpi_comm, pressure_vector_local);
-
-      // Accumulate instantaneous values into global vector.
-      // When writing the output files, we calculate the time-averaged values
-      // by dividing the global (accumulated) values by the number of samples.
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        // Take average value over all adjacent cells for a given point.
-        if(counter_vector_local[p] > 0)
-        {
-          pressure_global[line_iterator][p] += pressure_vector_local[p] / counter_vector_local[p];
-        }
-      }
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
-  }
 }
 
 template<int dim, typename Number>
@@ -32,6 +32,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
+#include <exadg/postprocessor/cached_point_evaluation.h>
 #include <exadg/postprocessor/time_control.h>
 
 namespace ExaDG
@@ -57,6 +58,11 @@ namespace IncNS
  *    circle, and that the other points in circumferential direction can be constructed by rotating
  *    the vector from the center of the circle (line.begin) to the current point along the line
  *    around the normal vector.
+ *
+ * The points of all lines (including the points in circumferential direction) are distributed
+ * over all processes and located in the mesh once during setup. Each evaluation then evaluates
+ * velocity and pressure in all points of a process at once and reduces the sums over the points
+ * belonging to the same point along a line with a single collective operation.
  */
 
 template<int dim, typename Number>
@@ -65,10 +71,6 @@ class LinePlotCalculatorStatistics
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef typename std::vector<
-    std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>>
-    TYPE;
-
   LinePlotCalculatorStatistics(dealii::DoFHandler<dim> const & dof_handler_velocity_in,
                                dealii::DoFHandler<dim> const & dof_handler_pressure_in,
                                dealii::Mapping<dim> const &    mapping_in,
@@ -92,22 +94,9 @@ private:
     f << "number of samples: N = " << number_of_samples << std::endl;
   }
 
-  void
-  initialize_cell_data(VectorType const & velocity, VectorType const & pressure);
-
   void
   do_evaluate(VectorType const & velocity, VectorType const & pressure);
 
-  void
-  do_evaluate_velocity(VectorType const & velocity,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
-
-  void
-  do_evaluate_pressure(VectorType const & pressure,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
-
   void
   do_write_output() const;
 
@@ -123,19 +112,20 @@ private:
   // Global points
   std::vector<std::vector<dealii::Point<dim>>> global_points;
 
-  bool cell_data_has_been_initialized;
+  // The points along all lines are numbered consecutively. For all lines: index of the first point
+  std::vector<unsigned int> first_point_of_line;
+
+  // For all points along all lines: number of points the solution is averaged over (several points
+  // in case of averaging in circumferential direction)
+  std::vector<unsigned int> n_averaging_points;
+
+  // For all points evaluated by this process: index of the point along the lines it belongs to
+  std::vector<unsigned int> local_point_to_line_point;
 
-  // For all lines: for all points along the line: for all relevant cells: dof index of first dof of
-  // current cell and all shape function values
-  std::vector<std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>>
-    cells_global_velocity;
+  bool velocity_has_to_be_evaluated;
+  bool pressure_has_to_be_evaluated;
 
-  // For all lines: for all points along the line: for all relevant cells: dof index of first dof of
-  // current cell and all shape function values
-  std::vector<std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>>
-    cells_global_pressure;
+  CachedPointEvaluation<dim> point_evaluation;
 
   // number of samples for averaging in time
   unsigned int number_of_samples;
@@ -19,8 +19,12 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <algorithm>
+#include <limits>
+
 // deal.II
-#include <deal.II/fe/fe_values.h>
+#include <deal.II/base/quadrature_lib.h>
 
 // ExaDG
 #include <exadg/grid/grid_data.h>
@@ -42,6 +46,11 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::LinePlotCalculatorStatisti
     dof_handler_pressure(dof_handler_pressure_in),
     mapping(mapping_in),
     mpi_comm(mpi_comm_in),
+    n_line_points(0),
+    length(0.0),
+    velocity_has_to_be_evaluated(false),
+    velocity_gradient_has_to_be_evaluated(false),
+    pressure_has_to_be_evaluated(false),
     number_of_samples(0),
     averaging_direction(2),
     write_final_output(false)
@@ -69,9 +78,10 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::setup(
     AssertThrow(data.lines.size() > 0, dealii::ExcMessage("Empty data"));
 
     global_points.resize(data.lines.size());
-    cells_and_ref_points_velocity.resize(data.lines.size());
-    cells_and_ref_points_pressure.resize(data.lines.size());
-    cells_and_ref_points_ref_pressure.resize(data.lines.size());
+    first_point_of_line.resize(data.lines.size());
+    reference_point_of_line.resize(data.lines.size(), dealii::numbers::invalid_unsigned_int);
+    tangent_vectors.resize(data.lines.size());
+    normal_vectors.resize(data.lines.size());
 
     velocity_global.resize(data.lines.size());
     wall_shear_global.resize(data.lines.size());
@@ -89,6 +99,9 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::setup(
     AssertThrow(averaging_direction == 0 or averaging_direction == 1 or averaging_direction == 2,
                 dealii::ExcMessage("Take the average either in x, y or z-direction"));
 
+    // For all points along all lines: coordinates of the point
+    std::vector<dealii::Point<dim>> line_points;
+
     unsigned int line_iterator = 0;
     for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
         line != data.lines.end();
@@ -104,221 +117,154 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::setup(
       AssertThrow(averaging_direction == line_hom->averaging_direction,
                   dealii::ExcMessage("All lines must use the same averaging direction."));
 
+      AssertThrow((*line)->quantities.size() > 0,
+                  dealii::ExcMessage("No quantities specified for line."));
+
       // Resize global variables for # of points on line
       velocity_global[line_iterator].resize((*line)->n_points);
       pressure_global[line_iterator].resize((*line)->n_points);
       wall_shear_global[line_iterator].resize((*line)->n_points);
       reynolds_global[line_iterator].resize((*line)->n_points);
-      cells_and_ref_points_velocity[line_iterator].resize((*line)->n_points);
-      cells_and_ref_points_pressure[line_iterator].resize((*line)->n_points);
 
       // initialize global_points: use equidistant points along line
+      first_point_of_line[line_iterator] = line_points.size();
       for(unsigned int i = 0; i < (*line)->n_points; ++i)
       {
         dealii::Point<dim> point = (*line)->begin + double(i) / double((*line)->n_points - 1) *
                                                       ((*line)->end - (*line)->begin);
         global_points[line_iterator].push_back(point);
-      }
-    }
-
-    // Save all cells and corresponding points on unit cell
-    // that are relevant for a given point along the line.
 
-    // use a tolerance to check whether a point is inside the unit cell
-    double const tolerance = 1.e-12;
+        line_points.push_back(point);
+        line_of_line_point.push_back(line_iterator);
+      }
 
-    // For velocity quantities:
-    for(auto const & cell : dof_handler_velocity.active_cell_iterators())
-    {
-      if(cell->is_locally_owned())
+      // find out which quantities have to be evaluated
+      for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
+            (*line)->quantities.begin();
+          quantity != (*line)->quantities.end();
+          ++quantity)
       {
-        line_iterator = 0;
-        for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
-            line != data.lines.end();
-            ++line, ++line_iterator)
+        if((*quantity)->type == QuantityType::Velocity or
+           (*quantity)->type == QuantityType::ReynoldsStresses)
         {
-          AssertThrow((*line)->quantities.size() > 0,
-                      dealii::ExcMessage("No quantities specified for line."));
-
-          bool velocity_has_to_be_evaluated = false;
-          for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-                (*line)->quantities.begin();
-              quantity != (*line)->quantities.end();
-              ++quantity)
-          {
-            if((*quantity)->type == QuantityType::Velocity or
-               (*quantity)->type == QuantityType::SkinFriction or
-               (*quantity)->type == QuantityType::ReynoldsStresses)
-            {
-              velocity_has_to_be_evaluated = true;
-            }
-          }
+          velocity_has_to_be_evaluated = true;
+        }
+        else if((*quantity)->type == QuantityType::SkinFriction)
+        {
+          velocity_gradient_has_to_be_evaluated = true;
 
-          if(velocity_has_to_be_evaluated == true)
-          {
-            // cells and reference points for all points along a line
-            for(unsigned int p = 0; p < (*line)->n_points; ++p)
-            {
-              // First, we move the line to the position of the current cell (vertex 0) in
-              // averaging direction and check whether this new point is inside the current cell
-              dealii::Point<dim> translated_point   = global_points[line_iterator][p];
-              translated_point[averaging_direction] = cell->vertex(0)[averaging_direction];
+          std::shared_ptr<QuantitySkinFriction<dim>> quantity_skin_friction =
+            std::dynamic_pointer_cast<QuantitySkinFriction<dim>>(*quantity);
 
-              // If the new point lies in the current cell, we have to take the current cell into
-              // account
-              dealii::Point<dim> const p_unit =
-                cell->real_to_unit_cell_affine_approximation(translated_point);
+          tangent_vectors[line_iterator] = quantity_skin_friction->tangent_vector;
+          normal_vectors[line_iterator]  = quantity_skin_friction->normal_vector;
+        }
+        else if((*quantity)->type == QuantityType::Pressure)
+        {
+          pressure_has_to_be_evaluated = true;
+        }
+        else if((*quantity)->type == QuantityType::PressureCoefficient)
+        {
+          pressure_has_to_be_evaluated = true;
 
-              if(dealii::GeometryInfo<dim>::is_inside_unit_cell(p_unit, tolerance))
-              {
-                cells_and_ref_points_velocity[line_iterator][p].push_back(
-                  std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator,
-                            dealii::Point<dim>>(cell, p_unit));
-              }
+          // reference pressure (only one point for each line)
+          std::shared_ptr<QuantityPressureCoefficient<dim>> quantity_ref_pressure =
+            std::dynamic_pointer_cast<QuantityPressureCoefficient<dim>>(*quantity);
 
-              //              dealii::Point<dim> p_unit = Point<dim>();
-              //              try
-              //              {
-              //                p_unit = mapping.transform_real_to_unit_cell(cell,
-              //                translated_point);
-              //              }
-              //              catch(...)
-              //              {
-              //                // A point that does not lie on the reference cell.
-              //                p_unit[0] = 2.0;
-              //              }
-              //              if(dealii::GeometryInfo<dim>::is_inside_unit_cell(p_unit,1.e-12))
-              //              {
-              //                cells_and_ref_points_velocity[line_iterator][p].push_back(
-              //                    std::pair<typename
-              //                    dealii::DoFHandler<dim>::active_cell_iterator,
-              //                    dealii::Point<dim> >(cell,p_unit));
-              //              }
-            }
-          }
+          reference_point_of_line[line_iterator] = line_points.size();
+          line_points.push_back(quantity_ref_pressure->reference_point);
+          line_of_line_point.push_back(line_iterator);
         }
       }
     }
 
-    // Save all cells and corresponding points on unit cell that are relevant for a given point
-    // along the line. We have to do the same for the pressure because the dealii::DoFHandlers for
-    // velocity and pressure are different.
-    for(auto const & cell : dof_handler_pressure.active_cell_iterators())
+    n_line_points = line_points.size();
+
+    // Determine the cell layers in averaging direction. Since the cells are aligned with the
+    // coordinate axes, the boundaries of the layers are given by the coordinates of the vertices in
+    // averaging direction.
+    std::vector<double> coordinates;
+    for(auto const & cell : dof_handler_velocity.active_cell_iterators())
     {
       if(cell->is_locally_owned())
       {
-        line_iterator = 0;
-        for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
-            line != data.lines.end();
-            ++line, ++line_iterator)
-        {
-          for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-                (*line)->quantities.begin();
-              quantity != (*line)->quantities.end();
-              ++quantity)
-          {
-            AssertThrow((*line)->quantities.size() > 0,
-                        dealii::ExcMessage("No quantities specified for line."));
+        for(unsigned int const v : cell->vertex_indices())
+          coordinates.push_back(cell->vertex(v)[averaging_direction]);
+      }
+    }
 
-            // evaluate quantities that involve pressure
-            if((*quantity)->type == QuantityType::Pressure)
-            {
-              // cells and reference points for all points along a line
-              for(unsigned int p = 0; p < (*line)->n_points; ++p)
-              {
-                // First, we move the line to the position of the current cell (vertex 0) in
-                // averaging direction and check whether this new point is inside the current cell
-                dealii::Point<dim> translated_point   = global_points[line_iterator][p];
-                translated_point[averaging_direction] = cell->vertex(0)[averaging_direction];
-
-                // If the new point lies in the current cell, we have to take the current cell into
-                // account
-                dealii::Point<dim> const p_unit =
-                  cell->real_to_unit_cell_affine_approximation(translated_point);
-                if(dealii::GeometryInfo<dim>::is_inside_unit_cell(p_unit, tolerance))
-                {
-                  cells_and_ref_points_pressure[line_iterator][p].push_back(
-                    std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator,
-                              dealii::Point<dim>>(cell, p_unit));
-                }
-
-                //                dealii::Point<dim> p_unit = Point<dim>();
-                //                try
-                //                {
-                //                  p_unit = mapping.transform_real_to_unit_cell(cell,
-                //                  translated_point);
-                //                }
-                //                catch(...)
-                //                {
-                //                  // A point that does not lie on the reference cell.
-                //                  p_unit[0] = 2.0;
-                //                }
-                //                if(dealii::GeometryInfo<dim>::is_inside_unit_cell(p_unit,1.e-12))
-                //                {
-                //                  cells_and_ref_points_pressure[line_iterator][p].push_back(
-                //                    std::pair<typename
-                //                    dealii::DoFHandler<dim>::active_cell_iterator,
-                //                    dealii::Point<dim> >(cell,p_unit));
-                //                }
-              }
-            }
-          }
+    double const min_coordinate = dealii::Utilities::MPI::min(
+      coordinates.empty() ? std::numeric_limits<double>::max() :
+                            *std::min_element(coordinates.begin(), coordinates.end()),
+      mpi_comm);
+    double const max_coordinate = dealii::Utilities::MPI::max(
+      coordinates.empty() ? std::numeric_limits<double>::lowest() :
+                            *std::max_element(coordinates.begin(), coordinates.end()),
+      mpi_comm);
 
-          // cells and reference points for reference pressure (only one point for each line)
-          for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-                (*line)->quantities.begin();
-              quantity != (*line)->quantities.end();
-              ++quantity)
-          {
-            AssertThrow((*line)->quantities.size() > 0,
-                        dealii::ExcMessage("No quantities specified for line."));
+    length = max_coordinate - min_coordinate;
 
-            // evaluate quantities that involve pressure
-            if((*quantity)->type == QuantityType::PressureCoefficient)
-            {
-              std::shared_ptr<QuantityPressureCoefficient<dim>> quantity_ref_pressure =
-                std::dynamic_pointer_cast<QuantityPressureCoefficient<dim>>(*quantity);
-
-              // First, we move the line to the position of the current cell (vertex 0) in
-              // averaging direction and check whether this new point is inside the current cell
-              dealii::Point<dim> translated_point   = quantity_ref_pressure->reference_point;
-              translated_point[averaging_direction] = cell->vertex(0)[averaging_direction];
-
-              // If the new point lies in the current cell, we have to take the current cell into
-              // account
-              dealii::Point<dim> const p_unit =
-                cell->real_to_unit_cell_affine_approximation(translated_point);
-              if(dealii::GeometryInfo<dim>::is_inside_unit_cell(p_unit, tolerance))
-              {
-                cells_and_ref_points_ref_pressure[line_iterator].push_back(
-                  std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator,
-                            dealii::Point<dim>>(cell, p_unit));
-              }
+    double const tolerance = 1.e-10 * length;
 
-              //              dealii::Point<dim> p_unit = Point<dim>();
-              //              try
-              //              {
-              //                p_unit = mapping.transform_real_to_unit_cell(cell,
-              //                translated_point);
-              //              }
-              //              catch(...)
-              //              {
-              //                // A point that does not lie on the reference cell.
-              //                p_unit[0] = 2.0;
-              //              }
-              //              if(dealii::GeometryInfo<dim>::is_inside_unit_cell(p_unit,1.e-12))
-              //              {
-              //                ref_pressure_cells_and_ref_points[line_iterator].push_back(
-              //                    std::pair<typename
-              //                    dealii::DoFHandler<dim>::active_cell_iterator,
-              //                    dealii::Point<dim> >(cell,p_unit));
-              //              }
-            }
-          }
-        }
+    auto const sort_and_remove_duplicates = [&](std::vector<double> & values) {
+      std::sort(values.begin(), values.end());
+      values.erase(std::unique(values.begin(),
+                               values.end(),
+                               [&](double const a, double const b) { return b - a < tolerance; }),
+                   values.end());
+    };
+
+    sort_and_remove_duplicates(coordinates);
+
+    std::vector<std::vector<double>> const coordinates_all =
+      dealii::Utilities::MPI::all_gather(mpi_comm, coordinates);
+
+    coordinates.clear();
+    for(std::vector<double> const & coordinates_proc : coordinates_all)
+      coordinates.insert(coordinates.end(), coordinates_proc.begin(), coordinates_proc.end());
+
+    sort_and_remove_duplicates(coordinates);
+
+    // use quadrature for averaging in homogeneous direction on each layer of cells
+    unsigned int const      fe_degree_velocity = dof_handler_velocity.get_fe().degree;
+    dealii::QGauss<1> const gauss_1d(fe_degree_velocity + 1);
+
+    std::vector<double> coordinates_q, weights_q;
+    for(unsigned int layer = 0; layer + 1 < coordinates.size(); ++layer)
+    {
+      double const h = coordinates[layer + 1] - coordinates[layer];
+      for(unsigned int q = 0; q < gauss_1d.size(); ++q)
+      {
+        coordinates_q.push_back(coordinates[layer] + h * gauss_1d.point(q)[0]);
+        weights_q.push_back(h * gauss_1d.weight(q));
       }
     }
 
+    // The quadrature points of all points along all lines are distributed over all processes, and
+    // every process locates only its own points in the mesh.
+    unsigned int const n_points_homogeneous = coordinates_q.size();
+
+    std::pair<unsigned int, unsigned int> const local_range =
+      CachedPointEvaluation<dim>::get_local_range(n_line_points * n_points_homogeneous, mpi_comm);
+
+    std::vector<dealii::Point<dim>> local_points;
+    local_point_to_line_point.clear();
+    local_weights.clear();
+    for(unsigned int i = local_range.first; i < local_range.second; ++i)
+    {
+      unsigned int const line_point = i / n_points_homogeneous;
+      unsigned int const q          = i % n_points_homogeneous;
+
+      dealii::Point<dim> point   = line_points[line_point];
+      point[averaging_direction] = coordinates_q[q];
+
+      local_points.push_back(point);
+      local_point_to_line_point.push_back(line_point);
+      local_weights.push_back(weights_q[q]);
+    }
+
+    point_evaluation.reinit(local_points, dof_handler_velocity.get_triangulation(), mapping);
+
     create_directories(data.directory, mpi_comm);
   }
 }
@@ -355,362 +301,121 @@ LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate(VectorType con
   // increment number of samples
   number_of_samples++;
 
-  // Iterator for lines
-  unsigned int line_iterator = 0;
-  for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
-      line != data.lines.end();
-      ++line, ++line_iterator)
-  {
-    bool evaluate_velocity = false;
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      // evaluate quantities that involve velocity
-      if((*quantity)->type == QuantityType::Velocity or
-         (*quantity)->type == QuantityType::SkinFriction or
-         (*quantity)->type == QuantityType::ReynoldsStresses)
-      {
-        evaluate_velocity = true;
-      }
-    }
-    if(evaluate_velocity == true)
-      do_evaluate_velocity(velocity, *(*line), line_iterator);
-
-    bool evaluate_pressure = false;
-    for(typename std::vector<std::shared_ptr<Quantity>>::iterator quantity =
-          (*line)->quantities.begin();
-        quantity != (*line)->quantities.end();
-        ++quantity)
-    {
-      // evaluate quantities that involve velocity
-      if((*quantity)->type == QuantityType::Pressure or
-         (*quantity)->type == QuantityType::PressureCoefficient)
-      {
-        evaluate_pressure = true;
-      }
-    }
-    if(evaluate_pressure == true)
-      do_evaluate_pressure(pressure, *(*line), line_iterator);
-  }
-}
-
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate_velocity(
-  VectorType const & velocity,
-  Line<dim> const &  line,
-  unsigned int const line_iterator)
-{
-  // Local variables for specific line
-  std::vector<double>                         length_local(line.n_points);
-  std::vector<dealii::Tensor<1, dim, double>> velocity_local(line.n_points);
-  std::vector<double>                         wall_shear_local(line.n_points);
-  std::vector<dealii::Tensor<2, dim, double>> reynolds_local(line.n_points);
-
-  unsigned int const scalar_dofs_per_cell =
-    dof_handler_velocity.get_fe().base_element(0).dofs_per_cell;
-
-  std::vector<dealii::Tensor<1, dim>> velocity_vector(scalar_dofs_per_cell);
-
-  std::vector<dealii::types::global_dof_index> dof_indices(
-    dof_handler_velocity.get_fe().dofs_per_cell);
-
-  for(unsigned int p = 0; p < line.n_points; ++p)
-  {
-    for(typename TYPE::const_iterator cell_and_ref_point =
-          cells_and_ref_points_velocity[line_iterator][p].begin();
-        cell_and_ref_point != cells_and_ref_points_velocity[line_iterator][p].end();
-        ++cell_and_ref_point)
-    {
-      unsigned int const fe_degree_velocity = dof_handler_velocity.get_fe().degree;
-
-      // use quadrature for averaging in homogeneous direction
-      dealii::QGauss<1>               gauss_1d(fe_degree_velocity + 1);
-      std::vector<dealii::Point<dim>> points(gauss_1d.size());  // 1D points
-      std::vector<double>             weights(gauss_1d.size()); // 1D weights
-
-      dealii::Point<dim> const p_unit = cell_and_ref_point->second;
-
-      // Find points and weights for Gauss quadrature
-      find_points_and_weights(p_unit, points, weights, averaging_direction, gauss_1d);
-
-      dealii::FEValues<dim, dim> fe_values(mapping,
-                                           dof_handler_velocity.get_fe().base_element(0),
-                                           dealii::Quadrature<dim>(points, weights),
-                                           dealii::update_values | dealii::update_jacobians |
-                                             dealii::update_quadrature_points |
-                                             dealii::update_gradients);
-
-      typename dealii::DoFHandler<dim>::active_cell_iterator const cell = cell_and_ref_point->first;
-      fe_values.reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
-
-      cell->get_dof_indices(dof_indices);
-
-      // resort velocity dofs
-      for(unsigned int j = 0; j < dof_indices.size(); ++j)
-      {
-        const std::pair<unsigned int, unsigned int> comp =
-          dof_handler_velocity.get_fe().system_to_component_index(j);
-        if(comp.first < dim)
-          velocity_vector[comp.second][comp.first] = velocity(dof_indices[j]);
-      }
-
-      // perform averaging in homogeneous direction
-      for(unsigned int q = 0; q < fe_values.n_quadrature_points; ++q)
-      {
-        double det = std::abs(fe_values.jacobian(q)[averaging_direction][averaging_direction]);
-        double JxW = det * fe_values.get_quadrature().weight(q);
+  if(data.update_points_before_evaluation)
+    point_evaluation.update_after_grid_motion();
 
-        // calculate integrals in homogeneous direction
-        length_local[p] += JxW;
+  // For all points along all lines: integrals in homogeneous direction in the layout (velocity
+  // components, Reynolds stresses, wall shear stress, pressure).
+  unsigned int const index_reynolds   = dim;
+  unsigned int const index_wall_shear = index_reynolds + dim * dim;
+  unsigned int const index_pressure   = index_wall_shear + 1;
+  unsigned int const n_values         = index_pressure + 1;
 
-        for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-              line.quantities.begin();
-            quantity != line.quantities.end();
-            ++quantity)
-        {
-          dealii::Tensor<1, dim> velocity;
-
-          if((*quantity)->type == QuantityType::Velocity or
-             (*quantity)->type == QuantityType::ReynoldsStresses)
-          {
-            // evaluate velocity solution in current quadrature points
-            for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-              velocity += fe_values.shape_value(j, q) * velocity_vector[j];
-          }
+  std::vector<double> integrals(n_values * n_line_points, 0.0);
 
-          if((*quantity)->type == QuantityType::Velocity)
-          {
-            for(unsigned int i = 0; i < dim; ++i)
-              velocity_local[p][i] += velocity[i] * JxW;
-          }
-          else if((*quantity)->type == QuantityType::ReynoldsStresses)
-          {
-            for(unsigned int i = 0; i < dim; ++i)
-            {
-              for(unsigned int j = 0; j < dim; ++j)
-              {
-                reynolds_local[p][i][j] += velocity[i] * velocity[j] * JxW;
-              }
-            }
-          }
-          else if((*quantity)->type == QuantityType::SkinFriction)
-          {
-            dealii::Tensor<2, dim> velocity_gradient;
-            for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-              velocity_gradient += outer_product(velocity_vector[j], fe_values.shape_grad(j, q));
-
-            std::shared_ptr<QuantitySkinFriction<dim>> quantity_skin_friction =
-              std::dynamic_pointer_cast<QuantitySkinFriction<dim>>(*quantity);
-
-            dealii::Tensor<1, dim, double> normal  = quantity_skin_friction->normal_vector;
-            dealii::Tensor<1, dim, double> tangent = quantity_skin_friction->tangent_vector;
-
-            for(unsigned int i = 0; i < dim; ++i)
-              for(unsigned int j = 0; j < dim; ++j)
-                wall_shear_local[p] += tangent[i] * velocity_gradient[i][j] * normal[j] * JxW;
-          }
-        }
-      }
-    }
-  }
-
-  dealii::Utilities::MPI::sum(length_local, mpi_comm, length_local);
-
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
+  if(velocity_has_to_be_evaluated)
   {
-    // Cells are distributed over processors, therefore we need
-    // to sum the contributions of every single processor.
-    if((*quantity)->type == QuantityType::Velocity)
-    {
-      dealii::Utilities::MPI::sum(
-        dealii::ArrayView<double const>(&velocity_local[0][0], dim * velocity_local.size()),
-        mpi_comm,
-        dealii::ArrayView<double>(&velocity_local[0][0], dim * velocity_local.size()));
+    auto const velocity_values =
+      point_evaluation.template evaluate_values<dim>(dof_handler_velocity, velocity);
 
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        for(unsigned int d = 0; d < dim; ++d)
-        {
-          velocity_global[line_iterator][p][d] += velocity_local[p][d] / length_local[p];
-        }
-      }
-    }
-    else if((*quantity)->type == QuantityType::ReynoldsStresses)
+    for(unsigned int i = 0; i < velocity_values.size(); ++i)
     {
-      dealii::Utilities::MPI::sum(
-        dealii::ArrayView<double const>(&reynolds_local[0][0][0],
-                                        dim * dim * reynolds_local.size()),
-        mpi_comm,
-        dealii::ArrayView<double>(&reynolds_local[0][0][0], dim * dim * reynolds_local.size()));
+      double * integral = &integrals[local_point_to_line_point[i] * n_values];
+      double   JxW      = local_weights[i];
 
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        for(unsigned int i = 0; i < dim; ++i)
-        {
-          for(unsigned int j = 0; j < dim; ++j)
-          {
-            reynolds_global[line_iterator][p][i][j] += reynolds_local[p][i][j] / length_local[p];
-          }
-        }
-      }
-    }
-    else if((*quantity)->type == QuantityType::SkinFriction)
-    {
-      dealii::Utilities::MPI::sum(wall_shear_local, mpi_comm, wall_shear_local);
+      for(unsigned int d = 0; d < dim; ++d)
+        integral[d] += velocity_values[i][d] * JxW;
 
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        wall_shear_global[line_iterator][p] += wall_shear_local[p] / length_local[p];
-      }
+      for(unsigned int d1 = 0; d1 < dim; ++d1)
+        for(unsigned int d2 = 0; d2 < dim; ++d2)
+          integral[index_reynolds + d1 * dim + d2] +=
+            velocity_values[i][d1] * velocity_values[i][d2] * JxW;
     }
   }
-}
-
 
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatisticsHomogeneous<dim, Number>::do_evaluate_pressure(
-  VectorType const & pressure,
-  Line<dim> const &  line,
-  unsigned int const line_iterator)
-{
-  for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
-        line.quantities.begin();
-      quantity != line.quantities.end();
-      ++quantity)
+  if(velocity_gradient_has_to_be_evaluated)
   {
-    if((*quantity)->type == QuantityType::Pressure)
-    {
-      // Local variables for specific line
-      std::vector<double> length_local(line.n_points);
-      std::vector<double> pressure_local(line.n_points);
+    auto const velocity_gradients =
+      point_evaluation.template evaluate_gradients<dim>(dof_handler_velocity, velocity);
 
-      for(unsigned int p = 0; p < line.n_points; ++p)
-      {
-        TYPE vector_cells_and_ref_points = cells_and_ref_points_pressure[line_iterator][p];
-
-        average_pressure_for_given_point(pressure,
-                                         vector_cells_and_ref_points,
-                                         length_local[p],
-                                         pressure_local[p]);
-      }
-
-      // MPI communication
-      dealii::Utilities::MPI::sum(length_local, mpi_comm, length_local);
-      dealii::Utilities::MPI::sum(pressure_local, mpi_comm, pressure_local);
-
-      // averaging in space (over homogeneous direction)
-      for(unsigned int p = 0; p < line.n_points; ++p)
-        pressure_global[line_iterator][p] += pressure_local[p] / length_local[p];
-    }
-
-    if((*quantity)->type == QuantityType::PressureCoefficient)
+    for(unsigned int i = 0; i < velocity_gradients.size(); ++i)
     {
-      double length_local   = 0.0;
-      double pressure_local = 0.0;
-
-      TYPE vector_cells_and_ref_points = cells_and_ref_points_ref_pressure[line_iterator];
-
-      average_pressure_for_given_point(pressure,
-                                       vector_cells_and_ref_points,
-                                       length_local,
-                                       pressure_local);
-
-      // MPI communication
-      length_local   = dealii::Utilities::MPI::sum(length_local, mpi_comm);
-      pressure_local = dealii::Utilities::MPI::sum(pressure_local, mpi_comm);
-
-      // averaging in space (over homogeneous direction)
-      reference_pressure_global[line_iterator] += pressure_local / length_local;
+      unsigned int const line_point = local_point_to_line_point[i];
+      double *           integral   = &integrals[line_point * n_values];
+      double             JxW        = local_weights[i];
+
+      unsigned int const                     line    = line_of_line_point[line_point];
+      dealii::Tensor<1, dim, double> const & tangent = tangent_vectors[line];
+      dealii::Tensor<1, dim, double> const & normal  = normal_vectors[line];
+
+      for(unsigned int d1 = 0; d1 < dim; ++d1)
+        for(unsigned int d2 = 0; d2 < dim; ++d2)
+          integral[index_wall_shear] +=
+            tangent[d1] * velocity_gradients[i][d1][d2] * normal[d2] * JxW;
     }
   }
-}
 
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatisticsHomogeneous<dim, Number>::average_pressure_for_given_point(
-  VectorType const & pressure,
-  TYPE const &       vector_cells_and_ref_points,
-  double &           length_local,
-  double &           pressure_local)
-{
-  unsigned int const scalar_dofs_per_cell =
-    dof_handler_pressure.get_fe().base_element(0).dofs_per_cell;
-  std::vector<double>                          pressure_vector(scalar_dofs_per_cell);
-  std::vector<dealii::types::global_dof_index> dof_indices(
-    dof_handler_pressure.get_fe().dofs_per_cell);
-
-  for(typename TYPE::const_iterator cell_and_ref_point = vector_cells_and_ref_points.begin();
-      cell_and_ref_point != vector_cells_and_ref_points.end();
-      ++cell_and_ref_point)
+  if(pressure_has_to_be_evaluated)
   {
-    unsigned int const fe_degree_pressure = dof_handler_pressure.get_fe().degree;
-
-    // use quadrature for averaging in homogeneous direction
-    dealii::QGauss<1>               gauss_1d(fe_degree_pressure + 1);
-    std::vector<dealii::Point<dim>> points(gauss_1d.size());  // 1D points
-    std::vector<double>             weights(gauss_1d.size()); // 1D weights
-
-    dealii::Point<dim> const p_unit = cell_and_ref_point->second;
-
-    // Find points and weights for Gauss quadrature
-    find_points_and_weights(p_unit, points, weights, averaging_direction, gauss_1d);
-
-    dealii::FEValues<dim, dim> fe_values(mapping,
-                                         dof_handler_pressure.get_fe().base_element(0),
-                                         dealii::Quadrature<dim>(points, weights),
-                                         dealii::update_values | dealii::update_jacobians |
-                                           dealii::update_quadrature_points);
-
-    typename dealii::DoFHandler<dim>::active_cell_iterator const cell = cell_and_ref_point->first;
-    fe_values.reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
+    auto const pressure_values =
+      point_evaluation.template evaluate_values<1>(dof_handler_pressure, pressure);
 
-    cell->get_dof_indices(dof_indices);
+    for(unsigned int i = 0; i < pressure_values.size(); ++i)
+      integrals[local_point_to_line_point[i] * n_values + index_pressure] +=
+        pressure_values[i] * local_weights[i];
+  }
 
-    for(unsigned int j = 0; j < scalar_dofs_per_cell; ++j)
-      pressure_vector[j] = pressure(dof_indices[j]);
+  // The points are distributed over processors, therefore we need to sum the contributions of
+  // every single processor.
+  dealii::Utilities::MPI::sum(integrals, mpi_comm, integrals);
 
-    for(unsigned int q = 0; q < fe_values.n_quadrature_points; ++q)
+  // averaging in space (over homogeneous direction)
+  unsigned int line_iterator = 0;
+  for(typename std::vector<std::shared_ptr<Line<dim>>>::iterator line = data.lines.begin();
+      line != data.lines.end();
+      ++line, ++line_iterator)
+  {
+    for(typename std::vector<std::shared_ptr<Quantity>>::const_iterator quantity =
+          (*line)->quantities.begin();
+        quantity != (*line)->quantities.end();
+        ++quantity)
     {
-      double p = 0;
-
-      for(unsigned int j = 0; j < pressure_vector.size(); ++j)
-        p += fe_values.shape_value(j, q) * pressure_vector[j];
+      if((*quantity)->type == QuantityType::PressureCoefficient)
+      {
+        unsigned int const line_point = reference_point_of_line[line_iterator];
+        reference_pressure_global[line_iterator] +=
+          integrals[line_point * n_values + index_pressure] / length;
 
-      double det = std::abs(fe_values.jacobian(q)[averaging_direction][averaging_direction]);
-      double JxW = det * fe_values.get_quadrature().weight(q);
+        continue;
+      }
 
-      length_local += JxW;
-      pressure_local += p * JxW;
-    }
-  }
-}
+      for(unsigned int p = 0; p < (*line)->n_points; ++p)
+      {
+        double const * integral =
+          &integrals[(first_point_of_line[line_iterator] + p) * n_values];
 
-template<int dim, typename Number>
-void
-LinePlotCalculatorStatisticsHomogeneous<dim, Number>::find_points_and_weights(
-  dealii::Point<dim> const &        point_in_ref_coord,
-  std::vector<dealii::Point<dim>> & points,
-  std::vector<double> &             weights,
-  unsigned int const                averaging_direction,
-  dealii::QGauss<1> const &         gauss_1d)
-{
-  for(unsigned int q = 0; q < gauss_1d.size(); ++q)
-  {
-    for(unsigned int d = 0; d < dim; ++d)
-    {
-      if(d == averaging_direction)
-        points[q][d] = gauss_1d.point(q)[0];
-      else
-        points[q][d] = point_in_ref_coord[d];
+        if((*quantity)->type == QuantityType::Velocity)
+        {
+          for(unsigned int d = 0; d < dim; ++d)
+            velocity_global[line_iterator][p][d] += integral[d] / length;
+        }
+        else if((*quantity)->type == QuantityType::ReynoldsStresses)
+        {
+          for(unsigned int d1 = 0; d1 < dim; ++d1)
+            for(unsigned int d2 = 0; d2 < dim; ++d2)
+              reynolds_global[line_iterator][p][d1][d2] +=
+                integral[index_reynolds + d1 * dim + d2] / length;
+        }
+        else if((*quantity)->type == QuantityType::SkinFriction)
+        {
+          wall_shear_global[line_iterator][p] += integral[index_wall_shear] / length;
+        }
+        else if((*quantity)->type == QuantityType::Pressure)
+        {
+          pressure_global[line_iterator][p] += integral[index_pressure] / length;
+        }
+      }
     }
-    weights[q] = gauss_1d.weight(q);
   }
 }
 
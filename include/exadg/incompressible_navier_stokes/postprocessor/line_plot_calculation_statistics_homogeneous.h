@@ -32,6 +32,7 @@
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_data.h>
+#include <exadg/postprocessor/cached_point_evaluation.h>
 #include <exadg/postprocessor/time_control.h>
 
 namespace ExaDG
@@ -45,6 +46,11 @@ namespace IncNS
  *
  * NOTE: This functionality can only be used for hypercube meshes and for geometries/meshes for
  * which the cells are aligned with the coordinate axis.
+ *
+ * The integrals in homogeneous direction are computed by Gauss quadrature on each layer of cells in
+ * homogeneous direction. The quadrature points of all lines are distributed over all processes and
+ * located in the mesh once during setup. Each evaluation then evaluates all quantities in all
+ * points of a process at once and reduces the integrals with a single collective operation.
  */
 
 template<int dim, typename Number>
@@ -53,10 +59,6 @@ class LinePlotCalculatorStatisticsHomogeneous
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  typedef typename std::vector<
-    std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>>
-    TYPE;
-
   LinePlotCalculatorStatisticsHomogeneous(dealii::DoFHandler<dim> const & dof_handler_velocity_in,
                                           dealii::DoFHandler<dim> const & dof_handler_pressure_in,
                                           dealii::Mapping<dim> const &    mapping_in,
@@ -80,29 +82,6 @@ private:
   void
   do_evaluate(VectorType const & velocity, VectorType const & pressure);
 
-  void
-  do_evaluate_velocity(VectorType const & velocity,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
-
-  void
-  do_evaluate_pressure(VectorType const & pressure,
-                       Line<dim> const &  line,
-                       unsigned int const line_iterator);
-
-  void
-  average_pressure_for_given_point(VectorType const & pressure,
-                                   TYPE const &       vector_cells_and_ref_points,
-                                   double &           length_local,
-                                   double &           pressure_local);
-
-  void
-  find_points_and_weights(dealii::Point<dim> const &        point_in_ref_coord,
-                          std::vector<dealii::Point<dim>> & points,
-                          std::vector<double> &             weights,
-                          unsigned int const                averaging_direction,
-                          dealii::QGauss<1> const &         gauss_1d);
-
   void
   do_write_output() const;
 
@@ -118,23 +97,35 @@ private:
   // Global points
   std::vector<std::vector<dealii::Point<dim>>> global_points;
 
-  // For all lines: for all points along the line: list of all relevant cells and points in ref
-  // coordinates
-  std::vector<std::vector<std::vector<
-    std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>>>>
-    cells_and_ref_points_velocity;
-
-  // For all lines: for all points along the line: list of all relevant cells and points in ref
-  // coordinates
-  std::vector<std::vector<std::vector<
-    std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>>>>
-    cells_and_ref_points_pressure;
-
-  // For all lines: for pressure reference point: list of all relevant cells and points in ref
-  // coordinates
-  std::vector<std::vector<
-    std::pair<typename dealii::DoFHandler<dim>::active_cell_iterator, dealii::Point<dim>>>>
-    cells_and_ref_points_ref_pressure;
+  // The points along all lines and the reference points for the pressure are numbered
+  // consecutively. For all lines: index of the first point along the line and index of the
+  // reference point for the pressure (or invalid_unsigned_int if not needed)
+  std::vector<unsigned int> first_point_of_line;
+  std::vector<unsigned int> reference_point_of_line;
+
+  // total number of points along all lines including the reference points for the pressure
+  unsigned int n_line_points;
+
+  // For all points along all lines: index of the line
+  std::vector<unsigned int> line_of_line_point;
+
+  // For all quadrature points in homogeneous direction evaluated by this process: index of the
+  // point along the lines it belongs to and quadrature weight
+  std::vector<unsigned int> local_point_to_line_point;
+  std::vector<double>       local_weights;
+
+  // length of the domain in homogeneous direction
+  double length;
+
+  // For all lines: tangent and normal vector of the skin friction
+  std::vector<dealii::Tensor<1, dim, double>> tangent_vectors;
+  std::vector<dealii::Tensor<1, dim, double>> normal_vectors;
+
+  bool velocity_has_to_be_evaluated;
+  bool velocity_gradient_has_to_be_evaluated;
+  bool pressure_has_to_be_evaluated;
+
+  CachedPointEvaluation<dim> point_evaluation;
 
   // number of samples for averaging in time
   unsigned int number_of_samples;
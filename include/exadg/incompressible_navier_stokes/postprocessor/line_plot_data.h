@@ -225,8 +225,17 @@ struct LinePlotData : public LinePlotDataBase<dim>
 template<int dim>
 struct LinePlotDataStatistics : public LinePlotDataBase<dim>
 {
+  LinePlotDataStatistics() : update_points_before_evaluation(false)
+  {
+  }
+
   TimeControlDataStatistics time_control_data_statistics;
 
+  /*
+   *  the points have to be located again before each evaluation if the mesh moves (ALE)
+   */
+  bool update_points_before_evaluation;
+
   void
   print(dealii::ConditionalOStream & pcout)
   {
@@ -263,6 +263,9 @@ MeanVelocityCalculator<dim, Number>::local_calculate_volume(
     }
   }
 
+  // the loop may be executed by several threads concurrently
+  std::lock_guard<std::mutex> lock(mutex);
+
   dst.at(0) += volume;
 }
 
@@ -378,6 +381,9 @@ MeanVelocityCalculator<dim, Number>::local_calculate_flow_rate_volume(
     }
   }
 
+  // the loop may be executed by several threads concurrently
+  std::lock_guard<std::mutex> lock(mutex);
+
   dst.at(0) += flow_rate;
 }
 
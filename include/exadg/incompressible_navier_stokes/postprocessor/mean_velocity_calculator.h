@@ -22,6 +22,8 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_MEAN_VELOCITY_CALCULATOR_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_MEAN_VELOCITY_CALCULATOR_H_
 
+#include <mutex>
+
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/utilities/print_functions.h>
 
@@ -168,6 +170,9 @@ private:
   mutable bool                            clear_files;
 
   MPI_Comm const mpi_comm;
+
+  // protects the accumulation of the results of the local cell loops in task-parallel loops
+  mutable std::mutex mutex;
 };
 
 } // namespace IncNS
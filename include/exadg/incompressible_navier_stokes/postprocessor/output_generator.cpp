@@ -52,8 +52,7 @@ write_output(
 {
   std::string folder = output_data.directory, file = output_data.filename;
 
-  dealii::DataOutBase::VtkFlags flags;
-  flags.write_higher_order_cells = output_data.write_higher_order;
+  dealii::DataOutBase::VtkFlags const flags = get_vtk_flags(output_data);
 
   dealii::DataOut<dim> data_out;
   data_out.set_flags(flags);
@@ -114,9 +113,27 @@ write_output(
     }
   }
 
+  select_cells_for_output(data_out, output_data);
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
   data_out.write_vtu_with_pvtu_record(folder, file, output_counter, mpi_comm, 4);
+
+  // velocity and pressure on the selected boundary surfaces
+  if(not output_data.surface_boundary_IDs.empty())
+  {
+    DataOutBoundaryFaces<dim> data_out_surface(output_data.surface_boundary_IDs);
+    data_out_surface.set_flags(flags);
+
+    data_out_surface.add_data_vector(dof_handler_velocity,
+                                     velocity,
+                                     velocity_names,
+                                     velocity_component_interpretation);
+    data_out_surface.add_data_vector(dof_handler_pressure, pressure, "p");
+
+    data_out_surface.build_patches(mapping, output_data.degree);
+    data_out_surface.write_vtu_with_pvtu_record(
+      folder, file + "_boundary", output_counter, mpi_comm, 4);
+  }
 }
 
 template<int dim, typename Number>
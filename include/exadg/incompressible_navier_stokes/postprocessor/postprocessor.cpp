@@ -19,6 +19,10 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <map>
+
+// ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor.h>
 
 namespace ExaDG
@@ -30,6 +34,8 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
                                           MPI_Comm const &               comm)
   : mpi_comm(comm),
     pp_data(postprocessor_data),
+    counter_mean_velocity(0),
+    counter_offset_mean_velocity(0),
     output_generator(comm),
     pointwise_output_generator(comm),
     error_calculator_u(comm),
@@ -39,7 +45,8 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
     div_and_mass_error_calculator(comm),
     kinetic_energy_calculator(comm),
     kinetic_energy_spectrum_calculator(comm),
-    line_plot_calculator(comm)
+    line_plot_calculator(comm),
+    fused_integral_evaluator(comm)
 {
 }
 
@@ -106,6 +113,54 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                              pde_operator.get_dof_handler_p(),
                              *pde_operator.get_mapping(),
                              pp_data.line_plot_data);
+
+  fused_integral_evaluator.setup(pde_operator.get_matrix_free(),
+                                 pde_operator.get_dof_index_velocity(),
+                                 pde_operator.get_dof_index_pressure(),
+                                 pde_operator.get_quad_index_velocity_standard());
+
+  fused_kernels.clear();
+
+  // tools using different MatrixFree data than the evaluator are not registered and compute their
+  // integrals on their own
+  auto add_fused_kernel = [&](TimeControl const * time_control, unsigned int const kernel_index) {
+    if(kernel_index != dealii::numbers::invalid_unsigned_int)
+      fused_kernels.emplace_back(time_control, kernel_index);
+  };
+
+  if(pp_data.lift_and_drag_data.time_control_data.is_active and
+     pp_data.lift_and_drag_data.boundary_IDs.size() > 0)
+  {
+    add_fused_kernel(&lift_and_drag_calculator.time_control,
+                     lift_and_drag_calculator.register_fused_integrals(fused_integral_evaluator));
+  }
+
+  if(pp_data.mass_data.time_control_data.is_active)
+  {
+    add_fused_kernel(
+      &div_and_mass_error_calculator.time_control,
+      div_and_mass_error_calculator.register_fused_integrals(fused_integral_evaluator));
+  }
+
+  if(pp_data.kinetic_energy_data.time_control_data.is_active)
+  {
+    add_fused_kernel(&kinetic_energy_calculator.time_control,
+                     kinetic_energy_calculator.register_fused_integrals(fused_integral_evaluator));
+  }
+}
+
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::setup_after_coarsening_and_refinement()
+{
+  // The DoFHandlers and the MatrixFree object are updated in place, so that the calculators
+  // evaluating the solution on the fly do not require any additional setup. The derived fields
+  // are reinitialized on the new mesh, which restarts the averaging of the mean velocity.
+  counter_offset_mean_velocity = counter_mean_velocity;
+
+  initialize_derived_fields();
+
+  pointwise_output_generator.setup_after_coarsening_and_refinement();
 }
 
 template<int dim, typename Number>
@@ -127,6 +182,8 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
                   "Calculating mean velocity does not make sense for steady problems."));
 
     mean_velocity.evaluate(velocity);
+
+    counter_mean_velocity = time_control_mean_velocity.get_counter() + 1;
   }
 
 
@@ -207,10 +264,38 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
   if(error_calculator_p.time_control.needs_evaluation(time, time_step_number))
     error_calculator_p.evaluate(pressure, time, Utilities::is_unsteady_timestep(time_step_number));
 
+  /*
+   *  Compute the integrals of all calculators that are due in a single loop. Note that
+   *  needs_evaluation() must only be called once per time step.
+   */
+  std::map<TimeControl const *, bool> needs_evaluation;
+  for(auto const & kernel : fused_kernels)
+  {
+    bool const needs_evaluation_kernel = kernel.first->needs_evaluation(time, time_step_number);
+    needs_evaluation[kernel.first] = needs_evaluation_kernel;
+    fused_integral_evaluator.set_active(kernel.second, needs_evaluation_kernel);
+  }
+
+  // a single kernel does not benefit from the fused loop
+  unsigned int n_active = 0;
+  for(auto const & it : needs_evaluation)
+    n_active += it.second ? 1 : 0;
+
+  if(n_active > 1)
+    fused_integral_evaluator.evaluate(velocity, pressure);
+
+  auto const is_due = [&](TimeControl const & time_control) {
+    auto it = needs_evaluation.find(&time_control);
+    if(it != needs_evaluation.end())
+      return it->second;
+    else
+      return time_control.needs_evaluation(time, time_step_number);
+  };
+
   /*
    *  calculation of lift and drag coefficients
    */
-  if(lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number))
+  if(is_due(lift_and_drag_calculator.time_control))
     lift_and_drag_calculator.evaluate(velocity, pressure, time);
 
   /*
@@ -222,7 +307,7 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
   /*
    *  Analysis of divergence and mass error
    */
-  if(div_and_mass_error_calculator.time_control.needs_evaluation(time, time_step_number))
+  if(is_due(div_and_mass_error_calculator.time_control))
   {
     div_and_mass_error_calculator.evaluate(velocity,
                                            time,
@@ -232,7 +317,7 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
   /*
    *  calculation of kinetic energy
    */
-  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
+  if(is_due(kinetic_energy_calculator.time_control))
   {
     kinetic_energy_calculator.evaluate(velocity,
                                        time,
@@ -390,7 +475,8 @@ PostProcessor<dim, Number>::initialize_derived_fields()
       navier_stokes_operator->initialize_vector_velocity(dst);
     };
     mean_velocity.recompute_solution_field = [&](VectorType & dst, VectorType const & velocity) {
-      unsigned int const counter = time_control_mean_velocity.get_counter();
+      unsigned int const counter =
+        time_control_mean_velocity.get_counter() - counter_offset_mean_velocity;
       dst.sadd((double)counter, 1.0, velocity);
       dst *= 1. / (double)(counter + 1);
     };
@@ -30,6 +30,7 @@
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
 #include <exadg/postprocessor/error_calculation.h>
+#include <exadg/postprocessor/fused_integral_evaluation.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
 #include <exadg/postprocessor/lift_and_drag_calculation.h>
 #include <exadg/postprocessor/pressure_difference_calculation.h>
@@ -76,6 +77,9 @@ public:
   void
   setup(Operator const & pde_operator) override;
 
+  void
+  setup_after_coarsening_and_refinement() override;
+
   void
   do_postprocessing(VectorType const &     velocity,
                     VectorType const &     pressure,
@@ -109,6 +113,10 @@ private:
   TimeControl                time_control_mean_velocity;
   SolutionField<dim, Number> mean_velocity; // velocity field averaged over time
 
+  // In case of adaptive mesh refinement, the averaging of the mean velocity restarts on the new
+  // mesh, i.e., the samples taken on previous meshes are not counted.
+  unsigned int counter_mean_velocity, counter_offset_mean_velocity;
+
   // write output for visualization of results (e.g., using paraview)
   OutputGenerator<dim, Number> output_generator;
 
@@ -138,6 +146,13 @@ private:
 
   // evaluate quantities along lines through the domain
   LinePlotCalculator<dim, Number> line_plot_calculator;
+
+  // computes the integrals of lift and drag, divergence and mass error, and kinetic energy
+  // calculators in a single loop if several of them are due in the same time step
+  FusedIntegralEvaluator<dim, Number> fused_integral_evaluator;
+
+  // kernel indices of the calculators in fused_integral_evaluator
+  std::vector<std::pair<TimeControl const *, unsigned int>> fused_kernels;
 };
 
 
@@ -52,6 +52,12 @@ public:
    */
   virtual void
   setup(Operator const & pde_operator) = 0;
+
+  /*
+   * In the derived classes, one might need to take some actions after coarsening and refinement.
+   */
+  virtual void
+  setup_after_coarsening_and_refinement() = 0;
 };
 
 
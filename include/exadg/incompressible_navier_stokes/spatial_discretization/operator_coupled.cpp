@@ -19,6 +19,7 @@
  *  ______________________________________________________________________
  */
 
+#include <deal.II/base/timer.h>
 #include <deal.II/numerics/vector_tools_mean_value.h>
 
 #include <exadg/incompressible_navier_stokes/preconditioners/multigrid_preconditioner_momentum.h>
@@ -74,11 +75,22 @@ OperatorCoupled<dim, Number>::setup_preconditioners_and_solvers()
 {
   Base::setup_preconditioners_and_solvers();
 
+  dealii::Timer timer;
+
   if(this->param.apply_penalty_terms_in_postprocessing_step)
+  {
     Base::setup_projection_solver();
+    this->insert_timings_setup_solver("Projection", timer.wall_time());
+  }
 
+  timer.restart();
   setup_block_preconditioner();
   setup_solver_coupled();
+  this->insert_timings_setup_solver("Coupled", timer.wall_time());
+  this->insert_timings_setup_preconditioner("Coupled", preconditioner_momentum, "Momentum block");
+  this->insert_timings_setup_preconditioner("Coupled",
+                                            multigrid_preconditioner_schur_complement,
+                                            "Schur complement");
 }
 
 template<int dim, typename Number>
@@ -631,10 +643,15 @@ OperatorCoupled<dim, Number>::setup_multigrid_preconditioner_schur_complement()
 
   MultigridData mg_data = this->param.multigrid_data_pressure_block;
 
-  multigrid_preconditioner_schur_complement = std::make_shared<MultigridPoisson>(this->mpi_comm);
-
+  // After adaptive mesh refinement, the existing multigrid preconditioner is initialized again,
+  // which keeps the data structures of the levels not affected by the refinement.
   std::shared_ptr<MultigridPoisson> mg_preconditioner =
     std::dynamic_pointer_cast<MultigridPoisson>(multigrid_preconditioner_schur_complement);
+  if(not mg_preconditioner.get())
+  {
+    mg_preconditioner                         = std::make_shared<MultigridPoisson>(this->mpi_comm);
+    multigrid_preconditioner_schur_complement = mg_preconditioner;
+  }
 
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
     dirichlet_boundary_conditions = laplace_operator_data.bc->dirichlet_bc;
@@ -19,6 +19,10 @@
  *  ______________________________________________________________________
  */
 
+// deal.II
+#include <deal.II/base/timer.h>
+
+// ExaDG
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_projection_methods.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
@@ -76,13 +80,22 @@ template<int dim, typename Number>
 void
 OperatorProjectionMethods<dim, Number>::setup_preconditioners_and_solvers()
 {
+  dealii::Timer timer;
+
   setup_preconditioner_pressure_poisson();
   setup_solver_pressure_poisson();
+  this->insert_timings_setup_solver("Pressure Poisson", timer.wall_time());
+  this->insert_timings_setup_preconditioner("Pressure Poisson", preconditioner_pressure_poisson);
 
+  timer.restart();
   Base::setup_projection_solver();
+  this->insert_timings_setup_solver("Projection", timer.wall_time());
 
+  timer.restart();
   setup_momentum_preconditioner();
   setup_momentum_solver();
+  this->insert_timings_setup_solver("Momentum", timer.wall_time());
+  this->insert_timings_setup_preconditioner("Momentum", momentum_preconditioner);
 }
 
 template<int dim, typename Number>
@@ -174,10 +187,15 @@ OperatorProjectionMethods<dim, Number>::setup_preconditioner_pressure_poisson()
 
     typedef Poisson::MultigridPreconditioner<dim, Number, 1> Multigrid;
 
-    preconditioner_pressure_poisson = std::make_shared<Multigrid>(this->mpi_comm);
-
+    // After adaptive mesh refinement, the existing multigrid preconditioner is initialized again,
+    // which keeps the data structures of the levels not affected by the refinement.
     std::shared_ptr<Multigrid> mg_preconditioner =
       std::dynamic_pointer_cast<Multigrid>(preconditioner_pressure_poisson);
+    if(not mg_preconditioner.get())
+    {
+      mg_preconditioner               = std::make_shared<Multigrid>(this->mpi_comm);
+      preconditioner_pressure_poisson = mg_preconditioner;
+    }
 
     std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
       dirichlet_boundary_conditions = laplace_operator.get_data().bc->dirichlet_bc;
@@ -272,9 +272,14 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current face, one per thread for task-parallel matrix-free loops
+  static thread_local scalar tau;
 };
 
+template<int dim, typename Number>
+thread_local typename ContinuityPenaltyKernel<dim, Number>::scalar
+  ContinuityPenaltyKernel<dim, Number>::tau;
+
 } // namespace Operators
 
 template<int dim>
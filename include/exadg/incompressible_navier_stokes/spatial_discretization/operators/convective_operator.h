@@ -25,7 +25,9 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/weak_boundary_conditions.h>
 #include <exadg/incompressible_navier_stokes/user_interface/parameters.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/matrix_free/thread_local_data.h>
 #include <exadg/operators/operator_base.h>
+#include <exadg/operators/variable_coefficients.h>
 
 namespace ExaDG
 {
@@ -41,7 +43,8 @@ struct ConvectiveKernelData
       upwind_factor(1.0),
       use_outflow_bc(false),
       type_dirichlet_bc(TypeDirichletBCs::Mirror),
-      ale(false)
+      ale(false),
+      cache_linearization(false)
   {
   }
 
@@ -56,6 +59,11 @@ struct ConvectiveKernelData
   TypeDirichletBCs type_dirichlet_bc;
 
   bool ale;
+
+  // Evaluate the linearization velocity (and the grid velocity) in the quadrature points once
+  // whenever it is set and read these values in the linearized operator instead of evaluating the
+  // velocity in every operator application.
+  bool cache_linearization;
 };
 
 template<int dim, typename Number>
@@ -86,19 +94,17 @@ public:
     this->data = data;
 
     // integrators for linearized problem
-    integrator_velocity =
-      std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index_linearized);
-    integrator_velocity_m =
-      std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index_linearized);
-    integrator_velocity_p =
-      std::make_shared<IntegratorFace>(matrix_free, false, dof_index, quad_index_linearized);
+    integrators_velocity.initialize([&matrix_free, dof_index, quad_index_linearized]() {
+      return std::make_shared<IntegratorsVelocity>(matrix_free, dof_index, quad_index_linearized);
+    });
 
     if(data.ale)
     {
-      integrator_grid_velocity =
-        std::make_shared<IntegratorCell>(matrix_free, dof_index, quad_index_linearized);
-      integrator_grid_velocity_face =
-        std::make_shared<IntegratorFace>(matrix_free, true, dof_index, quad_index_linearized);
+      integrators_grid_velocity.initialize([&matrix_free, dof_index, quad_index_linearized]() {
+        return std::make_shared<IntegratorsGridVelocity>(matrix_free,
+                                                         dof_index,
+                                                         quad_index_linearized);
+      });
     }
 
     if(use_own_velocity_storage)
@@ -115,6 +121,19 @@ public:
                   dealii::ExcMessage(
                     "ALE formulation can only be used in combination with ConvectiveFormulation"));
     }
+
+    if(data.cache_linearization)
+    {
+      this->matrix_free = &matrix_free;
+
+      velocity_coefficients.initialize(matrix_free, quad_index_linearized, true, false);
+
+      if(data.formulation == FormulationConvectiveTerm::ConvectiveFormulation)
+        velocity_gradient_coefficients.initialize(matrix_free, quad_index_linearized, false, false);
+
+      if(data.ale)
+        grid_velocity_coefficients.initialize(matrix_free, quad_index_linearized, true, false);
+    }
   }
 
   static MappingFlags
@@ -180,6 +199,9 @@ public:
     velocity.own() = src;
 
     velocity->update_ghost_values();
+
+    if(data.cache_linearization)
+      cache_velocity();
   }
 
   void
@@ -188,6 +210,9 @@ public:
     velocity.reset(src);
 
     velocity->update_ghost_values();
+
+    if(data.cache_linearization)
+      cache_velocity();
   }
 
   void
@@ -196,6 +221,9 @@ public:
     grid_velocity.reset(src);
 
     grid_velocity->update_ghost_values();
+
+    if(data.cache_linearization)
+      cache_grid_velocity();
   }
 
   VectorType const &
@@ -208,28 +236,40 @@ public:
     vector
     get_velocity_cell(unsigned int const q) const
   {
-    return integrator_velocity->get_value(q);
+    if(data.cache_linearization)
+      return velocity_coefficients.get_coefficient_cell(cache_index.cell, q);
+    else
+      return integrators_velocity.current().cell.get_value(q);
   }
 
   inline DEAL_II_ALWAYS_INLINE //
     tensor
     get_velocity_gradient_cell(unsigned int const q) const
   {
-    return integrator_velocity->get_gradient(q);
+    if(data.cache_linearization)
+      return velocity_gradient_coefficients.get_coefficient_cell(cache_index.cell, q);
+    else
+      return integrators_velocity.current().cell.get_gradient(q);
   }
 
   inline DEAL_II_ALWAYS_INLINE //
     vector
     get_velocity_m(unsigned int const q) const
   {
-    return integrator_velocity_m->get_value(q);
+    if(data.cache_linearization and cache_index.face_is_cached)
+      return velocity_coefficients.get_coefficient_face(cache_index.face, q);
+
+    return integrators_velocity.current().face_m.get_value(q);
   }
 
   inline DEAL_II_ALWAYS_INLINE //
     vector
     get_velocity_p(unsigned int const q) const
   {
-    return integrator_velocity_p->get_value(q);
+    if(data.cache_linearization and cache_index.face_is_cached)
+      return velocity_coefficients.get_coefficient_face_neighbor(cache_index.face, q);
+
+    return integrators_velocity.current().face_p.get_value(q);
   }
 
   // grid velocity cell
@@ -237,7 +277,10 @@ public:
     vector
     get_grid_velocity_cell(unsigned int const q) const
   {
-    return integrator_grid_velocity->get_value(q);
+    if(data.cache_linearization)
+      return grid_velocity_coefficients.get_coefficient_cell(cache_index.cell, q);
+    else
+      return integrators_grid_velocity.current().cell.get_value(q);
   }
 
   // grid velocity face (the grid velocity is continuous
@@ -247,30 +290,41 @@ public:
     vector
     get_grid_velocity_face(unsigned int const q) const
   {
-    return integrator_grid_velocity_face->get_value(q);
+    if(data.cache_linearization and cache_index.face_is_cached)
+      return grid_velocity_coefficients.get_coefficient_face(cache_index.face, q);
+
+    return integrators_grid_velocity.current().face.get_value(q);
   }
 
   // linearized operator
   void
   reinit_cell(unsigned int const cell) const
   {
-    integrator_velocity->reinit(cell);
+    if(data.cache_linearization)
+    {
+      cache_index.cell = cell;
+      return;
+    }
 
-    if(data.ale)
-      integrator_grid_velocity->reinit(cell);
+    IntegratorCell & integrator = integrators_velocity.get().cell;
+    integrator.reinit(cell);
 
     if(data.formulation == FormulationConvectiveTerm::DivergenceFormulation)
     {
-      integrator_velocity->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      integrator.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
     }
     else if(data.formulation == FormulationConvectiveTerm::ConvectiveFormulation)
     {
-      integrator_velocity->gather_evaluate(*velocity,
-                                           dealii::EvaluationFlags::values |
-                                             dealii::EvaluationFlags::gradients);
+      integrator.gather_evaluate(*velocity,
+                                 dealii::EvaluationFlags::values |
+                                   dealii::EvaluationFlags::gradients);
 
       if(data.ale)
-        integrator_grid_velocity->gather_evaluate(*grid_velocity, dealii::EvaluationFlags::values);
+      {
+        IntegratorCell & integrator_grid = integrators_grid_velocity.get().cell;
+        integrator_grid.reinit(cell);
+        integrator_grid.gather_evaluate(*grid_velocity, dealii::EvaluationFlags::values);
+      }
     }
     else
     {
@@ -281,31 +335,48 @@ public:
   void
   reinit_face(unsigned int const face) const
   {
-    integrator_velocity_m->reinit(face);
-    integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+    if(data.cache_linearization)
+    {
+      cache_index.face           = face;
+      cache_index.face_is_cached = true;
+      return;
+    }
+
+    IntegratorsVelocity & integrators = integrators_velocity.get();
 
-    integrator_velocity_p->reinit(face);
-    integrator_velocity_p->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+    integrators.face_m.reinit(face);
+    integrators.face_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+
+    integrators.face_p.reinit(face);
+    integrators.face_p.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
 
     if(data.ale)
     {
-      integrator_grid_velocity_face->reinit(face);
-      integrator_grid_velocity_face->gather_evaluate(*grid_velocity,
-                                                     dealii::EvaluationFlags::values);
+      IntegratorFace & integrator_grid = integrators_grid_velocity.get().face;
+      integrator_grid.reinit(face);
+      integrator_grid.gather_evaluate(*grid_velocity, dealii::EvaluationFlags::values);
     }
   }
 
   void
   reinit_boundary_face(unsigned int const face) const
   {
-    integrator_velocity_m->reinit(face);
-    integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+    if(data.cache_linearization)
+    {
+      cache_index.face           = face;
+      cache_index.face_is_cached = true;
+      return;
+    }
+
+    IntegratorFace & integrator_m = integrators_velocity.get().face_m;
+    integrator_m.reinit(face);
+    integrator_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
 
     if(data.ale)
     {
-      integrator_grid_velocity_face->reinit(face);
-      integrator_grid_velocity_face->gather_evaluate(*grid_velocity,
-                                                     dealii::EvaluationFlags::values);
+      IntegratorFace & integrator_grid = integrators_grid_velocity.get().face;
+      integrator_grid.reinit(face);
+      integrator_grid.gather_evaluate(*grid_velocity, dealii::EvaluationFlags::values);
     }
   }
 
@@ -314,22 +385,29 @@ public:
                          unsigned int const               face,
                          dealii::types::boundary_id const boundary_id) const
   {
-    integrator_velocity_m->reinit(cell, face);
-    integrator_velocity_m->gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+    // The cache does not contain data for cell-based face access, the velocity is evaluated
+    // on the fly.
+    if(data.cache_linearization)
+      cache_index.face_is_cached = false;
+
+    IntegratorFace & integrator_m = integrators_velocity.get().face_m;
+    integrator_m.reinit(cell, face);
+    integrator_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
 
     if(data.ale)
     {
-      integrator_grid_velocity_face->reinit(cell, face);
-      integrator_grid_velocity_face->gather_evaluate(*grid_velocity,
-                                                     dealii::EvaluationFlags::values);
+      IntegratorFace & integrator_grid = integrators_grid_velocity.get().face;
+      integrator_grid.reinit(cell, face);
+      integrator_grid.gather_evaluate(*grid_velocity, dealii::EvaluationFlags::values);
     }
 
     if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
     {
       // TODO: Matrix-free implementation in deal.II does currently not allow to access data of
       // the neighboring element in case of cell-based face loops.
-      //      integrator_velocity_p->reinit(cell, face);
-      //      integrator_velocity_p->gather_evaluate(velocity,dealii::EvaluationFlags::values);
+      //      integrators_velocity.get().face_p.reinit(cell, face);
+      //      integrators_velocity.get().face_p.gather_evaluate(velocity,
+      //                                                        dealii::EvaluationFlags::values);
     }
   }
 
@@ -935,6 +1013,95 @@ public:
   }
 
 private:
+  /*
+   * Evaluates the linearization velocity in the quadrature points of all cells and faces and
+   * stores the values (and the gradients on cells for the convective formulation) in the cache.
+   */
+  void
+  cache_velocity()
+  {
+    dealii::EvaluationFlags::EvaluationFlags const flags_cell =
+      (data.formulation == FormulationConvectiveTerm::ConvectiveFormulation) ?
+        (dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients) :
+        dealii::EvaluationFlags::values;
+
+    IntegratorsVelocity & integrators  = integrators_velocity.get();
+    IntegratorCell &      integrator   = integrators.cell;
+    IntegratorFace &      integrator_m = integrators.face_m;
+    IntegratorFace &      integrator_p = integrators.face_p;
+
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(*velocity, flags_cell);
+
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      {
+        velocity_coefficients.set_coefficient_cell(cell, q, integrator.get_value(q));
+
+        if(data.formulation == FormulationConvectiveTerm::ConvectiveFormulation)
+          velocity_gradient_coefficients.set_coefficient_cell(cell, q, integrator.get_gradient(q));
+      }
+    }
+
+    for(unsigned int face = 0; face < matrix_free->n_inner_face_batches(); ++face)
+    {
+      integrator_m.reinit(face);
+      integrator_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+      integrator_p.reinit(face);
+      integrator_p.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+      {
+        velocity_coefficients.set_coefficient_face(face, q, integrator_m.get_value(q));
+        velocity_coefficients.set_coefficient_face_neighbor(face, q, integrator_p.get_value(q));
+      }
+    }
+
+    for(unsigned int face = matrix_free->n_inner_face_batches();
+        face < matrix_free->n_inner_face_batches() + matrix_free->n_boundary_face_batches();
+        ++face)
+    {
+      integrator_m.reinit(face);
+      integrator_m.gather_evaluate(*velocity, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+        velocity_coefficients.set_coefficient_face(face, q, integrator_m.get_value(q));
+    }
+  }
+
+  /*
+   * Evaluates the grid velocity in the quadrature points of all cells and faces and stores the
+   * values in the cache.
+   */
+  void
+  cache_grid_velocity()
+  {
+    IntegratorsGridVelocity & integrators     = integrators_grid_velocity.get();
+    IntegratorCell &          integrator      = integrators.cell;
+    IntegratorFace &          integrator_face = integrators.face;
+
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(*grid_velocity, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        grid_velocity_coefficients.set_coefficient_cell(cell, q, integrator.get_value(q));
+    }
+
+    for(unsigned int face = 0;
+        face < matrix_free->n_inner_face_batches() + matrix_free->n_boundary_face_batches();
+        ++face)
+    {
+      integrator_face.reinit(face);
+      integrator_face.gather_evaluate(*grid_velocity, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < integrator_face.n_q_points; ++q)
+        grid_velocity_coefficients.set_coefficient_face(face, q, integrator_face.get_value(q));
+    }
+  }
+
   ConvectiveKernelData data;
 
   // linearization velocity for nonlinear problems or transport velocity for "linearly implicit
@@ -944,14 +1111,66 @@ private:
   // grid velocity for ALE problems
   lazy_ptr<VectorType> grid_velocity;
 
-  std::shared_ptr<IntegratorCell> integrator_velocity;
-  std::shared_ptr<IntegratorFace> integrator_velocity_m;
-  std::shared_ptr<IntegratorFace> integrator_velocity_p;
+  struct IntegratorsVelocity
+  {
+    IntegratorsVelocity(dealii::MatrixFree<dim, Number> const & matrix_free,
+                        unsigned int const                      dof_index,
+                        unsigned int const                      quad_index)
+      : cell(matrix_free, dof_index, quad_index),
+        face_m(matrix_free, true, dof_index, quad_index),
+        face_p(matrix_free, false, dof_index, quad_index)
+    {
+    }
+
+    IntegratorCell cell;
+    IntegratorFace face_m;
+    IntegratorFace face_p;
+  };
+
+  // the grid velocity is continuous, so only the face integrator of the interior side is needed
+  struct IntegratorsGridVelocity
+  {
+    IntegratorsGridVelocity(dealii::MatrixFree<dim, Number> const & matrix_free,
+                            unsigned int const                      dof_index,
+                            unsigned int const                      quad_index)
+      : cell(matrix_free, dof_index, quad_index), face(matrix_free, true, dof_index, quad_index)
+    {
+    }
 
-  std::shared_ptr<IntegratorCell> integrator_grid_velocity;
-  std::shared_ptr<IntegratorFace> integrator_grid_velocity_face;
+    IntegratorCell cell;
+    IntegratorFace face;
+  };
+
+  // integrators for the current cell/face, one set per thread for task-parallel matrix-free loops
+  ThreadLocalData<IntegratorsVelocity>     integrators_velocity;
+  ThreadLocalData<IntegratorsGridVelocity> integrators_grid_velocity;
+
+  /*
+   * Cache of the linearization velocity and the grid velocity in the quadrature points, see
+   * ConvectiveKernelData::cache_linearization.
+   */
+  dealii::MatrixFree<dim, Number> const * matrix_free = nullptr;
+
+  VariableCoefficients<vector> velocity_coefficients;
+  VariableCoefficients<tensor> velocity_gradient_coefficients;
+  VariableCoefficients<vector> grid_velocity_coefficients;
+
+  // cell and face of the current matrix-free loop for the access to the cache, one per thread for
+  // task-parallel matrix-free loops
+  struct CacheIndex
+  {
+    unsigned int cell           = 0;
+    unsigned int face           = 0;
+    bool         face_is_cached = false;
+  };
+
+  static thread_local CacheIndex cache_index;
 };
 
+template<int dim, typename Number>
+thread_local typename ConvectiveKernel<dim, Number>::CacheIndex
+  ConvectiveKernel<dim, Number>::cache_index;
+
 
 } // namespace Operators
 
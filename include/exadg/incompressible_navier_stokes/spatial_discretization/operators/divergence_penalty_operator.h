@@ -224,9 +224,14 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current cell, one per thread for task-parallel matrix-free loops
+  static thread_local scalar tau;
 };
 
+template<int dim, typename Number>
+thread_local typename DivergencePenaltyKernel<dim, Number>::scalar
+  DivergencePenaltyKernel<dim, Number>::tau;
+
 } // namespace Operators
 
 struct DivergencePenaltyData
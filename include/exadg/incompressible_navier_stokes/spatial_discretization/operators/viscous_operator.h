@@ -70,7 +70,7 @@ private:
   typedef FaceIntegrator<dim, dim, Number> IntegratorFace;
 
 public:
-  ViscousKernel() : quad_index(0), degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  ViscousKernel() : quad_index(0), degree(1)
   {
   }
 
@@ -540,11 +540,15 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current face, one per thread for task-parallel matrix-free loops
+  static thread_local scalar tau;
 
   VariableCoefficients<dealii::VectorizedArray<Number>> viscosity_coefficients;
 };
 
+template<int dim, typename Number>
+thread_local typename ViscousKernel<dim, Number>::scalar ViscousKernel<dim, Number>::tau;
+
 } // namespace Operators
 
 template<int dim>
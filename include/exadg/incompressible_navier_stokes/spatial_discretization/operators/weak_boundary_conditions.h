@@ -100,10 +100,21 @@ inline DEAL_II_ALWAYS_INLINE //
 
       if(boundary_type == BoundaryTypeU::Dirichlet)
       {
-        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-        auto q_points = integrator.quadrature_point(q);
-
-        g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        auto const & separable_data = boundary_descriptor->get_dirichlet_separable_data();
+        if(separable_data.get() and separable_data->is_cached(integrator))
+        {
+          g = separable_data->template get_data<Number>(integrator.get_quadrature_index(),
+                                                        integrator.get_current_cell_index(),
+                                                        q,
+                                                        time);
+        }
+        else
+        {
+          auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+          auto q_points = integrator.quadrature_point(q);
+
+          g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        }
       }
       else if(boundary_type == BoundaryTypeU::DirichletCached)
       {
@@ -189,10 +200,21 @@ inline DEAL_II_ALWAYS_INLINE //
     {
       if(boundary_type == BoundaryTypeU::Dirichlet)
       {
-        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-        auto q_points = integrator.quadrature_point(q);
-
-        g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        auto const & separable_data = boundary_descriptor->get_dirichlet_separable_data();
+        if(separable_data.get() and separable_data->is_cached(integrator))
+        {
+          g = separable_data->template get_data<Number>(integrator.get_quadrature_index(),
+                                                        integrator.get_current_cell_index(),
+                                                        q,
+                                                        time);
+        }
+        else
+        {
+          auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
+          auto q_points = integrator.quadrature_point(q);
+
+          g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        }
       }
       else if(boundary_type == BoundaryTypeU::DirichletCached)
       {
@@ -19,11 +19,15 @@
  *  ______________________________________________________________________
  */
 
+// deal.II
+#include <deal.II/base/timer.h>
+
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/interpolate.h>
 #include <exadg/grid/mapping_dof_vector.h>
 #include <exadg/incompressible_navier_stokes/preconditioners/multigrid_preconditioner_projection.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
+#include <exadg/operators/error_indicators.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/grid_related_time_step_restrictions.h>
 #include <exadg/operators/quadrature.h>
@@ -62,6 +66,7 @@ SpatialOperatorBase<dim, Number>::SpatialOperatorBase(
     pressure_level_is_undefined(false),
     mpi_comm(mpi_comm_in),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
+    timer_tree_setup(new TimerTree()),
     velocity_ptr(nullptr),
     pressure_ptr(nullptr)
 {
@@ -69,8 +74,12 @@ SpatialOperatorBase<dim, Number>::SpatialOperatorBase(
         << "Construct incompressible Navier-Stokes operator ..." << std::endl
         << std::flush;
 
+  dealii::Timer timer;
+
   initialize_dof_handler_and_constraints();
 
+  timer_tree_setup->insert({"Spatial operator", "DoFs and constraints"}, timer.wall_time());
+
   initialize_boundary_descriptor_laplace();
 
   initialization_pure_dirichlet_bc();
@@ -335,6 +344,9 @@ SpatialOperatorBase<dim, Number>::fill_matrix_free_data(
   flags_cfl.cells = dealii::update_quadrature_points;
   matrix_free_data.append_mapping_flags(flags_cfl);
 
+  if(param.enable_adaptivity and param.amr_data.error_indicator == ErrorIndicator::FaceJump)
+    matrix_free_data.append_mapping_flags(get_mapping_flags_face_jump_indicator());
+
   // dof handler
   matrix_free_data.insert_dof_handler(&dof_handler_u, field + dof_index_u);
   matrix_free_data.insert_dof_handler(&dof_handler_p, field + dof_index_p);
@@ -399,6 +411,38 @@ SpatialOperatorBase<dim, Number>::initialize_dirichlet_cached_bc()
   }
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::initialize_dirichlet_separable_bc()
+{
+  // The data is stored per face batch, which is not compatible with cell-based face loops.
+  if(param.use_cell_based_face_loops)
+    return;
+
+  bool has_separable_function = false;
+  for(auto const & it : boundary_descriptor->velocity->dirichlet_bc)
+  {
+    if(dynamic_cast<SeparableFunction<dim> const *>(it.second.get()))
+      has_separable_function = true;
+  }
+
+  if(has_separable_function)
+  {
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index_velocity_standard());
+    quad_indices.emplace_back(get_quad_index_velocity_overintegration());
+    quad_indices.emplace_back(get_quad_index_velocity_nodal_points());
+
+    separable_data_dirichlet = std::make_shared<ContainerSeparableData<1, dim>>();
+    separable_data_dirichlet->setup(*matrix_free,
+                                    get_dof_index_velocity(),
+                                    quad_indices,
+                                    boundary_descriptor->velocity->dirichlet_bc);
+
+    boundary_descriptor->velocity->set_dirichlet_separable_data(separable_data_dirichlet);
+  }
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_index_temperature)
@@ -470,12 +514,13 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   divergence_operator.initialize(*matrix_free, divergence_operator_data);
 
   // convective operator
-  convective_kernel_data.formulation        = param.formulation_convective_term;
-  convective_kernel_data.temporal_treatment = param.treatment_of_convective_term;
-  convective_kernel_data.upwind_factor      = param.upwind_factor;
-  convective_kernel_data.use_outflow_bc     = param.use_outflow_bc_convective_term;
-  convective_kernel_data.type_dirichlet_bc  = param.type_dirichlet_bc_convective;
-  convective_kernel_data.ale                = param.ale_formulation;
+  convective_kernel_data.formulation         = param.formulation_convective_term;
+  convective_kernel_data.temporal_treatment  = param.treatment_of_convective_term;
+  convective_kernel_data.upwind_factor       = param.upwind_factor;
+  convective_kernel_data.use_outflow_bc      = param.use_outflow_bc_convective_term;
+  convective_kernel_data.type_dirichlet_bc   = param.type_dirichlet_bc_convective;
+  convective_kernel_data.ale                 = param.ale_formulation;
+  convective_kernel_data.cache_linearization = param.cache_linearization_convective_term;
   convective_kernel = std::make_shared<Operators::ConvectiveKernel<dim, Number>>();
   convective_kernel->reinit(*matrix_free,
                             convective_kernel_data,
@@ -686,6 +731,8 @@ SpatialOperatorBase<dim, Number>::setup()
   std::shared_ptr<MatrixFreeData<dim, Number>> mf_data =
     std::make_shared<MatrixFreeData<dim, Number>>();
 
+  dealii::Timer timer;
+
   fill_matrix_free_data(*mf_data);
 
   if(param.use_cell_based_face_loops)
@@ -696,7 +743,9 @@ SpatialOperatorBase<dim, Number>::setup()
              mf_data->get_quadrature_vector(),
              mf_data->data);
 
-  if(param.ale_formulation)
+  timer_tree_setup->insert({"Spatial operator", "MatrixFree"}, timer.wall_time());
+
+  if(param.ale_formulation or param.enable_adaptivity)
     matrix_free_own_storage = mf;
 
   // Subsequently, call the other setup function with MatrixFree/MatrixFreeData objects as
@@ -720,9 +769,12 @@ SpatialOperatorBase<dim, Number>::setup(
   matrix_free_data = matrix_free_data_in;
 
   // Next, initialize data structures depending on MatrixFree:
+  dealii::Timer timer;
 
   initialize_dirichlet_cached_bc();
 
+  initialize_dirichlet_separable_bc();
+
   initialize_operators(dof_index_temperature);
 
   initialize_calculators_for_derived_quantities();
@@ -730,11 +782,50 @@ SpatialOperatorBase<dim, Number>::setup(
   // Finally, do set up of derived classes
   setup_derived();
 
+  timer_tree_setup->insert({"Spatial operator", "Operators"}, timer.wall_time());
+
+  timer.restart();
   setup_preconditioners_and_solvers();
+  timer_tree_setup->insert({"Spatial operator", "Preconditioners and solvers"}, timer.wall_time());
 
   pcout << std::endl << "... done!" << std::endl << std::flush;
 }
 
+template<int dim, typename Number>
+std::shared_ptr<TimerTree>
+SpatialOperatorBase<dim, Number>::get_timings_setup() const
+{
+  return timer_tree_setup;
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::insert_timings_setup_solver(std::string const & name,
+                                                              double const        wall_time)
+{
+  timer_tree_setup->insert({"Spatial operator", "Preconditioners and solvers", name}, wall_time);
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::insert_timings_setup_preconditioner(
+  std::string const &                                 name,
+  std::shared_ptr<PreconditionerBase<Number>> const & preconditioner,
+  std::string const &                                 sub_tree_name)
+{
+  if(not preconditioner.get() or preconditioner->get_timings_setup()->get_max_level() == 0)
+    return;
+
+  // The sub-tree of a preconditioner can only be inserted once. Since the timer tree refers to
+  // the data of the sub-tree, later setups of the same preconditioner are covered as well.
+  if(inserted_preconditioner_timings.insert(name + "/" + sub_tree_name).second)
+  {
+    timer_tree_setup->insert({"Spatial operator", "Preconditioners and solvers", name},
+                             preconditioner->get_timings_setup(),
+                             sub_tree_name);
+  }
+}
+
 template<int dim, typename Number>
 dealii::types::global_dof_index
 SpatialOperatorBase<dim, Number>::get_number_of_dofs() const
@@ -1514,6 +1605,9 @@ SpatialOperatorBase<dim, Number>::update_after_grid_motion(bool const update_mat
     matrix_free_own_storage->update_mapping(*get_mapping());
   }
 
+  // the quadrature points of the precomputed boundary data have moved
+  initialize_dirichlet_separable_bc();
+
   if(param.turbulence_model_data.is_active)
   {
     // the mesh (and hence the filter width) changes in case of an ALE formulation
@@ -1542,6 +1636,99 @@ SpatialOperatorBase<dim, Number>::set_grid_velocity(VectorType const & u_grid_in
   convective_kernel->set_grid_velocity_ptr(u_grid_in);
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::prepare_coarsening_and_refinement(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
+{
+  solution_transfer_velocity =
+    std::make_shared<ExaDG::SolutionTransfer<dim, VectorType>>(dof_handler_u);
+  solution_transfer_pressure =
+    std::make_shared<ExaDG::SolutionTransfer<dim, VectorType>>(dof_handler_p);
+
+  solution_transfer_velocity->prepare_coarsening_and_refinement(vectors_velocity);
+  solution_transfer_pressure->prepare_coarsening_and_refinement(vectors_pressure);
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::interpolate_after_coarsening_and_refinement(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
+{
+  solution_transfer_velocity->interpolate_after_coarsening_and_refinement(vectors_velocity);
+  solution_transfer_pressure->interpolate_after_coarsening_and_refinement(vectors_pressure);
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::setup_after_coarsening_and_refinement()
+{
+  AssertThrow(matrix_free_own_storage.get(),
+              dealii::ExcMessage("Adaptive mesh refinement is only implemented if the MatrixFree "
+                                 "object is set up by the incompressible Navier-Stokes operator."));
+
+  constraint_u.clear();
+  constraint_p.clear();
+  constraint_u_scalar.clear();
+
+  initialize_dof_handler_and_constraints();
+
+  print_parameter(pcout,
+                  "number of dofs (total) after adaptive mesh refinement",
+                  get_number_of_dofs());
+
+  // the DoF index of the point used to fix the pressure level has changed
+  initialization_pure_dirichlet_bc();
+
+  std::shared_ptr<MatrixFreeData<dim, Number>> mf_data =
+    std::make_shared<MatrixFreeData<dim, Number>>();
+
+  fill_matrix_free_data(*mf_data);
+
+  if(param.use_cell_based_face_loops)
+    Categorization::do_cell_based_loops(*grid->triangulation, mf_data->data);
+  matrix_free_own_storage->reinit(*get_mapping(),
+                                  mf_data->get_dof_handler_vector(),
+                                  mf_data->get_constraint_vector(),
+                                  mf_data->get_quadrature_vector(),
+                                  mf_data->data);
+
+  // Operators, preconditioners and solvers are initialized again. Multigrid preconditioners keep
+  // the data structures of levels that are not affected by the refinement.
+  this->setup(matrix_free_own_storage, mf_data);
+}
+
+template<int dim, typename Number>
+unsigned int
+SpatialOperatorBase<dim, Number>::project_velocity_after_coarsening_and_refinement(
+  VectorType & velocity,
+  double const time,
+  double const time_step_size) const
+{
+  unsigned int n_iter = 0;
+
+  // the projection operator only exists if penalty terms are used
+  if(projection_operator.get())
+  {
+    VectorType rhs(velocity);
+    apply_mass_operator(rhs, velocity);
+
+    update_projection_operator(velocity, time_step_size);
+
+    if(param.use_continuity_penalty and param.continuity_penalty_use_boundary_data)
+      rhs_add_projection_operator(rhs, time);
+
+    // The preconditioner is updated, since the penalty parameters depend on the velocity field.
+    n_iter = solve_projection(velocity, rhs, true /* update_preconditioner */);
+  }
+
+  distribute_constraint_u(velocity);
+
+  return n_iter;
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::setup_projection_solver()
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_SPATIAL_OPERATOR_BASE_H_
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_SPATIAL_OPERATOR_BASE_H_
 
+// C/C++
+#include <set>
+
 // deal.II
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_raviart_thomas.h>
@@ -51,6 +54,7 @@
 #include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/mass_operator.h>
 #include <exadg/operators/navier_stokes_calculators.h>
+#include <exadg/operators/solution_transfer.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/poisson/spatial_discretization/laplace_operator.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
@@ -121,6 +125,14 @@ public:
         std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data,
         std::string const &                                    dof_index_temperature = "");
 
+  /*
+   * Returns the wall times of the setup of this operator (DoFs and constraints, MatrixFree,
+   * operators, preconditioners and solvers), where the setup of preconditioners is further
+   * subdivided, e.g. into the MatrixFree objects of all multigrid levels.
+   */
+  std::shared_ptr<TimerTree>
+  get_timings_setup() const;
+
 protected:
   /*
    * This function initializes operators, preconditioners, and solvers related to the solution of
@@ -132,6 +144,24 @@ protected:
   {
   }
 
+  /*
+   * Inserts the wall time of the setup of a preconditioner and the corresponding solver as item
+   * @param name below "Preconditioners and solvers" into the timings of the setup.
+   */
+  void
+  insert_timings_setup_solver(std::string const & name, double const wall_time);
+
+  /*
+   * Inserts the setup timings of @param preconditioner (if any) below the item @param name, which
+   * has to be inserted by insert_timings_setup_solver() before. If not empty, @param sub_tree_name
+   * replaces the name of the sub-tree.
+   */
+  void
+  insert_timings_setup_preconditioner(
+    std::string const &                                 name,
+    std::shared_ptr<PreconditionerBase<Number>> const & preconditioner,
+    std::string const &                                 sub_tree_name = "");
+
 private:
   /**
    * Additional setup to be done by derived classes.
@@ -430,6 +460,39 @@ public:
   void
   set_grid_velocity(VectorType const & velocity);
 
+  /*
+   * Adaptive mesh refinement: Transfers the velocity and pressure vectors to the new mesh. The
+   * sequence of vectors has to be the same in both functions.
+   */
+  void
+  prepare_coarsening_and_refinement(std::vector<VectorType *> & vectors_velocity,
+                                    std::vector<VectorType *> & vectors_pressure);
+
+  void
+  interpolate_after_coarsening_and_refinement(std::vector<VectorType *> & vectors_velocity,
+                                              std::vector<VectorType *> & vectors_pressure);
+
+  /*
+   * Distributes the degrees of freedom on the new mesh and sets up the MatrixFree object as well
+   * as all operators, preconditioners and solvers again. The MatrixFree object is reinitialized in
+   * place, so that references to it held by other objects (e.g. postprocessing tools) remain
+   * valid.
+   */
+  void
+  setup_after_coarsening_and_refinement();
+
+  /*
+   * Projects a velocity field that has been transferred to a new mesh by means of the divergence
+   * and continuity penalty terms (if used) and applies the constraints of the velocity. The
+   * interpolation of coarsened cells introduces jumps of the normal velocity across faces and
+   * local divergence, which are damped by this projection to keep the discrete divergence bounded
+   * after adaptive mesh refinement. Returns the number of iterations of the projection solver.
+   */
+  unsigned int
+  project_velocity_after_coarsening_and_refinement(VectorType & velocity,
+                                                   double const time,
+                                                   double const time_step_size) const;
+
   /*
    *  Calls constraint_u.distribute(u) and updates the constrained DoFs of the velocity field
    */
@@ -532,9 +595,16 @@ private:
 
   // If we want to be able to update the mapping, we need a pointer to a non-const MatrixFree
   // object. In case this object is created, we let the above object called matrix_free point to
-  // matrix_free_own_storage. This variable is needed for ALE formulations.
+  // matrix_free_own_storage. This variable is needed for ALE formulations and adaptive mesh
+  // refinement.
   std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free_own_storage;
 
+  /*
+   * Transfer of vectors in case of adaptive mesh refinement
+   */
+  std::shared_ptr<ExaDG::SolutionTransfer<dim, VectorType>> solution_transfer_velocity;
+  std::shared_ptr<ExaDG::SolutionTransfer<dim, VectorType>> solution_transfer_pressure;
+
   bool pressure_level_is_undefined;
 
   /*
@@ -542,6 +612,11 @@ private:
    */
   std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data_dirichlet_cached;
 
+  /*
+   * Precomputed Dirichlet boundary data for boundary conditions of type SeparableFunction
+   */
+  std::shared_ptr<ContainerSeparableData<1, dim>> separable_data_dirichlet;
+
 protected:
   /*
    * Operator kernels.
@@ -620,6 +695,9 @@ protected:
 
   dealii::ConditionalOStream pcout;
 
+  std::shared_ptr<TimerTree> timer_tree_setup;
+  std::set<std::string>      inserted_preconditioner_timings;
+
 private:
   // Minimum element length h_min required for global CFL condition.
   double
@@ -637,6 +715,9 @@ private:
   void
   initialize_dirichlet_cached_bc();
 
+  void
+  initialize_dirichlet_separable_bc();
+
   void
   initialize_operators(std::string const & dof_index_temperature);
 
@@ -144,6 +144,8 @@ main(int argc, char ** argv)
   ExaDG::HypercubeResolutionParameters                    resolution(input_file, general.dim);
   ExaDG::ThroughputParameters<ExaDG::IncNS::OperatorType> throughput(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   ExaDG::IncNS::PressureDegree pressure_degree = ExaDG::IncNS::PressureDegree::MixedOrder;
 
   dealii::ParameterHandler prm;
@@ -434,6 +434,61 @@ TimeIntBDF<dim, Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::prepare_coarsening_and_refinement()
+{
+  std::vector<VectorType *> vectors_velocity, vectors_pressure;
+  get_vectors_coarsening_and_refinement(vectors_velocity, vectors_pressure);
+
+  operator_base->prepare_coarsening_and_refinement(vectors_velocity, vectors_pressure);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::interpolate_after_coarsening_and_refinement()
+{
+  this->allocate_vectors();
+
+  std::vector<VectorType *> vectors_velocity, vectors_pressure;
+  get_vectors_coarsening_and_refinement(vectors_velocity, vectors_pressure);
+
+  operator_base->interpolate_after_coarsening_and_refinement(vectors_velocity, vectors_pressure);
+
+  // The interpolated velocities are only approximately divergence-free and do not satisfy the
+  // continuity of the normal velocity at the new faces. Apply the divergence and continuity
+  // penalty terms to the velocity at t_{n+1} and to the velocities of previous instants of time.
+  AssertThrow(vectors_velocity.size() >= this->order + 1,
+              dealii::ExcMessage("Velocity vectors at t_{n+1} and t_{n-i} are missing."));
+
+  operator_base->project_velocity_after_coarsening_and_refinement(*vectors_velocity[0],
+                                                                  this->get_next_time(),
+                                                                  this->get_time_step_size());
+
+  for(unsigned int i = 0; i < this->order; ++i)
+  {
+    operator_base->project_velocity_after_coarsening_and_refinement(*vectors_velocity[i + 1],
+                                                                    this->get_previous_time(i),
+                                                                    this->get_time_step_size());
+  }
+
+  // The explicit convective term is not a finite element function but an integral of test
+  // functions, so it is evaluated again for the velocities on the new mesh.
+  if(needs_vector_convective_term and param.ale_formulation == false)
+  {
+    for(unsigned int i = 0; i < vec_convective_term.size(); ++i)
+    {
+      operator_base->evaluate_convective_term(vec_convective_term[i],
+                                              get_velocity(i),
+                                              this->get_previous_time(i));
+    }
+
+    operator_base->evaluate_convective_term(convective_term_np,
+                                            get_velocity_np(),
+                                            this->get_next_time());
+  }
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::get_velocities_and_times(std::vector<VectorType const *> & velocities,
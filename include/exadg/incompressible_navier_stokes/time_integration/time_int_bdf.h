@@ -102,10 +102,26 @@ public:
   bool
   print_solver_info() const final;
 
+  void
+  prepare_coarsening_and_refinement() final;
+
+  void
+  interpolate_after_coarsening_and_refinement() final;
+
 protected:
   void
   allocate_vectors() override;
 
+  /*
+   * Vectors transferred to the new mesh in case of adaptive mesh refinement. The velocity vectors
+   * start with the velocity at t_{n+1} followed by the velocities at t_{n-i}, i=0,...,order-1,
+   * which are projected onto the space of (approximately) divergence-free velocities after the
+   * transfer.
+   */
+  virtual void
+  get_vectors_coarsening_and_refinement(std::vector<VectorType *> & vectors_velocity,
+                                        std::vector<VectorType *> & vectors_pressure) = 0;
+
   void
   setup_derived() override;
 
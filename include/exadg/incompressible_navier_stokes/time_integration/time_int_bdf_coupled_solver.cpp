@@ -60,6 +60,23 @@ TimeIntBDFCoupled<dim, Number>::allocate_vectors()
   pde_operator->initialize_block_vector_velocity_pressure(solution_np);
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFCoupled<dim, Number>::get_vectors_coarsening_and_refinement(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
+{
+  // velocity
+  vectors_velocity.emplace_back(&solution_np.block(0));
+  for(unsigned int i = 0; i < solution.size(); ++i)
+    vectors_velocity.emplace_back(&solution[i].block(0));
+
+  // pressure
+  vectors_pressure.emplace_back(&solution_np.block(1));
+  for(unsigned int i = 0; i < solution.size(); ++i)
+    vectors_pressure.emplace_back(&solution[i].block(1));
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDFCoupled<dim, Number>::initialize_current_solution()
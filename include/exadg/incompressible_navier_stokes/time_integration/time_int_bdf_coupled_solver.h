@@ -78,6 +78,10 @@ private:
   void
   allocate_vectors() final;
 
+  void
+  get_vectors_coarsening_and_refinement(std::vector<VectorType *> & vectors_velocity,
+                                        std::vector<VectorType *> & vectors_pressure) final;
+
   void
   setup_derived() final;
 
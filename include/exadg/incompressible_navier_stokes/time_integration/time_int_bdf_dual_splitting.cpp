@@ -133,6 +133,28 @@ TimeIntBDFDualSplitting<dim, Number>::allocate_vectors()
   pde_operator->initialize_vector_velocity(velocity_dbc_np);
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFDualSplitting<dim, Number>::get_vectors_coarsening_and_refinement(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
+{
+  // velocity
+  vectors_velocity.emplace_back(&velocity_np);
+  for(unsigned int i = 0; i < velocity.size(); ++i)
+    vectors_velocity.emplace_back(&velocity[i]);
+
+  // velocity_dbc
+  for(unsigned int i = 0; i < velocity_dbc.size(); ++i)
+    vectors_velocity.emplace_back(&velocity_dbc[i]);
+  vectors_velocity.emplace_back(&velocity_dbc_np);
+
+  // pressure
+  vectors_pressure.emplace_back(&pressure_np);
+  for(unsigned int i = 0; i < pressure.size(); ++i)
+    vectors_pressure.emplace_back(&pressure[i]);
+}
+
 
 template<int dim, typename Number>
 void
@@ -140,6 +140,26 @@ TimeIntBDFPressureCorrection<dim, Number>::allocate_vectors()
     pde_operator->initialize_vector_pressure(pressure_dbc[i]);
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFPressureCorrection<dim, Number>::get_vectors_coarsening_and_refinement(
+  std::vector<VectorType *> & vectors_velocity,
+  std::vector<VectorType *> & vectors_pressure)
+{
+  // velocity
+  vectors_velocity.emplace_back(&velocity_np);
+  for(unsigned int i = 0; i < velocity.size(); ++i)
+    vectors_velocity.emplace_back(&velocity[i]);
+
+  // pressure
+  vectors_pressure.emplace_back(&pressure_np);
+  for(unsigned int i = 0; i < pressure.size(); ++i)
+    vectors_pressure.emplace_back(&pressure[i]);
+
+  for(unsigned int i = 0; i < pressure_dbc.size(); ++i)
+    vectors_pressure.emplace_back(&pressure_dbc[i]);
+}
+
 
 template<int dim, typename Number>
 void
@@ -31,6 +31,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+#include <exadg/functions_and_boundary_conditions/separable_function.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 
 namespace ExaDG
@@ -182,8 +183,27 @@ struct BoundaryDescriptorU
     return dirichlet_cached_data;
   }
 
+  void
+  set_dirichlet_separable_data(
+    std::shared_ptr<ContainerSeparableData<1, dim> const> separable_data) const
+  {
+    dirichlet_separable_data = separable_data;
+  }
+
+  /*
+   * Returns the precomputed data for Dirichlet boundary conditions of type SeparableFunction, or
+   * an empty pointer if no such data has been set.
+   */
+  std::shared_ptr<ContainerSeparableData<1, dim> const> const &
+  get_dirichlet_separable_data() const
+  {
+    return dirichlet_separable_data;
+  }
+
 private:
   mutable std::shared_ptr<ContainerInterfaceData<1, dim, double> const> dirichlet_cached_data;
+
+  mutable std::shared_ptr<ContainerSeparableData<1, dim> const> dirichlet_separable_data;
 };
 
 template<int dim>
@@ -101,6 +101,9 @@ Parameters::Parameters()
     degree_u(2),
     degree_p(DegreePressure::MixedOrder),
 
+    // adaptive mesh refinement
+    enable_adaptivity(false),
+
     // convective term
     upwind_factor(1.0),
     type_dirichlet_bc_convective(TypeDirichletBCs::Mirror),
@@ -141,6 +144,7 @@ Parameters::Parameters()
     use_cell_based_face_loops(false),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
     quad_rule_linearization(QuadratureRuleLinearization::Overintegration32k),
+    cache_linearization_convective_term(false),
 
     // PROJECTION METHODS
 
@@ -349,6 +353,26 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
 
   grid.check();
 
+  if(enable_adaptivity)
+  {
+    AssertThrow(not ale_formulation,
+                dealii::ExcMessage("Combination of adaptive mesh refinement "
+                                   "and ALE formulation not implemented."));
+
+    AssertThrow(problem_type == ProblemType::Unsteady and solver_type == SolverType::Unsteady and
+                  temporal_discretization != TemporalDiscretization::InterpolateAnalyticalSolution,
+                dealii::ExcMessage("Adaptive mesh refinement is only implemented for unsteady "
+                                   "problems and the BDF-type time integration schemes."));
+
+    AssertThrow(spatial_discretization == SpatialDiscretization::L2,
+                dealii::ExcMessage("Adaptive mesh refinement is currently "
+                                   "only supported for SpatialDiscretization::L2."));
+
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("Adaptive mesh refinement is currently "
+                                   "only supported for hypercube elements."));
+  }
+
   // For the coupled solution approach, degree_p = 0 is allowed in principle.
   // For projection-type methods, degree_p > 0 has to be fulfilled (the SIPG discretization
   // of the pressure Poisson equation would be inconsistent for degree_p = 0).
@@ -931,6 +955,11 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
 
   print_parameter(pcout, "Polynomial degree pressure", degree_p);
 
+  if(enable_adaptivity)
+  {
+    amr_data.print(pcout);
+  }
+
   // nothing to print if we bypass the PDE solver by
   // TemporalDiscretization::InterpolateAnalyticalSolution
   if(solver_type == SolverType::Unsteady and
@@ -1031,6 +1060,10 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
   }
 
   print_parameter(pcout, "Quadrature rule linearization", quad_rule_linearization);
+
+  print_parameter(pcout,
+                  "Cache linearization convective term",
+                  cache_linearization_convective_term);
 }
 
 void
@@ -29,6 +29,7 @@
 #include <exadg/grid/grid_data.h>
 #include <exadg/incompressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/incompressible_navier_stokes/user_interface/viscosity_model_data.h>
+#include <exadg/operators/adaptive_mesh_refinement.h>
 #include <exadg/operators/inverse_mass_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
@@ -329,6 +330,10 @@ public:
   // Polynomial degree of pressure shape functions
   DegreePressure degree_p;
 
+  // enable adaptive mesh refinement
+  bool                       enable_adaptivity;
+  AdaptiveMeshRefinementData amr_data;
+
   // convective term: upwind factor describes the scaling factor in front of the
   // stabilization term (which is strictly dissipative) of the numerical function
   // of the convective term. For the divergence formulation of the convective term with
@@ -467,6 +472,13 @@ public:
   // really allows to achieve a more efficient method overall.
   QuadratureRuleLinearization quad_rule_linearization;
 
+  // Evaluate the linearization velocity of the linearized convective term (and the grid velocity
+  // in case of ALE) in the quadrature points once whenever the linearization is updated and store
+  // these values, instead of evaluating the velocity in every application of the linearized
+  // operator. This trades memory for a reduced cost per iteration of the linear solver and is
+  // beneficial if many linear iterations are performed per linearization.
+  bool cache_linearization_convective_term;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                 Solver parameters for mass matrix problem                          */
@@ -23,6 +23,7 @@
 #define INCLUDE_FUNCTIONALITIES_MATRIX_FREE_DATA_H_
 
 // deal.II
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/distributed/tria.h>
 #include <deal.II/dofs/dof_handler.h>
@@ -44,7 +45,13 @@ public:
    */
   MatrixFreeData()
   {
-    data.tasks_parallel_scheme = dealii::MatrixFree<dim, Number>::AdditionalData::none;
+    // In hybrid MPI+threads mode, the cells of each process are split into partitions that are
+    // processed by different threads. Otherwise, matrix-free loops are executed serially.
+    if(dealii::MultithreadInfo::n_threads() > 1)
+      data.tasks_parallel_scheme =
+        dealii::MatrixFree<dim, Number>::AdditionalData::partition_partition;
+    else
+      data.tasks_parallel_scheme = dealii::MatrixFree<dim, Number>::AdditionalData::none;
   }
 
   /**
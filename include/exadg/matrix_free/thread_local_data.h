@@ -0,0 +1,129 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_THREAD_LOCAL_DATA_H_
+#define INCLUDE_EXADG_MATRIX_FREE_THREAD_LOCAL_DATA_H_
+
+// C/C++
+#include <functional>
+#include <memory>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/thread_local_storage.h>
+
+namespace ExaDG
+{
+/**
+ * Data of a kernel that is set for the current cell/face in the reinit functions of the kernel and
+ * used during the evaluation at the quadrature points, e.g., integrators for the point of
+ * linearization. If a matrix-free loop is executed by several threads (task-parallel
+ * dealii::MatrixFree loops), each thread needs its own copy of this data. This class creates one
+ * object per thread on first access.
+ *
+ * Looking up the object of a thread via get() takes a lock and searches a map. It should therefore
+ * be done once per cell/face in the reinit functions. get() also makes the object the current
+ * object of the calling thread, which is returned by current() at the cost of reading a
+ * thread_local pointer. Use current() in functions that are called for every quadrature point.
+ *
+ * The current object is shared by all instances of ThreadLocalData<T> on a thread. The reinit and
+ * the evaluation of two instances with the same type T must therefore not be interleaved on one
+ * thread, and several integrators of a kernel are stored in a single type T.
+ */
+template<typename T>
+class ThreadLocalData
+{
+public:
+  ~ThreadLocalData()
+  {
+    if(current_owner == this)
+    {
+      current_owner  = nullptr;
+      current_object = nullptr;
+    }
+  }
+
+  /**
+   * Sets the function that creates the object of a thread. Objects created previously are deleted.
+   */
+  void
+  initialize(std::function<std::shared_ptr<T>()> const & create_in)
+  {
+    create = create_in;
+
+    objects.clear();
+    current_owner  = nullptr;
+    current_object = nullptr;
+  }
+
+  bool
+  is_initialized() const
+  {
+    return static_cast<bool>(create);
+  }
+
+  /**
+   * Returns the object of the calling thread and makes it the current object of this thread.
+   */
+  T &
+  get() const
+  {
+    std::shared_ptr<T> & object = objects.get();
+
+    if(object.get() == nullptr)
+      object = create();
+
+    current_owner  = this;
+    current_object = object.get();
+
+    return *object;
+  }
+
+  /**
+   * Returns the object of the last call to get() on the calling thread.
+   */
+  T &
+  current() const
+  {
+    Assert(current_owner == this,
+           dealii::ExcMessage("get() has to be called before current() on this thread."));
+
+    return *current_object;
+  }
+
+private:
+  std::function<std::shared_ptr<T>()> create;
+
+  mutable dealii::Threads::ThreadLocalStorage<std::shared_ptr<T>> objects;
+
+  static thread_local ThreadLocalData const * current_owner;
+  static thread_local T *                     current_object;
+};
+
+template<typename T>
+thread_local ThreadLocalData<T> const * ThreadLocalData<T>::current_owner = nullptr;
+
+template<typename T>
+thread_local T * ThreadLocalData<T>::current_object = nullptr;
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_THREAD_LOCAL_DATA_H_ */
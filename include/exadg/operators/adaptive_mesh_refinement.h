@@ -40,6 +40,56 @@
 
 namespace ExaDG
 {
+/**
+ * Error indicator used to mark cells for refinement and coarsening. Kelly uses
+ * dealii::KellyErrorEstimator, while FaceJump and ModalDecay are evaluated matrix-free, see
+ * error_indicators.h.
+ */
+enum class ErrorIndicator
+{
+  Kelly,
+  FaceJump,
+  ModalDecay
+};
+
+/**
+ * Parameters of the cell cost model used to balance the computational load between the processes
+ * after adaptive mesh refinement, see CellCostModel. All costs are relative to the cost of a cell
+ * without boundary faces and without faces with hanging nodes.
+ */
+struct CellCostModelData
+{
+  CellCostModelData()
+    : use_cell_weights(false), calibrate(true), cost_boundary_face(0.0), cost_hanging_face(0.0)
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "Cost-weighted load balancing", use_cell_weights);
+    if(use_cell_weights)
+    {
+      print_parameter(pcout, "Calibrate cell costs", calibrate);
+      print_parameter(pcout, "Cost per boundary face", cost_boundary_face);
+      print_parameter(pcout, "Cost per face with hanging nodes", cost_hanging_face);
+    }
+  }
+
+  // repartition the triangulation according to the cell costs instead of the number of cells
+  bool use_cell_weights;
+
+  // if true, the costs below are only used for the first refinement and are replaced by costs
+  // measured in matrix-free loops after each refinement
+  bool calibrate;
+
+  // additional cost per boundary face of a cell
+  double cost_boundary_face;
+
+  // additional cost per face of a cell with hanging nodes
+  double cost_hanging_face;
+};
+
 struct AdaptiveMeshRefinementData
 {
   AdaptiveMeshRefinementData()
@@ -47,6 +97,7 @@ struct AdaptiveMeshRefinementData
       maximum_refinement_level(10),
       minimum_refinement_level(0),
       preserve_boundary_cells(false),
+      error_indicator(ErrorIndicator::Kelly),
       fraction_of_cells_to_be_refined(0.0),
       fraction_of_cells_to_be_coarsened(0.0)
   {
@@ -60,8 +111,10 @@ struct AdaptiveMeshRefinementData
     print_parameter(pcout, "Maximum refinement level", maximum_refinement_level);
     print_parameter(pcout, "Minimum refinement level", minimum_refinement_level);
     print_parameter(pcout, "Preserve boundary cells", preserve_boundary_cells);
+    print_parameter(pcout, "Error indicator", error_indicator);
     print_parameter(pcout, "Fraction of cells to be refined", fraction_of_cells_to_be_refined);
     print_parameter(pcout, "Fraction of cells to be coarsened", fraction_of_cells_to_be_coarsened);
+    cell_cost_model.print(pcout);
   }
 
   unsigned int trigger_every_n_time_steps;
@@ -70,8 +123,14 @@ struct AdaptiveMeshRefinementData
   int  minimum_refinement_level;
   bool preserve_boundary_cells;
 
+  // FaceJump is a matrix-free variant of Kelly, ModalDecay measures the fraction of the solution in
+  // the highest polynomial modes of each cell and is suited for DG
+  ErrorIndicator error_indicator;
+
   double fraction_of_cells_to_be_refined;
   double fraction_of_cells_to_be_coarsened;
+
+  CellCostModelData cell_cost_model;
 };
 
 /**
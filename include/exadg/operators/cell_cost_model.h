@@ -0,0 +1,316 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_OPERATORS_CELL_COST_MODEL_H_
+#define INCLUDE_EXADG_OPERATORS_CELL_COST_MODEL_H_
+
+// C/C++
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/operators/adaptive_mesh_refinement.h>
+
+namespace ExaDG
+{
+/**
+ * Model for the computational cost of the cells of a triangulation in matrix-free loops, used to
+ * balance the load between the processes when the triangulation is repartitioned after adaptive
+ * mesh refinement. The cost of a cell is modeled as
+ *
+ *   cost = cost_cell(category) + n_boundary_faces * cost_boundary_face
+ *                              + n_hanging_faces  * cost_hanging_face,
+ *
+ * where category is the cell_vectorization_category of the cell in dealii::MatrixFree. All costs
+ * are relative to the cost of a cell of category 0 without boundary faces and hanging nodes. The
+ * costs are either given by CellCostModelData or calibrated by measure(), which times matrix-free
+ * cell and face loops separately for the different types of cells and faces.
+ */
+template<int dim>
+class CellCostModel
+{
+public:
+  typedef typename dealii::Triangulation<dim>::cell_iterator CellIterator;
+
+  CellCostModel(CellCostModelData const & data)
+    : calibrate(data.calibrate),
+      cost_boundary_face(data.cost_boundary_face),
+      cost_hanging_face(data.cost_hanging_face)
+  {
+  }
+
+  ~CellCostModel()
+  {
+    connection.disconnect();
+  }
+
+  /**
+   * Connects the cost model to the weight signal of @param triangulation. The weights are used by
+   * dealii::parallel::distributed::Triangulation to partition the cells whenever the triangulation
+   * is refined or coarsened.
+   */
+  void
+  attach(dealii::Triangulation<dim> & triangulation)
+  {
+    connection.disconnect();
+
+    // Cells that will be coarsened are passed as parent cells, all other cells are active. The
+    // weight of a cell that will be refined is used for each of its children.
+    auto const weight = [this](CellIterator const & cell, auto const) -> unsigned int {
+      return static_cast<unsigned int>(std::round(weight_per_unit_cost * get_cost(cell)));
+    };
+
+#if DEAL_II_VERSION_GTE(9, 6, 0)
+    connection = triangulation.signals.weight.connect(weight);
+#else
+    connection = triangulation.signals.cell_weight.connect(weight);
+#endif
+  }
+
+  /**
+   * Returns the relative cost of a cell.
+   */
+  double
+  get_cost(CellIterator const & cell) const
+  {
+    CellIterator const active_cell = cell->is_active() ? cell : cell->child(0);
+
+    double cost = 1.0;
+    if(active_cell->is_locally_owned() and active_cell->active_cell_index() < cost_cell.size())
+      cost = cost_cell[active_cell->active_cell_index()];
+
+    for(unsigned int const f : cell->face_indices())
+    {
+      if(cell->at_boundary(f) and not cell->has_periodic_neighbor(f))
+        cost += cost_boundary_face;
+      else if(cell->is_active() and not cell->at_boundary(f) and
+              (cell->face(f)->has_children() or cell->neighbor_is_coarser(f)))
+        cost += cost_hanging_face;
+    }
+
+    return cost;
+  }
+
+  /**
+   * Times a matrix-free evaluation of values and gradients on all cell batches and face batches of
+   * @param matrix_free, separately for each cell category and for regular interior faces, interior
+   * faces with hanging nodes, and boundary faces. If the calibration is enabled, the costs of the
+   * model are replaced by the measured costs, averaged over all processes. Returns the measured
+   * wall time of this process, i.e. the local work without communication.
+   *
+   * This function has to be called by all processes.
+   */
+  template<int n_components, typename Number>
+  double
+  measure(dealii::MatrixFree<dim, Number> const & matrix_free,
+          unsigned int const                      dof_index,
+          unsigned int const                      quad_index)
+  {
+    typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+    dealii::EvaluationFlags::EvaluationFlags const flags =
+      dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+    VectorType src, dst;
+    matrix_free.initialize_dof_vector(src, dof_index);
+    matrix_free.initialize_dof_vector(dst, dof_index);
+    src = 1.0;
+    src.update_ghost_values();
+
+    auto const wall_time = [](auto const start) {
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    MPI_Comm const mpi_comm = matrix_free.get_dof_handler(dof_index).get_communicator();
+
+    // time and number of cells per category
+    unsigned int n_categories = 1;
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      n_categories = std::max(n_categories, matrix_free.get_cell_category(cell) + 1);
+    n_categories = dealii::Utilities::MPI::max(n_categories, mpi_comm);
+
+    std::vector<double> time_cells(n_categories, 0.0), n_cells(n_categories, 0.0);
+    {
+      CellIntegrator<dim, n_components, Number> integrator(matrix_free, dof_index, quad_index);
+
+      for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      {
+        auto const start = std::chrono::steady_clock::now();
+
+        integrator.reinit(cell);
+        integrator.read_dof_values(src);
+        integrator.evaluate(flags);
+        integrator.integrate(flags);
+        integrator.distribute_local_to_global(dst);
+
+        unsigned int const category = matrix_free.get_cell_category(cell);
+        time_cells[category] += wall_time(start);
+        n_cells[category] += matrix_free.n_active_entries_per_cell_batch(cell);
+      }
+    }
+
+    // time and number of regular interior faces, interior faces with hanging nodes, and boundary
+    // faces
+    enum FaceType
+    {
+      Regular  = 0,
+      Hanging  = 1,
+      Boundary = 2
+    };
+    std::vector<double> time_faces(3, 0.0), n_faces(3, 0.0);
+    {
+      FaceIntegrator<dim, n_components, Number> integrator_m(matrix_free,
+                                                             true,
+                                                             dof_index,
+                                                             quad_index);
+      FaceIntegrator<dim, n_components, Number> integrator_p(matrix_free,
+                                                             false,
+                                                             dof_index,
+                                                             quad_index);
+
+      unsigned int const n_inner_faces = matrix_free.n_inner_face_batches();
+      for(unsigned int face = 0; face < n_inner_faces + matrix_free.n_boundary_face_batches();
+          ++face)
+      {
+        auto const start = std::chrono::steady_clock::now();
+
+        integrator_m.reinit(face);
+        integrator_m.read_dof_values(src);
+        integrator_m.evaluate(flags);
+        integrator_m.integrate(flags);
+        integrator_m.distribute_local_to_global(dst);
+
+        FaceType type = Boundary;
+        if(face < n_inner_faces)
+        {
+          integrator_p.reinit(face);
+          integrator_p.read_dof_values(src);
+          integrator_p.evaluate(flags);
+          integrator_p.integrate(flags);
+          integrator_p.distribute_local_to_global(dst);
+
+          bool const hanging = matrix_free.get_face_info(face).subface_index !=
+                               dealii::GeometryInfo<dim>::max_children_per_cell;
+          type = hanging ? Hanging : Regular;
+        }
+
+        time_faces[type] += wall_time(start);
+        n_faces[type] += matrix_free.n_active_entries_per_face_batch(face);
+      }
+    }
+
+    double const local_time = std::accumulate(time_cells.begin(), time_cells.end(), 0.0) +
+                              std::accumulate(time_faces.begin(), time_faces.end(), 0.0);
+
+    if(calibrate)
+    {
+      time_cells = dealii::Utilities::MPI::sum(time_cells, mpi_comm);
+      n_cells    = dealii::Utilities::MPI::sum(n_cells, mpi_comm);
+      time_faces = dealii::Utilities::MPI::sum(time_faces, mpi_comm);
+      n_faces    = dealii::Utilities::MPI::sum(n_faces, mpi_comm);
+
+      // each interior face is shared by two cells, while boundary faces and faces with hanging
+      // nodes are accounted for separately
+      double const time_face_regular =
+        n_faces[Regular] > 0.0 ? time_faces[Regular] / n_faces[Regular] : 0.0;
+
+      // use the average over all categories as reference if there are no cells of category 0
+      double const time_cell_category_0 =
+        n_cells[0] > 0.0 ?
+          time_cells[0] / n_cells[0] :
+          std::accumulate(time_cells.begin(), time_cells.end(), 0.0) /
+            std::max(1.0, std::accumulate(n_cells.begin(), n_cells.end(), 0.0));
+      double const time_cell_reference =
+        time_cell_category_0 + 0.5 * dealii::GeometryInfo<dim>::faces_per_cell * time_face_regular;
+
+      std::vector<double> cost_category(n_categories, 1.0);
+      for(unsigned int c = 1; c < n_categories; ++c)
+      {
+        if(n_cells[c] > 0.0)
+          cost_category[c] =
+            1.0 + (time_cells[c] / n_cells[c] - time_cell_category_0) / time_cell_reference;
+      }
+
+      if(n_faces[Boundary] > 0.0)
+        cost_boundary_face =
+          std::max(0.0, time_faces[Boundary] / n_faces[Boundary] - 0.5 * time_face_regular) /
+          time_cell_reference;
+
+      if(n_faces[Hanging] > 0.0)
+        cost_hanging_face =
+          std::max(0.0, time_faces[Hanging] / n_faces[Hanging] - 0.5 * time_face_regular) /
+          time_cell_reference;
+
+      // store the cost of the category of each locally owned cell
+      cost_cell.assign(matrix_free.get_dof_handler(dof_index).get_triangulation().n_active_cells(),
+                       1.0);
+      for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      {
+        for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+          cost_cell[matrix_free.get_cell_iterator(cell, v, dof_index)->active_cell_index()] =
+            cost_category[matrix_free.get_cell_category(cell)];
+      }
+    }
+
+    return local_time;
+  }
+
+  double
+  get_cost_boundary_face() const
+  {
+    return cost_boundary_face;
+  }
+
+  double
+  get_cost_hanging_face() const
+  {
+    return cost_hanging_face;
+  }
+
+private:
+  // the weights passed to the triangulation are integers
+  static constexpr double weight_per_unit_cost = 1000.0;
+
+  bool const calibrate;
+
+  double cost_boundary_face;
+  double cost_hanging_face;
+
+  // cost of the category of each locally owned cell, indexed by the active cell index
+  std::vector<double> cost_cell;
+
+  boost::signals2::connection connection;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_CELL_COST_MODEL_H_ */
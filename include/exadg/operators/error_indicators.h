@@ -0,0 +1,339 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_OPERATORS_ERROR_INDICATORS_H_
+#define INCLUDE_EXADG_OPERATORS_ERROR_INDICATORS_H_
+
+// C/C++
+#include <array>
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/polynomial.h>
+#include <deal.II/distributed/grid_refinement.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/operators/adaptive_mesh_refinement.h>
+#include <exadg/operators/mapping_flags.h>
+
+namespace ExaDG
+{
+/**
+ * Mapping flags required by the face-jump indicator on interior faces. They have to be added to
+ * the MatrixFree object passed to compute_face_jump_indicator().
+ */
+inline MappingFlags
+get_mapping_flags_face_jump_indicator()
+{
+  MappingFlags flags;
+
+  flags.inner_faces = dealii::update_gradients | dealii::update_JxW_values |
+                      dealii::update_normal_vectors;
+
+  return flags;
+}
+
+namespace internal
+{
+/**
+ * Returns a ghosted copy of @param solution with the constraints distributed, so that the cell and
+ * face integrators can read the plain DoF values including hanging nodes and Dirichlet values.
+ */
+template<int dim, typename Number>
+dealii::LinearAlgebra::distributed::Vector<Number>
+get_solution_with_constraints_distributed(
+  dealii::MatrixFree<dim, Number> const &                    matrix_free,
+  dealii::AffineConstraints<Number> const &                  constraints,
+  unsigned int const                                         dof_index,
+  dealii::LinearAlgebra::distributed::Vector<Number> const & solution)
+{
+  dealii::LinearAlgebra::distributed::Vector<Number> solution_ghosted;
+  matrix_free.initialize_dof_vector(solution_ghosted, dof_index);
+  solution_ghosted.copy_locally_owned_data_from(solution);
+  constraints.distribute(solution_ghosted);
+  solution_ghosted.update_ghost_values();
+
+  return solution_ghosted;
+}
+} // namespace internal
+
+/**
+ * Matrix-free variant of the Kelly error estimator for continuous and discontinuous Galerkin
+ * discretizations. The indicator of a cell K is
+ *
+ *   eta_K^2 = sum_{F in interior faces of K} h_F * || [grad(u) * n] ||_F^2
+ *                                          + 1/h_F * || [u] ||_F^2 ,
+ *
+ * where the jump of the solution vanishes for continuous elements. The face integrals are computed
+ * with sum factorization on the face batches of @param matrix_free, which therefore has to provide
+ * the mapping flags of get_mapping_flags_face_jump_indicator(). Returns the indicators indexed by
+ * the active cell index, where only the entries of locally owned cells are valid.
+ */
+template<int dim, int n_components, typename Number>
+dealii::Vector<float>
+compute_face_jump_indicator(
+  dealii::MatrixFree<dim, Number> const &                    matrix_free,
+  dealii::AffineConstraints<Number> const &                  constraints,
+  unsigned int const                                         dof_index,
+  unsigned int const                                         quad_index,
+  dealii::LinearAlgebra::distributed::Vector<Number> const & solution)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  dealii::LinearAlgebra::distributed::Vector<Number> const solution_ghosted =
+    internal::get_solution_with_constraints_distributed(matrix_free,
+                                                        constraints,
+                                                        dof_index,
+                                                        solution);
+
+  dealii::Triangulation<dim> const & triangulation =
+    matrix_free.get_dof_handler(dof_index).get_triangulation();
+
+  // A face at a processor boundary is only visited by one of the two processes. The contributions
+  // are therefore summed up by the global active cell index, which sends the contributions to
+  // ghost cells to the owner of the cell.
+  dealii::LinearAlgebra::distributed::Vector<double> indicator_squared(
+    triangulation.global_active_cell_index_partitioner().lock());
+
+  FaceIntegrator<dim, n_components, Number> integrator_m(matrix_free, true, dof_index, quad_index);
+  FaceIntegrator<dim, n_components, Number> integrator_p(matrix_free, false, dof_index, quad_index);
+
+  dealii::EvaluationFlags::EvaluationFlags const flags =
+    dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+
+  for(unsigned int face = 0; face < matrix_free.n_inner_face_batches(); ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_m.read_dof_values_plain(solution_ghosted);
+    integrator_m.evaluate(flags);
+
+    integrator_p.reinit(face);
+    integrator_p.read_dof_values_plain(solution_ghosted);
+    integrator_p.evaluate(flags);
+
+    scalar area = scalar(0.0), jump_gradient = scalar(0.0), jump_value = scalar(0.0);
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      auto const jump_normal_derivative =
+        integrator_m.get_normal_derivative(q) - integrator_p.get_normal_derivative(q);
+      auto const jump = integrator_m.get_value(q) - integrator_p.get_value(q);
+
+      area += integrator_m.JxW(q);
+      jump_gradient += integrator_m.JxW(q) * (jump_normal_derivative * jump_normal_derivative);
+      jump_value += integrator_m.JxW(q) * (jump * jump);
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      double const h_face = std::pow(area[v], 1.0 / (dim - 1));
+      double const contribution =
+        h_face * jump_gradient[v] + (h_face > 0.0 ? jump_value[v] / h_face : 0.0);
+
+      indicator_squared(
+        matrix_free.get_face_iterator(face, v, true).first->global_active_cell_index()) +=
+        contribution;
+      indicator_squared(
+        matrix_free.get_face_iterator(face, v, false).first->global_active_cell_index()) +=
+        contribution;
+    }
+  }
+
+  indicator_squared.compress(dealii::VectorOperation::add);
+
+  dealii::Vector<float> indicator(triangulation.n_active_cells());
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned())
+      indicator[cell->active_cell_index()] =
+        std::sqrt(indicator_squared(cell->global_active_cell_index()));
+
+  return indicator;
+}
+
+/**
+ * Spectral indicator based on the decay of the modal coefficients of the solution in each cell
+ * (Persson and Peraire). The solution is projected onto the tensor product of orthonormal Legendre
+ * polynomials of the degree of the finite element, and the indicator of a cell is the fraction of
+ * the L2 norm squared contained in the modes of highest degree in any direction. The projection is
+ * computed with sum factorization from the values at the quadrature points, which requires a
+ * tensor-product quadrature rule with at least degree + 1 points per direction. This indicator is
+ * intended for discontinuous Galerkin discretizations of hypercube meshes and needs no face loops.
+ * Returns the indicators indexed by the active cell index, where only the entries of locally owned
+ * cells are valid.
+ */
+template<int dim, int n_components, typename Number>
+dealii::Vector<float>
+compute_modal_decay_indicator(
+  dealii::MatrixFree<dim, Number> const &                    matrix_free,
+  dealii::AffineConstraints<Number> const &                  constraints,
+  unsigned int const                                         dof_index,
+  unsigned int const                                         quad_index,
+  dealii::LinearAlgebra::distributed::Vector<Number> const & solution)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  dealii::Quadrature<dim> const & quadrature = matrix_free.get_quadrature(quad_index);
+  AssertThrow(quadrature.is_tensor_product(),
+              dealii::ExcMessage("The modal decay indicator requires a tensor-product quadrature "
+                                 "rule."));
+
+  dealii::Quadrature<1> const quadrature_1d = quadrature.get_tensor_basis()[0];
+
+  unsigned int const n_q_points_1d = quadrature_1d.size();
+  unsigned int const n_modes_1d = matrix_free.get_dof_handler(dof_index).get_fe().degree + 1;
+
+  AssertThrow(n_modes_1d >= 2,
+              dealii::ExcMessage("The modal decay indicator requires a degree of at least 1."));
+  AssertThrow(n_q_points_1d >= n_modes_1d,
+              dealii::ExcMessage("The modal decay indicator requires at least degree + 1 "
+                                 "quadrature points per direction."));
+
+  // projection of the values at the 1D quadrature points onto the Legendre polynomials, which are
+  // orthonormal on the unit interval in deal.II
+  std::vector<Number> projection(n_modes_1d * n_q_points_1d);
+  for(unsigned int k = 0; k < n_modes_1d; ++k)
+  {
+    dealii::Polynomials::Legendre<double> const legendre(k);
+    for(unsigned int q = 0; q < n_q_points_1d; ++q)
+      projection[k * n_q_points_1d + q] =
+        quadrature_1d.weight(q) * legendre.value(quadrature_1d.point(q)[0]);
+  }
+
+  dealii::LinearAlgebra::distributed::Vector<Number> const solution_ghosted =
+    internal::get_solution_with_constraints_distributed(matrix_free,
+                                                        constraints,
+                                                        dof_index,
+                                                        solution);
+
+  dealii::Vector<float> indicator(
+    matrix_free.get_dof_handler(dof_index).get_triangulation().n_active_cells());
+
+  CellIntegrator<dim, n_components, Number> integrator(matrix_free, dof_index, quad_index);
+
+  std::vector<scalar> coefficients, coefficients_tmp;
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values_plain(solution_ghosted);
+    integrator.evaluate(dealii::EvaluationFlags::values);
+
+    scalar energy_highest_modes = scalar(0.0), energy = scalar(0.0);
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      coefficients.assign(integrator.begin_values() + c * integrator.n_q_points,
+                          integrator.begin_values() + (c + 1) * integrator.n_q_points);
+
+      // sum factorization, applying the 1D projection in one direction after the other
+      std::array<unsigned int, dim> sizes;
+      sizes.fill(n_q_points_1d);
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        unsigned int stride = 1, n_outer = 1;
+        for(unsigned int e = 0; e < d; ++e)
+          stride *= sizes[e];
+        for(unsigned int e = d + 1; e < dim; ++e)
+          n_outer *= sizes[e];
+
+        coefficients_tmp.assign(stride * n_modes_1d * n_outer, scalar(0.0));
+        for(unsigned int outer = 0; outer < n_outer; ++outer)
+          for(unsigned int k = 0; k < n_modes_1d; ++k)
+            for(unsigned int q = 0; q < sizes[d]; ++q)
+              for(unsigned int inner = 0; inner < stride; ++inner)
+                coefficients_tmp[inner + stride * (k + n_modes_1d * outer)] +=
+                  projection[k * n_q_points_1d + q] *
+                  coefficients[inner + stride * (q + sizes[d] * outer)];
+
+        sizes[d] = n_modes_1d;
+        coefficients.swap(coefficients_tmp);
+      }
+
+      for(unsigned int i = 0; i < coefficients.size(); ++i)
+      {
+        bool is_highest_mode = false;
+        for(unsigned int d = 0, index = i; d < dim; ++d, index /= n_modes_1d)
+          if(index % n_modes_1d == n_modes_1d - 1)
+            is_highest_mode = true;
+
+        energy += coefficients[i] * coefficients[i];
+        if(is_highest_mode)
+          energy_highest_modes += coefficients[i] * coefficients[i];
+      }
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      indicator[matrix_free.get_cell_iterator(cell, v, dof_index)->active_cell_index()] =
+        energy[v] > 0.0 ? energy_highest_modes[v] / energy[v] : 0.0;
+    }
+  }
+
+  return indicator;
+}
+
+/**
+ * Marks cells for refinement and coarsening according to the matrix-free error indicator selected
+ * in @param amr_data.
+ */
+template<int dim, int n_components, typename Number>
+void
+mark_cells_matrix_free_error_indicator(
+  dealii::Triangulation<dim> &                               tria,
+  dealii::MatrixFree<dim, Number> const &                    matrix_free,
+  dealii::AffineConstraints<Number> const &                  constraints,
+  unsigned int const                                         dof_index,
+  unsigned int const                                         quad_index,
+  dealii::LinearAlgebra::distributed::Vector<Number> const & solution,
+  AdaptiveMeshRefinementData const &                         amr_data)
+{
+  dealii::Vector<float> indicator;
+  if(amr_data.error_indicator == ErrorIndicator::FaceJump)
+  {
+    indicator = compute_face_jump_indicator<dim, n_components, Number>(
+      matrix_free, constraints, dof_index, quad_index, solution);
+  }
+  else if(amr_data.error_indicator == ErrorIndicator::ModalDecay)
+  {
+    indicator = compute_modal_decay_indicator<dim, n_components, Number>(
+      matrix_free, constraints, dof_index, quad_index, solution);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("This error indicator is not matrix-free."));
+  }
+
+  dealii::parallel::distributed::GridRefinement::refine_and_coarsen_fixed_number(
+    tria,
+    indicator,
+    amr_data.fraction_of_cells_to_be_refined,
+    amr_data.fraction_of_cells_to_be_coarsened);
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_OPERATORS_ERROR_INDICATORS_H_ */
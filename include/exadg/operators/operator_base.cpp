@@ -19,7 +19,11 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <mutex>
+
 // deal.II
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/lac/sparse_matrix_tools.h>
 #include <deal.II/lac/sparsity_tools.h>
@@ -35,6 +39,13 @@
 
 namespace ExaDG
 {
+namespace
+{
+// Adding entries to the global sparse matrix is not thread-safe. In hybrid MPI+threads mode, the
+// local matrices of the cells/faces processed concurrently are therefore added one after another.
+std::mutex mutex_system_matrix;
+} // namespace
+
 template<int dim, typename Number, int n_components>
 OperatorBase<dim, Number, n_components>::OperatorBase()
   : dealii::Subscriptor(),
@@ -705,6 +716,11 @@ void
 OperatorBase<dim, Number, n_components>::initialize_block_diagonal_preconditioner_matrix_free(
   bool const initialize) const
 {
+  AssertThrow(dealii::MultithreadInfo::n_threads() == 1,
+              dealii::ExcMessage("The elementwise solvers of the matrix-free block-Jacobi "
+                                 "preconditioner are not thread-safe. Use a matrix-based "
+                                 "block-Jacobi preconditioner in hybrid MPI+threads mode."));
+
   elementwise_operator = std::make_shared<ELEMENTWISE_OPERATOR>(*this);
 
   if(data.preconditioner_block_diagonal == Elementwise::Preconditioner::None)
@@ -2047,6 +2063,8 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
             temp[matrix_free.get_shape_info(this->data.dof_index).lexicographic_numbering[j]];
       }
 
+      std::lock_guard<std::mutex> lock(mutex_system_matrix);
+
       // choose the version of distribute_local_to_global with a single
       // `dof_indices` argument to indicate that we write to a diagonal block
       // of the matrix (vs 2 for off-diagonal ones); this implies a non-zero
@@ -2149,6 +2167,8 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
         cell_p->get_dof_indices(dof_indices_p);
       }
 
+      std::lock_guard<std::mutex> lock(mutex_system_matrix);
+
       // save M_mm
       constraint_double.distribute_local_to_global(matrices_m[v], dof_indices_m, dst);
       // save M_pm
@@ -2209,6 +2229,8 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
         cell_p->get_dof_indices(dof_indices_p);
       }
 
+      std::lock_guard<std::mutex> lock(mutex_system_matrix);
+
       // save M_mp
       constraint_double.distribute_local_to_global(matrices_m[v],
                                                    dof_indices_m,
@@ -2277,6 +2299,8 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_calculate_system_mat
       else
         cell_v->get_dof_indices(dof_indices);
 
+      std::lock_guard<std::mutex> lock(mutex_system_matrix);
+
       constraint_double.distribute_local_to_global(matrices[v], dof_indices, dst);
     }
   }
@@ -19,7 +19,15 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <array>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <string>
+
 // ExaDG
+#include <exadg/solvers_and_preconditioners/utilities/qr_decomposition.h>
 #include <exadg/poisson/overset_grids/driver.h>
 #include <exadg/utilities/print_general_infos.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -30,11 +38,49 @@ namespace Poisson
 {
 namespace OversetGrids
 {
+namespace
+{
+template<int dim>
+std::array<double, 1>
+value_to_array(dealii::Tensor<0, dim, double> const & value)
+{
+  return {{value}};
+}
+
+template<int dim>
+std::array<double, dim>
+value_to_array(dealii::Tensor<1, dim, double> const & value)
+{
+  std::array<double, dim> values;
+  for(unsigned int d = 0; d < dim; ++d)
+    values[d] = value[d];
+  return values;
+}
+
+template<int dim>
+void
+array_to_value(std::array<double, 1> const & values, dealii::Tensor<0, dim, double> & value)
+{
+  value = values[0];
+}
+
+template<int dim>
+void
+array_to_value(std::array<double, dim> const & values, dealii::Tensor<1, dim, double> & value)
+{
+  for(unsigned int d = 0; d < dim; ++d)
+    value[d] = values[d];
+}
+} // namespace
+
 template<int dim, int n_components, typename Number>
 Driver<dim, n_components, Number>::Driver(
   MPI_Comm const &                                            comm,
   std::shared_ptr<ApplicationBase<dim, n_components, Number>> app)
   : mpi_comm(comm),
+    mpi_comm_domain(new MPI_Comm(comm), [](MPI_Comm * comm) { delete comm; }),
+    domain1_on_this_process(true),
+    domain2_on_this_process(true),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
     application(app)
 {
@@ -54,82 +100,189 @@ Driver<dim, n_components, Number>::setup()
   AssertThrow(application->domain1.get(), dealii::ExcMessage("Domain 1 is uninitialized."));
   AssertThrow(application->domain2.get(), dealii::ExcMessage("Domain 2 is uninitialized."));
 
-  application->domain1->setup_pre(grid1, mapping1, multigrid_mappings1, {"Domain1"});
-  application->domain2->setup_pre(grid2, mapping2, multigrid_mappings2, {"Domain2"});
+  application->setup_parameters();
+  application->schwarz_parameters.print(pcout, "List of parameters for Schwarz iteration:");
 
-  // set boundary IDs for domain 1
-  set_boundary_ids_overlap_region(*grid1->triangulation,
-                                  application->boundary_id_overlap,
-                                  *mapping2,
-                                  *grid2->triangulation);
+  if(application->schwarz_parameters.solve_subdomains_concurrently)
+  {
+    split_communicator();
 
-  // set boundary IDs for domain 2
-  set_boundary_ids_overlap_region(*grid2->triangulation,
-                                  application->boundary_id_overlap,
-                                  *mapping1,
-                                  *grid1->triangulation);
+    if(domain1_on_this_process)
+      application->domain1->setup_pre(grid1, mapping1, multigrid_mappings1, {"Domain1"});
+    else
+      application->domain2->setup_pre(grid2, mapping2, multigrid_mappings2, {"Domain2"});
 
-  application->domain1->setup_post(grid1);
-  application->domain2->setup_post(grid2);
+    // set boundary IDs for domain 1
+    set_boundary_ids_overlap_region_across_communicators<dim>(
+      mpi_comm,
+      domain1_on_this_process ? grid1->triangulation.get() : nullptr,
+      application->boundary_id_overlap,
+      domain2_on_this_process ? mapping2.get() : nullptr,
+      domain2_on_this_process ? grid2->triangulation.get() : nullptr);
 
-  // setup Poisson solvers
-  poisson1->setup(application->domain1, grid1, mapping1, multigrid_mappings1, mpi_comm);
-  poisson2->setup(application->domain2, grid2, mapping2, multigrid_mappings2, mpi_comm);
+    // set boundary IDs for domain 2
+    set_boundary_ids_overlap_region_across_communicators<dim>(
+      mpi_comm,
+      domain2_on_this_process ? grid2->triangulation.get() : nullptr,
+      application->boundary_id_overlap,
+      domain1_on_this_process ? mapping1.get() : nullptr,
+      domain1_on_this_process ? grid1->triangulation.get() : nullptr);
 
-  // setup interface coupling
+    // setup Poisson solvers
+    if(domain1_on_this_process)
+    {
+      application->domain1->setup_post(grid1);
+      poisson1->setup(
+        application->domain1, grid1, mapping1, multigrid_mappings1, *mpi_comm_domain);
+    }
+    else
+    {
+      application->domain2->setup_post(grid2);
+      poisson2->setup(
+        application->domain2, grid2, mapping2, multigrid_mappings2, *mpi_comm_domain);
+    }
+  }
+  else
   {
-    // domain 1 to domain 2
-    pcout << std::endl << "Setup interface coupling first -> second ..." << std::endl;
+    application->domain1->setup_pre(grid1, mapping1, multigrid_mappings1, {"Domain1"});
+    application->domain2->setup_pre(grid2, mapping2, multigrid_mappings2, {"Domain2"});
+
+    // set boundary IDs for domain 1
+    set_boundary_ids_overlap_region(*grid1->triangulation,
+                                    application->boundary_id_overlap,
+                                    *mapping2,
+                                    *grid2->triangulation);
+
+    // set boundary IDs for domain 2
+    set_boundary_ids_overlap_region(*grid2->triangulation,
+                                    application->boundary_id_overlap,
+                                    *mapping1,
+                                    *grid1->triangulation);
+
+    application->domain1->setup_post(grid1);
+    application->domain2->setup_post(grid2);
+
+    // setup Poisson solvers
+    poisson1->setup(application->domain1, grid1, mapping1, multigrid_mappings1, mpi_comm);
+    poisson2->setup(application->domain2, grid2, mapping2, multigrid_mappings2, mpi_comm);
+  }
+
+  if(domain1_on_this_process)
+    interface_data.push_back(poisson1->pde_operator->get_container_interface_data());
+  if(domain2_on_this_process)
+    interface_data.push_back(poisson2->pde_operator->get_container_interface_data());
+
+  setup_interface_coupling();
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::split_communicator()
+{
+  unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  AssertThrow(n_processes > 1,
+              dealii::ExcMessage(
+                "Solving the subdomains concurrently requires at least two MPI processes."));
+
+  // domain 1 is solved on the first processes, domain 2 on the last processes
+  int const n_processes_domain1 = std::min<int>(
+    std::max<int>(std::round(application->schwarz_parameters.fraction_of_processes_domain1 *
+                             n_processes),
+                  1),
+    n_processes - 1);
 
-    first_to_second = std::make_shared<InterfaceCoupling<rank, dim, Number>>();
-    // No map of boundary IDs can be provided to make the search more efficient. The reason behind
-    // is that the two domains are not connected along boundaries but are overlapping instead. To
-    // resolve this, the implementation of InterfaceCoupling needs to be generalized.
+  int const rank_ = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  domain1_on_this_process = rank_ < n_processes_domain1;
+  domain2_on_this_process = not domain1_on_this_process;
+
+  MPI_Comm * sub_comm = new MPI_Comm;
+  int const  ierr = MPI_Comm_split(mpi_comm, domain1_on_this_process ? 0 : 1, rank_, sub_comm);
+  AssertThrowMPI(ierr);
+
+  mpi_comm_domain = std::unique_ptr<MPI_Comm, void (*)(MPI_Comm *)>(sub_comm, [](MPI_Comm * comm) {
+    MPI_Comm_free(comm);
+    delete comm;
+  });
+
+  if(domain1_on_this_process)
+    application->domain1->set_mpi_comm(*mpi_comm_domain);
+  else
+    application->domain2->set_mpi_comm(*mpi_comm_domain);
+
+  pcout << std::endl << "Distribution of MPI processes:" << std::endl << std::endl;
+  print_parameter(pcout, "Processes domain 1", n_processes_domain1);
+  print_parameter(pcout, "Processes domain 2", n_processes - n_processes_domain1);
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::setup_interface_coupling()
+{
+  // No map of boundary IDs can be provided to make the search more efficient. The reason behind
+  // is that the two domains are not connected along boundaries but are overlapping instead. To
+  // resolve this, the implementation of InterfaceCoupling needs to be generalized.
+
+  // domain 1 to domain 2
+  pcout << std::endl << "Setup interface coupling first -> second ..." << std::endl;
+
+  first_to_second = std::make_shared<InterfaceCoupling<rank, dim, Number>>();
+
+  if(application->schwarz_parameters.solve_subdomains_concurrently)
+  {
+    first_to_second->setup_across_communicators(
+      mpi_comm,
+      domain2_on_this_process ? poisson2->pde_operator->get_container_interface_data() : nullptr,
+      domain1_on_this_process ? &poisson1->pde_operator->get_dof_handler() : nullptr,
+      domain1_on_this_process ? mapping1.get() : nullptr,
+      1.e-8 /* geometric tolerance */);
+  }
+  else
+  {
     first_to_second->setup(poisson2->pde_operator->get_container_interface_data(),
                            poisson1->pde_operator->get_dof_handler(),
                            *mapping1,
                            {} /* marked_vertices */,
                            1.e-8 /* geometric tolerance */);
+  }
+
+  pcout << std::endl << "... done." << std::endl;
 
-    pcout << std::endl << "... done." << std::endl;
+  // domain 2 to domain 1
+  pcout << std::endl << "Setup interface coupling second -> first ..." << std::endl;
 
-    // domain 2 to domain 1
-    pcout << std::endl << "Setup interface coupling second -> first ..." << std::endl;
+  second_to_first = std::make_shared<InterfaceCoupling<rank, dim, Number>>();
 
-    second_to_first = std::make_shared<InterfaceCoupling<rank, dim, Number>>();
+  if(application->schwarz_parameters.solve_subdomains_concurrently)
+  {
+    second_to_first->setup_across_communicators(
+      mpi_comm,
+      domain1_on_this_process ? poisson1->pde_operator->get_container_interface_data() : nullptr,
+      domain2_on_this_process ? &poisson2->pde_operator->get_dof_handler() : nullptr,
+      domain2_on_this_process ? mapping2.get() : nullptr,
+      1.e-8 /* geometric tolerance */);
+  }
+  else
+  {
     second_to_first->setup(poisson1->pde_operator->get_container_interface_data(),
                            poisson2->pde_operator->get_dof_handler(),
                            *mapping2,
                            {} /* marked_vertices */,
                            1.e-8 /* geometric tolerance */);
-
-    pcout << std::endl << "... done." << std::endl;
   }
+
+  pcout << std::endl << "... done." << std::endl;
 }
 
 template<int dim, int n_components, typename Number>
 void
-Driver<dim, n_components, Number>::solve()
+Driver<dim, n_components, Number>::do_schwarz_iteration(VectorType & sol_1,
+                                                        VectorType & rhs_1,
+                                                        VectorType & sol_2,
+                                                        VectorType & rhs_2) const
 {
-  // initialization of vectors
-  dealii::LinearAlgebra::distributed::Vector<Number> rhs_1, rhs_2;
-  dealii::LinearAlgebra::distributed::Vector<Number> sol_1, sol_2;
-  poisson1->pde_operator->initialize_dof_vector(rhs_1);
-  poisson1->pde_operator->initialize_dof_vector(sol_1);
-  poisson1->pde_operator->prescribe_initial_conditions(sol_1);
-
-  poisson2->pde_operator->initialize_dof_vector(rhs_2);
-  poisson2->pde_operator->initialize_dof_vector(sol_2);
-  poisson2->pde_operator->prescribe_initial_conditions(sol_2);
-
-  // postprocessing of results
-  poisson1->postprocessor->do_postprocessing(sol_1);
-  poisson2->postprocessor->do_postprocessing(sol_2);
-
-  // solve linear system of equations
-  bool         converged = false;
-  unsigned int iter      = 0;
-  while(not(converged))
+  if(application->schwarz_parameters.type == SchwarzType::Multiplicative)
   {
     // solve on domain 1
     poisson1->pde_operator->rhs(rhs_1);
@@ -144,16 +297,241 @@ Driver<dim, n_components, Number>::solve()
 
     // Transfer data from 2 to 1
     second_to_first->update_data(sol_2);
+  }
+  else if(application->schwarz_parameters.type == SchwarzType::Additive)
+  {
+    // Both solves use the interface data of the previous iteration. If the domains live on
+    // disjoint sets of processes, the solves run concurrently.
+    if(domain1_on_this_process)
+    {
+      poisson1->pde_operator->rhs(rhs_1);
+      poisson1->pde_operator->solve(sol_1, rhs_1, 0.0 /* time */);
+    }
 
-    // postprocessing of results
+    if(domain2_on_this_process)
+    {
+      poisson2->pde_operator->rhs(rhs_2);
+      poisson2->pde_operator->solve(sol_2, rhs_2, 0.0 /* time */);
+    }
+
+    if(application->schwarz_parameters.solve_subdomains_concurrently)
+    {
+      if(domain1_on_this_process)
+      {
+        first_to_second->send_data(sol_1);
+        second_to_first->receive_data();
+      }
+      else
+      {
+        second_to_first->send_data(sol_2);
+        first_to_second->receive_data();
+      }
+    }
+    else
+    {
+      first_to_second->update_data(sol_1);
+      second_to_first->update_data(sol_2);
+    }
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::initialize_interface_vector(InterfaceVectorType & vector) const
+{
+  unsigned int n_locally_owned = 0;
+  for(auto const & data : interface_data)
+    for(auto const quad_index : data->get_quad_indices())
+      n_locally_owned += data->get_array_solution(quad_index).size() * n_components;
+
+  dealii::types::global_dof_index const n_locally_owned_global = n_locally_owned;
+  dealii::types::global_dof_index const offset =
+    dealii::Utilities::MPI::partial_sums(n_locally_owned_global, mpi_comm) -
+    n_locally_owned_global;
+
+  dealii::IndexSet locally_owned(dealii::Utilities::MPI::sum(n_locally_owned_global, mpi_comm));
+  locally_owned.add_range(offset, offset + n_locally_owned_global);
+
+  vector.reinit(locally_owned, mpi_comm);
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::copy_interface_data_to_vector(InterfaceVectorType & dst) const
+{
+  unsigned int index = 0;
+  for(auto const & data : interface_data)
+  {
+    for(auto const quad_index : data->get_quad_indices())
+    {
+      for(auto const & value : data->get_array_solution(quad_index))
+      {
+        std::array<double, n_components> const values = value_to_array(value);
+        for(unsigned int c = 0; c < n_components; ++c)
+          dst.local_element(index++) = values[c];
+      }
+    }
+  }
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::copy_vector_to_interface_data(
+  InterfaceVectorType const & src) const
+{
+  unsigned int index = 0;
+  for(auto const & data : interface_data)
+  {
+    for(auto const quad_index : data->get_quad_indices())
+    {
+      for(auto & value : data->get_array_solution(quad_index))
+      {
+        std::array<double, n_components> values;
+        for(unsigned int c = 0; c < n_components; ++c)
+          values[c] = src.local_element(index++);
+        array_to_value(values, value);
+      }
+    }
+  }
+}
+
+template<int dim, int n_components, typename Number>
+void
+Driver<dim, n_components, Number>::solve()
+{
+  // initialization of vectors
+  VectorType rhs_1, rhs_2;
+  VectorType sol_1, sol_2;
+  if(domain1_on_this_process)
+  {
+    poisson1->pde_operator->initialize_dof_vector(rhs_1);
+    poisson1->pde_operator->initialize_dof_vector(sol_1);
+    poisson1->pde_operator->prescribe_initial_conditions(sol_1);
+  }
+
+  if(domain2_on_this_process)
+  {
+    poisson2->pde_operator->initialize_dof_vector(rhs_2);
+    poisson2->pde_operator->initialize_dof_vector(sol_2);
+    poisson2->pde_operator->prescribe_initial_conditions(sol_2);
+  }
+
+  // postprocessing of results
+  if(domain1_on_this_process)
     poisson1->postprocessor->do_postprocessing(sol_1);
+  if(domain2_on_this_process)
     poisson2->postprocessor->do_postprocessing(sol_2);
 
-    // TODO check convergence
+  SchwarzParameters const & param = application->schwarz_parameters;
+
+  // The Schwarz iteration is a fixed-point iteration g = F(g) for the interface data g. In case of
+  // Anderson acceleration, the new iterate is the combination of the last values F(g) that
+  // minimizes the l2-norm of the combined residuals r = F(g) - g. The least-squares problem is
+  // solved by a QR decomposition that is updated incrementally.
+  InterfaceVectorType g, F_g, residual, F_g_old, residual_old, tmp;
+  initialize_interface_vector(g);
+  F_g          = g;
+  residual     = g;
+  F_g_old      = g;
+  residual_old = g;
+  tmp          = g;
+
+  copy_interface_data_to_vector(g);
+
+  QRDecomposition<InterfaceVectorType, double> QR;
+  std::deque<InterfaceVectorType>              D;
+
+  dealii::Timer timer;
+
+  double       norm_residual_initial = 1.0;
+  bool         converged             = false;
+  unsigned int iter                  = 0;
+  while(not converged and iter < param.max_iter)
+  {
+    copy_vector_to_interface_data(g);
+
+    do_schwarz_iteration(sol_1, rhs_1, sol_2, rhs_2);
+
+    // postprocessing of results
+    if(domain1_on_this_process)
+      poisson1->postprocessor->do_postprocessing(sol_1);
+    if(domain2_on_this_process)
+      poisson2->postprocessor->do_postprocessing(sol_2);
+
+    copy_interface_data_to_vector(F_g);
+    residual.equ(1.0, F_g);
+    residual.add(-1.0, g);
+
+    double const norm_residual = residual.l2_norm();
+    if(iter == 0)
+      norm_residual_initial = norm_residual;
+
+    pcout << std::endl
+          << "Schwarz iteration " << iter + 1 << ": interface residual = " << std::scientific
+          << std::setprecision(4) << norm_residual << std::endl;
+
+    converged =
+      norm_residual < param.abs_tol or norm_residual < param.rel_tol * norm_residual_initial;
+
+    if(not converged)
+    {
+      if(param.acceleration == InterfaceAcceleration::Anderson)
+      {
+        if(iter > 0)
+        {
+          tmp.equ(1.0, residual);
+          tmp.add(-1.0, residual_old);
+          if(QR.append_column(tmp))
+          {
+            D.push_back(F_g);
+            D.back().add(-1.0, F_g_old);
+          }
+
+          if(QR.size() > param.anderson_depth)
+          {
+            QR.remove_first_column();
+            D.pop_front();
+          }
+        }
+
+        residual_old = residual;
+        F_g_old      = F_g;
+
+        g = F_g;
+        if(QR.size() > 0)
+        {
+          std::vector<double> const rhs = QR.apply_Q_transpose(residual);
+          std::vector<double>       gamma(rhs.size());
+          backward_substitution(QR.get_R(), gamma, rhs);
+
+          for(unsigned int i = 0; i < gamma.size(); ++i)
+            g.add(-gamma[i], D[i]);
+        }
+      }
+      else
+      {
+        g = F_g;
+      }
+    }
+
     ++iter;
-    if(iter > 10)
-      converged = true;
   }
+
+  double const wall_time = timer.wall_time();
+
+  // Without tolerances, a fixed number of iterations is performed and convergence is not checked.
+  std::string status = "finished";
+  if(param.abs_tol > 0.0 or param.rel_tol > 0.0)
+    status = converged ? "converged" : "did not converge";
+
+  pcout << std::endl
+        << "Schwarz iteration " << status << " after " << iter
+        << " iterations (wall time: " << std::scientific << std::setprecision(4) << wall_time
+        << " s)." << std::endl;
 }
 
 template class Driver<2, 1, float>;
@@ -82,9 +82,48 @@ private:
   static unsigned int const rank =
     (n_components == 1) ? 0 : ((n_components == dim) ? 1 : dealii::numbers::invalid_unsigned_int);
 
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+  // vector of the interface data of both domains, distributed over all processes
+  using InterfaceVectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+  void
+  split_communicator();
+
+  void
+  setup_interface_coupling();
+
+  /*
+   * Performs one Schwarz iteration, i.e., solves on both domains for the interface data currently
+   * stored in the containers of the Poisson operators and updates the interface data.
+   */
+  void
+  do_schwarz_iteration(VectorType & sol_1,
+                       VectorType & rhs_1,
+                       VectorType & sol_2,
+                       VectorType & rhs_2) const;
+
+  void
+  initialize_interface_vector(InterfaceVectorType & vector) const;
+
+  void
+  copy_interface_data_to_vector(InterfaceVectorType & dst) const;
+
+  void
+  copy_vector_to_interface_data(InterfaceVectorType const & src) const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
+  // In case the subdomains are solved concurrently, every process works on exactly one of the
+  // domains using the sub-communicator mpi_comm_domain. Otherwise, mpi_comm_domain equals
+  // mpi_comm. A sub-communicator is freed by a custom deleter after the solvers have been
+  // destroyed, since members are destroyed in reverse order.
+  std::unique_ptr<MPI_Comm, void (*)(MPI_Comm *)> mpi_comm_domain;
+
+  bool domain1_on_this_process;
+  bool domain2_on_this_process;
+
   // output to std::cout
   dealii::ConditionalOStream pcout;
 
@@ -101,6 +140,9 @@ private:
 
   // interface coupling
   std::shared_ptr<InterfaceCoupling<rank, dim, Number>> first_to_second, second_to_first;
+
+  // interface data of the domains set up on this process
+  std::vector<std::shared_ptr<ContainerInterfaceData<rank, dim, double>>> interface_data;
 };
 } // namespace OversetGrids
 } // namespace Poisson
@@ -107,6 +107,8 @@ main(int argc, char ** argv)
 
   ExaDG::GeneralParameters general(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   if(general.dim == 2 and general.precision == "float")
     ExaDG::run<2, 1, float>(input_file, mpi_comm);
   else if(general.dim == 2 and general.precision == "double")
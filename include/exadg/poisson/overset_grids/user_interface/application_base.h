@@ -26,6 +26,8 @@
 #include <deal.II/grid/grid_tools_cache.h>
 
 // ExaDG
+#include <exadg/functions_and_boundary_conditions/remote_point_evaluation_across_communicators.h>
+#include <exadg/poisson/overset_grids/user_interface/parameters.h>
 #include <exadg/poisson/user_interface/application_base.h>
 
 namespace ExaDG
@@ -34,43 +36,85 @@ namespace Poisson
 {
 namespace OversetGrids
 {
+namespace internal
+{
 /**
- * This function determines which faces of the dst triangulation are inside the src-triangulation.
- * A face is considered inside, if all vertices of the face are inside. Then, the boundary ID is
- * set to bid for all the faces of the dst-triangulation in the overlap region.
+ * Collects the vertices of all boundary faces of @param tria. For every face, the index of its
+ * first vertex in @param points is stored in @param face_to_first_point.
  */
 template<int dim>
 void
-set_boundary_ids_overlap_region(dealii::Triangulation<dim> const & tria_dst,
-                                dealii::types::boundary_id const & bid,
-                                dealii::Mapping<dim> const &       mapping_src,
-                                dealii::Triangulation<dim> const & tria_src)
+collect_boundary_face_vertices(
+  dealii::Triangulation<dim> const &                            tria,
+  std::vector<dealii::Point<dim>> &                             points,
+  std::vector<std::pair<typename dealii::Triangulation<dim>::cell_iterator,
+                        std::pair<unsigned int /* face */, unsigned int /* first_point */>>> &
+    face_to_first_point)
 {
-  std::vector<dealii::Point<dim>> points;
-  using CellIteratorType = typename dealii::Triangulation<dim>::cell_iterator;
-  using Id               = std::tuple<CellIteratorType /* cell */, unsigned int /*face*/>;
-  std::vector<std::pair<Id, unsigned int /* first_point_in_vector */>> id_to_vector_index;
-
-  // fill vector of points for all boundary faces
-  for(auto cell : tria_dst.cell_iterators())
+  for(auto cell : tria.cell_iterators())
   {
     for(auto const & f : cell->face_indices())
     {
       if(cell->face(f)->at_boundary())
       {
-        for(auto const & v : cell->face(f)->vertex_indices())
-        {
-          if(v == 0)
-          {
-            Id const id = std::make_tuple(cell, f);
-            id_to_vector_index.push_back({id, points.size()});
-          }
+        face_to_first_point.push_back({cell, {f, points.size()}});
 
+        for(auto const & v : cell->face(f)->vertex_indices())
           points.push_back(cell->face(f)->vertex(v));
-        }
       }
     }
   }
+}
+
+/**
+ * Sets the boundary ID to @param bid for all faces whose vertices have all been found, where
+ * @param point_found has one entry per point collected by collect_boundary_face_vertices().
+ */
+template<int dim>
+void
+set_boundary_ids_of_faces_found(
+  std::vector<std::pair<typename dealii::Triangulation<dim>::cell_iterator,
+                        std::pair<unsigned int /* face */, unsigned int /* first_point */>>> const &
+                                     face_to_first_point,
+  std::vector<bool> const &          point_found,
+  dealii::types::boundary_id const & bid)
+{
+  for(auto iter = face_to_first_point.begin(); iter != face_to_first_point.end(); ++iter)
+  {
+    unsigned int const begin = iter->second.second;
+    unsigned int const end =
+      (iter + 1 != face_to_first_point.end()) ? (iter + 1)->second.second : point_found.size();
+
+    bool inside = true;
+    for(unsigned int i = begin; i < end; ++i)
+    {
+      inside = (inside and point_found[i]);
+    }
+
+    if(inside)
+      iter->first->face(iter->second.first)->set_boundary_id(bid);
+  }
+}
+} // namespace internal
+
+/**
+ * This function determines which faces of the dst triangulation are inside the src-triangulation.
+ * A face is considered inside, if all vertices of the face are inside. Then, the boundary ID is
+ * set to bid for all the faces of the dst-triangulation in the overlap region.
+ */
+template<int dim>
+void
+set_boundary_ids_overlap_region(dealii::Triangulation<dim> const & tria_dst,
+                                dealii::types::boundary_id const & bid,
+                                dealii::Mapping<dim> const &       mapping_src,
+                                dealii::Triangulation<dim> const & tria_src)
+{
+  // fill vector of points for all boundary faces
+  std::vector<dealii::Point<dim>> points;
+  std::vector<std::pair<typename dealii::Triangulation<dim>::cell_iterator,
+                        std::pair<unsigned int, unsigned int>>>
+    face_to_first_point;
+  internal::collect_boundary_face_vertices(tria_dst, points, face_to_first_point);
 
   // create and reinit RemotePointEvaluation: find points on src-side
   std::vector<bool> marked_vertices = {};
@@ -92,23 +136,58 @@ set_boundary_ids_overlap_region(dealii::Triangulation<dim> const & tria_dst,
 
   // check which points have been found and whether a face on dst-side is located inside the src
   // triangulation
-  for(auto iter = id_to_vector_index.begin(); iter != id_to_vector_index.end(); ++iter)
+  std::vector<bool> point_found(points.size());
+  for(unsigned int i = 0; i < points.size(); ++i)
+    point_found[i] = rpe.point_found(i);
+
+  internal::set_boundary_ids_of_faces_found<dim>(face_to_first_point, point_found, bid);
+}
+
+/**
+ * Same as above, but for the case that the dst triangulation and the src triangulation live on
+ * disjoint sets of processes of @param comm. Processes owning the dst triangulation pass nullptr
+ * for @param mapping_src and @param tria_src, processes owning the src triangulation pass nullptr
+ * for @param tria_dst.
+ */
+template<int dim>
+void
+set_boundary_ids_overlap_region_across_communicators(MPI_Comm const &                   comm,
+                                                     dealii::Triangulation<dim> const * tria_dst,
+                                                     dealii::types::boundary_id const & bid,
+                                                     dealii::Mapping<dim> const *       mapping_src,
+                                                     dealii::Triangulation<dim> const * tria_src)
+{
+  bool const is_dst = (tria_dst != nullptr);
+
+  std::vector<dealii::Point<dim>> points;
+  std::vector<std::pair<typename dealii::Triangulation<dim>::cell_iterator,
+                        std::pair<unsigned int, unsigned int>>>
+    face_to_first_point;
+  if(is_dst)
+    internal::collect_boundary_face_vertices(*tria_dst, points, face_to_first_point);
+
+  RemotePointEvaluationAcrossCommunicators<dim> rpe;
+  rpe.reinit(comm, is_dst, points, tria_src, mapping_src, 1.e-10 /* tolerance */);
+
+  if(is_dst)
   {
-    unsigned int const begin = iter->second;
-    unsigned int const end =
-      (iter + 1 != id_to_vector_index.end()) ? (iter + 1)->second : points.size();
+    std::vector<int> found;
+    rpe.receive(found);
 
-    bool inside = true;
-    for(unsigned int i = begin; i < end; ++i)
-    {
-      inside = (inside and rpe.point_found(i));
-    }
+    std::vector<bool> point_found(found.begin(), found.end());
+    internal::set_boundary_ids_of_faces_found<dim>(face_to_first_point, point_found, bid);
+  }
+  else
+  {
+    dealii::Utilities::MPI::RemotePointEvaluation<dim> const & evaluator =
+      rpe.get_remote_point_evaluation();
 
-    if(inside)
-    {
-      auto const & [cell, f] = iter->first;
-      cell->face(f)->set_boundary_id(bid);
-    }
+    std::vector<int> found(evaluator.get_point_ptrs().size() - 1);
+    for(unsigned int i = 0; i < found.size(); ++i)
+      found[i] = evaluator.point_found(i);
+
+    rpe.start_send(found);
+    rpe.finish_send();
   }
 }
 
@@ -152,6 +231,17 @@ public:
   {
   }
 
+  /**
+   * Replaces the MPI communicator passed to the constructor. This is needed if the subdomains are
+   * solved concurrently on disjoint sub-communicators. Has to be called before setup_pre().
+   */
+  void
+  set_mpi_comm(MPI_Comm const & comm)
+  {
+    mpi_comm = comm;
+    pcout.set_condition(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  }
+
   void
   setup_pre(std::shared_ptr<Grid<dim>> &                      grid,
             std::shared_ptr<dealii::Mapping<dim>> &           mapping,
@@ -218,7 +308,7 @@ protected:
     prm.parse_input(parameter_file, "", true, true);
   }
 
-  MPI_Comm const mpi_comm;
+  MPI_Comm mpi_comm;
 
   dealii::ConditionalOStream pcout;
 
@@ -266,12 +356,26 @@ public:
 
     domain1->add_parameters(prm, {"Domain1"});
     domain2->add_parameters(prm, {"Domain2"});
+
+    schwarz_parameters.add_parameters(prm, "Schwarz");
   }
 
   virtual ~ApplicationBase()
   {
   }
 
+  void
+  setup_parameters()
+  {
+    dealii::ParameterHandler prm;
+    schwarz_parameters.add_parameters(prm, "Schwarz");
+    prm.parse_input(parameter_file, "", true, true);
+
+    schwarz_parameters.check();
+  }
+
+  SchwarzParameters schwarz_parameters;
+
   std::shared_ptr<Domain<dim, n_components, Number>> domain1, domain2;
 
   // use "-1" since max() is defined invalid by deal.II
@@ -0,0 +1,180 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#ifndef INCLUDE_EXADG_POISSON_OVERSET_GRIDS_USER_INTERFACE_PARAMETERS_H_
+#define INCLUDE_EXADG_POISSON_OVERSET_GRIDS_USER_INTERFACE_PARAMETERS_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/parameter_handler.h>
+
+// ExaDG
+#include <exadg/utilities/enum_patterns.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace Poisson
+{
+namespace OversetGrids
+{
+enum class SchwarzType
+{
+  // solve on domain 1, transfer to domain 2, solve on domain 2, transfer to domain 1
+  Multiplicative,
+  // solve on both domains with the interface data of the previous iteration, then transfer in
+  // both directions. The subdomain solves are independent and can run concurrently.
+  Additive
+};
+
+enum class InterfaceAcceleration
+{
+  None,
+  Anderson
+};
+
+class SchwarzParameters
+{
+public:
+  SchwarzParameters()
+    : type(SchwarzType::Multiplicative),
+      acceleration(InterfaceAcceleration::None),
+      anderson_depth(5),
+      abs_tol(0.0),
+      rel_tol(0.0),
+      max_iter(11),
+      solve_subdomains_concurrently(false),
+      fraction_of_processes_domain1(0.5)
+  {
+  }
+
+  void
+  check() const
+  {
+    AssertThrow(acceleration == InterfaceAcceleration::None or anderson_depth > 0,
+                dealii::ExcMessage("Anderson acceleration needs a depth larger than 0."));
+
+    if(solve_subdomains_concurrently)
+    {
+      AssertThrow(type == SchwarzType::Additive,
+                  dealii::ExcMessage(
+                    "Solving the subdomains concurrently requires additive Schwarz."));
+
+      AssertThrow(fraction_of_processes_domain1 > 0.0 and fraction_of_processes_domain1 < 1.0,
+                  dealii::ExcMessage("Fraction of processes for domain 1 has to be in (0,1)."));
+    }
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout, std::string const & name) const
+  {
+    pcout << std::endl << name << std::endl << std::endl;
+    print_parameter(pcout, "Schwarz type", type);
+    print_parameter(pcout, "Interface acceleration", acceleration);
+    if(acceleration == InterfaceAcceleration::Anderson)
+      print_parameter(pcout, "Anderson depth", anderson_depth);
+    print_parameter(pcout, "Absolute tolerance", abs_tol);
+    print_parameter(pcout, "Relative tolerance", rel_tol);
+    print_parameter(pcout, "Maximum number of iterations", max_iter);
+    print_parameter(pcout, "Solve subdomains concurrently", solve_subdomains_concurrently);
+    if(solve_subdomains_concurrently)
+      print_parameter(pcout, "Fraction of processes domain 1", fraction_of_processes_domain1);
+  }
+
+  void
+  add_parameters(dealii::ParameterHandler & prm, std::string const & subsection_name)
+  {
+    prm.enter_subsection(subsection_name);
+    {
+      prm.add_parameter("Type",
+                        type,
+                        "Multiplicative or additive Schwarz iteration.",
+                        Patterns::Enum<SchwarzType>());
+
+      prm.add_parameter("Acceleration",
+                        acceleration,
+                        "Acceleration of the fixed-point iteration for the interface data.",
+                        Patterns::Enum<InterfaceAcceleration>());
+
+      prm.add_parameter("AndersonDepth",
+                        anderson_depth,
+                        "Number of previous iterations used by Anderson acceleration.",
+                        dealii::Patterns::Integer(1));
+
+      prm.add_parameter("AbsTol",
+                        abs_tol,
+                        "Absolute tolerance for the interface residual.",
+                        dealii::Patterns::Double(0.0));
+
+      prm.add_parameter("RelTol",
+                        rel_tol,
+                        "Relative tolerance for the interface residual.",
+                        dealii::Patterns::Double(0.0));
+
+      prm.add_parameter("MaxIter",
+                        max_iter,
+                        "Maximum number of Schwarz iterations.",
+                        dealii::Patterns::Integer(1));
+
+      prm.add_parameter("SolveSubdomainsConcurrently",
+                        solve_subdomains_concurrently,
+                        "Solve both subdomains on disjoint sets of processes.",
+                        dealii::Patterns::Bool());
+
+      prm.add_parameter("FractionOfProcessesDomain1",
+                        fraction_of_processes_domain1,
+                        "Fraction of processes used by domain 1 if solved concurrently.",
+                        dealii::Patterns::Double(0.0, 1.0));
+    }
+    prm.leave_subsection();
+  }
+
+  SchwarzType type;
+
+  // The Schwarz iteration is a fixed-point iteration for the data at the quadrature points of the
+  // overlap boundaries. Anderson acceleration combines the last iterates such that the interface
+  // residual is minimized, which reduces the number of subdomain solves.
+  InterfaceAcceleration acceleration;
+  unsigned int          anderson_depth;
+
+  // The iteration stops once the l2-norm of the interface residual is below abs_tol or below
+  // rel_tol times the norm of the initial interface residual. A tolerance of zero disables the
+  // respective criterion. By default, both tolerances are zero and exactly max_iter = 11
+  // multiplicative sweeps without acceleration are performed, as in previous versions.
+  double       abs_tol;
+  double       rel_tol;
+  unsigned int max_iter;
+
+  // Solve the subdomains on disjoint sets of processes at the same time. Only possible for
+  // additive Schwarz, where both subdomain solves use the interface data of the previous iteration.
+  bool solve_subdomains_concurrently;
+
+  // Fraction of processes assigned to domain 1 if the subdomains are solved concurrently. This
+  // value should balance the wall times of both subdomain solves.
+  double fraction_of_processes_domain1;
+};
+
+} // namespace OversetGrids
+} // namespace Poisson
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POISSON_OVERSET_GRIDS_USER_INTERFACE_PARAMETERS_H_ */
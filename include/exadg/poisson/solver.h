@@ -123,6 +123,8 @@ main(int argc, char ** argv)
   ExaDG::GeneralParameters                 general(input_file);
   ExaDG::SpatialResolutionParametersMinMax spatial(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   std::vector<ExaDG::SolverResult> results;
 
   // k-refinement
@@ -54,7 +54,7 @@ private:
   typedef FaceIntegrator<dim, n_components, Number> IntegratorFace;
 
 public:
-  LaplaceKernel() : degree(1), tau(dealii::make_vectorized_array<Number>(0.0))
+  LaplaceKernel() : degree(1)
   {
   }
 
@@ -202,9 +202,14 @@ private:
 
   dealii::AlignedVector<scalar> array_penalty_parameter;
 
-  mutable scalar tau;
+  // penalty parameter of the current face, one per thread for task-parallel matrix-free loops
+  static thread_local scalar tau;
 };
 
+template<int dim, typename Number, int n_components>
+thread_local typename LaplaceKernel<dim, Number, n_components>::scalar
+  LaplaceKernel<dim, Number, n_components>::tau;
+
 } // namespace Operators
 
 template<int rank, int dim>
@@ -146,6 +146,8 @@ main(int argc, char ** argv)
   ExaDG::HypercubeResolutionParameters                      resolution(input_file, general.dim);
   ExaDG::ThroughputParameters<ExaDG::Poisson::OperatorType> throughput(input_file);
 
+  ExaDG::set_number_of_threads(general);
+
   // get additional parameters
   ExaDG::Poisson::SpatialDiscretization spatial_discretization =
     ExaDG::Poisson::SpatialDiscretization::Undefined;
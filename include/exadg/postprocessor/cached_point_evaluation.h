@@ -0,0 +1,315 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_CACHED_POINT_EVALUATION_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_CACHED_POINT_EVALUATION_H_
+
+// C/C++
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
+namespace ExaDG
+{
+/**
+ * Evaluates finite element functions at a fixed set of points. The points are located in the mesh
+ * once by a dealii::Utilities::MPI::RemotePointEvaluation, which also sets up the communication
+ * pattern. During an evaluation, all points inside a cell are evaluated at once with
+ * dealii::FEPointEvaluation, and only the values at the points are communicated. Points that lie
+ * on the boundary between cells get the average of the values of these cells.
+ *
+ * Only the processes that pass points to reinit() receive values. If the mesh moves (ALE),
+ * update_after_grid_motion() recomputes the reference coordinates of the points in the cells found
+ * previously, and the points are searched again only if one of them has left its cell. If the
+ * triangulation changes, e.g. due to adaptive mesh refinement, the points are searched again
+ * before the next evaluation.
+ */
+template<int dim>
+class CachedPointEvaluation
+{
+public:
+  template<typename Number>
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+  typedef dealii::Utilities::MPI::RemotePointEvaluation<dim> RemotePointEvaluation;
+
+  CachedPointEvaluation(double const tolerance = 1.e-6)
+    : triangulation(nullptr), mapping(nullptr), tolerance(tolerance), needs_reinit(false)
+  {
+  }
+
+  ~CachedPointEvaluation()
+  {
+    triangulation_changed.disconnect();
+  }
+
+  /**
+   * Locates @param points_in in the mesh. This function has to be called by all processes of the
+   * triangulation, also by those that do not evaluate any points.
+   */
+  void
+  reinit(std::vector<dealii::Point<dim>> const & points_in,
+         dealii::Triangulation<dim> const &      triangulation_in,
+         dealii::Mapping<dim> const &            mapping_in)
+  {
+    points        = points_in;
+    triangulation = &triangulation_in;
+    mapping       = &mapping_in;
+
+    triangulation_changed.disconnect();
+    triangulation_changed =
+      triangulation_in.signals.any_change.connect([this]() { needs_reinit = true; });
+
+    locate_points();
+  }
+
+  /**
+   * Updates the point location data after the mapping has changed. This function has to be called
+   * by all processes of the triangulation.
+   */
+  void
+  update_after_grid_motion()
+  {
+    if(needs_reinit)
+      return;
+
+    auto const & cell_data = rpe->get_cell_data();
+
+    bool         point_has_left_cell = false;
+    unsigned int offset              = 0;
+    for(unsigned int const i : cell_data.cell_indices())
+    {
+      auto const         cell          = cell_data.get_active_cell_iterator(i);
+      unsigned int const n_points_cell = cell_data.get_unit_points(i).size();
+
+      dealii::ArrayView<dealii::Point<dim>> unit_points_cell(unit_points.data() + offset,
+                                                             n_points_cell);
+      mapping->transform_points_real_to_unit_cell(
+        cell,
+        dealii::ArrayView<dealii::Point<dim> const>(real_points.data() + offset, n_points_cell),
+        unit_points_cell);
+
+      for(dealii::Point<dim> const & p : unit_points_cell)
+        if(p[0] == std::numeric_limits<double>::infinity() or
+           not cell->reference_cell().contains_point(p, tolerance))
+          point_has_left_cell = true;
+
+      offset += n_points_cell;
+    }
+
+    if(dealii::Utilities::MPI::max(static_cast<int>(point_has_left_cell),
+                                   triangulation->get_communicator()) > 0)
+      locate_points();
+  }
+
+  unsigned int
+  n_points() const
+  {
+    return points.size();
+  }
+
+  /**
+   * Returns the values of the finite element function at the points passed to reinit() by this
+   * process. This function has to be called by all processes of the triangulation.
+   */
+  template<int n_components, typename Number>
+  std::vector<typename dealii::FEPointEvaluation<n_components, dim, dim, Number>::value_type>
+  evaluate_values(dealii::DoFHandler<dim> const & dof_handler, VectorType<Number> const & vector)
+  {
+    typedef dealii::FEPointEvaluation<n_components, dim, dim, Number> Evaluator;
+
+    return evaluate<n_components, Number, typename Evaluator::value_type>(
+      dof_handler,
+      vector,
+      dealii::EvaluationFlags::values,
+      [](Evaluator const & evaluator, unsigned int const q) { return evaluator.get_value(q); });
+  }
+
+  /**
+   * Same as evaluate_values() for the gradients of the finite element function.
+   */
+  template<int n_components, typename Number>
+  std::vector<typename dealii::FEPointEvaluation<n_components, dim, dim, Number>::gradient_type>
+  evaluate_gradients(dealii::DoFHandler<dim> const & dof_handler, VectorType<Number> const & vector)
+  {
+    typedef dealii::FEPointEvaluation<n_components, dim, dim, Number> Evaluator;
+
+    return evaluate<n_components, Number, typename Evaluator::gradient_type>(
+      dof_handler,
+      vector,
+      dealii::EvaluationFlags::gradients,
+      [](Evaluator const & evaluator, unsigned int const q) { return evaluator.get_gradient(q); });
+  }
+
+  /**
+   * Splits @param n_points_total points into contiguous ranges of similar size for all processes
+   * of @param comm and returns the range of this process. This can be used to distribute the
+   * evaluation of quantities that are reduced over all points afterwards, e.g. sums or integrals
+   * along lines.
+   */
+  static std::pair<unsigned int, unsigned int>
+  get_local_range(unsigned int const n_points_total, MPI_Comm const & comm)
+  {
+    unsigned long long const n_procs = dealii::Utilities::MPI::n_mpi_processes(comm);
+    unsigned long long const rank    = dealii::Utilities::MPI::this_mpi_process(comm);
+
+    return {static_cast<unsigned int>(n_points_total * rank / n_procs),
+            static_cast<unsigned int>(n_points_total * (rank + 1) / n_procs)};
+  }
+
+private:
+  void
+  locate_points()
+  {
+    rpe = std::make_shared<RemotePointEvaluation>(tolerance, false, 0);
+    rpe->reinit(points, *triangulation, *mapping);
+
+    AssertThrow(rpe->all_points_found(),
+                dealii::ExcMessage("Not all evaluation points have been found in the mesh."));
+
+    // store reference coordinates and real coordinates of the points in the cells found
+    auto const & cell_data = rpe->get_cell_data();
+
+    unit_points.clear();
+    real_points.clear();
+    for(unsigned int const i : cell_data.cell_indices())
+    {
+      auto const cell = cell_data.get_active_cell_iterator(i);
+      for(dealii::Point<dim> const & p : cell_data.get_unit_points(i))
+      {
+        unit_points.push_back(p);
+        real_points.push_back(mapping->transform_unit_to_real_cell(cell, p));
+      }
+    }
+
+    needs_reinit = false;
+  }
+
+  template<int n_components, typename Number, typename T, typename Kernel>
+  std::vector<T>
+  evaluate(dealii::DoFHandler<dim> const &                dof_handler,
+           VectorType<Number> const &                     vector,
+           dealii::EvaluationFlags::EvaluationFlags const flags,
+           Kernel const &                                 kernel)
+  {
+    if(needs_reinit)
+      locate_points();
+
+    bool const has_ghost_elements = vector.has_ghost_elements();
+    if(not has_ghost_elements)
+      vector.update_ghost_values();
+
+    dealii::UpdateFlags const update_flags =
+      (flags & dealii::EvaluationFlags::gradients) ? dealii::update_gradients :
+                                                     dealii::update_values;
+
+    dealii::FEPointEvaluation<n_components, dim, dim, Number> evaluator(*mapping,
+                                                                        dof_handler.get_fe(),
+                                                                        update_flags);
+
+    std::vector<Number> dof_values(dof_handler.get_fe().n_dofs_per_cell());
+
+    auto const evaluate_cells = [&](dealii::ArrayView<T> const &                     values,
+                                    typename RemotePointEvaluation::CellData const & cell_data) {
+      unsigned int offset = 0;
+      for(unsigned int const i : cell_data.cell_indices())
+      {
+        auto const         cell_tria     = cell_data.get_active_cell_iterator(i);
+        unsigned int const n_points_cell = cell_data.get_unit_points(i).size();
+
+        typename dealii::DoFHandler<dim>::active_cell_iterator const cell(
+          &cell_tria->get_triangulation(), cell_tria->level(), cell_tria->index(), &dof_handler);
+
+        evaluator.reinit(cell,
+                         dealii::ArrayView<dealii::Point<dim> const>(unit_points.data() + offset,
+                                                                     n_points_cell));
+
+        cell->get_dof_values(vector, dof_values.begin(), dof_values.end());
+        evaluator.evaluate(dof_values, flags);
+
+        dealii::ArrayView<T> const cell_values = cell_data.get_data_view(i, values);
+        for(unsigned int q = 0; q < n_points_cell; ++q)
+          cell_values[q] = kernel(evaluator, q);
+
+        offset += n_points_cell;
+      }
+    };
+
+    std::vector<T> evaluated_values, buffer;
+    rpe->template evaluate_and_process<T>(evaluated_values, buffer, evaluate_cells);
+
+    if(not has_ghost_elements)
+      vector.zero_out_ghost_values();
+
+    if(rpe->is_map_unique())
+      return evaluated_values;
+
+    // average over all cells a point has been found in
+    std::vector<unsigned int> const & point_ptrs = rpe->get_point_ptrs();
+
+    std::vector<T> result(point_ptrs.size() - 1);
+    for(unsigned int p = 0; p + 1 < point_ptrs.size(); ++p)
+    {
+      unsigned int const n_entries = point_ptrs[p + 1] - point_ptrs[p];
+      if(n_entries == 0)
+        continue;
+
+      for(unsigned int j = point_ptrs[p]; j < point_ptrs[p + 1]; ++j)
+        result[p] += evaluated_values[j];
+      result[p] /= Number(n_entries);
+    }
+
+    return result;
+  }
+
+  std::vector<dealii::Point<dim>> points;
+
+  dealii::Triangulation<dim> const * triangulation;
+  dealii::Mapping<dim> const *       mapping;
+
+  double const tolerance;
+
+  std::shared_ptr<RemotePointEvaluation> rpe;
+
+  // reference coordinates and real coordinates of the points in the order of the cell data of rpe
+  std::vector<dealii::Point<dim>> unit_points;
+  std::vector<dealii::Point<dim>> real_points;
+
+  // set if the triangulation has changed since the points have been located
+  bool                        needs_reinit;
+  boost::signals2::connection triangulation_changed;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_CACHED_POINT_EVALUATION_H_ */
@@ -23,10 +23,14 @@
 #include <fstream>
 
 // deal.II
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/mapping_q_cache.h>
+#include <deal.II/lac/affine_constraints.h>
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
 #include <exadg/grid/grid_data.h>
+#include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/quadrature.h>
 #include <exadg/postprocessor/error_calculation.h>
 #include <exadg/utilities/create_directories.h>
@@ -114,10 +118,19 @@ calculate_error(MPI_Comm const &                               mpi_comm,
 
 template<int dim, typename Number>
 ErrorCalculator<dim, Number>::ErrorCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files_L2(true), clear_files_H1_seminorm(true)
+  : mpi_comm(comm),
+    clear_files_L2(true),
+    clear_files_H1_seminorm(true),
+    matrix_free_needs_setup(true)
 {
 }
 
+template<int dim, typename Number>
+ErrorCalculator<dim, Number>::~ErrorCalculator()
+{
+  triangulation_changed.disconnect();
+}
+
 template<int dim, typename Number>
 void
 ErrorCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const &   dof_handler_in,
@@ -132,6 +145,213 @@ ErrorCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const &   dof_handle
 
   if(error_data.analytical_solution and error_data.write_errors_to_file)
     create_directories(error_data.directory, mpi_comm);
+
+  // the matrix-free data structures are set up at the first evaluation and have to be rebuilt
+  // after adaptive mesh refinement
+  matrix_free_needs_setup = true;
+  triangulation_changed.disconnect();
+  triangulation_changed = dof_handler->get_triangulation().signals.any_change.connect(
+    [&]() { matrix_free_needs_setup = true; });
+}
+
+template<int dim, typename Number>
+bool
+ErrorCalculator<dim, Number>::use_matrix_free() const
+{
+  unsigned int const n_components = dof_handler->get_fe().n_components();
+
+  return get_element_type(dof_handler->get_triangulation()) == ElementType::Hypercube and
+         (n_components == 1 or n_components == dim);
+}
+
+template<int dim, typename Number>
+void
+ErrorCalculator<dim, Number>::setup_matrix_free()
+{
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme =
+    dealii::MatrixFree<dim, double>::AdditionalData::TasksParallelScheme::none;
+  additional_data.mapping_update_flags = dealii::update_values | dealii::update_gradients |
+                                         dealii::update_JxW_values |
+                                         dealii::update_quadrature_points;
+
+  // same quadrature rule as for the evaluation with dealii::VectorTools::integrate_difference()
+  unsigned int const additional_quadrature_points = 3;
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  matrix_free = std::make_shared<dealii::MatrixFree<dim, double>>();
+  matrix_free->reinit(*mapping,
+                      *dof_handler,
+                      constraints,
+                      dealii::QGauss<1>(dof_handler->get_fe().degree +
+                                        additional_quadrature_points),
+                      additional_data);
+
+  matrix_free->initialize_dof_vector(solution_double);
+
+  matrix_free_needs_setup = false;
+}
+
+template<int dim, typename Number>
+std::array<double, 4>
+ErrorCalculator<dim, Number>::calculate_errors_matrix_free(VectorType const & solution_vector,
+                                                           double const       time)
+{
+  if(error_data.spatially_weight_error == true)
+    AssertThrow(error_data.weight != nullptr,
+                dealii::ExcMessage("No spatial weight provided for error computation."));
+
+  if(matrix_free_needs_setup)
+  {
+    setup_matrix_free();
+  }
+  else if(dynamic_cast<dealii::MappingQCache<dim> const *>(&(*mapping)) != nullptr)
+  {
+    // the mapping might describe a deforming mesh
+    matrix_free->update_mapping(*mapping);
+  }
+
+  error_data.analytical_solution->set_time(time);
+
+  // The vector layout of the matrix-free object created here might differ from the layout of
+  // the solution vector in terms of ghost entries, but both use the same locally owned indices.
+  AssertThrow(solution_double.locally_owned_size() == solution_vector.locally_owned_size(),
+              dealii::ExcMessage("Vector layout does not match DoFHandler."));
+  for(unsigned int i = 0; i < solution_vector.locally_owned_size(); ++i)
+    solution_double.local_element(i) = solution_vector.local_element(i);
+  solution_double.update_ghost_values();
+
+  std::array<double, 4> result = {{0.0, 0.0, 0.0, 0.0}};
+  if(dof_handler->get_fe().n_components() == 1)
+    integrate_errors<1>(result);
+  else
+    integrate_errors<dim>(result);
+
+  solution_double.zero_out_ghost_values();
+
+  dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(result.data(), result.size()),
+                              mpi_comm,
+                              dealii::ArrayView<double>(result.data(), result.size()));
+
+  return result;
+}
+
+template<int dim, typename Number>
+template<int n_components>
+void
+ErrorCalculator<dim, Number>::integrate_errors(std::array<double, 4> & result) const
+{
+  bool const calculate_H1 = error_data.calculate_H1_seminorm_error;
+
+  dealii::Function<dim> const & analytical_solution = *error_data.analytical_solution;
+  dealii::Function<dim> const * weight =
+    error_data.spatially_weight_error ? error_data.weight.get() : nullptr;
+
+  CellIntegrator<dim, n_components, double> integrator(*matrix_free);
+
+  dealii::EvaluationFlags::EvaluationFlags const flags =
+    calculate_H1 ? dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients :
+                   dealii::EvaluationFlags::values;
+
+  // values of functions at all quadrature points of all active cells of a cell batch, which are
+  // evaluated with one call of the *_list() functions per component
+  std::vector<dealii::Point<dim>>                  points;
+  std::vector<std::vector<double>>                 exact_values(n_components);
+  std::vector<std::vector<dealii::Tensor<1, dim>>> exact_gradients(n_components);
+  std::vector<std::vector<double>>                 weight_values(n_components);
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(solution_double);
+    integrator.evaluate(flags);
+
+    unsigned int const n_lanes = matrix_free->n_active_entries_per_cell_batch(cell);
+
+    points.resize(integrator.n_q_points * n_lanes);
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      dealii::Point<dim, dealii::VectorizedArray<double>> const q_points =
+        integrator.quadrature_point(q);
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        for(unsigned int d = 0; d < dim; ++d)
+          points[q * n_lanes + v][d] = q_points[d][v];
+    }
+
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      exact_values[c].resize(points.size());
+      analytical_solution.value_list(points, exact_values[c], c);
+
+      if(calculate_H1)
+      {
+        exact_gradients[c].resize(points.size());
+        analytical_solution.gradient_list(points, exact_gradients[c], c);
+      }
+
+      weight_values[c].assign(points.size(), 1.0);
+      if(weight != nullptr)
+        weight->value_list(points, weight_values[c], weight->n_components == 1 ? 0 : c);
+    }
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      auto const                            value = integrator.get_value(q);
+      dealii::VectorizedArray<double> const JxW   = integrator.JxW(q);
+
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        unsigned int const index = q * n_lanes + v;
+
+        for(unsigned int c = 0; c < n_components; ++c)
+        {
+          double numerical_value;
+          if constexpr(n_components == 1)
+            numerical_value = value[v];
+          else
+            numerical_value = value[c][v];
+
+          double const exact_value = exact_values[c][index];
+          double const factor      = JxW[v] * weight_values[c][index];
+
+          result[0] += factor * (numerical_value - exact_value) * (numerical_value - exact_value);
+          result[1] += factor * exact_value * exact_value;
+        }
+      }
+
+      if(calculate_H1)
+      {
+        auto const gradient = integrator.get_gradient(q);
+
+        for(unsigned int v = 0; v < n_lanes; ++v)
+        {
+          unsigned int const index = q * n_lanes + v;
+
+          for(unsigned int c = 0; c < n_components; ++c)
+          {
+            double const factor = JxW[v] * weight_values[c][index];
+
+            for(unsigned int d = 0; d < dim; ++d)
+            {
+              double numerical_gradient;
+              if constexpr(n_components == 1)
+                numerical_gradient = gradient[d][v];
+              else
+                numerical_gradient = gradient[c][d][v];
+
+              double const exact_gradient = exact_gradients[c][index][d];
+
+              result[2] += factor * (numerical_gradient - exact_gradient) *
+                           (numerical_gradient - exact_gradient);
+              result[3] += factor * exact_gradient * exact_gradient;
+            }
+          }
+        }
+      }
+    }
+  }
 }
 
 template<int dim, typename Number>
@@ -168,16 +388,58 @@ ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, do
 {
   bool relative = error_data.calculate_relative_errors;
 
-  double const error = calculate_error<dim>(mpi_comm,
-                                            relative,
-                                            *dof_handler,
-                                            *mapping,
-                                            solution_vector,
-                                            error_data.analytical_solution,
-                                            time,
-                                            dealii::VectorTools::L2_norm,
-                                            error_data.spatially_weight_error,
-                                            error_data.weight);
+  double error_L2 = 0.0, error_H1_seminorm = 0.0;
+  if(use_matrix_free())
+  {
+    // L2 and H1 errors as well as the norms of the solution are computed at once
+    std::array<double, 4> const result = calculate_errors_matrix_free(solution_vector, time);
+
+    auto const compute_error = [&](double const error_squared, double const norm_squared) {
+      if(relative == true)
+      {
+        AssertThrow(std::sqrt(norm_squared) > 1.e-15,
+                    dealii::ExcMessage(
+                      "Cannot compute relative error since norm of solution tends to zero."));
+
+        return std::sqrt(error_squared) / std::sqrt(norm_squared);
+      }
+      else // absolute error
+      {
+        return std::sqrt(error_squared);
+      }
+    };
+
+    error_L2 = compute_error(result[0], result[1]);
+    if(error_data.calculate_H1_seminorm_error)
+      error_H1_seminorm = compute_error(result[2], result[3]);
+  }
+  else
+  {
+    error_L2 = calculate_error<dim>(mpi_comm,
+                                    relative,
+                                    *dof_handler,
+                                    *mapping,
+                                    solution_vector,
+                                    error_data.analytical_solution,
+                                    time,
+                                    dealii::VectorTools::L2_norm,
+                                    error_data.spatially_weight_error,
+                                    error_data.weight);
+
+    if(error_data.calculate_H1_seminorm_error)
+      error_H1_seminorm = calculate_error<dim>(mpi_comm,
+                                               relative,
+                                               *dof_handler,
+                                               *mapping,
+                                               solution_vector,
+                                               error_data.analytical_solution,
+                                               time,
+                                               dealii::VectorTools::H1_seminorm,
+                                               error_data.spatially_weight_error,
+                                               error_data.weight);
+  }
+
+  double const error = error_L2;
 
   dealii::ConditionalOStream pcout(std::cout,
                                    dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
@@ -214,16 +476,7 @@ ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, do
   // H1-seminorm
   if(error_data.calculate_H1_seminorm_error)
   {
-    double const error = calculate_error<dim>(mpi_comm,
-                                              relative,
-                                              *dof_handler,
-                                              *mapping,
-                                              solution_vector,
-                                              error_data.analytical_solution,
-                                              time,
-                                              dealii::VectorTools::H1_seminorm,
-                                              error_data.spatially_weight_error,
-                                              error_data.weight);
+    double const error = error_H1_seminorm;
 
     dealii::ConditionalOStream pcout(std::cout,
                                      dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
@@ -22,11 +22,16 @@
 #ifndef INCLUDE_POSTPROCESSOR_ERROR_CALCULATION_H_
 #define INCLUDE_POSTPROCESSOR_ERROR_CALCULATION_H_
 
+// C/C++
+#include <array>
+
 // deal.II
 #include <deal.II/base/function.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/tria.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
 #include <exadg/postprocessor/time_control.h>
@@ -98,6 +103,8 @@ public:
 
   ErrorCalculator(MPI_Comm const & comm);
 
+  ~ErrorCalculator();
+
   void
   setup(dealii::DoFHandler<dim> const &   dof_handler,
         dealii::Mapping<dim> const &      mapping,
@@ -112,6 +119,28 @@ private:
   void
   do_evaluate(VectorType const & solution_vector, double const time);
 
+  /*
+   * Returns true if the errors can be computed with the matrix-free implementation, which
+   * requires a hypercube mesh and a finite element with 1 or dim components.
+   */
+  bool
+  use_matrix_free() const;
+
+  void
+  setup_matrix_free();
+
+  /*
+   * Computes the squared (weighted) L2 norms of the error and the analytical solution and, if
+   * requested, the squared H1 seminorms of the error and the analytical solution (in this order)
+   * with a single matrix-free loop and a single MPI reduction.
+   */
+  std::array<double, 4>
+  calculate_errors_matrix_free(VectorType const & solution_vector, double const time);
+
+  template<int n_components>
+  void
+  integrate_errors(std::array<double, 4> & result) const;
+
   MPI_Comm const mpi_comm;
 
   bool clear_files_L2, clear_files_H1_seminorm;
@@ -120,6 +149,13 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
   ErrorCalculationData<dim> error_data;
+
+  // matrix-free data structures with additional quadrature points, set up lazily and rebuilt
+  // after the triangulation has changed
+  std::shared_ptr<dealii::MatrixFree<dim, double>>   matrix_free;
+  bool                                               matrix_free_needs_setup;
+  boost::signals2::connection                        triangulation_changed;
+  dealii::LinearAlgebra::distributed::Vector<double> solution_double;
 };
 
 } // namespace ExaDG
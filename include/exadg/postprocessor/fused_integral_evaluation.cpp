@@ -0,0 +1,413 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+
+// ExaDG
+#include <exadg/postprocessor/fused_integral_evaluation.h>
+
+namespace ExaDG
+{
+template<int dim, typename Number>
+FusedIntegralEvaluator<dim, Number>::FusedIntegralEvaluator(MPI_Comm const & comm)
+  : mpi_comm(comm),
+    matrix_free(nullptr),
+    dof_index_velocity(0),
+    dof_index_pressure(0),
+    quad_index(0),
+    n_sums(0),
+    n_maxima(0),
+    cell_evaluation_flags(dealii::EvaluationFlags::nothing),
+    face_evaluation_flags(dealii::EvaluationFlags::nothing),
+    boundary_face_evaluation_flags(dealii::EvaluationFlags::nothing),
+    boundary_face_needs_pressure(false),
+    pressure(nullptr),
+    evaluated_velocity(nullptr)
+{
+}
+
+template<int dim, typename Number>
+void
+FusedIntegralEvaluator<dim, Number>::setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+                                           unsigned int const dof_index_velocity_in,
+                                           unsigned int const dof_index_pressure_in,
+                                           unsigned int const quad_index_in)
+{
+  matrix_free        = &matrix_free_in;
+  dof_index_velocity = dof_index_velocity_in;
+  dof_index_pressure = dof_index_pressure_in;
+  quad_index         = quad_index_in;
+}
+
+template<int dim, typename Number>
+unsigned int
+FusedIntegralEvaluator<dim, Number>::add_kernel(Kernel const & kernel)
+{
+  kernels.push_back(kernel);
+
+  offset_sums.push_back(n_sums);
+  offset_maxima.push_back(n_maxima);
+  n_sums += kernel.n_sums;
+  n_maxima += kernel.n_maxima;
+
+  active.push_back(false);
+  evaluated.push_back(false);
+
+  return kernels.size() - 1;
+}
+
+template<int dim, typename Number>
+void
+FusedIntegralEvaluator<dim, Number>::set_active(unsigned int const kernel_index,
+                                                bool const         active_in)
+{
+  AssertIndexRange(kernel_index, kernels.size());
+
+  active[kernel_index] = active_in;
+
+  std::fill(evaluated.begin(), evaluated.end(), false);
+  evaluated_velocity = nullptr;
+}
+
+template<int dim, typename Number>
+bool
+FusedIntegralEvaluator<dim, Number>::any_active() const
+{
+  return std::find(active.begin(), active.end(), true) != active.end();
+}
+
+template<int dim, typename Number>
+void
+FusedIntegralEvaluator<dim, Number>::evaluate(VectorType const & velocity,
+                                              VectorType const & pressure_in)
+{
+  AssertThrow(matrix_free != nullptr, dealii::ExcMessage("MatrixFree object is not set up."));
+
+  cell_evaluation_flags          = dealii::EvaluationFlags::nothing;
+  face_evaluation_flags          = dealii::EvaluationFlags::nothing;
+  boundary_face_evaluation_flags = dealii::EvaluationFlags::nothing;
+  boundary_face_needs_pressure   = false;
+
+  bool needs_faces = false;
+  for(unsigned int k = 0; k < kernels.size(); ++k)
+  {
+    if(not active[k])
+      continue;
+
+    if(kernels[k].cell)
+      cell_evaluation_flags = cell_evaluation_flags | kernels[k].cell_evaluation_flags;
+
+    if(kernels[k].face)
+    {
+      face_evaluation_flags = face_evaluation_flags | kernels[k].face_evaluation_flags;
+      needs_faces           = true;
+    }
+
+    if(kernels[k].boundary_face and not kernels[k].boundary_ids.empty())
+    {
+      boundary_face_evaluation_flags =
+        boundary_face_evaluation_flags | kernels[k].boundary_face_evaluation_flags;
+      boundary_face_needs_pressure =
+        boundary_face_needs_pressure or kernels[k].boundary_face_needs_pressure;
+      needs_faces = true;
+    }
+  }
+
+  pressure = &pressure_in;
+
+  std::vector<Number> dst(n_sums + n_maxima, 0.0);
+
+  // only exchange ghost values of the velocity if there are face integrals
+  if(needs_faces)
+  {
+    matrix_free->loop(
+      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, velocity);
+  }
+  else
+  {
+    matrix_free->cell_loop(&This::cell_loop, this, dst, velocity);
+  }
+
+  pressure = nullptr;
+
+  // one collective operation for all sums and one for all maxima
+  results.resize(n_sums + n_maxima);
+  if(n_sums > 0)
+  {
+    dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(dst.data(), n_sums),
+                                mpi_comm,
+                                dealii::ArrayView<Number>(results.data(), n_sums));
+  }
+  if(n_maxima > 0)
+  {
+    dealii::Utilities::MPI::max(dealii::ArrayView<Number const>(dst.data() + n_sums, n_maxima),
+                                mpi_comm,
+                                dealii::ArrayView<Number>(results.data() + n_sums, n_maxima));
+  }
+
+  evaluated          = active;
+  evaluated_velocity = &velocity;
+}
+
+template<int dim, typename Number>
+bool
+FusedIntegralEvaluator<dim, Number>::has_results(unsigned int const kernel_index,
+                                                 VectorType const & velocity) const
+{
+  AssertIndexRange(kernel_index, kernels.size());
+
+  return evaluated[kernel_index] and evaluated_velocity == &velocity;
+}
+
+template<int dim, typename Number>
+Number
+FusedIntegralEvaluator<dim, Number>::get_sum(unsigned int const kernel_index,
+                                             unsigned int const i) const
+{
+  AssertIndexRange(kernel_index, kernels.size());
+  AssertIndexRange(i, kernels[kernel_index].n_sums);
+  AssertThrow(evaluated[kernel_index], dealii::ExcMessage("Kernel has not been evaluated."));
+
+  return results[offset_sums[kernel_index] + i];
+}
+
+template<int dim, typename Number>
+Number
+FusedIntegralEvaluator<dim, Number>::get_maximum(unsigned int const kernel_index,
+                                                 unsigned int const i) const
+{
+  AssertIndexRange(kernel_index, kernels.size());
+  AssertIndexRange(i, kernels[kernel_index].n_maxima);
+  AssertThrow(evaluated[kernel_index], dealii::ExcMessage("Kernel has not been evaluated."));
+
+  return results[n_sums + offset_maxima[kernel_index] + i];
+}
+
+template<int dim, typename Number>
+dealii::MatrixFree<dim, Number> const &
+FusedIntegralEvaluator<dim, Number>::get_matrix_free() const
+{
+  AssertThrow(matrix_free != nullptr, dealii::ExcMessage("MatrixFree object is not set up."));
+
+  return *matrix_free;
+}
+
+template<int dim, typename Number>
+unsigned int
+FusedIntegralEvaluator<dim, Number>::get_dof_index_velocity() const
+{
+  return dof_index_velocity;
+}
+
+template<int dim, typename Number>
+unsigned int
+FusedIntegralEvaluator<dim, Number>::get_dof_index_pressure() const
+{
+  return dof_index_pressure;
+}
+
+template<int dim, typename Number>
+unsigned int
+FusedIntegralEvaluator<dim, Number>::get_quad_index() const
+{
+  return quad_index;
+}
+
+template<int dim, typename Number>
+void
+FusedIntegralEvaluator<dim, Number>::cell_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & cell_range) const
+{
+  if(cell_evaluation_flags == dealii::EvaluationFlags::nothing)
+    return;
+
+  CellIntegratorU integrator(matrix_free, dof_index_velocity, quad_index);
+
+  std::vector<scalar> sums(n_sums), maxima(n_maxima);
+
+  std::vector<Number> dst_range(dst.size(), 0.);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(src);
+    integrator.evaluate(cell_evaluation_flags);
+
+    std::fill(sums.begin(), sums.end(), dealii::make_vectorized_array<Number>(0.));
+    std::fill(maxima.begin(), maxima.end(), dealii::make_vectorized_array<Number>(0.));
+
+    for(unsigned int k = 0; k < kernels.size(); ++k)
+    {
+      if(active[k] and kernels[k].cell)
+        kernels[k].cell(integrator, sums.data() + offset_sums[k], maxima.data() + offset_maxima[k]);
+    }
+
+    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      for(unsigned int i = 0; i < n_sums; ++i)
+        dst_range[i] += sums[i][v];
+      for(unsigned int i = 0; i < n_maxima; ++i)
+        dst_range[n_sums + i] = std::max(dst_range[n_sums + i], maxima[i][v]);
+    }
+  }
+
+  add_results(dst, dst_range);
+}
+
+template<int dim, typename Number>
+void
+FusedIntegralEvaluator<dim, Number>::face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & face_range) const
+{
+  if(face_evaluation_flags == dealii::EvaluationFlags::nothing)
+    return;
+
+  FaceIntegratorU integrator_m(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorU integrator_p(matrix_free, false, dof_index_velocity, quad_index);
+
+  std::vector<scalar> sums(n_sums);
+
+  std::vector<Number> dst_range(dst.size(), 0.);
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_m.read_dof_values(src);
+    integrator_m.evaluate(face_evaluation_flags);
+    integrator_p.reinit(face);
+    integrator_p.read_dof_values(src);
+    integrator_p.evaluate(face_evaluation_flags);
+
+    std::fill(sums.begin(), sums.end(), dealii::make_vectorized_array<Number>(0.));
+
+    for(unsigned int k = 0; k < kernels.size(); ++k)
+    {
+      if(active[k] and kernels[k].face)
+        kernels[k].face(integrator_m, integrator_p, sums.data() + offset_sums[k]);
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      for(unsigned int i = 0; i < n_sums; ++i)
+        dst_range[i] += sums[i][v];
+    }
+  }
+
+  add_results(dst, dst_range);
+}
+
+template<int dim, typename Number>
+void
+FusedIntegralEvaluator<dim, Number>::boundary_face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & face_range) const
+{
+  if(boundary_face_evaluation_flags == dealii::EvaluationFlags::nothing)
+    return;
+
+  FaceIntegratorU integrator_velocity(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorP integrator_pressure(matrix_free, true, dof_index_pressure, quad_index);
+
+  std::vector<scalar> sums(n_sums);
+
+  std::vector<Number> dst_range(dst.size(), 0.);
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    dealii::types::boundary_id const boundary_id = matrix_free.get_boundary_id(face);
+
+    // skip faces that are not relevant for any of the active kernels
+    bool relevant = false;
+    for(unsigned int k = 0; k < kernels.size(); ++k)
+    {
+      if(active[k] and kernels[k].boundary_face and
+         kernels[k].boundary_ids.find(boundary_id) != kernels[k].boundary_ids.end())
+        relevant = true;
+    }
+
+    if(not relevant)
+      continue;
+
+    integrator_velocity.reinit(face);
+    integrator_velocity.read_dof_values(src);
+    integrator_velocity.evaluate(boundary_face_evaluation_flags);
+
+    if(boundary_face_needs_pressure)
+    {
+      integrator_pressure.reinit(face);
+      integrator_pressure.read_dof_values(*pressure);
+      integrator_pressure.evaluate(dealii::EvaluationFlags::values);
+    }
+
+    std::fill(sums.begin(), sums.end(), dealii::make_vectorized_array<Number>(0.));
+
+    for(unsigned int k = 0; k < kernels.size(); ++k)
+    {
+      if(active[k] and kernels[k].boundary_face and
+         kernels[k].boundary_ids.find(boundary_id) != kernels[k].boundary_ids.end())
+      {
+        kernels[k].boundary_face(integrator_velocity,
+                                 integrator_pressure,
+                                 sums.data() + offset_sums[k]);
+      }
+    }
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      for(unsigned int i = 0; i < n_sums; ++i)
+        dst_range[i] += sums[i][v];
+    }
+  }
+
+  add_results(dst, dst_range);
+}
+
+template<int dim, typename Number>
+void
+FusedIntegralEvaluator<dim, Number>::add_results(std::vector<Number> &       dst,
+                                                 std::vector<Number> const & dst_range) const
+{
+  // the loops may be executed by several threads concurrently
+  std::lock_guard<std::mutex> lock(mutex);
+
+  for(unsigned int i = 0; i < n_sums; ++i)
+    dst[i] += dst_range[i];
+  for(unsigned int i = n_sums; i < n_sums + n_maxima; ++i)
+    dst[i] = std::max(dst[i], dst_range[i]);
+}
+
+template class FusedIntegralEvaluator<2, float>;
+template class FusedIntegralEvaluator<2, double>;
+
+template class FusedIntegralEvaluator<3, float>;
+template class FusedIntegralEvaluator<3, double>;
+
+} // namespace ExaDG
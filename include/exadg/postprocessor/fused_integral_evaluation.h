@@ -0,0 +1,212 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_FUSED_INTEGRAL_EVALUATION_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_FUSED_INTEGRAL_EVALUATION_H_
+
+// C/C++
+#include <functional>
+#include <mutex>
+#include <set>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+/**
+ * Evaluates the integrals required by several postprocessing tools in a single matrix-free loop
+ * over the velocity (and pressure) field. Each tool registers a kernel during setup that adds the
+ * contributions of one cell batch or face batch to a number of sums and maxima. Before each
+ * evaluation, the kernels whose tools are due are activated. The velocity is then read and
+ * evaluated only once per cell/face batch for all active kernels, and the sums and maxima of all
+ * kernels are reduced over all MPI processes with one collective operation each.
+ */
+template<int dim, typename Number>
+class FusedIntegralEvaluator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
+  typedef FaceIntegrator<dim, dim, Number> FaceIntegratorU;
+  typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorP;
+
+  typedef FusedIntegralEvaluator<dim, Number> This;
+
+  /**
+   * Description of the integrals of one postprocessing tool. The kernels add their contributions
+   * to the arrays of sums and maxima (of size n_sums and n_maxima), which are initialized with
+   * zero for each cell/face batch.
+   */
+  struct Kernel
+  {
+    Kernel()
+      : n_sums(0),
+        n_maxima(0),
+        cell_evaluation_flags(dealii::EvaluationFlags::nothing),
+        face_evaluation_flags(dealii::EvaluationFlags::nothing),
+        boundary_face_evaluation_flags(dealii::EvaluationFlags::nothing),
+        boundary_face_needs_pressure(false)
+    {
+    }
+
+    unsigned int n_sums;
+    unsigned int n_maxima;
+
+    dealii::EvaluationFlags::EvaluationFlags cell_evaluation_flags;
+    std::function<void(CellIntegratorU const & integrator, scalar * sums, scalar * maxima)> cell;
+
+    // interior faces
+    dealii::EvaluationFlags::EvaluationFlags face_evaluation_flags;
+    std::function<void(FaceIntegratorU const & integrator_m,
+                       FaceIntegratorU const & integrator_p,
+                       scalar *                sums)>
+      face;
+
+    // boundary faces with the given boundary IDs
+    std::set<dealii::types::boundary_id>     boundary_ids;
+    dealii::EvaluationFlags::EvaluationFlags boundary_face_evaluation_flags;
+    bool                                     boundary_face_needs_pressure;
+    std::function<void(FaceIntegratorU const & integrator_velocity,
+                       FaceIntegratorP const & integrator_pressure,
+                       scalar *                sums)>
+      boundary_face;
+  };
+
+  FusedIntegralEvaluator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+        unsigned int const                      dof_index_velocity_in,
+        unsigned int const                      dof_index_pressure_in,
+        unsigned int const                      quad_index_in);
+
+  /**
+   * Registers a kernel and returns its index.
+   */
+  unsigned int
+  add_kernel(Kernel const & kernel);
+
+  /**
+   * Activates or deactivates a kernel for the next evaluation. Results of previous evaluations
+   * are invalidated.
+   */
+  void
+  set_active(unsigned int const kernel_index, bool const active);
+
+  bool
+  any_active() const;
+
+  /**
+   * Performs a single loop over all cells and faces for all active kernels.
+   */
+  void
+  evaluate(VectorType const & velocity, VectorType const & pressure);
+
+  /**
+   * Returns true if the results of the kernel are available for the given velocity vector.
+   */
+  bool
+  has_results(unsigned int const kernel_index, VectorType const & velocity) const;
+
+  Number
+  get_sum(unsigned int const kernel_index, unsigned int const i) const;
+
+  Number
+  get_maximum(unsigned int const kernel_index, unsigned int const i) const;
+
+  dealii::MatrixFree<dim, Number> const &
+  get_matrix_free() const;
+
+  unsigned int
+  get_dof_index_velocity() const;
+
+  unsigned int
+  get_dof_index_pressure() const;
+
+  unsigned int
+  get_quad_index() const;
+
+private:
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & cell_range) const;
+
+  void
+  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            src,
+            std::pair<unsigned int, unsigned int> const & face_range) const;
+
+  void
+  boundary_face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                     std::vector<Number> &                         dst,
+                     VectorType const &                            src,
+                     std::pair<unsigned int, unsigned int> const & face_range) const;
+
+  /**
+   * Adds the sums and maxima of a range of cells/faces to the results of the whole loop.
+   */
+  void
+  add_results(std::vector<Number> & dst, std::vector<Number> const & dst_range) const;
+
+  MPI_Comm const mpi_comm;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  unsigned int dof_index_velocity, dof_index_pressure, quad_index;
+
+  std::vector<Kernel> kernels;
+
+  // offsets of the sums and maxima of each kernel in the arrays of results
+  std::vector<unsigned int> offset_sums, offset_maxima;
+  unsigned int              n_sums, n_maxima;
+
+  std::vector<bool> active;
+
+  // union of the evaluation flags of all active kernels
+  dealii::EvaluationFlags::EvaluationFlags cell_evaluation_flags, face_evaluation_flags,
+    boundary_face_evaluation_flags;
+  bool boundary_face_needs_pressure;
+
+  VectorType const * pressure;
+
+  // results of the last evaluation, sums followed by maxima
+  std::vector<Number> results;
+  VectorType const *  evaluated_velocity;
+  std::vector<bool>   evaluated;
+
+  mutable std::mutex mutex;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_FUSED_INTEGRAL_EVALUATION_H_ */
@@ -20,6 +20,7 @@
  */
 
 // C/C++
+#include <array>
 #include <fstream>
 
 // ExaDG
@@ -30,7 +31,13 @@ namespace ExaDG
 {
 template<int dim, typename Number>
 KineticEnergyCalculator<dim, Number>::KineticEnergyCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files(true), matrix_free(nullptr), dof_index(0), quad_index(0)
+  : mpi_comm(comm),
+    clear_files(true),
+    matrix_free(nullptr),
+    dof_index(0),
+    quad_index(0),
+    fused_evaluator(nullptr),
+    fused_kernel_index(0)
 {
 }
 
@@ -117,6 +124,38 @@ KineticEnergyCalculator<dim, Number>::calculate_basic(VectorType const & velocit
   }
 }
 
+template<int dim, typename Number>
+unsigned int
+KineticEnergyCalculator<dim, Number>::register_fused_integrals(
+  FusedIntegralEvaluator<dim, Number> & evaluator)
+{
+  // the integrals are computed by the loops of this class if the evaluator uses different data,
+  // e.g., a different quadrature rule
+  if(&evaluator.get_matrix_free() != matrix_free or
+     evaluator.get_dof_index_velocity() != dof_index or evaluator.get_quad_index() != quad_index)
+  {
+    fused_evaluator = nullptr;
+    return dealii::numbers::invalid_unsigned_int;
+  }
+
+  // the same integrals as in cell_loop(): volume, energy, enstrophy, dissipation, max. vorticity
+  typename FusedIntegralEvaluator<dim, Number>::Kernel kernel;
+  kernel.n_sums   = 4;
+  kernel.n_maxima = 1;
+  kernel.cell_evaluation_flags =
+    dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients;
+  kernel.cell = [&](CellIntegrator<dim, dim, Number> const & fe_eval,
+                    scalar *                                 sums,
+                    scalar *                                 maxima) {
+    integrate_cell_batch(fe_eval, sums, maxima[0]);
+  };
+
+  fused_evaluator    = &evaluator;
+  fused_kernel_index = evaluator.add_kernel(kernel);
+
+  return fused_kernel_index;
+}
+
 template<int dim, typename Number>
 Number
 KineticEnergyCalculator<dim, Number>::integrate(dealii::MatrixFree<dim, Number> const & matrix_free,
@@ -126,25 +165,66 @@ KineticEnergyCalculator<dim, Number>::integrate(dealii::MatrixFree<dim, Number>
                                                 Number &                                dissipation,
                                                 Number & max_vorticity)
 {
-  std::vector<Number> dst(5, 0.0);
-  matrix_free.cell_loop(&KineticEnergyCalculator<dim, Number>::cell_loop, this, dst, velocity);
-
-  // sum over all MPI processes
   Number volume = 1.0;
-  volume        = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
-  energy        = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
-  enstrophy     = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
-  dissipation   = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+
+  if(fused_evaluator != nullptr and fused_evaluator->has_results(fused_kernel_index, velocity))
+  {
+    // the integrals have already been computed together with other postprocessing tools
+    volume        = fused_evaluator->get_sum(fused_kernel_index, 0);
+    energy        = fused_evaluator->get_sum(fused_kernel_index, 1);
+    enstrophy     = fused_evaluator->get_sum(fused_kernel_index, 2);
+    dissipation   = fused_evaluator->get_sum(fused_kernel_index, 3);
+    max_vorticity = fused_evaluator->get_maximum(fused_kernel_index, 0);
+  }
+  else
+  {
+    std::vector<Number> dst(5, 0.0);
+    matrix_free.cell_loop(&KineticEnergyCalculator<dim, Number>::cell_loop, this, dst, velocity);
+
+    // sum over all MPI processes
+    volume      = dealii::Utilities::MPI::sum(dst.at(0), mpi_comm);
+    energy      = dealii::Utilities::MPI::sum(dst.at(1), mpi_comm);
+    enstrophy   = dealii::Utilities::MPI::sum(dst.at(2), mpi_comm);
+    dissipation = dealii::Utilities::MPI::sum(dst.at(3), mpi_comm);
+
+    max_vorticity = dealii::Utilities::MPI::max(dst.at(4), mpi_comm);
+  }
 
   energy /= volume;
   enstrophy /= volume;
   dissipation /= volume;
 
-  max_vorticity = dealii::Utilities::MPI::max(dst.at(4), mpi_comm);
-
   return volume;
 }
 
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::integrate_cell_batch(
+  CellIntegrator<dim, dim, Number> const & fe_eval,
+  scalar *                                 sums,
+  scalar &                                 max_vorticity) const
+{
+  for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
+  {
+    sums[0] += fe_eval.JxW(q);
+
+    vector velocity = fe_eval.get_value(q);
+    sums[1] += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * velocity * velocity;
+
+    tensor velocity_gradient = fe_eval.get_gradient(q);
+    sums[3] += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(this->data.viscosity) *
+               scalar_product(velocity_gradient, velocity_gradient);
+
+    dealii::Tensor<1, number_vorticity_components, scalar> omega = fe_eval.get_curl(q);
+
+    scalar norm_omega = omega * omega;
+
+    sums[2] += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
+
+    max_vorticity = std::max(max_vorticity, std::sqrt(norm_omega));
+  }
+}
+
 template<int dim, typename Number>
 void
 KineticEnergyCalculator<dim, Number>::cell_loop(
@@ -168,47 +248,29 @@ KineticEnergyCalculator<dim, Number>::cell_loop(
     fe_eval.read_dof_values(src);
     fe_eval.evaluate(dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
 
-    scalar volume_vec        = dealii::make_vectorized_array<Number>(0.);
-    scalar energy_vec        = dealii::make_vectorized_array<Number>(0.);
-    scalar enstrophy_vec     = dealii::make_vectorized_array<Number>(0.);
-    scalar dissipation_vec   = dealii::make_vectorized_array<Number>(0.);
+    // volume, energy, enstrophy, dissipation
+    std::array<scalar, 4> sums_vec;
+    sums_vec.fill(dealii::make_vectorized_array<Number>(0.));
     scalar max_vorticity_vec = dealii::make_vectorized_array<Number>(0.);
 
-    for(unsigned int q = 0; q < fe_eval.n_q_points; ++q)
-    {
-      volume_vec += fe_eval.JxW(q);
-
-      vector velocity = fe_eval.get_value(q);
-      energy_vec +=
-        fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * velocity * velocity;
-
-      tensor velocity_gradient = fe_eval.get_gradient(q);
-      dissipation_vec += fe_eval.JxW(q) *
-                         dealii::make_vectorized_array<Number>(this->data.viscosity) *
-                         scalar_product(velocity_gradient, velocity_gradient);
-
-      dealii::Tensor<1, number_vorticity_components, scalar> omega = fe_eval.get_curl(q);
-
-      scalar norm_omega = omega * omega;
-
-      enstrophy_vec += fe_eval.JxW(q) * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
-
-      max_vorticity_vec = std::max(max_vorticity_vec, std::sqrt(norm_omega));
-    }
+    integrate_cell_batch(fe_eval, sums_vec.data(), max_vorticity_vec);
 
     // sum over entries of dealii::VectorizedArray, but only over those
     // that are "active"
     for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
     {
-      volume += volume_vec[v];
-      energy += energy_vec[v];
-      enstrophy += enstrophy_vec[v];
-      dissipation += dissipation_vec[v];
+      volume += sums_vec[0][v];
+      energy += sums_vec[1][v];
+      enstrophy += sums_vec[2][v];
+      dissipation += sums_vec[3][v];
 
       max_vorticity = std::max(max_vorticity, max_vorticity_vec[v]);
     }
   }
 
+  // the loop may be executed by several threads concurrently
+  std::lock_guard<std::mutex> lock(mutex);
+
   dst.at(0) += volume;
   dst.at(1) += energy;
   dst.at(2) += enstrophy;
@@ -22,12 +22,16 @@
 #ifndef INCLUDE_EXADG_POSTPROCESSOR_KINETIC_ENERGY_CALCULATION_H_
 #define INCLUDE_EXADG_POSTPROCESSOR_KINETIC_ENERGY_CALCULATION_H_
 
+// C/C++
+#include <mutex>
+
 // deal.II
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/spatial_discretization/curl_compute.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/fused_integral_evaluation.h>
 #include <exadg/postprocessor/time_control.h>
 #include <exadg/utilities/print_functions.h>
 
@@ -99,6 +103,17 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Registers the integrals computed by this class with @param evaluator, which computes them in
+   * a single loop together with the integrals of other postprocessing tools. Returns the index of
+   * the kernel. Integrals are taken from the evaluator if it holds results for the given velocity.
+   * If the evaluator uses different MatrixFree data than this class, no kernel is registered,
+   * dealii::numbers::invalid_unsigned_int is returned, and the integrals are computed by the loops
+   * of this class.
+   */
+  unsigned int
+  register_fused_integrals(FusedIntegralEvaluator<dim, Number> & evaluator);
+
   TimeControl time_control;
 
 protected:
@@ -128,6 +143,16 @@ protected:
             Number &                                dissipation,
             Number &                                max_vorticity);
 
+  /*
+   * Adds the integrals over the cell batch of @param fe_eval to @param sums (volume, energy,
+   * enstrophy, dissipation) and updates @param max_vorticity. Used by cell_loop() and by the kernel
+   * of the fused loop.
+   */
+  void
+  integrate_cell_batch(CellIntegrator<dim, dim, Number> const & fe_eval,
+                       scalar *                                 sums,
+                       scalar &                                 max_vorticity) const;
+
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       data,
             std::vector<Number> &                         dst,
@@ -141,6 +166,12 @@ protected:
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   KineticEnergyData                       data;
+
+  FusedIntegralEvaluator<dim, Number> const * fused_evaluator;
+  unsigned int                                fused_kernel_index;
+
+  // protects the accumulation of the results of cell_loop() in task-parallel loops
+  std::mutex mutex;
 };
 
 } // namespace ExaDG
@@ -21,6 +21,7 @@
 
 // C/C++
 #include <fstream>
+#include <type_traits>
 
 // deal.II
 #include <deal.II/base/mpi.h>
@@ -45,7 +46,6 @@
 
 // ExaDG
 #  include <exadg/postprocessor/spectral_analysis/interpolation.h>
-#  include <exadg/postprocessor/spectral_analysis/permutation.h>
 #  include <exadg/postprocessor/spectral_analysis/setup.h>
 #  include <exadg/postprocessor/spectral_analysis/spectrum.h>
 #  include <exadg/postprocessor/spectral_analysis/timer.h>
@@ -142,54 +142,43 @@ public:
     fftw.init();
     timer.stop("Init-FFTW");
 
-    int start_;
-    int end_;
-    fftw.getLocalRange(start_, end_);
-    const dealii::types::global_dof_index start = start_;
-    const dealii::types::global_dof_index end   = end_;
+    // the FFT is performed on x-pencils, i.e., this process owns all points in x-direction for
+    // a range of y- and z-coordinates
+    int y_start, y_end, z_start, z_end;
+    fftw.get_local_range_real(y_start, y_end, z_start, z_end);
 
+    dealii::types::global_dof_index const N = s.cells * s.points_dst;
+
+    // indices of the points of the interpolated velocity field (one velocity component), ordered
+    // cell by cell ...
     std::vector<dealii::types::global_dof_index> indices_has, indices_want;
 
     for(auto const & I : local_cells)
       for(dealii::types::global_dof_index i = 0; i < dealii::Utilities::pow(points_dst, dim); i++)
-        for(dealii::types::global_dof_index d = 0; d < dim; d++)
-        {
-          dealii::types::global_dof_index index =
-            (I / (n_cells_1D * n_cells_1D) * points_dst + i / (points_dst * points_dst)) *
-              dealii::Utilities::pow(n_cells_1D * points_dst, 2) +
-            (((I / n_cells_1D) % n_cells_1D) * points_dst + ((i / points_dst) % points_dst)) *
-              dealii::Utilities::pow(n_cells_1D * points_dst, 1) +
-            (I % (n_cells_1D)*points_dst + i % (points_dst));
-
-          indices_has.push_back(d * dealii::Utilities::pow(points_dst * n_cells_1D, dim) + index);
-        }
-
-    dealii::types::global_dof_index N  = s.cells * s.points_dst;
-    dealii::types::global_dof_index Nx = (N / 2 + 1) * 2;
+      {
+        dealii::types::global_dof_index index =
+          (I / (n_cells_1D * n_cells_1D) * points_dst + i / (points_dst * points_dst)) *
+            dealii::Utilities::pow(n_cells_1D * points_dst, 2) +
+          (((I / n_cells_1D) % n_cells_1D) * points_dst + ((i / points_dst) % points_dst)) *
+            dealii::Utilities::pow(n_cells_1D * points_dst, 1) +
+          (I % (n_cells_1D)*points_dst + i % (points_dst));
+
+        indices_has.push_back(index);
+      }
 
-    for(dealii::types::global_dof_index d = 0;
-        d < static_cast<dealii::types::global_dof_index>(s.dim);
-        d++)
-    {
-      dealii::types::global_dof_index c = 0;
-      for(dealii::types::global_dof_index k = 0; k < (end - start); k++)
-        for(dealii::types::global_dof_index j = 0; j < N; j++)
-          for(dealii::types::global_dof_index i = 0; i < Nx; i++, c++)
-            if(i < N)
-              indices_want.push_back(d * dealii::Utilities::pow(points_dst * n_cells_1D, dim) +
-                                     (k + start) *
-                                       dealii::Utilities::pow(points_dst * n_cells_1D, 2) +
-                                     j * dealii::Utilities::pow(points_dst * n_cells_1D, 1) + i);
-            else
-              indices_want.push_back(dealii::numbers::invalid_dof_index); // x-padding
-
-      for(; c < static_cast<dealii::types::global_dof_index>(fftw.bsize); c++)
-        indices_want.push_back(dealii::numbers::invalid_dof_index); // z-padding
-    }
+    // ... and of the points of the x-pencil of this process
+    for(int k = z_start; k < z_end; k++)
+      for(int j = y_start; j < y_end; j++)
+        for(dealii::types::global_dof_index i = 0; i < N; i++)
+          indices_want.push_back(k * N * N + j * N + i);
 
+    // the same communication pattern is used for all velocity components
     nonconti = std::make_shared<dealii::Utilities::MPI::NoncontiguousPartitioner>(indices_has,
                                                                                   indices_want,
                                                                                   comm);
+
+    temporary_storage.assign(dim, std::vector<double>(nonconti->temporary_storage_size()));
+    requests.resize(dim);
   }
 
   /**
@@ -200,8 +189,9 @@ public:
    * @param src   current velocity field
    *
    */
+  template<typename Number>
   void
-  execute(double const * src, std::string const & file_name = "", double const time = 0.0)
+  execute(Number const * src, std::string const & file_name = "", double const time = 0.0)
   {
     if(write)
     {
@@ -209,32 +199,62 @@ public:
       AssertThrow(file_name != "", dealii::ExcMessage("No file name has been provided!"));
       s.time = time;
       s.writeHeader(file_name.c_str());
-      ipol.serialize(file_name.c_str(), src);
+
+      // the file format uses double precision
+      if constexpr(std::is_same<Number, double>::value)
+      {
+        ipol.serialize(file_name.c_str(), src);
+      }
+      else
+      {
+        std::size_t const size = static_cast<std::size_t>(ipol.cells) * ipol.dofs_source * s.dim;
+        std::copy(src, src + size, ipol.src);
+        ipol.serialize(file_name.c_str());
+      }
     }
 
     if(inplace)
     {
-      // compute energy spectrum: interpolate ...
-      timer.start("Interpolation");
-      ipol.interpolate(src);
-      timer.append("Interpolation");
-
-      // ... permute
-      timer.start("Permutation");
-      dealii::types::global_dof_index const size =
-        dealii::Utilities::pow(static_cast<dealii::types::global_dof_index>(s.cells * s.points_dst),
-                               s.dim) *
-        s.dim;
-      dealii::ArrayView<double>       dst(fftw.u_real, size * 2);
-      dealii::ArrayView<double const> src_(ipol.dst, size);
-      nonconti->export_to_ghosted_array(src_, dst);
-
-      timer.append("Permutation");
-
-      // ... fft
-      timer.start("FFT");
-      fftw.execute();
-      timer.append("FFT");
+      std::size_t const n_points_interpolated =
+        static_cast<std::size_t>(ipol.cells) * ipol.dofs_target;
+
+      // compute energy spectrum: interpolate and start to permute one velocity component ...
+      auto const interpolate_and_permute = [&](int const d) {
+        double * dst = ipol.dst + d * n_points_interpolated;
+
+        timer.start("Interpolation");
+        ipol.interpolate_component(src, d, dst);
+        timer.append("Interpolation");
+
+        timer.start("Permutation");
+        nonconti->export_to_ghosted_array_start<double>(
+          d,
+          dealii::ArrayView<double const>(dst, n_points_interpolated),
+          dealii::ArrayView<double>(temporary_storage[d].data(), temporary_storage[d].size()),
+          requests[d]);
+        timer.append("Permutation");
+      };
+
+      // ... such that the communication of the next component overlaps with the interpolation
+      // and the FFT of the current component
+      interpolate_and_permute(0);
+      for(int d = 0; d < s.dim; d++)
+      {
+        if(d + 1 < s.dim)
+          interpolate_and_permute(d + 1);
+
+        timer.start("Permutation");
+        nonconti->export_to_ghosted_array_finish<double>(
+          dealii::ArrayView<double const>(temporary_storage[d].data(), temporary_storage[d].size()),
+          dealii::ArrayView<double>(fftw.get_real(d), fftw.n_local_points_real()),
+          requests[d]);
+        timer.append("Permutation");
+
+        // ... fft
+        timer.start("FFT");
+        fftw.execute(d);
+        timer.append("FFT");
+      }
 
       // ... spectral analysis
       timer.start("Postprocessing");
@@ -304,6 +324,10 @@ private:
   DealSpectrumTimer timer;
 
   std::shared_ptr<dealii::Utilities::MPI::NoncontiguousPartitioner> nonconti;
+
+  // buffers and requests of the non-blocking permutation of each velocity component
+  std::vector<std::vector<double>>      temporary_storage;
+  std::vector<std::vector<MPI_Request>> requests;
 };
 } // namespace ExaDG
 #else
@@ -326,8 +350,9 @@ public:
   {
   }
 
+  template<typename Number>
   void
-  execute(double const *, std::string const & = "", double const = 0.0)
+  execute(Number const *, std::string const & = "", double const = 0.0)
   {
   }
 
@@ -686,13 +711,11 @@ void
 KineticEnergySpectrumCalculator<dim, Number>::do_evaluate(VectorType const & velocity,
                                                           double const       time)
 {
-  // extract beginning of vector...
-  Number const * temp = velocity.begin();
-
   std::string const file_name =
     data.filename + "_" + dealii::Utilities::int_to_string(time_control.get_counter(), 4);
 
-  deal_spectrum_wrapper->execute((double *)temp, file_name, time);
+  // the velocity is read in its native precision
+  deal_spectrum_wrapper->execute(velocity.begin(), file_name, time);
 
   if(data.do_fftw)
   {
@@ -30,6 +30,30 @@
 
 namespace ExaDG
 {
+/*
+ * Returns the force per unit area that the fluid exerts on the boundary, tau = (p I - 2 nu
+ * sym(grad(u))) * n, at quadrature point @param q. This is the integrand of the lift and drag force
+ * used by both calculate_lift_and_drag_force() and the fused postprocessing loop.
+ */
+template<int dim, typename Number, typename IntegratorVelocity, typename IntegratorPressure>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+  calculate_surface_traction(IntegratorVelocity const & integrator_velocity,
+                             IntegratorPressure const & integrator_pressure,
+                             unsigned int const         q,
+                             double const               viscosity)
+{
+  dealii::VectorizedArray<Number> pressure = integrator_pressure.get_value(q);
+
+  dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal =
+    integrator_velocity.get_normal_vector(q);
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> velocity_gradient =
+    integrator_velocity.get_gradient(q);
+
+  return pressure * normal -
+         viscosity * (velocity_gradient + transpose(velocity_gradient)) * normal;
+}
+
 template<int dim, typename Number>
 void
 calculate_lift_and_drag_force(dealii::Tensor<1, dim, Number> &             Force,
@@ -59,33 +83,27 @@ calculate_lift_and_drag_force(dealii::Tensor<1, dim, Number> &             Force
       face < (matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches());
       face++)
   {
-    integrator_velocity.reinit(face);
-    integrator_velocity.read_dof_values(velocity);
-    integrator_velocity.evaluate(dealii::EvaluationFlags::gradients);
-
-    integrator_pressure.reinit(face);
-    integrator_pressure.read_dof_values(pressure);
-    integrator_pressure.evaluate(dealii::EvaluationFlags::values);
-
     dealii::types::boundary_id boundary_id = matrix_free.get_boundary_id(face);
 
     typename std::set<dealii::types::boundary_id>::iterator it = boundary_IDs.find(boundary_id);
     if(it != boundary_IDs.end())
     {
-      for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
-      {
-        dealii::VectorizedArray<Number> pressure = integrator_pressure.get_value(q);
+      integrator_velocity.reinit(face);
+      integrator_velocity.read_dof_values(velocity);
+      integrator_velocity.evaluate(dealii::EvaluationFlags::gradients);
 
-        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> normal =
-          integrator_velocity.get_normal_vector(q);
-        dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> velocity_gradient =
-          integrator_velocity.get_gradient(q);
+      integrator_pressure.reinit(face);
+      integrator_pressure.read_dof_values(pressure);
+      integrator_pressure.evaluate(dealii::EvaluationFlags::values);
 
-        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> tau =
-          pressure * normal -
-          viscosity * (velocity_gradient + transpose(velocity_gradient)) * normal;
-
-        integrator_velocity.submit_value(tau, q);
+      for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
+      {
+        integrator_velocity.submit_value(
+          calculate_surface_traction<dim, Number>(integrator_velocity,
+                                                  integrator_pressure,
+                                                  q,
+                                                  viscosity),
+          q);
       }
 
       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> Force_local =
@@ -134,7 +152,9 @@ LiftAndDragCalculator<dim, Number>::LiftAndDragCalculator(MPI_Comm const & comm)
     c_L_min(std::numeric_limits<double>::max()),
     c_L_max(-std::numeric_limits<double>::max()),
     c_D_min(std::numeric_limits<double>::max()),
-    c_D_max(-std::numeric_limits<double>::max())
+    c_D_max(-std::numeric_limits<double>::max()),
+    fused_evaluator(nullptr),
+    fused_kernel_index(0)
 {
 }
 
@@ -170,16 +190,25 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
   {
     dealii::Tensor<1, dim, Number> Force;
 
-    calculate_lift_and_drag_force<dim, Number>(Force,
-                                               *matrix_free,
-                                               dof_index_velocity,
-                                               quad_index,
-                                               dof_index_pressure,
-                                               data.boundary_IDs,
-                                               velocity,
-                                               pressure,
-                                               data.viscosity,
-                                               mpi_comm);
+    if(fused_evaluator != nullptr and fused_evaluator->has_results(fused_kernel_index, velocity))
+    {
+      // the force has already been computed together with other postprocessing tools
+      for(unsigned int d = 0; d < dim; ++d)
+        Force[d] = fused_evaluator->get_sum(fused_kernel_index, d);
+    }
+    else
+    {
+      calculate_lift_and_drag_force<dim, Number>(Force,
+                                                 *matrix_free,
+                                                 dof_index_velocity,
+                                                 quad_index,
+                                                 dof_index_pressure,
+                                                 data.boundary_IDs,
+                                                 velocity,
+                                                 pressure,
+                                                 data.viscosity,
+                                                 mpi_comm);
+    }
 
     // compute lift and drag coefficients (c = (F/rho)/(1/2 U² A)
     double const reference_value = data.reference_value;
@@ -250,6 +279,50 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
   }
 }
 
+template<int dim, typename Number>
+unsigned int
+LiftAndDragCalculator<dim, Number>::register_fused_integrals(
+  FusedIntegralEvaluator<dim, Number> & evaluator)
+{
+  // the integrals are computed by the loops of this class if the evaluator uses different data,
+  // e.g., a different quadrature rule
+  if(&evaluator.get_matrix_free() != matrix_free or
+     evaluator.get_dof_index_velocity() != dof_index_velocity or
+     evaluator.get_dof_index_pressure() != dof_index_pressure or
+     evaluator.get_quad_index() != quad_index)
+  {
+    fused_evaluator = nullptr;
+    return dealii::numbers::invalid_unsigned_int;
+  }
+
+  // the same integral as in calculate_lift_and_drag_force()
+  typename FusedIntegralEvaluator<dim, Number>::Kernel kernel;
+  kernel.n_sums                         = dim;
+  kernel.boundary_ids                   = data.boundary_IDs;
+  kernel.boundary_face_evaluation_flags = dealii::EvaluationFlags::gradients;
+  kernel.boundary_face_needs_pressure   = true;
+  kernel.boundary_face = [&](auto const &                      integrator_velocity,
+                             auto const &                      integrator_pressure,
+                             dealii::VectorizedArray<Number> * sums) {
+    for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
+    {
+      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> tau =
+        calculate_surface_traction<dim, Number>(integrator_velocity,
+                                                integrator_pressure,
+                                                q,
+                                                data.viscosity);
+
+      for(unsigned int d = 0; d < dim; ++d)
+        sums[d] += integrator_velocity.JxW(q) * tau[d];
+    }
+  };
+
+  fused_evaluator    = &evaluator;
+  fused_kernel_index = evaluator.add_kernel(kernel);
+
+  return fused_kernel_index;
+}
+
 template class LiftAndDragCalculator<2, float>;
 template class LiftAndDragCalculator<2, double>;
 
@@ -27,6 +27,7 @@
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
+#include <exadg/postprocessor/fused_integral_evaluation.h>
 #include <exadg/postprocessor/time_control.h>
 
 namespace ExaDG
@@ -93,6 +94,13 @@ public:
   void
   evaluate(VectorType const & velocity, VectorType const & pressure, double const time) const;
 
+  /*
+   * Registers the force integral with @param evaluator and returns the index of the kernel, see
+   * KineticEnergyCalculator::register_fused_integrals().
+   */
+  unsigned int
+  register_fused_integrals(FusedIntegralEvaluator<dim, Number> & evaluator);
+
   TimeControl time_control;
 
 private:
@@ -107,6 +115,9 @@ private:
   mutable double c_L_min, c_L_max, c_D_min, c_D_max;
 
   LiftAndDragData data;
+
+  FusedIntegralEvaluator<dim, Number> const * fused_evaluator;
+  unsigned int                                fused_kernel_index;
 };
 
 } // namespace ExaDG
@@ -22,11 +22,37 @@
 #ifndef INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_DATA_BASE_H_
 #define INCLUDE_EXADG_POSTPROCESSOR_OUTPUT_DATA_BASE_H_
 
+// C/C++
+#include <set>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/data_out_base.h>
+
+// ExaDG
 #include <exadg/postprocessor/time_control.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
 {
+/*
+ * Plane through a point with the given normal vector. The vectors have dim entries.
+ */
+struct OutputSlice
+{
+  std::vector<double> point;
+  std::vector<double> normal;
+};
+
+/*
+ * Axis-parallel box defined by its lower and upper corner. The vectors have dim entries.
+ */
+struct OutputBox
+{
+  std::vector<double> lower_corner;
+  std::vector<double> upper_corner;
+};
+
 struct OutputDataBase
 {
   OutputDataBase()
@@ -37,7 +63,8 @@ struct OutputDataBase
       write_grid(false),
       write_processor_id(false),
       write_higher_order(true),
-      degree(1)
+      degree(1),
+      compression_level(dealii::DataOutBase::CompressionLevel::best_speed)
   {
   }
 
@@ -58,6 +85,43 @@ struct OutputDataBase
 
       print_parameter(pcout, "Write higher order", write_higher_order);
       print_parameter(pcout, "Polynomial degree", degree);
+
+      print_parameter(pcout, "Compression level", compression_level_to_string());
+
+      if(write_reduced_output())
+      {
+        print_parameter(pcout, "Number of output slices", slices.size());
+        print_parameter(pcout, "Number of output boxes", boxes.size());
+      }
+      if(not surface_boundary_IDs.empty())
+        print_parameter(pcout, "Number of output surfaces", surface_boundary_IDs.size());
+    }
+  }
+
+  /*
+   * Returns true if only the cells cut by the slices or intersecting the boxes are written.
+   */
+  bool
+  write_reduced_output() const
+  {
+    return not(slices.empty() and boxes.empty());
+  }
+
+  std::string
+  compression_level_to_string() const
+  {
+    switch(compression_level)
+    {
+      case dealii::DataOutBase::CompressionLevel::no_compression:
+        return "no compression";
+      case dealii::DataOutBase::CompressionLevel::best_speed:
+        return "best speed";
+      case dealii::DataOutBase::CompressionLevel::best_compression:
+        return "best compression";
+      case dealii::DataOutBase::CompressionLevel::default_compression:
+        return "default compression";
+      default:
+        return "other";
     }
   }
 
@@ -94,6 +158,21 @@ struct OutputDataBase
   // case of write_higher_order = false, this variable defines the number of subdivisions of a cell,
   // with ParaView using linear interpolation for visualization on these subdivided cells.
   unsigned int degree;
+
+  // zlib compression level of the binary VTU data. Higher compression reduces the file size at
+  // the cost of a longer write time.
+  dealii::DataOutBase::CompressionLevel compression_level;
+
+  // In-situ reduced output: if slices or boxes are given, only the cells that are cut by one of the
+  // slices or that intersect one of the boxes are written instead of the whole volume. Use the
+  // Slice filter in ParaView to extract the exact plane from the written layer of cells. Together
+  // with a small output degree, this reduces the size of the snapshots by orders of magnitude.
+  std::vector<OutputSlice> slices;
+  std::vector<OutputBox>   boxes;
+
+  // write the solution on the boundary faces with these boundary IDs into separate files (suffix
+  // "_boundary"), e.g., to visualize wall quantities without writing the volume
+  std::set<dealii::types::boundary_id> surface_boundary_IDs;
 };
 
 } // namespace ExaDG
@@ -20,8 +20,13 @@
  */
 
 
+// C/C++
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+
 // deal.II
-#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -32,9 +37,36 @@
 
 namespace ExaDG
 {
+#ifdef DEAL_II_WITH_HDF5
+namespace
+{
+// The HDF5 library is not necessarily thread-safe. All HDF5 calls of this module are therefore
+// protected by one mutex, which is shared by all output generators.
+std::mutex hdf5_mutex;
+
+template<typename Number>
+hid_t
+get_hdf5_type()
+{
+  return std::is_same<Number, double>::value ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+}
+
+void
+check_hdf5_status(herr_t const status)
+{
+  AssertThrow(status >= 0, dealii::ExcMessage("Error in HDF5 call."));
+}
+} // namespace
+#endif
+
 template<int dim>
 PointwiseOutputDataBase<dim>::PointwiseOutputDataBase()
-  : directory("output/"), filename("name"), update_points_before_evaluation(false)
+  : directory("output/"),
+    filename("name"),
+    update_points_before_evaluation(false),
+    n_samples_per_flush(1),
+    compression_level(0),
+    flush_interval_time(std::numeric_limits<double>::max())
 {
 }
 
@@ -52,6 +84,9 @@ PointwiseOutputDataBase<dim>::print(dealii::ConditionalOStream & pcout) const
     print_parameter(pcout, "Output directory", directory);
     print_parameter(pcout, "Name of output file", filename);
     print_parameter(pcout, "Update Points before evaluation", update_points_before_evaluation);
+    print_parameter(pcout, "Samples per flush", n_samples_per_flush);
+    print_parameter(pcout, "Compression level", compression_level);
+    print_parameter(pcout, "Flush interval time", flush_interval_time);
   }
 }
 
@@ -74,6 +109,8 @@ PointwiseOutputGeneratorBase<dim, Number>::do_evaluate(std::function<void()> con
       AssertThrow(time_control.get_counter() == 0,
                   dealii::ExcMessage(
                     "Only implemented in the case that the simulation is not restarted"));
+
+      last_flush_time = time;
     }
 
     if(pointwise_output_data.update_points_before_evaluation)
@@ -82,13 +119,51 @@ PointwiseOutputGeneratorBase<dim, Number>::do_evaluate(std::function<void()> con
     write_time(time);
 
     write_solution();
+
+    ++n_buffered_samples;
+
+    if(n_buffered_samples == pointwise_output_data.n_samples_per_flush or
+       time - last_flush_time >= pointwise_output_data.flush_interval_time)
+    {
+      flush();
+      last_flush_time = time;
+    }
   }
 }
 
 template<int dim, typename Number>
 PointwiseOutputGeneratorBase<dim, Number>::PointwiseOutputGeneratorBase(MPI_Comm const & comm)
-  : mpi_comm(comm), n_out_samples(dealii::numbers::invalid_unsigned_int), first_evaluation(true)
+  : mpi_comm(comm),
+    first_evaluation(true),
+    n_buffered_samples(0),
+    n_written_samples(0),
+    last_flush_time(0.0)
 {
+#ifdef DEAL_II_WITH_HDF5
+  hdf5_file = -1;
+#endif
+}
+
+template<int dim, typename Number>
+PointwiseOutputGeneratorBase<dim, Number>::~PointwiseOutputGeneratorBase()
+{
+#ifdef DEAL_II_WITH_HDF5
+  // write the remaining samples, which involves only the first process
+  if(hdf5_file >= 0)
+  {
+    try
+    {
+      flush();
+      wait_for_flush();
+
+      std::lock_guard<std::mutex> lock(hdf5_mutex);
+      H5Fclose(hdf5_file);
+    }
+    catch(...)
+    {
+    }
+  }
+#endif
 }
 
 template<int dim, typename Number>
@@ -113,34 +188,23 @@ PointwiseOutputGeneratorBase<dim, Number>::setup_base(
       dealii::ExcMessage(
         "This module can currently only be used with time TimeControlData::UnsteadyEvalType::Interval"));
 
+    AssertThrow(pointwise_output_data.n_samples_per_flush > 0,
+                dealii::ExcMessage("n_samples_per_flush has to be > 0."));
+    AssertThrow(pointwise_output_data.compression_level <= 9,
+                dealii::ExcMessage("compression_level has to be in the range 0-9."));
+
     time_control.setup(pointwise_output_data.time_control_data);
 
     mapping = &mapping_in;
 
-    // allocate memory for hyperslab
+    // allocate memory for one sample of one component
     componentwise_result.reinit(pointwise_output_data.evaluation_points.size());
 
-    // number of samples to write into file
-    n_out_samples = 1 + static_cast<unsigned int>(
-                          std::ceil((pointwise_output_data.time_control_data.end_time -
-                                     pointwise_output_data.time_control_data.start_time) /
-                                    pointwise_output_data.time_control_data.trigger_interval));
-
     setup_remote_evaluator();
 
     create_hdf5_file();
 
-    {
-      auto group = hdf5_file->create_group("GeneralInformation");
-      add_evaluation_points_dataset(group, "EvaluationPoints");
-      write_evaluation_points("GeneralInformation/EvaluationPoints");
-    }
-
-    {
-      auto group = hdf5_file->create_group("PhysicalInformation");
-      add_time_dataset(group, "Time");
-    }
-
+    create_time_series_dataset("Time", 1);
 #else
     (void)triangulation_in;
     (void)mapping_in;
@@ -160,18 +224,27 @@ PointwiseOutputGeneratorBase<dim, Number>::add_quantity(std::string const & name
   AssertThrow(success, dealii::ExcMessage("Name already given to quantity dataset."));
 
 #ifdef DEAL_II_WITH_HDF5
-  auto group = hdf5_file->open_group("PhysicalInformation");
   for(unsigned int comp = 0; comp < n_components; ++comp)
   {
-    group.template create_dataset<Number>(
-      (n_components == 1) ? name : name + std::to_string(comp),
-      std::vector<hsize_t>{pointwise_output_data.evaluation_points.size(), 1 * n_out_samples});
+    create_time_series_dataset((n_components == 1) ? name : name + std::to_string(comp),
+                               pointwise_output_data.evaluation_points.size());
   }
 #else
   AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with HDF5!"));
 #endif
 }
 
+template<int dim, typename Number>
+void
+PointwiseOutputGeneratorBase<dim, Number>::setup_after_coarsening_and_refinement()
+{
+  if(pointwise_output_data.time_control_data.is_active and
+     pointwise_output_data.evaluation_points.size() > 0)
+  {
+    reinit_remote_evaluator();
+  }
+}
+
 template<int dim, typename Number>
 void
 PointwiseOutputGeneratorBase<dim, Number>::setup_remote_evaluator()
@@ -185,7 +258,13 @@ template<int dim, typename Number>
 void
 PointwiseOutputGeneratorBase<dim, Number>::reinit_remote_evaluator()
 {
-  remote_evaluator->reinit(pointwise_output_data.evaluation_points, *triangulation, *mapping);
+  // only the first process writes the file and, therefore, requests the values at the points
+  std::vector<dealii::Point<dim>> const points =
+    (dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0) ?
+      pointwise_output_data.evaluation_points :
+      std::vector<dealii::Point<dim>>();
+
+  remote_evaluator->reinit(points, *triangulation, *mapping);
   AssertThrow(remote_evaluator->all_points_found(),
               dealii::ExcMessage("Not all remote points found."));
 }
@@ -196,10 +275,44 @@ PointwiseOutputGeneratorBase<dim, Number>::create_hdf5_file()
 {
 #ifdef DEAL_II_WITH_HDF5
   ExaDG::create_directories(pointwise_output_data.directory, mpi_comm);
-  hdf5_file = std::make_unique<dealii::HDF5::File>(pointwise_output_data.directory +
-                                                     pointwise_output_data.filename + ".h5",
-                                                   dealii::HDF5::File::FileAccessMode::create,
-                                                   mpi_comm);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
+
+    std::string const filename =
+      pointwise_output_data.directory + pointwise_output_data.filename + ".h5";
+    hdf5_file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    AssertThrow(hdf5_file >= 0, dealii::ExcMessage("Could not create file " + filename + "."));
+
+    for(std::string const group_name : {"GeneralInformation", "PhysicalInformation"})
+    {
+      hid_t const group =
+        H5Gcreate2(hdf5_file, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+      check_hdf5_status(group);
+      check_hdf5_status(H5Gclose(group));
+    }
+
+    // evaluation points
+    hsize_t const dims[2]   = {pointwise_output_data.evaluation_points.size(), dim};
+    hid_t const   dataspace = H5Screate_simple(2, dims, nullptr);
+    hid_t const   dataset   = H5Dcreate2(hdf5_file,
+                                     "GeneralInformation/EvaluationPoints",
+                                     get_hdf5_type<point_value_type>(),
+                                     dataspace,
+                                     H5P_DEFAULT,
+                                     H5P_DEFAULT,
+                                     H5P_DEFAULT);
+    check_hdf5_status(dataset);
+    check_hdf5_status(H5Dwrite(dataset,
+                               get_hdf5_type<point_value_type>(),
+                               H5S_ALL,
+                               H5S_ALL,
+                               H5P_DEFAULT,
+                               &pointwise_output_data.evaluation_points[0][0]));
+    check_hdf5_status(H5Dclose(dataset));
+    check_hdf5_status(H5Sclose(dataspace));
+  }
 #else
   AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with HDF5!"));
 #endif
@@ -207,78 +320,154 @@ PointwiseOutputGeneratorBase<dim, Number>::create_hdf5_file()
 
 template<int dim, typename Number>
 void
-PointwiseOutputGeneratorBase<dim, Number>::write_evaluation_points(std::string const & name)
+PointwiseOutputGeneratorBase<dim, Number>::create_time_series_dataset(std::string const & name,
+                                                                      unsigned int const  n_rows)
 {
 #ifdef DEAL_II_WITH_HDF5
-  auto dataset = hdf5_file->open_dataset(name);
-
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
-    dealii::FullMatrix<point_value_type> evaluation_points(
-      dataset.get_dimensions()[0],
-      dataset.get_dimensions()[1],
-      &pointwise_output_data.evaluation_points[0][0]);
-
-    std::vector<hsize_t> hyperslab_offset = {0, 0};
+    unsigned int const n_samples_per_flush = pointwise_output_data.n_samples_per_flush;
+
+    buffers[name].resize(n_rows * n_samples_per_flush);
+
+    std::lock_guard<std::mutex> lock(hdf5_mutex);
+
+    // The dataset grows in time direction with every flush. Each chunk contains the samples of one
+    // flush, and the number of rows per chunk is limited such that a chunk has at most 1 MB.
+    hsize_t const dims[2]       = {n_rows, 0};
+    hsize_t const max_dims[2]   = {n_rows, H5S_UNLIMITED};
+    hsize_t const chunk_dims[2] = {
+      std::max<hsize_t>(1,
+                        std::min<hsize_t>(n_rows,
+                                          (1 << 20) / (sizeof(Number) * n_samples_per_flush))),
+      n_samples_per_flush};
+
+    hid_t const dataspace  = H5Screate_simple(2, dims, max_dims);
+    hid_t const properties = H5Pcreate(H5P_DATASET_CREATE);
+    check_hdf5_status(H5Pset_chunk(properties, 2, chunk_dims));
+    if(pointwise_output_data.compression_level > 0)
+    {
+      check_hdf5_status(H5Pset_shuffle(properties));
+      check_hdf5_status(H5Pset_deflate(properties, pointwise_output_data.compression_level));
+    }
 
-    dataset.write_hyperslab(evaluation_points, hyperslab_offset, dataset.get_dimensions());
-  }
-  else
-  {
-    dataset.template write_none<point_value_type>();
+    hid_t const dataset = H5Dcreate2(hdf5_file,
+                                     ("PhysicalInformation/" + name).c_str(),
+                                     get_hdf5_type<Number>(),
+                                     dataspace,
+                                     H5P_DEFAULT,
+                                     properties,
+                                     H5P_DEFAULT);
+    check_hdf5_status(dataset);
+    check_hdf5_status(H5Dclose(dataset));
+    check_hdf5_status(H5Pclose(properties));
+    check_hdf5_status(H5Sclose(dataspace));
   }
 #else
   (void)name;
+  (void)n_rows;
   AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with HDF5!"));
 #endif
 }
 
-#ifdef DEAL_II_WITH_HDF5
 template<int dim, typename Number>
 void
-PointwiseOutputGeneratorBase<dim, Number>::add_evaluation_points_dataset(
-  dealii::HDF5::Group & group,
-  std::string const &   name)
+PointwiseOutputGeneratorBase<dim, Number>::write_time(double time)
 {
-  std::vector<hsize_t> hdf5_point_dims{pointwise_output_data.evaluation_points.size(), dim};
-
-  group.template create_dataset<point_value_type>(name, hdf5_point_dims);
+#ifdef DEAL_II_WITH_HDF5
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    buffers.at("Time")[n_buffered_samples] = static_cast<Number>(time);
+#else
+  (void)time;
+  AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with HDF5!"));
+#endif
 }
 
 template<int dim, typename Number>
 void
-PointwiseOutputGeneratorBase<dim, Number>::add_time_dataset(dealii::HDF5::Group & group,
-                                                            std::string const &   name)
+PointwiseOutputGeneratorBase<dim, Number>::flush()
 {
-  group.template create_dataset<Number>(name, std::vector<hsize_t>{1, 1 * n_out_samples});
-}
+#ifdef DEAL_II_WITH_HDF5
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0 and n_buffered_samples > 0)
+  {
+    // the flush buffers might still be in use by the last flush
+    wait_for_flush();
+
+    flush_buffers = buffers;
+
+    unsigned int const first_sample = n_written_samples;
+    unsigned int const n_samples    = n_buffered_samples;
+
+    n_written_samples += n_buffered_samples;
+    n_buffered_samples = 0;
+
+    flush_task = std::async(std::launch::async, [this, first_sample, n_samples]() {
+      write_flush_buffers(first_sample, n_samples);
+    });
+  }
 #endif
+}
 
 template<int dim, typename Number>
 void
-PointwiseOutputGeneratorBase<dim, Number>::write_time(double time)
+PointwiseOutputGeneratorBase<dim, Number>::write_flush_buffers(unsigned int const first_sample,
+                                                               unsigned int const n_samples)
 {
 #ifdef DEAL_II_WITH_HDF5
-  auto dataset = hdf5_file->open_dataset("PhysicalInformation/Time");
+  std::lock_guard<std::mutex> lock(hdf5_mutex);
 
-  std::vector<hsize_t> hyperslab_offset = {0, time_control.get_counter()};
+  unsigned int const n_samples_per_flush = pointwise_output_data.n_samples_per_flush;
 
-  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-  {
-    dataset.write_hyperslab(std::vector<Number>{static_cast<Number>(time)},
-                            hyperslab_offset,
-                            std::vector<hsize_t>{1, 1});
-  }
-  else
+  for(auto const & [name, buffer] : flush_buffers)
   {
-    dataset.template write_none<Number>();
+    hsize_t const n_rows = buffer.size() / n_samples_per_flush;
+
+    hid_t const dataset =
+      H5Dopen2(hdf5_file, ("PhysicalInformation/" + name).c_str(), H5P_DEFAULT);
+    check_hdf5_status(dataset);
+
+    hsize_t const new_dims[2] = {n_rows, first_sample + n_samples};
+    check_hdf5_status(H5Dset_extent(dataset, new_dims));
+
+    // select the new samples in the file ...
+    hid_t const   file_space     = H5Dget_space(dataset);
+    hsize_t const file_offset[2] = {0, first_sample};
+    hsize_t const count[2]       = {n_rows, n_samples};
+    check_hdf5_status(
+      H5Sselect_hyperslab(file_space, H5S_SELECT_SET, file_offset, nullptr, count, nullptr));
+
+    // ... and the filled part of the buffer, which is not full if the flush has been triggered by
+    // the flush interval
+    hsize_t const memory_dims[2]   = {n_rows, n_samples_per_flush};
+    hsize_t const memory_offset[2] = {0, 0};
+    hid_t const   memory_space     = H5Screate_simple(2, memory_dims, nullptr);
+    check_hdf5_status(
+      H5Sselect_hyperslab(memory_space, H5S_SELECT_SET, memory_offset, nullptr, count, nullptr));
+
+    check_hdf5_status(H5Dwrite(
+      dataset, get_hdf5_type<Number>(), memory_space, file_space, H5P_DEFAULT, buffer.data()));
+
+    check_hdf5_status(H5Sclose(memory_space));
+    check_hdf5_status(H5Sclose(file_space));
+    check_hdf5_status(H5Dclose(dataset));
   }
+
+  // make sure that the data is on disk in case the simulation crashes later
+  check_hdf5_status(H5Fflush(hdf5_file, H5F_SCOPE_LOCAL));
 #else
-  (void)time;
-  AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with HDF5!"));
+  (void)first_sample;
+  (void)n_samples;
 #endif
 }
 
+template<int dim, typename Number>
+void
+PointwiseOutputGeneratorBase<dim, Number>::wait_for_flush()
+{
+  if(flush_task.valid())
+    flush_task.get();
+}
+
 // Vector Instantiations
 template class PointwiseOutputGeneratorBase<2, float>;
 template class PointwiseOutputGeneratorBase<2, double>;
@@ -23,13 +23,17 @@
 #define INCLUDE_COMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POINTWISE_OUTPUT_GENERATOR_BASE_H_
 
 
+// C/C++
+#include <future>
+#include <map>
+
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mpi_remote_point_evaluation.h>
 #include <deal.II/base/point.h>
 
 #ifdef DEAL_II_WITH_HDF5
-#  include <deal.II/base/hdf5.h>
+#  include <hdf5.h>
 #endif
 
 #include <deal.II/distributed/tria.h>
@@ -61,6 +65,17 @@ struct PointwiseOutputDataBase
 
   std::vector<dealii::Point<dim>> evaluation_points;
 
+  // Number of samples that are kept in memory before they are written to the file with a single
+  // HDF5 call. This is also the chunk size of the datasets in time direction.
+  unsigned int n_samples_per_flush;
+
+  // Compression level of the datasets (0: no compression, 1-9: deflate with shuffle filter)
+  unsigned int compression_level;
+
+  // The buffered samples are written at least once per this interval of physical time. If set to
+  // the restart interval, all samples up to a restart are contained in the file.
+  double flush_interval_time;
+
   void
   print(dealii::ConditionalOStream & pcout) const;
 };
@@ -73,13 +88,20 @@ public:
 
   TimeControl time_control;
 
+  /*
+   * The evaluation points have to be searched again in case the triangulation has changed, e.g.,
+   * due to adaptive mesh refinement.
+   */
+  void
+  setup_after_coarsening_and_refinement();
+
 protected:
   void
   do_evaluate(std::function<void()> const & write_solution, double const time, bool const unsteady);
 
   PointwiseOutputGeneratorBase(MPI_Comm const & comm);
 
-  virtual ~PointwiseOutputGeneratorBase() = default;
+  virtual ~PointwiseOutputGeneratorBase();
 
   void
   setup_base(dealii::Triangulation<dim> const &   triangulation_in,
@@ -131,33 +153,41 @@ private:
   create_hdf5_file();
 
   void
-  write_evaluation_points(std::string const & name);
+  create_time_series_dataset(std::string const & name, unsigned int const n_rows);
 
-#ifdef DEAL_II_WITH_HDF5
   void
-  add_evaluation_points_dataset(dealii::HDF5::Group & group, std::string const & name);
+  write_time(double time);
 
+  /*
+   * Copies the buffered samples and writes them to the file in a separate thread.
+   */
   void
-  add_time_dataset(dealii::HDF5::Group & group, std::string const & name);
-#endif
+  flush();
 
+  /*
+   * Waits until the last flush has been completed.
+   */
   void
-  write_time(double time);
+  wait_for_flush();
+
+  void
+  write_flush_buffers(unsigned int const first_sample, unsigned int const n_samples);
 
   template<typename ComponentwiseContainerType>
   void
   write_component(std::string const & name, ComponentwiseContainerType const & componentwise_result)
   {
 #ifdef DEAL_II_WITH_HDF5
-    auto dataset = hdf5_file->open_dataset("PhysicalInformation/" + name);
-
-    std::vector<hsize_t> hyperslab_offset = {0, time_control.get_counter()};
-    std::vector<hsize_t> hyperslab_dim    = {pointwise_output_data.evaluation_points.size(), 1};
-
+    // only the first process receives values and writes the file
     if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-      dataset.write_hyperslab(componentwise_result, hyperslab_offset, hyperslab_dim);
-    else
-      dataset.template write_none<Number>();
+    {
+      std::vector<Number> & buffer = buffers.at(name);
+
+      unsigned int const n_points = pointwise_output_data.evaluation_points.size();
+      for(unsigned int p = 0; p < n_points; ++p)
+        buffer[p * pointwise_output_data.n_samples_per_flush + n_buffered_samples] =
+          componentwise_result[p];
+    }
 #else
     (void)name;
     (void)componentwise_result;
@@ -171,14 +201,24 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>                    mapping;
   PointwiseOutputDataBase<dim>                                        pointwise_output_data;
   dealii::Vector<Number>                                              componentwise_result;
-  unsigned int                                                        n_out_samples;
   std::shared_ptr<dealii::Utilities::MPI::RemotePointEvaluation<dim>> remote_evaluator;
   bool                                                                first_evaluation;
 
   std::map<std::string, unsigned int> name_to_components;
 
+  // Samples that have not been written yet for each dataset in the layout of the datasets, i.e.,
+  // (point, sample), and a copy of these samples that is being written by the flush thread.
+  std::map<std::string, std::vector<Number>> buffers;
+  std::map<std::string, std::vector<Number>> flush_buffers;
+
+  unsigned int n_buffered_samples;
+  unsigned int n_written_samples;
+  double       last_flush_time;
+
+  std::future<void> flush_task;
+
 #ifdef DEAL_II_WITH_HDF5
-  std::unique_ptr<dealii::HDF5::File> hdf5_file;
+  hid_t hdf5_file;
 #endif
 };
 
@@ -79,6 +79,20 @@ public:
     }
   }
 
+  /**
+   * This function gives write access to the solution vector for the case that the solution field
+   * is computed outside of this class, e.g. together with other solution fields in a single loop,
+   * instead of by the lambda recompute_solution_field. The solution vector is marked as available,
+   * i.e., the caller is responsible for computing it before it is accessed.
+   */
+  VectorType &
+  get_vector_for_external_evaluation()
+  {
+    is_available = true;
+
+    return solution_vector;
+  }
+
   VectorType const &
   get() const
   {
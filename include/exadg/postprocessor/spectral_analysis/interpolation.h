@@ -241,6 +241,54 @@ public:
     }
   }
 
+  /**
+   * Perform interpolation of velocity component @p d of all cells. The source vector contains
+   * the values of all velocity components cell by cell (as the source vector of interpolate())
+   * and is read in its native precision. The interpolated values are written cell by cell to
+   * @p dst, i.e., @p dst contains cells * dofs_target values.
+   *
+   * @params src      source vector (vector to be interpolated)
+   * @params d        velocity component
+   * @params dst      destination vector
+   */
+  template<typename Number>
+  void
+  interpolate_component(Number const * src, int const d, double * dst)
+  {
+    dealii::AlignedVector<double> temp1(MAX(dofs_source, dofs_target));
+    dealii::AlignedVector<double> temp2(MAX(dofs_source, dofs_target));
+
+    dealii::internal::EvaluatorTensorProduct<dealii::internal::evaluate_general, 2, 0, 0, double>
+      eval_val_2d(shape_values, shape_values, shape_values, points_source, points_target);
+    dealii::internal::EvaluatorTensorProduct<dealii::internal::evaluate_general, 3, 0, 0, double>
+      eval_val_3d(shape_values, shape_values, shape_values, points_source, points_target);
+
+    // loop over all cells
+    for(int c = 0; c < cells; c++)
+    {
+      Number const * src_ = src + (static_cast<std::size_t>(c) * DIM + d) * dofs_source;
+      double *       dst_ = dst + static_cast<std::size_t>(c) * dofs_target;
+
+      for(int i = 0; i < dofs_source; i++)
+        temp1[i] = src_[i];
+
+      // perform interpolation
+      if(DIM == 2)
+      {
+        // ... 2D
+        eval_val_2d.template values<0, true, false>(temp1.begin(), temp2.begin());
+        eval_val_2d.template values<1, true, false>(temp2.begin(), dst_);
+      }
+      else
+      {
+        // ... 3D
+        eval_val_3d.template values<0, true, false>(temp1.begin(), temp2.begin());
+        eval_val_3d.template values<1, true, false>(temp2.begin(), temp1.begin());
+        eval_val_3d.template values<2, true, false>(temp1.begin(), dst_);
+      }
+    }
+  }
+
   /**
    * Only for testing:
    * Do not perform interpolation and only permute dofs such that u, v, and w
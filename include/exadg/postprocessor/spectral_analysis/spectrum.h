@@ -22,24 +22,36 @@
 #ifndef DEAL_SPECTRUM_SPECTRUM
 #define DEAL_SPECTRUM_SPECTRUM
 
-#include <fftw3-mpi.h>
+#include <fftw3.h>
 #include <mpi.h>
+#include <algorithm>
 #include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
 
 // ExaDG
 #include <exadg/postprocessor/spectral_analysis/setup.h>
 
-// shortcuts for accessing linearized arrays
-#define u_comp2(i, j) u_comp[(j - local_start) * (N / 2 + 1) + i]
-#define v_comp2(i, j) v_comp[(j - local_start) * (N / 2 + 1) + i]
-#define u_comp3(i, j, k) u_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define v_comp3(i, j, k) v_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define w_comp3(i, j, k) w_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-
 namespace dealspectrum
 {
 /**
  * Class wrapping FFTW and performing energy spectral analysis.
+ *
+ * The FFT is performed with a 2D pencil decomposition (3D) or a slab decomposition (2D) of the
+ * N^dim points: the processes are arranged in a P1 x P2 grid. Each process owns complete lines
+ * in x-direction of its part of the y-z-plane ("x-pencils"). One-dimensional FFTs are performed
+ * along the lines owned by a process, and the data is transposed between the FFTs within the
+ * rows (x <-> y) and columns (y <-> z) of the process grid. Hence, up to N^(dim-1) processes can
+ * participate in the FFT. The FFTW plans are created once in init() and are reused for all
+ * evaluations.
+ *
+ * Input: real field of each velocity component, given on the x-pencil of this process in the
+ * layout [z][y][x] (x running fastest), see get_local_range_real().
+ *
+ * Output: complex coefficients for the wave numbers kx in [0, N/2] owned by this process (r2c
+ * transform) in the layout [ky][kx][kz] (3D) or [kx][ky] (2D).
  */
 class SpectralAnalysis
 {
@@ -49,8 +61,6 @@ class SpectralAnalysis
   Setup & s;
   // is initialized?
   bool initialized;
-  // rank of process which owns row
-  int * _indices_proc_rows;
 
 public:
   /**
@@ -62,28 +72,39 @@ public:
   }
 
   /**
-   * Determines rank of process owning specified row (2D) or plane (3D)
+   * Get the process local range of the real input field: the process owns the points with
+   * y in [y_start, y_end) and z in [z_start, z_end) for all x (z_start = 0, z_end = 1 in 2D)
    *
-   * @param i     position on sfc
-   * @return      rank of process owning cell
+   * @param y_start   start point in y-direction
+   * @param y_end     end point in y-direction
+   * @param z_start   start point in z-direction
+   * @param z_end     end point in z-direction
    */
-  inline int
-  indices_proc_rows(int i)
+  void
+  get_local_range_real(int & y_start, int & y_end, int & z_start, int & z_end) const
   {
-    return _indices_proc_rows[i];
+    y_start = range_y_real[0];
+    y_end   = range_y_real[1];
+    z_start = range_z_real[0];
+    z_end   = range_z_real[1];
   }
 
   /**
-   * Get process local range of rows/plane this process owns
-   *
-   * @param start     start point
-   * @param end       end point
+   * Number of points of the real input field owned by this process (per velocity component)
    */
-  void
-  getLocalRange(int & start, int & end)
+  int
+  n_local_points_real() const
+  {
+    return N * (range_y_real[1] - range_y_real[0]) * (range_z_real[1] - range_z_real[0]);
+  }
+
+  /**
+   * Real input field of velocity component @p d
+   */
+  double *
+  get_real(int const d)
   {
-    start = local_start;
-    end   = local_end;
+    return u_real[d];
   }
 
   /**
@@ -99,62 +120,100 @@ public:
 
     // extract settings
     this->N    = s.cells * s.points_dst;
+    this->Nc   = N / 2 + 1;
+    this->Nz   = s.dim == 3 ? N : 1;
     this->dim  = s.dim;
     this->rank = s.rank;
     this->size = s.size;
     this->bins = s.bins;
 
-    // setup global size of output arrays...
-    n = new ptrdiff_t[dim];
-    for(int i = 0; i < dim - 1; i++)
-      n[i] = N;
-    n[dim - 1] = N / 2 + 1;
-
-    // ...get local size of local output arrays
-    ptrdiff_t local_elements = 0;
-    alloc_local              = fftw_mpi_local_size(dim, n, comm, &local_elements, &local_start);
-    local_end                = local_start + local_elements;
-
-    // determine how many rows each process has
-    int * global_elements = new int[size];
-    MPI_Allgather(&local_elements, 1, MPI_INTEGER, global_elements, 1, MPI_INTEGER, comm);
-
-    // ... save for each row by whom it is owned
-    _indices_proc_rows = new int[N];
-
-    for(int i = 0, c = 0; i < size; i++)
-      for(int j = 0; j < global_elements[i]; j++, c++)
-        _indices_proc_rows[c] = i;
-
-    // ... clean up
-    delete[] global_elements;
-
-    // modify global size for input array
-    n[dim - 1] = N;
-
-    // allocate memory
-    // ... for input array (real) - allocated together for all directions
-    u_real = fftw_alloc_real(2 * alloc_local * dim);
-    // ... and save required size
-    this->bsize = 2 * alloc_local;
-
-    // initialize input array with zero (not needed: only useful for IO -> hard zero)
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
-      u_real[i] = 0;
-
-    // set pointer for v input field
-    v_real = u_real + 2 * alloc_local;
-
-    // allocate memory for output array (complex)
-    u_comp = fftw_alloc_complex(alloc_local);
-    v_comp = fftw_alloc_complex(alloc_local);
-
-    // do the same for 3D
+    // arrange processes in a P1 x P2 grid (P2 = 1 in 2D)
+    int dims[2] = {0, 0};
     if(dim == 3)
+      MPI_Dims_create(size, 2, dims);
+    else
+    {
+      dims[0] = size;
+      dims[1] = 1;
+    }
+    P1 = dims[0];
+    P2 = dims[1];
+
+    int const p1 = rank % P1;
+    int const p2 = rank / P1;
+
+    // processes with the same p2 exchange data in the transpose x <-> y, processes with the same
+    // p1 in the transpose y <-> z
+    MPI_Comm_split(comm, p2, p1, &comm_row);
+    MPI_Comm_split(comm, p1, p2, &comm_col);
+
+    // x-pencils: all x, y and z distributed
+    get_range(N, P1, p1, range_y_real);
+    get_range(Nz, P2, p2, range_z_real);
+    // y-pencils: all y, kx and z distributed
+    get_range(Nc, P1, p1, range_kx);
+    // z-pencils: all z, kx and ky distributed
+    get_range(N, P2, p2, range_ky);
+
+    int const n_y  = range_y_real[1] - range_y_real[0];
+    int const n_z  = range_z_real[1] - range_z_real[0];
+    int const n_kx = range_kx[1] - range_kx[0];
+    int const n_ky = range_ky[1] - range_ky[0];
+
+    size_x = n_z * n_y * Nc;
+    size_y = n_z * n_kx * N;
+    size_z = dim == 3 ? n_ky * n_kx * N : size_y;
+
+    // allocate memory for the input arrays (real) and the output arrays (complex) of all velocity
+    // components, and for the intermediate steps
+    u_real.resize(dim);
+    u_comp.resize(dim);
+    for(int d = 0; d < dim; d++)
     {
-      w_real = v_real + 2 * alloc_local;
-      w_comp = fftw_alloc_complex(alloc_local);
+      u_real[d] = fftw_alloc_real(std::max(n_local_points_real(), 1));
+      u_comp[d] = fftw_alloc_complex(std::max(size_z, 1));
     }
+    work_x = fftw_alloc_complex(std::max(size_x, 1));
+    work_y = fftw_alloc_complex(std::max(size_y, 1));
+
+    send_buffer.resize(2 * std::max(size_x, size_y));
+    recv_buffer.resize(2 * std::max(size_y, size_z));
+
+    // Create persistent plans. FFTW_MEASURE overwrites the arrays during planning, which is why the
+    // plans have to be created before the arrays are filled.
+    plan_x = nullptr;
+    plan_y = nullptr;
+    plan_z = nullptr;
+
+    if(size_x > 0)
+      plan_x = fftw_plan_many_dft_r2c(
+        1, &N, n_z * n_y, u_real[0], NULL, 1, N, work_x, NULL, 1, Nc, FFTW_MEASURE);
+
+    // in 2D, the last transform is performed in the output array
+    fftw_complex * data_y = dim == 3 ? work_y : u_comp[0];
+    if(size_y > 0)
+      plan_y = fftw_plan_many_dft(
+        1, &N, n_z * n_kx, data_y, NULL, 1, N, data_y, NULL, 1, N, FFTW_FORWARD, FFTW_MEASURE);
+
+    if(dim == 3 and size_z > 0)
+      plan_z = fftw_plan_many_dft(1,
+                                  &N,
+                                  n_ky * n_kx,
+                                  u_comp[0],
+                                  NULL,
+                                  1,
+                                  N,
+                                  u_comp[0],
+                                  NULL,
+                                  1,
+                                  N,
+                                  FFTW_FORWARD,
+                                  FFTW_MEASURE);
+
+    // initialize input arrays with zero
+    for(int d = 0; d < dim; d++)
+      for(int i = 0; i < n_local_points_real(); i++)
+        u_real[d][i] = 0;
 
     // allocate memory and ...
     this->e = new double[N];
@@ -175,48 +234,132 @@ public:
       return;
 
     // free data structures
-    delete[] _indices_proc_rows;
-
-    free(n);
-    fftw_free(u_comp);
-    fftw_free(v_comp);
-    free(u_real);
-
-    if(dim == 3)
+    if(plan_x)
+      fftw_destroy_plan(plan_x);
+    if(plan_y)
+      fftw_destroy_plan(plan_y);
+    if(plan_z)
+      fftw_destroy_plan(plan_z);
+
+    for(int d = 0; d < dim; d++)
     {
-      fftw_free(w_comp);
+      fftw_free(u_real[d]);
+      fftw_free(u_comp[d]);
     }
-
-    delete e;
-    delete E;
-    delete k;
-    delete K;
-    delete c;
-    delete C;
+    fftw_free(work_x);
+    fftw_free(work_y);
+
+    MPI_Comm_free(&comm_row);
+    MPI_Comm_free(&comm_col);
+
+    delete[] e;
+    delete[] E;
+    delete[] k;
+    delete[] K;
+    delete[] c;
+    delete[] C;
   }
 
   /**
-   * Perform FFT with FFTW
+   * Perform FFT with FFTW for all velocity components
    */
   void
   execute()
   {
-    // perform FFT for u
-    fftw_plan pu = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pu);
-    fftw_destroy_plan(pu);
+    for(int d = 0; d < dim; d++)
+      execute(d);
+  }
 
-    // ... for v
-    fftw_plan pv = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pv);
-    fftw_destroy_plan(pv);
+  /**
+   * Perform FFT with FFTW for velocity component @p d. This function has to be called by all
+   * processes.
+   */
+  void
+  execute(int const d)
+  {
+    int const n_y  = range_y_real[1] - range_y_real[0];
+    int const n_z  = range_z_real[1] - range_z_real[0];
+    int const n_kx = range_kx[1] - range_kx[0];
+    int const n_ky = range_ky[1] - range_ky[0];
+
+    // FFT in x-direction (real to complex)
+    if(plan_x)
+      fftw_execute_dft_r2c(plan_x, u_real[d], work_x);
+
+    // transpose x <-> y: [z][y][kx] -> [z][kx][y]
+    fftw_complex * data_y = dim == 3 ? work_y : u_comp[d];
+    transpose(comm_row,
+              P1,
+              work_x,
+              data_y,
+              n_z,
+              range_y_real,
+              N,
+              Nc,
+              [&](int const q, int * range) { get_range(Nc, P1, q, range); },
+              [&](int const q, int * range) { get_range(N, P1, q, range); },
+              n_kx);
+
+    // FFT in y-direction
+    if(plan_y)
+      fftw_execute_dft(plan_y, data_y, data_y);
 
-    // ... for w
     if(dim == 3)
     {
-      fftw_plan pw = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, FFTW_ESTIMATE);
-      fftw_execute(pw);
-      fftw_destroy_plan(pw);
+      // transpose y <-> z: [z][kx][y] -> [ky][kx][z]
+      std::vector<int> counts_send(P2), counts_recv(P2), displs_send(P2), displs_recv(P2);
+
+      int offset_send = 0, offset_recv = 0;
+      for(int q = 0; q < P2; q++)
+      {
+        int range_ky_q[2], range_z_q[2];
+        get_range(N, P2, q, range_ky_q);
+        get_range(Nz, P2, q, range_z_q);
+
+        // pack data for process q: [z][kx][ky in range_ky_q]
+        displs_send[q] = offset_send;
+        for(int z = 0; z < n_z; z++)
+          for(int kx = 0; kx < n_kx; kx++)
+            for(int ky = range_ky_q[0]; ky < range_ky_q[1]; ky++, offset_send += 2)
+            {
+              send_buffer[offset_send + 0] = work_y[(z * n_kx + kx) * N + ky][0];
+              send_buffer[offset_send + 1] = work_y[(z * n_kx + kx) * N + ky][1];
+            }
+        counts_send[q] = offset_send - displs_send[q];
+
+        displs_recv[q] = offset_recv;
+        counts_recv[q] = 2 * (range_z_q[1] - range_z_q[0]) * n_kx * n_ky;
+        offset_recv += counts_recv[q];
+      }
+
+      MPI_Alltoallv(send_buffer.data(),
+                    counts_send.data(),
+                    displs_send.data(),
+                    MPI_DOUBLE,
+                    recv_buffer.data(),
+                    counts_recv.data(),
+                    displs_recv.data(),
+                    MPI_DOUBLE,
+                    comm_col);
+
+      // unpack data of process q: [z in range_z_q][kx][ky]
+      for(int q = 0, i = 0; q < P2; q++)
+      {
+        int range_z_q[2];
+        get_range(Nz, P2, q, range_z_q);
+
+        for(int z = range_z_q[0]; z < range_z_q[1]; z++)
+          for(int kx = 0; kx < n_kx; kx++)
+            for(int ky = 0; ky < n_ky; ky++, i += 2)
+            {
+              u_comp[d][(ky * n_kx + kx) * N + z][0] = recv_buffer[i + 0];
+              u_comp[d][(ky * n_kx + kx) * N + z][1] = recv_buffer[i + 1];
+            }
+      }
+
+      // FFT in z-direction
+      if(plan_z)
+        fftw_execute_dft(plan_z, u_comp[d], u_comp[d]);
     }
   }
 
@@ -226,59 +369,30 @@ public:
     double scaling    = pow(N, dim);
     double e_physical = 0.0, e_spectral = 0.0;
 
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
-    {
-      e_physical += u_real[i] * u_real[i];
-    }
+    for(int d = 0; d < dim; d++)
+      for(int i = 0; i < n_local_points_real(); i++)
+        e_physical += u_real[d][i] * u_real[d][i];
 
     // scale: integrate cell wise...
     e_physical /= pow(N, dim);
     // ... and make to energy 0.5*u^2
     e_physical *= 0.5;
 
-    if(dim == 2)
-    {
-      for(int j = local_start; j < local_end; j++)
-      {
-        for(int i = 0; i < N; i++)
-        {
-          e_spectral += u_comp2(MIN(i, N - i), j)[0] * u_comp2(MIN(i, N - i), j)[0] +
-                        u_comp2(MIN(i, N - i), j)[1] * u_comp2(MIN(i, N - i), j)[1] +
-                        v_comp2(MIN(i, N - i), j)[0] * v_comp2(MIN(i, N - i), j)[0] +
-                        v_comp2(MIN(i, N - i), j)[1] * v_comp2(MIN(i, N - i), j)[1];
-        }
-      }
-    }
-    else if(dim == 3)
-    {
-      for(int k_ = local_start; k_ < local_end; k_++)
-      {
-        for(int j = 0; j < N; j++)
-        {
-          for(int i = 0; i < N; i++)
-          {
-            e_spectral += u_comp3(MIN(i, N - i), j, k_)[0] * u_comp3(MIN(i, N - i), j, k_)[0] +
-                          u_comp3(MIN(i, N - i), j, k_)[1] * u_comp3(MIN(i, N - i), j, k_)[1] +
-                          v_comp3(MIN(i, N - i), j, k_)[0] * v_comp3(MIN(i, N - i), j, k_)[0] +
-                          v_comp3(MIN(i, N - i), j, k_)[1] * v_comp3(MIN(i, N - i), j, k_)[1] +
-                          w_comp3(MIN(i, N - i), j, k_)[0] * w_comp3(MIN(i, N - i), j, k_)[0] +
-                          w_comp3(MIN(i, N - i), j, k_)[1] * w_comp3(MIN(i, N - i), j, k_)[1];
-          }
-        }
-      }
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("Not implemented."));
-    }
+    loop_over_modes([&](double const weight, double const, double const * u) {
+      for(int d = 0; d < dim; d++)
+        e_spectral += weight * (u[2 * d] * u[2 * d] + u[2 * d + 1] * u[2 * d + 1]);
+    });
 
     // scale: due to FFT...
     e_spectral /= scaling * scaling;
     // ... and make to energy 0.5*u^2
     e_spectral *= 0.5;
 
-    MPI_Reduce(&e_physical, &this->e_d, 1, MPI_DOUBLE, MPI_SUM, 0, comm);
-    MPI_Reduce(&e_spectral, &this->e_s, 1, MPI_DOUBLE, MPI_SUM, 0, comm);
+    double e_local[2] = {e_physical, e_spectral};
+    double e_global[2];
+    MPI_Reduce(e_local, e_global, 2, MPI_DOUBLE, MPI_SUM, 0, comm);
+    this->e_d = e_global[0];
+    this->e_s = e_global[1];
   }
 
   /**
@@ -298,56 +412,17 @@ public:
     }
 
     // collect energy for local domain...
-    if(dim == 2)
-    {
-      for(int j = local_start; j < local_end; j++)
-      {
-        for(int i = 0; i < N; i++)
-        {
-          // determine wavenumber...
-          double r = sqrt(pow(MIN(i, N - i), 2.0) + pow(MIN(j, N - j), 2.0));
-          // ... use for binning
-          int p = static_cast<int>(std::round(r));
-          // ... update energy
-          e[p] += u_comp2(MIN(i, N - i), j)[0] * u_comp2(MIN(i, N - i), j)[0] +
-                  u_comp2(MIN(i, N - i), j)[1] * u_comp2(MIN(i, N - i), j)[1] +
-                  v_comp2(MIN(i, N - i), j)[0] * v_comp2(MIN(i, N - i), j)[0] +
-                  v_comp2(MIN(i, N - i), j)[1] * v_comp2(MIN(i, N - i), j)[1];
-
-          // ... update kappa results
-          k[p] += r;
-          c[p]++;
-        }
-      }
-    }
-    else if(dim == 3)
-    {
-      for(int k_ = local_start; k_ < local_end; k_++)
-      {
-        for(int j = 0; j < N; j++)
-        {
-          for(int i = 0; i < N; i++)
-          {
-            // determine wavenumber...
-            double r =
-              sqrt(pow(MIN(i, N - i), 2.0) + pow(MIN(j, N - j), 2.0) + pow(MIN(k_, N - k_), 2.0));
-            // ... use for binning
-            int p = static_cast<int>(std::round(r));
-            // ... update energy
-            e[p] += u_comp3(MIN(i, N - i), j, k_)[0] * u_comp3(MIN(i, N - i), j, k_)[0] +
-                    u_comp3(MIN(i, N - i), j, k_)[1] * u_comp3(MIN(i, N - i), j, k_)[1] +
-                    v_comp3(MIN(i, N - i), j, k_)[0] * v_comp3(MIN(i, N - i), j, k_)[0] +
-                    v_comp3(MIN(i, N - i), j, k_)[1] * v_comp3(MIN(i, N - i), j, k_)[1] +
-                    w_comp3(MIN(i, N - i), j, k_)[0] * w_comp3(MIN(i, N - i), j, k_)[0] +
-                    w_comp3(MIN(i, N - i), j, k_)[1] * w_comp3(MIN(i, N - i), j, k_)[1];
-
-            // ... update kappa results
-            k[p] += r;
-            c[p]++;
-          }
-        }
-      }
-    }
+    loop_over_modes([&](double const weight, double const r, double const * u) {
+      // ... use wavenumber for binning
+      int p = static_cast<int>(std::round(r));
+      // ... update energy
+      for(int d = 0; d < dim; d++)
+        e[p] += weight * (u[2 * d] * u[2 * d] + u[2 * d + 1] * u[2 * d + 1]);
+
+      // ... update kappa results
+      k[p] += weight * r;
+      c[p] += weight;
+    });
 
     // ... sum up local results to global result
     MPI_Reduce(e, E, N, MPI_DOUBLE, MPI_SUM, 0, comm);
@@ -384,93 +459,146 @@ public:
     return N / 2 + 1;
   }
 
+private:
   /**
-   * Write arrays to file
-   *
-   * @param filename name of file
+   * Range [range[0], range[1]) of the entries of n entries distributed among P processes owned
+   * by process p
    */
-  void
-  serialize(char const * filename)
+  static void
+  get_range(int const n, int const P, int const p, int * range)
   {
-    int start     = local_start;
-    int end       = local_end;
-    int delta     = 2 * (N / 2 + 1) * dealii::Utilities::pow(N, dim - 2);
-    int delta_all = 2 * (N / 2 + 1) * dealii::Utilities::pow(N, dim - 1) * sizeof(double);
-
-    //
-    int        dofs = (end - start) * delta;
-    MPI_Offset disp = 8 * sizeof(int) + start * delta * sizeof(double); // bytes
+    range[0] = static_cast<int>((static_cast<long long>(n) * p) / P);
+    range[1] = static_cast<int>((static_cast<long long>(n) * (p + 1)) / P);
+  }
 
-    // create view
-    MPI_Datatype stype;
-    MPI_Type_contiguous(dofs, MPI_DOUBLE, &stype);
-    MPI_Type_commit(&stype);
+  /**
+   * Transpose the data [z][a][b] with all b and a in range_a to [z][b][a] with all a and b in
+   * the range of this process, within communicator @p comm_transpose of size @p P.
+   */
+  template<typename RangeB, typename RangeA>
+  void
+  transpose(MPI_Comm const &     comm_transpose,
+            int const            P,
+            fftw_complex const * src,
+            fftw_complex *       dst,
+            int const            n_z,
+            int const *          range_a,
+            int const            n_a_all,
+            int const            n_b_all,
+            RangeB const &       get_range_b,
+            RangeA const &       get_range_a,
+            int const            n_b)
+  {
+    int const n_a = range_a[1] - range_a[0];
 
-    // read file
-    MPI_File fh;
-    MPI_File_open(comm, filename, MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
+    std::vector<int> counts_send(P), counts_recv(P), displs_send(P), displs_recv(P);
 
-    MPI_File_set_view(fh, disp + delta_all * 0, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_write_all(fh, u_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+    int offset_send = 0, offset_recv = 0;
+    for(int q = 0; q < P; q++)
+    {
+      int range_b_q[2], range_a_q[2];
+      get_range_b(q, range_b_q);
+      get_range_a(q, range_a_q);
+
+      // pack data for process q: [z][a][b in range_b_q]
+      displs_send[q] = offset_send;
+      for(int z = 0; z < n_z; z++)
+        for(int a = 0; a < n_a; a++)
+          for(int b = range_b_q[0]; b < range_b_q[1]; b++, offset_send += 2)
+          {
+            send_buffer[offset_send + 0] = src[(z * n_a + a) * n_b_all + b][0];
+            send_buffer[offset_send + 1] = src[(z * n_a + a) * n_b_all + b][1];
+          }
+      counts_send[q] = offset_send - displs_send[q];
 
-    MPI_File_set_view(fh, disp + delta_all * 1, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_write_all(fh, v_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      displs_recv[q] = offset_recv;
+      counts_recv[q] = 2 * n_z * (range_a_q[1] - range_a_q[0]) * n_b;
+      offset_recv += counts_recv[q];
+    }
 
-    if(dim == 3)
+    MPI_Alltoallv(send_buffer.data(),
+                  counts_send.data(),
+                  displs_send.data(),
+                  MPI_DOUBLE,
+                  recv_buffer.data(),
+                  counts_recv.data(),
+                  displs_recv.data(),
+                  MPI_DOUBLE,
+                  comm_transpose);
+
+    // unpack data of process q: [z][a in range_a_q][b]
+    for(int q = 0, i = 0; q < P; q++)
     {
-      MPI_File_set_view(fh, disp + delta_all * 2, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-      MPI_File_write_all(fh, w_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-    }
+      int range_a_q[2];
+      get_range_a(q, range_a_q);
 
-    MPI_File_close(&fh);
-    MPI_Type_free(&stype);
+      for(int z = 0; z < n_z; z++)
+        for(int a = range_a_q[0]; a < range_a_q[1]; a++)
+          for(int b = 0; b < n_b; b++, i += 2)
+          {
+            dst[(z * n_b + b) * n_a_all + a][0] = recv_buffer[i + 0];
+            dst[(z * n_b + b) * n_a_all + a][1] = recv_buffer[i + 1];
+          }
+    }
   }
 
   /**
-   * Read arrays from file
-   *
-   * @param filename name of file
+   * Loop over all wave numbers owned by this process. The function @p f is called with the
+   * weight of the mode (modes with kx in (0, N/2) represent two modes of the full spectrum due
+   * to the conjugate symmetry of the real-to-complex transform), the wavenumber, and the
+   * coefficients of all velocity components.
    */
+  template<typename Function>
   void
-  deserialize(char *& filename)
+  loop_over_modes(Function const & f) const
   {
-    int start     = local_start;
-    int end       = local_end;
-    int delta     = 2 * (N / 2 + 1) * dealii::Utilities::pow(N, dim - 2);
-    int delta_all = 2 * (N / 2 + 1) * dealii::Utilities::pow(N, dim - 1) * sizeof(double);
+    int const n_kx = range_kx[1] - range_kx[0];
+    int const n_ky = range_ky[1] - range_ky[0];
 
-    //
-    int        dofs = (end - start) * delta;
-    MPI_Offset disp = 8 * sizeof(int) + start * delta * sizeof(double); // bytes
+    std::vector<double> u(2 * dim);
 
-    // create view
-    MPI_Datatype stype;
-    MPI_Type_contiguous(dofs, MPI_DOUBLE, &stype);
-    MPI_Type_commit(&stype);
+    auto const process = [&](int const kx, int const ky, int const kz, int const index) {
+      double const weight = (kx == 0 or 2 * kx == N) ? 1.0 : 2.0;
 
-    // read file
-    MPI_File fh;
-    MPI_File_open(comm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+      // determine wavenumber...
+      double const r = sqrt(pow(kx, 2.0) + pow(MIN(ky, N - ky), 2.0) + pow(MIN(kz, N - kz), 2.0));
 
-    MPI_File_set_view(fh, disp + delta_all * 0, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_read_all(fh, u_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      for(int d = 0; d < dim; d++)
+      {
+        u[2 * d]     = u_comp[d][index][0];
+        u[2 * d + 1] = u_comp[d][index][1];
+      }
 
-    MPI_File_set_view(fh, disp + delta_all * 1, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_read_all(fh, v_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      f(weight, r, u.data());
+    };
 
-    if(dim == 3)
+    if(dim == 2)
     {
-      MPI_File_set_view(fh, disp + delta_all * 2, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-      MPI_File_read_all(fh, w_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      // layout [kx][ky]
+      for(int kx = 0; kx < n_kx; kx++)
+        for(int ky = 0; ky < N; ky++)
+          process(range_kx[0] + kx, ky, 0, kx * N + ky);
+    }
+    else if(dim == 3)
+    {
+      // layout [ky][kx][kz]
+      for(int ky = 0; ky < n_ky; ky++)
+        for(int kx = 0; kx < n_kx; kx++)
+          for(int kz = 0; kz < N; kz++)
+            process(range_kx[0] + kx, range_ky[0] + ky, kz, (ky * n_kx + kx) * N + kz);
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
-
-    MPI_File_close(&fh);
-    MPI_Type_free(&stype);
   }
 
-private:
   // number of dofs in each direction
   int N;
+  // number of complex coefficients in x-direction
+  int Nc;
+  // number of dofs in z-direction (1 in 2D)
+  int Nz;
   // dimensions
   int dim;
   // rank of this process
@@ -479,33 +607,42 @@ private:
   int size;
   // bin count
   int bins;
-  // number of dofs in each direction (for FFTW)
-  ptrdiff_t * n;
-  // local row/plane range: start
-  ptrdiff_t local_start;
-  // ... end
-  ptrdiff_t local_end;
-  ptrdiff_t alloc_local;
-
-public:
-  // size of each real field
-  int bsize;
-  // real field for u
-  double * u_real;
 
-private:
-  // ... for v
-  double * v_real;
-  // ... for w
-  double * w_real;
-  // complex field for u
-  fftw_complex * u_comp;
-  // ... for v
-  fftw_complex * v_comp;
-  // ... for w
-  fftw_complex * w_comp;
+  // process grid
+  int      P1;
+  int      P2;
+  MPI_Comm comm_row;
+  MPI_Comm comm_col;
+
+  // local ranges of the x-pencils ...
+  int range_y_real[2];
+  int range_z_real[2];
+  // ... and of the wave numbers
+  int range_kx[2];
+  int range_ky[2];
+
+  // sizes of the complex arrays after the FFT in x, y, and z-direction
+  int size_x;
+  int size_y;
+  int size_z;
+
+  // persistent plans of the FFTs in x, y, and z-direction
+  fftw_plan plan_x;
+  fftw_plan plan_y;
+  fftw_plan plan_z;
+
+  // real fields of all velocity components
+  std::vector<double *> u_real;
+  // complex fields of all velocity components
+  std::vector<fftw_complex *> u_comp;
+  // intermediate results after the FFT in x- and y-direction
+  fftw_complex * work_x;
+  fftw_complex * work_y;
+
+  // buffers for the transposes
+  std::vector<double> send_buffer;
+  std::vector<double> recv_buffer;
 
-private:
   // array for locally collecting energy
   double * e;
   // ... kappa
@@ -20,12 +20,14 @@
  */
 
 // C/C++
+#include <array>
 #include <fstream>
 
 // deal.II
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/distributed/tria_base.h>
 #include <deal.II/fe/fe_values.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 // ExaDG
 #include <exadg/grid/grid_data.h>
@@ -36,6 +38,43 @@
 
 namespace ExaDG
 {
+namespace
+{
+/*
+ * Applies the matrix @p matrix of size n_out x n_in (stored row-major) to the second index of the
+ * tensor-product data @p in of size n_pre x n_in x n_post, with the first index running fastest.
+ * The result is written to @p out of size n_pre x n_out x n_post.
+ */
+template<typename Number>
+void
+apply_matrix_1d(std::vector<double> const & matrix,
+                Number const *              in,
+                Number *                    out,
+                unsigned int const          n_pre,
+                unsigned int const          n_in,
+                unsigned int const          n_out,
+                unsigned int const          n_post)
+{
+  for(unsigned int post = 0; post < n_post; ++post)
+  {
+    for(unsigned int o = 0; o < n_out; ++o)
+    {
+      Number * out_ptr = out + (post * n_out + o) * n_pre;
+      for(unsigned int pre = 0; pre < n_pre; ++pre)
+        out_ptr[pre] = Number();
+
+      for(unsigned int i = 0; i < n_in; ++i)
+      {
+        double const   m      = matrix[o * n_in + i];
+        Number const * in_ptr = in + (post * n_in + i) * n_pre;
+        for(unsigned int pre = 0; pre < n_pre; ++pre)
+          out_ptr[pre] += m * in_ptr[pre];
+      }
+    }
+  }
+}
+} // namespace
+
 template<int dim, typename Number>
 StatisticsManager<dim, Number>::StatisticsManager(
   dealii::DoFHandler<dim> const & dof_handler_velocity,
@@ -292,6 +331,17 @@ StatisticsManager<dim, Number>::setup(const std::function<double(double const &)
 
     AssertThrow(y_glob.size() == n_points_y_glob, dealii::ExcInternalError());
 
+    vel_loc.resize(dim);
+    velsq_loc.resize(dim);
+    for(unsigned int i = 0; i < dim; i++)
+    {
+      vel_loc[i].resize(n_points_y_glob);
+      velsq_loc[i].resize(n_points_y_glob);
+    }
+    veluv_loc.resize(n_points_y_glob);
+
+    setup_cell_data();
+
     create_directories(data.directory, mpi_comm);
   }
 }
@@ -306,10 +356,223 @@ StatisticsManager<dim, Number>::evaluate(VectorType const & velocity, bool const
   this->evaluate_statistics(velocity);
 }
 
+template<int dim, typename Number>
+void
+StatisticsManager<dim, Number>::setup_cell_data()
+{
+  dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+  AssertThrow(fe.n_base_elements() == 1,
+              dealii::ExcMessage("Only implemented for a single base element."));
+
+  unsigned int const n_dofs_1d     = fe.degree + 1;
+  unsigned int const n_dofs_scalar = fe.base_element(0).dofs_per_cell;
+  unsigned int const n_points_xz   = dealii::Utilities::pow(n_dofs_1d, dim - 1);
+  unsigned int const n_points_cell = n_points_xz * n_points_y_per_cell;
+  unsigned int const n_lanes       = dealii::VectorizedArray<double>::size();
+
+  // vector-valued FE where all components are explicitly listed in the dealii::DoFHandler, or
+  // scalar FE where we have several vectors referring to the same dealii::DoFHandler
+  bool const vector_valued_fe = fe.element_multiplicity(0) >= dim;
+  if(not vector_valued_fe)
+    AssertDimension(fe.element_multiplicity(0), 1);
+
+  // use the Gauss points of the 2d quadrature in x- and z-direction
+  dealii::QGauss<1> const gauss_1d(n_dofs_1d);
+
+  std::vector<dealii::Point<1>> points_y(n_points_y_per_cell);
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+    points_y[i][0] = (double)i / (n_points_y_per_cell - 1);
+  dealii::Quadrature<1> const sampling_planes(points_y,
+                                              std::vector<double>(n_points_y_per_cell, 1.0));
+
+  dealii::internal::MatrixFreeFunctions::ShapeInfo<double> const shape_info_xz(gauss_1d, fe, 0);
+  dealii::internal::MatrixFreeFunctions::ShapeInfo<double> const shape_info_y(sampling_planes,
+                                                                              fe,
+                                                                              0);
+
+  // the univariate shape values are stored with the quadrature point index running fastest
+  shape_values_xz.resize(n_dofs_1d * n_dofs_1d);
+  for(unsigned int q = 0; q < n_dofs_1d; ++q)
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+      shape_values_xz[q * n_dofs_1d + i] =
+        shape_info_xz.get_shape_data().shape_values[i * n_dofs_1d + q];
+
+  shape_values_y.resize(n_points_y_per_cell * n_dofs_1d);
+  for(unsigned int q = 0; q < n_points_y_per_cell; ++q)
+    for(unsigned int i = 0; i < n_dofs_1d; ++i)
+      shape_values_y[q * n_dofs_1d + i] =
+        shape_info_y.get_shape_data().shape_values[i * n_points_y_per_cell + q];
+
+  // The area elements are computed with the mapping once, at the same points as used by the
+  // sum-factorization kernel, i.e., the tensor product of the Gauss points in x- and
+  // z-direction and the sampling planes in y-direction.
+  std::vector<std::shared_ptr<dealii::FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
+  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  {
+    std::vector<dealii::Point<dim>> points(n_points_xz);
+    for(unsigned int j = 0; j < n_points_xz; ++j)
+    {
+      points[j][0] = gauss_1d.point(j % n_dofs_1d)[0];
+      if(dim == 3)
+        points[j][2] = gauss_1d.point(j / n_dofs_1d)[0];
+      points[j][1] = sampling_planes.point(i)[0];
+    }
+
+    fe_values[i].reset(new dealii::FEValues<dim>(mapping,
+                                                 fe.base_element(0),
+                                                 dealii::Quadrature<dim>(points),
+                                                 dealii::update_jacobians |
+                                                   dealii::update_quadrature_points));
+  }
+
+  n_filled_lanes.clear();
+  dof_indices.clear();
+  plane_indices.clear();
+  area_elements.clear();
+
+  std::vector<double> area_loc(y_glob.size());
+
+  std::vector<dealii::types::global_dof_index> dof_indices_cell(fe.dofs_per_cell);
+
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(not cell->is_locally_owned())
+      continue;
+
+    if(n_filled_lanes.empty() or n_filled_lanes.back() == n_lanes)
+    {
+      n_filled_lanes.push_back(0);
+      dof_indices.resize(n_filled_lanes.size() * n_lanes * dim * n_dofs_scalar);
+      plane_indices.resize(n_filled_lanes.size() * n_lanes * n_points_y_per_cell);
+      area_elements.resize(n_filled_lanes.size() * n_points_cell,
+                           dealii::VectorizedArray<double>(0.0));
+    }
+
+    unsigned int const batch = n_filled_lanes.size() - 1;
+    unsigned int const lane  = n_filled_lanes.back();
+
+    // dof indices in lexicographic order for all velocity components
+    cell->get_dof_indices(dof_indices_cell);
+    for(unsigned int d = 0; d < dim; ++d)
+      for(unsigned int i = 0; i < n_dofs_scalar; ++i)
+        dof_indices[((batch * n_lanes + lane) * dim + d) * n_dofs_scalar + i] =
+          dof_indices_cell[shape_info_xz.lexicographic_numbering[(vector_valued_fe ? d : 0) *
+                                                                   n_dofs_scalar +
+                                                                 i]];
+
+    // loop over all x-z-planes of current cell
+    for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+    {
+      fe_values[i]->reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
+
+      // Tranform cell index 'i' to global index 'idx' of y_glob-vector
+
+      // find index within the y-values: first do a binary search to find
+      // the next larger value of y in the list...
+      double const y = fe_values[i]->quadrature_point(0)[1];
+      // std::lower_bound: returns iterator to first element that is >= y.
+      // Note that the vector y_glob has to be sorted. As a result, the
+      // index might be too large.
+      unsigned int idx =
+        std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
+
+      // make sure that the index does not exceed the array bounds in case of round-off errors
+      if(idx == y_glob.size())
+        idx--;
+
+      // reduce index by 1 in case that the previous point is closer to y than
+      // the next point
+      if(idx > 0 and std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
+        idx--;
+
+      AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
+                  dealii::ExcMessage("Could not locate " + std::to_string(y) +
+                                     " among pre-evaluated points. Closest point is " +
+                                     std::to_string(y_glob[idx]) + " at distance " +
+                                     std::to_string(std::abs(y_glob[idx] - y)) +
+                                     ". Check transform() function given to constructor."));
+
+      plane_indices[(batch * n_lanes + lane) * n_points_y_per_cell + i] = idx;
+
+      for(unsigned int q = 0; q < n_points_xz; ++q)
+      {
+        double det = 0.;
+        if(dim == 3)
+        {
+          dealii::Tensor<2, 2> reduced_jacobian;
+          reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
+          reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
+          reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
+          reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
+          det                    = determinant(reduced_jacobian);
+        }
+        else
+        {
+          det = std::abs(fe_values[i]->jacobian(q)[0][0]);
+        }
+
+        double const area_ele = det * gauss_1d.weight(q % n_dofs_1d) *
+                                (dim == 3 ? gauss_1d.weight(q / n_dofs_1d) : 1.0);
+
+        // lexicographic index of the point (x,y,z)
+        unsigned int const point =
+          q % n_dofs_1d + n_dofs_1d * (i + n_points_y_per_cell * (q / n_dofs_1d));
+
+        area_elements[batch * n_points_cell + point][lane] = area_ele;
+        area_loc[idx] += area_ele;
+      }
+    }
+
+    ++n_filled_lanes.back();
+  }
+
+  // lanes of the last batch not filled with cells read the dofs of the first cell, their area
+  // elements are zero
+  if(not n_filled_lanes.empty())
+  {
+    unsigned int const batch = n_filled_lanes.size() - 1;
+    for(unsigned int lane = n_filled_lanes.back(); lane < n_lanes; ++lane)
+      std::copy(dof_indices.begin() + batch * n_lanes * dim * n_dofs_scalar,
+                dof_indices.begin() + (batch * n_lanes + 1) * dim * n_dofs_scalar,
+                dof_indices.begin() + (batch * n_lanes + lane) * dim * n_dofs_scalar);
+  }
+
+  area_glob.resize(y_glob.size());
+  dealii::Utilities::MPI::sum(area_loc, mpi_comm, area_glob);
+}
+
 template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::write_output()
 {
+  // accumulate data over all processors with a single reduction, and compute the values
+  // averaged over global x-z-planes (=MPI::sum(xxx_loc)/MPI::sum(area_loc)), still summed over
+  // all time samples. Averaging over time-samples is performed when writing the output.
+  unsigned int const  n_points_y_glob = y_glob.size();
+  std::vector<double> buffer((2 * dim + 1) * n_points_y_glob);
+  for(unsigned int i = 0; i < dim; i++)
+  {
+    std::copy(vel_loc[i].begin(), vel_loc[i].end(), buffer.begin() + i * n_points_y_glob);
+    std::copy(velsq_loc[i].begin(),
+              velsq_loc[i].end(),
+              buffer.begin() + (dim + i) * n_points_y_glob);
+  }
+  std::copy(veluv_loc.begin(), veluv_loc.end(), buffer.begin() + 2 * dim * n_points_y_glob);
+
+  dealii::Utilities::MPI::sum(buffer, mpi_comm, buffer);
+
+  for(unsigned int idx = 0; idx < n_points_y_glob; idx++)
+  {
+    for(unsigned int i = 0; i < dim; i++)
+      vel_glob[i][idx] = buffer[i * n_points_y_glob + idx] / area_glob[idx];
+
+    for(unsigned int i = 0; i < dim; i++)
+      velsq_glob[i][idx] = buffer[(dim + i) * n_points_y_glob + idx] / area_glob[idx];
+
+    veluv_glob[idx] = buffer[2 * dim * n_points_y_glob + idx] / area_glob[idx];
+  }
+
   std::string filename = data.directory + data.filename;
   this->do_write_output(filename, data.viscosity, data.density);
 }
@@ -326,6 +589,14 @@ StatisticsManager<dim, Number>::reset()
 
   std::fill(veluv_glob.begin(), veluv_glob.end(), 0.);
 
+  for(unsigned int i = 0; i < dim; i++)
+    std::fill(vel_loc[i].begin(), vel_loc[i].end(), 0.);
+
+  for(unsigned int i = 0; i < dim; i++)
+    std::fill(velsq_loc[i].begin(), velsq_loc[i].end(), 0.);
+
+  std::fill(veluv_loc.begin(), veluv_loc.end(), 0.);
+
   number_of_samples = 0;
 }
 
@@ -370,186 +641,105 @@ template<int dim, typename Number>
 void
 StatisticsManager<dim, Number>::do_evaluate(const std::vector<VectorType const *> & velocity)
 {
-  // Use local vectors xxx_loc in order to average/integrate over all
-  // locally owned cells of current processor.
-  std::vector<double> area_loc(vel_glob[0].size());
-
-  std::vector<std::vector<double>> vel_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    vel_loc[i].resize(vel_glob[0].size());
-
-  std::vector<std::vector<double>> velsq_loc(dim);
-  for(unsigned int i = 0; i < dim; i++)
-    velsq_loc[i].resize(vel_glob[0].size());
-
-  std::vector<double> veluv_loc(vel_glob[0].size());
-
-  // use 2d quadrature to integrate over x-z-planes
-  unsigned int const      fe_degree = dof_handler.get_fe().degree;
-  dealii::QGauss<dim - 1> gauss_2d(fe_degree + 1);
-
-  // vector of dealii::FEValues for all x-z-planes of a cell
-  std::vector<std::shared_ptr<dealii::FEValues<dim, dim>>> fe_values(n_points_y_per_cell);
-
-  for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
+  typedef dealii::VectorizedArray<double> scalar;
+
+  unsigned int const n_dofs_1d     = dof_handler.get_fe().degree + 1;
+  unsigned int const n_dofs_scalar = dealii::Utilities::pow(n_dofs_1d, dim);
+  unsigned int const n_points_z    = dealii::Utilities::pow(n_dofs_1d, dim - 2);
+  unsigned int const n_points_cell = n_dofs_1d * n_points_y_per_cell * n_points_z;
+  unsigned int const n_lanes       = scalar::size();
+
+  dealii::AlignedVector<scalar> dof_values(n_dofs_scalar), values_y(n_points_cell),
+    values_xy(n_points_cell);
+  std::vector<dealii::AlignedVector<scalar>> values(dim,
+                                                    dealii::AlignedVector<scalar>(n_points_cell));
+
+  // loop over all batches of locally owned cells and interpolate the velocity to the points on
+  // the x-z-planes by sum factorization
+  for(unsigned int batch = 0; batch < n_filled_lanes.size(); ++batch)
   {
-    std::vector<dealii::Point<dim>> points(gauss_2d.size());
-    std::vector<double>             weights(gauss_2d.size());
-    for(unsigned int j = 0; j < gauss_2d.size(); ++j)
+    for(unsigned int d = 0; d < dim; ++d)
     {
-      points[j][0] = gauss_2d.point(j)[0];
+      VectorType const & vector = *velocity[velocity.size() == 1 ? 0 : d];
+
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        dealii::types::global_dof_index const * indices =
+          dof_indices.data() + ((batch * n_lanes + v) * dim + d) * n_dofs_scalar;
+        for(unsigned int i = 0; i < n_dofs_scalar; ++i)
+          dof_values[i][v] = vector(indices[i]);
+      }
+
+      // y-direction
+      apply_matrix_1d(shape_values_y,
+                      dof_values.data(),
+                      values_y.data(),
+                      n_dofs_1d,
+                      n_dofs_1d,
+                      n_points_y_per_cell,
+                      n_points_z);
+
+      // x-direction
+      apply_matrix_1d(shape_values_xz,
+                      values_y.data(),
+                      dim == 3 ? values_xy.data() : values[d].data(),
+                      1,
+                      n_dofs_1d,
+                      n_dofs_1d,
+                      n_points_y_per_cell * n_points_z);
+
+      // z-direction
       if(dim == 3)
-        points[j][2] = gauss_2d.point(j)[1];
-      points[j][1] = (double)i / (n_points_y_per_cell - 1);
-      weights[j]   = gauss_2d.weight(j);
+        apply_matrix_1d(shape_values_xz,
+                        values_xy.data(),
+                        values[d].data(),
+                        n_dofs_1d * n_points_y_per_cell,
+                        n_dofs_1d,
+                        n_dofs_1d,
+                        1);
     }
 
-    fe_values[i].reset(new dealii::FEValues<dim>(mapping,
-                                                 dof_handler.get_fe().base_element(0),
-                                                 dealii::Quadrature<dim>(points, weights),
-                                                 dealii::update_values | dealii::update_jacobians |
-                                                   dealii::update_quadrature_points));
-  }
-
-  unsigned int const scalar_dofs_per_cell = dof_handler.get_fe().base_element(0).dofs_per_cell;
-  std::vector<dealii::Tensor<1, dim>>          velocity_vector(scalar_dofs_per_cell);
-  std::vector<dealii::types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
+    scalar const * area = area_elements.data() + batch * n_points_cell;
 
-  // loop over all cells and perform averaging/integration for all locally owned cells
-  for(auto const & cell : dof_handler.active_cell_iterators())
-  {
-    if(cell->is_locally_owned())
+    // perform integral over the x-z-planes of the cells of the current batch
+    for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
     {
-      cell->get_dof_indices(dof_indices);
+      std::array<scalar, dim> vel, velsq;
+      vel.fill(scalar(0.0));
+      velsq.fill(scalar(0.0));
+      scalar veluv = scalar(0.0);
 
-      // vector-valued FE where all components are explicitly listed in the dealii::DoFHandler
-      if(dof_handler.get_fe().element_multiplicity(0) >= dim)
+      for(unsigned int z = 0; z < n_points_z; ++z)
       {
-        for(unsigned int j = 0; j < dof_indices.size(); ++j)
+        for(unsigned int x = 0; x < n_dofs_1d; ++x)
         {
-          const std::pair<unsigned int, unsigned int> comp =
-            dof_handler.get_fe().system_to_component_index(j);
-          if(comp.first < dim)
-            velocity_vector[comp.second][comp.first] = (*velocity[0])(dof_indices[j]);
-        }
-      }
-      else // scalar FE where we have several vectors referring to the same dealii::DoFHandler
-      {
-        AssertDimension(dof_handler.get_fe().element_multiplicity(0), 1);
-        for(unsigned int j = 0; j < scalar_dofs_per_cell; ++j)
-          for(unsigned int d = 0; d < dim; ++d)
-            velocity_vector[j][d] = (*velocity[d])(dof_indices[j]);
-      }
+          unsigned int const point = x + n_dofs_1d * (i + n_points_y_per_cell * z);
 
-      // loop over all x-z-planes of current cell
-      for(unsigned int i = 0; i < n_points_y_per_cell; ++i)
-      {
-        fe_values[i]->reinit(typename dealii::Triangulation<dim>::active_cell_iterator(cell));
-
-        std::vector<double> vel(dim, 0.);
-        std::vector<double> velsq(dim, 0.);
-        double              area = 0, veluv = 0;
-
-        // perform integral over current x-z-plane of current cell
-        for(unsigned int q = 0; q < fe_values[i]->n_quadrature_points; ++q)
-        {
-          // interpolate velocity to the quadrature point
-          dealii::Tensor<1, dim> velocity;
-          for(unsigned int j = 0; j < velocity_vector.size(); ++j)
-            velocity += fe_values[i]->shape_value(j, q) * velocity_vector[j];
-
-          double det = 0.;
-          if(dim == 3)
-          {
-            dealii::Tensor<2, 2> reduced_jacobian;
-            reduced_jacobian[0][0] = fe_values[i]->jacobian(q)[0][0];
-            reduced_jacobian[0][1] = fe_values[i]->jacobian(q)[0][2];
-            reduced_jacobian[1][0] = fe_values[i]->jacobian(q)[2][0];
-            reduced_jacobian[1][1] = fe_values[i]->jacobian(q)[2][2];
-            det                    = determinant(reduced_jacobian);
-          }
-          else
+          for(unsigned int d = 0; d < dim; ++d)
           {
-            det = std::abs(fe_values[i]->jacobian(q)[0][0]);
+            vel[d] += values[d][point] * area[point];
+            velsq[d] += values[d][point] * values[d][point] * area[point];
           }
 
-          double area_ele = det * fe_values[i]->get_quadrature().weight(q);
-          area += area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            vel[i] += velocity[i] * area_ele;
-
-          for(unsigned int i = 0; i < dim; i++)
-            velsq[i] += velocity[i] * velocity[i] * area_ele;
-
-          veluv += velocity[0] * velocity[1] * area_ele;
+          veluv += values[0][point] * values[1][point] * area[point];
         }
-
-        // Tranform cell index 'i' to global index 'idx' of y_glob-vector
-
-        // find index within the y-values: first do a binary search to find
-        // the next larger value of y in the list...
-        double const y = fe_values[i]->quadrature_point(0)[1];
-        // std::lower_bound: returns iterator to first element that is >= y.
-        // Note that the vector y_glob has to be sorted. As a result, the
-        // index might be too large.
-        unsigned int idx =
-          std::distance(y_glob.begin(), std::lower_bound(y_glob.begin(), y_glob.end(), y));
-
-        // make sure that the index does not exceed the array bounds in case of round-off errors
-        if(idx == y_glob.size())
-          idx--;
-
-        // reduce index by 1 in case that the previous point is closer to y than
-        // the next point
-        if(idx > 0 and std::abs(y_glob[idx - 1] - y) < std::abs(y_glob[idx] - y))
-          idx--;
-
-        AssertThrow(std::abs(y_glob[idx] - y) < 1e-13,
-                    dealii::ExcMessage("Could not locate " + std::to_string(y) +
-                                       " among pre-evaluated points. Closest point is " +
-                                       std::to_string(y_glob[idx]) + " at distance " +
-                                       std::to_string(std::abs(y_glob[idx] - y)) +
-                                       ". Check transform() function given to constructor."));
-
-        // Add results of cellwise integral to xxx_loc vectors since we want
-        // to average/integrate over all locally owned cells.
-        for(unsigned int i = 0; i < dim; i++)
-          vel_loc[i].at(idx) += vel[i];
-
-        for(unsigned int i = 0; i < dim; i++)
-          velsq_loc[i].at(idx) += velsq[i];
-
-        veluv_loc.at(idx) += veluv;
-        area_loc.at(idx) += area;
       }
-    }
-  }
-
-  // accumulate data over all processors overwriting
-  // the processor-local data in xxx_loc since we want
-  // to average/integrate over the global x-z-plane.
-  for(unsigned int i = 0; i < dim; i++)
-    dealii::Utilities::MPI::sum(vel_loc[i], mpi_comm, vel_loc[i]);
 
-  for(unsigned int i = 0; i < dim; i++)
-    dealii::Utilities::MPI::sum(velsq_loc[i], mpi_comm, velsq_loc[i]);
-
-  dealii::Utilities::MPI::sum(veluv_loc, mpi_comm, veluv_loc);
-  dealii::Utilities::MPI::sum(area_loc, mpi_comm, area_loc);
+      // Add results of cellwise integral to xxx_loc vectors since we want
+      // to average/integrate over all locally owned cells.
+      for(unsigned int v = 0; v < n_filled_lanes[batch]; ++v)
+      {
+        unsigned int const idx = plane_indices[(batch * n_lanes + v) * n_points_y_per_cell + i];
 
-  // Add values averaged over global x-z-planes
-  // (=MPI::sum(xxx_loc)/MPI::sum(area_loc)) to xxx_glob vectors.
-  // Averaging over time-samples is performed when writing the output.
-  for(unsigned int idx = 0; idx < y_glob.size(); idx++)
-  {
-    for(unsigned int i = 0; i < dim; i++)
-      vel_glob[i].at(idx) += vel_loc[i][idx] / area_loc[idx];
+        for(unsigned int d = 0; d < dim; d++)
+          vel_loc[d][idx] += vel[d][v];
 
-    for(unsigned int i = 0; i < dim; i++)
-      velsq_glob[i].at(idx) += velsq_loc[i][idx] / area_loc[idx];
+        for(unsigned int d = 0; d < dim; d++)
+          velsq_loc[d][idx] += velsq[d][v];
 
-    veluv_glob.at(idx) += veluv_loc[idx] / area_loc[idx];
+        veluv_loc[idx] += veluv[v];
+      }
+    }
   }
 
   // increment number of samples
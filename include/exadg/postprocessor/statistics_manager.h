@@ -23,6 +23,8 @@
 #define INCLUDE_EXADG_POSTPROCESSOR_STATISTICS_MANAGER_H_
 
 // deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/vectorization.h>
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -117,6 +119,14 @@ private:
   void
   evaluate_statistics(const std::vector<VectorType> & velocity);
 
+  /*
+   * Precomputes the data needed to evaluate the statistics with a sum-factorization kernel, i.e.,
+   * the lexicographic dof indices, the indices of the sampling planes, and the area elements of
+   * the quadrature points on the sampling planes for all locally owned cells.
+   */
+  void
+  setup_cell_data();
+
   void
   do_evaluate(const std::vector<VectorType const *> & velocity);
 
@@ -130,6 +140,26 @@ private:
   // vector of y-coordinates at which statistical quantities are computed
   std::vector<double> y_glob;
 
+  // area of the global x-z-planes (for all y-coordinates)
+  std::vector<double> area_glob;
+
+  // 1D interpolation matrices (row-major) from the dofs to the Gauss points in x- and
+  // z-direction and to the sampling planes in y-direction
+  std::vector<double> shape_values_xz, shape_values_y;
+
+  // data of the locally owned cells grouped into batches of VectorizedArray<double>::size()
+  // cells, see setup_cell_data()
+  std::vector<unsigned int>                              n_filled_lanes;
+  std::vector<dealii::types::global_dof_index>           dof_indices;
+  std::vector<unsigned int>                              plane_indices;
+  dealii::AlignedVector<dealii::VectorizedArray<double>> area_elements;
+
+  // Integrals over the locally owned parts of the x-z-planes summed over all samples. Since the
+  // mesh does not change, the division by the area of the planes and the summation over all
+  // processors are deferred until the output is written.
+  std::vector<std::vector<double>> vel_loc, velsq_loc;
+  std::vector<double>              veluv_loc;
+
   // mean velocity <u_i>, i=1,...,d (for all y-coordinates)
   std::vector<std::vector<double>> vel_glob;
 
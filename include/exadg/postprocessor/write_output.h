@@ -23,7 +23,10 @@
 #define INCLUDE_EXADG_POSTPROCESSOR_WRITE_OUTPUT_H_
 
 // C/C++
+#include <algorithm>
 #include <fstream>
+#include <limits>
+#include <set>
 
 // deal.II
 #include <deal.II/base/bounding_box.h>
@@ -34,20 +37,168 @@
 #include <deal.II/particles/data_out.h>
 #include <deal.II/particles/particle_handler.h>
 
+// ExaDG
+#include <exadg/postprocessor/output_data_base.h>
+
 namespace ExaDG
 {
+/**
+ * Writes the boundary faces of the locally owned cells with the given boundary IDs, or all
+ * boundary faces if no boundary IDs are given.
+ */
+template<int dim>
+class DataOutBoundaryFaces : public dealii::DataOutFaces<dim>
+{
+public:
+  typedef typename dealii::DataOutFaces<dim>::FaceDescriptor FaceDescriptor;
+
+  DataOutBoundaryFaces(std::set<dealii::types::boundary_id> const & boundary_IDs)
+    : dealii::DataOutFaces<dim>(true /*surface only*/), boundary_IDs(boundary_IDs)
+  {
+  }
+
+  FaceDescriptor
+  first_face() override
+  {
+    for(auto const & cell : this->triangulation->active_cell_iterators())
+      if(cell->is_locally_owned())
+        for(unsigned int const f : cell->face_indices())
+          if(is_selected(cell, f))
+            return FaceDescriptor(cell, f);
+
+    return FaceDescriptor();
+  }
+
+  FaceDescriptor
+  next_face(FaceDescriptor const & face) override
+  {
+    typename dealii::Triangulation<dim>::active_cell_iterator cell = face.first;
+
+    // remaining faces of the current cell
+    for(unsigned int f = face.second + 1; f < cell->n_faces(); ++f)
+      if(is_selected(cell, f))
+        return FaceDescriptor(cell, f);
+
+    // faces of the following cells
+    for(++cell; cell != this->triangulation->end(); ++cell)
+      if(cell->is_locally_owned())
+        for(unsigned int const f : cell->face_indices())
+          if(is_selected(cell, f))
+            return FaceDescriptor(cell, f);
+
+    return FaceDescriptor();
+  }
+
+private:
+  bool
+  is_selected(typename dealii::Triangulation<dim>::active_cell_iterator const & cell,
+              unsigned int const                                                f) const
+  {
+    return cell->face(f)->at_boundary() and
+           (boundary_IDs.empty() or boundary_IDs.count(cell->face(f)->boundary_id()) > 0);
+  }
+
+  std::set<dealii::types::boundary_id> const boundary_IDs;
+};
+
+/**
+ * Returns the flags for VTU output of solution fields according to @param output_data.
+ */
+inline dealii::DataOutBase::VtkFlags
+get_vtk_flags(OutputDataBase const & output_data)
+{
+  dealii::DataOutBase::VtkFlags flags;
+  flags.write_higher_order_cells = output_data.write_higher_order;
+  flags.compression_level        = output_data.compression_level;
+
+  return flags;
+}
+
+/**
+ * Returns true if the cell is cut by one of the slices or intersects one of the boxes.
+ */
+template<int dim>
+bool
+is_cell_selected_for_output(typename dealii::Triangulation<dim>::cell_iterator const & cell,
+                            std::vector<OutputSlice> const &                           slices,
+                            std::vector<OutputBox> const &                             boxes)
+{
+  for(OutputSlice const & slice : slices)
+  {
+    double min_distance = std::numeric_limits<double>::max();
+    double max_distance = std::numeric_limits<double>::lowest();
+    for(unsigned int const v : cell->vertex_indices())
+    {
+      double distance = 0.0;
+      for(unsigned int d = 0; d < dim; ++d)
+        distance += slice.normal[d] * (cell->vertex(v)[d] - slice.point[d]);
+
+      min_distance = std::min(min_distance, distance);
+      max_distance = std::max(max_distance, distance);
+    }
+
+    if(min_distance <= 0.0 and max_distance >= 0.0)
+      return true;
+  }
+
+  for(OutputBox const & box : boxes)
+  {
+    dealii::BoundingBox<dim> const cell_box = cell->bounding_box();
+
+    bool intersects = true;
+    for(unsigned int d = 0; d < dim; ++d)
+      if(cell_box.upper_bound(d) < box.lower_corner[d] or
+         cell_box.lower_bound(d) > box.upper_corner[d])
+        intersects = false;
+
+    if(intersects)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Restricts the output of @param data_out to the locally owned cells that are cut by the slices
+ * or that intersect the boxes of @param output_data. If neither slices nor boxes are given, all
+ * locally owned cells are written.
+ */
 template<int dim>
 void
-write_surface_mesh(dealii::Triangulation<dim> const & triangulation,
-                   dealii::Mapping<dim> const &       mapping,
-                   unsigned int const                 n_subdivisions,
-                   std::string const &                folder,
-                   std::string const &                file,
-                   unsigned int const                 counter,
-                   MPI_Comm const &                   mpi_comm)
+select_cells_for_output(dealii::DataOut<dim> & data_out, OutputDataBase const & output_data)
+{
+  if(not output_data.write_reduced_output())
+    return;
+
+  for(OutputSlice const & slice : output_data.slices)
+    AssertThrow(slice.point.size() == dim and slice.normal.size() == dim,
+                dealii::ExcMessage("Output slices need a point and a normal vector of size dim."));
+
+  for(OutputBox const & box : output_data.boxes)
+    AssertThrow(box.lower_corner.size() == dim and box.upper_corner.size() == dim,
+                dealii::ExcMessage("Output boxes need two corners of size dim."));
+
+  data_out.set_cell_selection(
+    [slices = output_data.slices,
+     boxes  = output_data.boxes](typename dealii::Triangulation<dim>::cell_iterator const & cell) {
+      return cell->is_active() and cell->is_locally_owned() and
+             is_cell_selected_for_output<dim>(cell, slices, boxes);
+    });
+}
+
+template<int dim>
+void
+write_surface_mesh(dealii::Triangulation<dim> const &           triangulation,
+                   dealii::Mapping<dim> const &                 mapping,
+                   unsigned int const                           n_subdivisions,
+                   std::string const &                          folder,
+                   std::string const &                          file,
+                   unsigned int const                           counter,
+                   MPI_Comm const &                             mpi_comm,
+                   std::set<dealii::types::boundary_id> const & boundary_IDs = {})
 {
   // write surface mesh only
-  dealii::DataOutFaces<dim> data_out_surface(true /*surface only*/);
+  DataOutBoundaryFaces<dim> data_out_surface(boundary_IDs);
   data_out_surface.attach_triangulation(triangulation);
   data_out_surface.build_patches(mapping, n_subdivisions);
   data_out_surface.write_vtu_with_pvtu_record(folder, file + "_surface", counter, mpi_comm, 4);
@@ -90,6 +90,13 @@ struct MGLevelInfo
     return _dof_handler_id;
   }
 
+  bool
+  operator==(MGLevelInfo const & other) const
+  {
+    return (_h_level == other._h_level) and (_dealii_tria_level == other._dealii_tria_level) and
+           (_dof_handler_id == other._dof_handler_id);
+  }
+
 private:
   /**
    * Counter for h-level running from 0 (coarse) to n_h_levels (fine)
@@ -20,6 +20,7 @@
  */
 
 // deal.II
+#include <deal.II/base/timer.h>
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_simplex_p.h>
@@ -48,7 +49,7 @@ namespace ExaDG
 template<int dim, typename Number, typename MultigridNumber>
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::MultigridPreconditionerBase(
   MPI_Comm const & comm)
-  : mpi_comm(comm)
+  : mpi_comm(comm), timer_tree_setup(new TimerTree())
 {
 }
 
@@ -64,6 +65,8 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize(
   Map_DBC_ComponentMask const &                         dirichlet_bc_component_mask,
   bool const                                            initialize_preconditioners)
 {
+  dealii::Timer timer, sub_timer;
+
   this->data = data;
 
   this->grid = grid;
@@ -72,26 +75,66 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize(
 
   bool const is_dg = (fe.dofs_per_vertex == 0);
 
+  sub_timer.restart();
+  // in case of a re-initialization, the levels of the previous initialization are compared to the
+  // new levels in order to identify the levels that can be kept
+  std::vector<MGLevelInfo> const level_info_old = level_info;
+  std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> const level_triangulations_old =
+    level_triangulations;
+
+  level_info.clear();
+  p_levels.clear();
   this->initialize_levels(fe.degree, is_dg);
 
   this->initialize_mapping();
 
+  level_triangulations.resize(get_number_of_levels());
+  level_is_unchanged.assign(get_number_of_levels(), false);
+  for_all_levels([&](unsigned int const level) {
+    level_triangulations[level] = get_triangulation(level_info[level].h_level());
+
+    // the mappings of coarse levels are recreated in case of MappingDoFVector
+    level_is_unchanged[level] = level < level_info_old.size() and
+                                level_info[level] == level_info_old[level] and
+                                level_triangulations[level] == level_triangulations_old[level] and
+                                level_triangulations[level] != grid->triangulation and
+                                not multigrid_mappings->involves_mapping_dof_vector();
+  });
+  timer_tree_setup->insert({"Multigrid", "Levels and mappings"}, sub_timer.wall_time());
+
+  sub_timer.restart();
   this->initialize_dof_handler_and_constraints(operator_is_singular,
                                                fe.n_components(),
                                                dirichlet_bc,
                                                dirichlet_bc_component_mask);
+  timer_tree_setup->insert({"Multigrid", "DoFs and constraints"}, sub_timer.wall_time());
 
+  sub_timer.restart();
   this->initialize_matrix_free_objects();
+  timer_tree_setup->insert({"Multigrid", "MatrixFree"}, sub_timer.wall_time());
 
+  sub_timer.restart();
   this->initialize_transfer_operators();
+  timer_tree_setup->insert({"Multigrid", "Transfer operators"}, sub_timer.wall_time());
 
+  sub_timer.restart();
   this->initialize_operators();
+  timer_tree_setup->insert({"Multigrid", "Operators"}, sub_timer.wall_time());
 
+  sub_timer.restart();
   this->initialize_smoothers(initialize_preconditioners);
+  timer_tree_setup->insert({"Multigrid", "Smoothers"}, sub_timer.wall_time());
 
+  sub_timer.restart();
   this->initialize_coarse_solver(operator_is_singular, initialize_preconditioners);
+  timer_tree_setup->insert({"Multigrid", "Coarse-grid solver"}, sub_timer.wall_time());
 
   this->initialize_multigrid_algorithm();
+
+  // smoothers and coarse-grid solver of new levels might not be initialized
+  this->update_needed = true;
+
+  timer_tree_setup->insert({"Multigrid"}, timer.wall_time());
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -329,6 +372,21 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_mapping()
   multigrid_mappings->initialize_coarse_mappings(*grid, this->get_number_of_h_levels());
 }
 
+template<int dim, typename Number, typename MultigridNumber>
+std::shared_ptr<dealii::Triangulation<dim> const>
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::get_triangulation(
+  unsigned int const h_level) const
+{
+  // levels of the fine triangulation in case no separate coarse triangulations exist
+  if(h_level == level_info.back().h_level() or grid->coarse_triangulations.empty())
+    return grid->triangulation;
+
+  AssertThrow(h_level < grid->coarse_triangulations.size(),
+              dealii::ExcMessage("The vector coarse_triangulations seems to have incorrect size."));
+
+  return grid->coarse_triangulations[h_level];
+}
+
 template<int dim, typename Number, typename MultigridNumber>
 dealii::Mapping<dim> const &
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::get_mapping(
@@ -387,6 +445,10 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::
     dealii::MGLevelObject<std::shared_ptr<dealii::AffineConstraints<MultigridNumber>>> &
       constraints)
 {
+  // the objects of unchanged levels are kept
+  auto const dof_handlers_old = dof_handlers;
+  auto const constraints_old  = constraints;
+
   dealii::MGLevelObject<std::shared_ptr<dealii::MGConstrainedDoFs>> constrained_dofs;
   constrained_dofs.resize(0, get_number_of_levels() - 1);
   dof_handlers.resize(0, get_number_of_levels() - 1);
@@ -400,6 +462,13 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::
   {
     // setup dof-handler and constrained dofs for all multigrid levels
     for_all_levels([&](unsigned int const l) {
+      if(level_is_unchanged[l])
+      {
+        dof_handlers[l] = dof_handlers_old[l];
+        constraints[l]  = constraints_old[l];
+        return;
+      }
+
       auto const & level = level_info[l];
 
       std::shared_ptr<dealii::FiniteElement<dim>> fe = create_finite_element<dim>(
@@ -579,10 +648,23 @@ template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_matrix_free_objects()
 {
+  // the objects of unchanged levels are kept
+  auto const matrix_free_data_objects_old = matrix_free_data_objects;
+  auto const matrix_free_objects_old      = matrix_free_objects;
+
   matrix_free_data_objects.resize(0, get_number_of_levels() - 1);
   matrix_free_objects.resize(0, get_number_of_levels() - 1);
 
   for_all_levels([&](unsigned int const level) {
+    if(level_is_unchanged[level])
+    {
+      matrix_free_data_objects[level] = matrix_free_data_objects_old[level];
+      matrix_free_objects[level]      = matrix_free_objects_old[level];
+      return;
+    }
+
+    dealii::Timer timer;
+
     matrix_free_data_objects[level] = std::make_shared<MatrixFreeData<dim, MultigridNumber>>();
     fill_matrix_free_data(*matrix_free_data_objects[level],
                           level,
@@ -595,6 +677,9 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_matrix_fre
                                        matrix_free_data_objects[level]->get_constraint_vector(),
                                        matrix_free_data_objects[level]->get_quadrature_vector(),
                                        matrix_free_data_objects[level]->data);
+
+    timer_tree_setup->insert({"Multigrid", "MatrixFree", "Level " + std::to_string(level)},
+                             timer.wall_time());
   });
 }
 
@@ -611,10 +696,17 @@ template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_operators()
 {
+  // the operators of unchanged levels are kept
+  auto const operators_old = operators;
+
   this->operators.resize(0, this->get_number_of_levels() - 1);
 
-  for_all_levels(
-    [&](unsigned int const level) { operators[level] = this->initialize_operator(level); });
+  for_all_levels([&](unsigned int const level) {
+    if(level_is_unchanged[level])
+      operators[level] = operators_old[level];
+    else
+      operators[level] = this->initialize_operator(level);
+  });
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -639,11 +731,17 @@ void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoothers(
   bool const initialize_preconditioner)
 {
+  // the smoothers of unchanged levels are kept
+  auto const smoothers_old = smoothers;
+
   if(get_number_of_levels() >= 2)
     this->smoothers.resize(1, get_number_of_levels() - 1);
 
   for_all_smoothing_levels([&](unsigned int const level) {
-    this->initialize_smoother(*this->operators[level], level, initialize_preconditioner);
+    if(level_is_unchanged[level])
+      smoothers[level] = smoothers_old[level];
+    else
+      this->initialize_smoother(*this->operators[level], level, initialize_preconditioner);
   });
 }
 
@@ -661,6 +759,13 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::get_timings() const
   return multigrid_algorithm->get_timings();
 }
 
+template<int dim, typename Number, typename MultigridNumber>
+std::shared_ptr<TimerTree>
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::get_timings_setup() const
+{
+  return timer_tree_setup;
+}
+
 template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::vmult(VectorType &       dst,
@@ -790,6 +895,9 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_coarse_sol
   bool const operator_is_singular,
   bool const initialize_preconditioners)
 {
+  if(level_is_unchanged[0] and coarse_grid_solver.get())
+    return;
+
   Operator & coarse_operator = *operators[0];
 
   switch(data.coarse_problem.solver)
@@ -859,9 +967,10 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::do_initialize_transfe
   std::shared_ptr<MultigridTransfer<dim, MultigridNumber, VectorTypeMG>> & transfers,
   unsigned int const                                                       dof_index)
 {
-  transfers = std::make_shared<MultigridTransfer<dim, MultigridNumber, VectorTypeMG>>();
+  if(not transfers.get())
+    transfers = std::make_shared<MultigridTransfer<dim, MultigridNumber, VectorTypeMG>>();
 
-  transfers->reinit(matrix_free_objects, dof_index, level_info);
+  transfers->reinit(matrix_free_objects, dof_index, level_info, level_is_unchanged);
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -96,6 +96,15 @@ public:
 
   /*
    * Initialization function.
+   *
+   * This function may be called again after the triangulations of the grid have changed, e.g.
+   * after adaptive mesh refinement. Levels whose triangulation object is unchanged (the fine
+   * triangulation always counts as changed) keep their DoFHandlers, constraints, MatrixFree
+   * objects, operators and smoothers as well as the transfer operators between two such levels.
+   * The coarse-grid solver is kept if the coarsest level is unchanged. Since the operators might
+   * have changed in the meantime, e.g. due to a new time step size or velocity field, kept
+   * smoothers and the kept coarse-grid solver are updated in the next call to update() like all
+   * others.
    */
   void
   initialize(MultigridData const &                                 data,
@@ -136,6 +145,14 @@ public:
   std::shared_ptr<TimerTree>
   get_timings() const override;
 
+  /*
+   * Wall times of initialize(): DoF handlers and constraints, MatrixFree objects of all levels,
+   * transfer operators, operators, smoothers (including eigenvalue estimates for Chebyshev) and
+   * coarse-grid solver (including AMG setup).
+   */
+  std::shared_ptr<TimerTree>
+  get_timings_setup() const override;
+
 protected:
   /*
    * Initialization of mapping depending on multigrid transfer type. Note that the mapping needs to
@@ -267,6 +284,9 @@ protected:
 
   std::vector<MGLevelInfo> level_info;
 
+  // Levels whose data structures have been kept from the previous call to initialize()
+  std::vector<bool> level_is_unchanged;
+
 private:
   /**
    * Initializes multigrid levels according to coarsening strategy (h-/p-/hp-/ph-MG).
@@ -274,6 +294,12 @@ private:
   void
   initialize_levels(unsigned int const degree, bool const is_dg);
 
+  /*
+   * Returns the triangulation of a given h-level.
+   */
+  std::shared_ptr<dealii::Triangulation<dim> const>
+  get_triangulation(unsigned int const h_level) const;
+
   /*
    * Returns the correct mapping depending on the multigrid transfer type and the current h-level.
    */
@@ -336,11 +362,17 @@ private:
   // when needed.
   std::vector<MGDoFHandlerIdentifier> p_levels;
 
+  // triangulations of all levels, which keeps the triangulations of the previous initialization
+  // alive until they have been compared to the new ones
+  std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> level_triangulations;
+
   dealii::MGLevelObject<std::shared_ptr<Smoother>> smoothers;
 
   std::shared_ptr<CoarseGridSolverBase<Operator>> coarse_grid_solver;
 
   std::shared_ptr<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>> multigrid_algorithm;
+
+  std::shared_ptr<TimerTree> timer_tree_setup;
 };
 } // namespace ExaDG
 
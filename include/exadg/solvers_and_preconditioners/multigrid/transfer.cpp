@@ -30,14 +30,26 @@ void
 MultigridTransfer<dim, Number, VectorType>::reinit(
   dealii::MGLevelObject<std::shared_ptr<dealii::MatrixFree<dim, Number>>> & mg_matrixfree,
   unsigned int const                                                        dof_handler_index,
-  std::vector<MGLevelInfo> const &                                          global_levels)
+  std::vector<MGLevelInfo> const &                                          global_levels,
+  std::vector<bool> const &                                                 level_is_unchanged)
 {
+  // transfer-operator instances of a previous call can be kept if the number of levels is the same
+  bool const keep_transfers = mg_transfer.get() and not level_is_unchanged.empty() and
+                              transfers.n_levels() == global_levels.size();
+
+  // mg_transfer refers to the transfer-operator instances
+  mg_transfer.reset();
+
   // create transfer-operator instances
-  transfers.resize(0, global_levels.size() - 1);
+  if(not keep_transfers)
+    transfers.resize(0, global_levels.size() - 1);
 
   // fill mg_transfer with the correct transfers
   for(unsigned int i = 1; i < global_levels.size(); i++)
   {
+    if(keep_transfers and level_is_unchanged[i - 1] and level_is_unchanged[i])
+      continue;
+
     auto const coarse_level = global_levels[i - 1];
     auto const fine_level   = global_levels[i];
 
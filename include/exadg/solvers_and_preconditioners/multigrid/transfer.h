@@ -38,10 +38,16 @@ template<int dim, typename Number, typename VectorType>
 class MultigridTransfer : public MultigridTransferBase<VectorType>
 {
 public:
+  /**
+   * Sets up the transfer operators between all levels. If this function is called again, e.g.
+   * after adaptive mesh refinement, the transfer operator between two levels is kept if both levels
+   * are marked as unchanged in @param level_is_unchanged and the number of levels is the same.
+   */
   void
   reinit(dealii::MGLevelObject<std::shared_ptr<dealii::MatrixFree<dim, Number>>> & mg_matrixfree,
          unsigned int const               dof_handler_index,
-         std::vector<MGLevelInfo> const & global_levels);
+         std::vector<MGLevelInfo> const & global_levels,
+         std::vector<bool> const &        level_is_unchanged = std::vector<bool>());
 
   void
   interpolate(unsigned int const level, VectorType & dst, VectorType const & src) const final;
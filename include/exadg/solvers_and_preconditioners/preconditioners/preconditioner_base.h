@@ -62,6 +62,15 @@ public:
     return std::make_shared<TimerTree>();
   }
 
+  /*
+   * Returns the wall times of the setup of the preconditioner.
+   */
+  virtual std::shared_ptr<TimerTree>
+  get_timings_setup() const
+  {
+    return std::make_shared<TimerTree>();
+  }
+
 protected:
   bool update_needed;
 };
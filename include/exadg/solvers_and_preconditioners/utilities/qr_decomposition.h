@@ -0,0 +1,432 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_QR_DECOMPOSITION_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_QR_DECOMPOSITION_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/*
+ * Upper triangular matrix with dynamic size, stored column by column, that can be extended by a
+ * new last column and from which columns can be removed.
+ */
+template<typename Number>
+class UpperTriangularMatrix
+{
+public:
+  unsigned int
+  size() const
+  {
+    return columns.size();
+  }
+
+  Number
+  get(unsigned int const i, unsigned int const j) const
+  {
+    AssertThrow(i < size() and j < size(), dealii::ExcMessage("Index exceeds matrix dimensions."));
+
+    return (i <= j) ? columns[j][i] : Number(0.0);
+  }
+
+  void
+  set(Number const value, unsigned int const i, unsigned int const j)
+  {
+    AssertThrow(i <= j and j < size(),
+                dealii::ExcMessage("Only the upper triangular part can be set."));
+
+    columns[j][i] = value;
+  }
+
+  /*
+   * Appends a column of length size()+1, i.e., the matrix grows by one row and one column.
+   */
+  void
+  append_column(std::vector<Number> const & column)
+  {
+    AssertThrow(column.size() == size() + 1, dealii::ExcMessage("Column has wrong size."));
+
+    columns.push_back(column);
+  }
+
+  /*
+   * Removes column m. The columns following m are of upper Hessenberg form and are brought back to
+   * upper triangular form by Givens rotations, after which the last row is dropped. The rotations
+   * are returned as pairs (c, s), where rotation k acts on rows m+k and m+k+1. They have to be
+   * applied to the columns of the orthogonal factor by the caller, before removing its last column.
+   */
+  std::vector<std::pair<Number, Number>>
+  remove_column(unsigned int const m)
+  {
+    AssertThrow(m < size(), dealii::ExcMessage("Index exceeds matrix dimensions."));
+
+    columns.erase(columns.begin() + m);
+
+    unsigned int const n = size();
+
+    std::vector<std::pair<Number, Number>> rotations(n - m);
+
+    for(unsigned int i = m; i < n; ++i)
+    {
+      // zero out the sub-diagonal entry (i+1, i)
+      Number const a = columns[i][i];
+      Number const b = columns[i][i + 1];
+      Number const r = std::sqrt(a * a + b * b);
+
+      Number const c = (r > 0.0) ? a / r : Number(1.0);
+      Number const s = (r > 0.0) ? b / r : Number(0.0);
+
+      rotations[i - m] = std::make_pair(c, s);
+
+      for(unsigned int j = i; j < n; ++j)
+      {
+        Number const x = columns[j][i];
+        Number const y = columns[j][i + 1];
+        columns[j][i]     = c * x + s * y;
+        columns[j][i + 1] = -s * x + c * y;
+      }
+
+      // the last row is dropped once it has been eliminated
+      columns[i].resize(i + 1);
+    }
+
+    return rotations;
+  }
+
+  void
+  clear()
+  {
+    columns.clear();
+  }
+
+private:
+  // column j holds the entries (0, j), ..., (j, j)
+  std::deque<std::vector<Number>> columns;
+};
+
+/*
+ * Computes the inner products of all vectors in Q with the vector v using a single global
+ * reduction. If requested, the squared l2-norm of v is appended as last entry of the result.
+ */
+template<typename Number, typename ContainerType, typename VectorType>
+std::vector<Number>
+batched_inner_products(ContainerType const & Q, VectorType const & v, bool const add_norm_square)
+{
+  unsigned int const n = Q.size();
+
+  std::vector<Number> result(add_norm_square ? n + 1 : n, Number(0.0));
+
+  unsigned int const local_size = v.locally_owned_size();
+  auto const *       v_ptr      = v.begin();
+
+  for(unsigned int j = 0; j < n; ++j)
+  {
+    AssertDimension(Q[j].locally_owned_size(), local_size);
+
+    auto const * q_ptr = Q[j].begin();
+    Number       sum   = 0.0;
+    for(unsigned int i = 0; i < local_size; ++i)
+      sum += q_ptr[i] * v_ptr[i];
+    result[j] = sum;
+  }
+
+  if(add_norm_square)
+  {
+    Number sum = 0.0;
+    for(unsigned int i = 0; i < local_size; ++i)
+      sum += v_ptr[i] * v_ptr[i];
+    result[n] = sum;
+  }
+
+  if(not result.empty())
+  {
+    dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(result.data(), result.size()),
+                                v.get_mpi_communicator(),
+                                dealii::ArrayView<Number>(result.data(), result.size()));
+  }
+
+  return result;
+}
+
+/*
+ * QR decomposition of a matrix whose columns are vectors, which is updated incrementally: new
+ * columns are appended at the end by classical Gram-Schmidt with re-orthogonalization (two
+ * global reductions independently of the number of columns) and columns are removed by Givens
+ * rotations (no global reductions). Nearly linearly dependent columns are filtered, either by not
+ * inserting the new column or by removing the oldest column involved in the linear dependency.
+ *
+ * The vectors are stored in a deque so that columns are neither copied nor reallocated when the
+ * history is shifted.
+ */
+template<typename VectorType, typename Number>
+class QRDecomposition
+{
+public:
+  QRDecomposition(Number const eps = 1.e-2) : eps(eps)
+  {
+  }
+
+  unsigned int
+  size() const
+  {
+    return Q.size();
+  }
+
+  void
+  clear()
+  {
+    Q.clear();
+    R.clear();
+  }
+
+  /*
+   * Appends the column v. Returns false if v has been filtered out due to being (nearly) linearly
+   * dependent on the existing columns, in which case the decomposition remains unchanged.
+   */
+  bool
+  append_column(VectorType const & v)
+  {
+    std::vector<Number> r;
+    Number              norm_v;
+    return try_append_column(v, r, norm_v);
+  }
+
+  /*
+   * Appends the column v such that the newest information is retained: if v is (nearly) linearly
+   * dependent on the existing columns, the oldest column involved in this linear dependency is
+   * removed and the insertion is repeated. This corresponds to filtering a QR-decomposition whose
+   * columns are sorted from the newest to the oldest column. The indices of the removed columns
+   * are returned in the order of removal, each index referring to the column ordering before that
+   * removal. Returns false only if v is zero.
+   */
+  bool
+  append_column_and_filter_oldest(VectorType const & v, std::vector<unsigned int> & removed_columns)
+  {
+    removed_columns.clear();
+
+    std::vector<Number> r;
+    Number              norm_v;
+    while(not(try_append_column(v, r, norm_v)))
+    {
+      if(norm_v == 0.0 or size() == 0)
+        return false;
+
+      // coefficients c = R^{-1} Q^T v of the linear combination v = sum_j c_j a_j of the columns
+      unsigned int const  n = size();
+      std::vector<Number> c(n, 0.0);
+      for(int i = n - 1; i >= 0; --i)
+      {
+        Number value = r[i];
+        for(unsigned int j = i + 1; j < n; ++j)
+          value -= R.get(i, j) * c[j];
+        c[i] = value / R.get(i, i);
+      }
+
+      // the oldest column with a relevant contribution to v
+      unsigned int m = 0;
+      for(; m < n; ++m)
+      {
+        Number norm_a_sqr = 0.0;
+        for(unsigned int i = 0; i <= m; ++i)
+          norm_a_sqr += R.get(i, m) * R.get(i, m);
+
+        if(std::abs(c[m]) * std::sqrt(norm_a_sqr) >= eps * norm_v)
+          break;
+      }
+
+      if(m == n)
+        m = 0;
+
+      remove_column(m);
+      removed_columns.push_back(m);
+    }
+
+    return true;
+  }
+
+  /*
+   * Removes column m.
+   */
+  void
+  remove_column(unsigned int const m)
+  {
+    std::vector<std::pair<Number, Number>> const rotations = R.remove_column(m);
+
+    // apply Givens rotations to the columns of Q
+    for(unsigned int k = 0; k < rotations.size(); ++k)
+    {
+      Number const c = rotations[k].first;
+      Number const s = rotations[k].second;
+
+      unsigned int const i = m + k;
+
+      tmp = Q[i];
+      Q[i].sadd(c, s, Q[i + 1]);
+      Q[i + 1].sadd(c, -s, tmp);
+    }
+
+    // the last column of Q corresponds to the row of R that has been dropped
+    Q.pop_back();
+  }
+
+  /*
+   * Removes the first (i.e. oldest) column.
+   */
+  void
+  remove_first_column()
+  {
+    remove_column(0);
+  }
+
+  /*
+   * Computes dst = Q^T src using a single global reduction.
+   */
+  std::vector<Number>
+  apply_Q_transpose(VectorType const & src) const
+  {
+    return batched_inner_products<Number>(Q, src, false);
+  }
+
+  std::deque<VectorType> const &
+  get_Q() const
+  {
+    return Q;
+  }
+
+  UpperTriangularMatrix<Number> const &
+  get_R() const
+  {
+    return R;
+  }
+
+private:
+  /*
+   * Orthogonalizes v against the existing columns and appends it unless it is (nearly) linearly
+   * dependent on them. On return, r contains the coefficients Q^T v and norm_v the norm of v.
+   */
+  bool
+  try_append_column(VectorType const & v, std::vector<Number> & r, Number & norm_v)
+  {
+    unsigned int const n = size();
+
+    VectorType w = v;
+
+    // first pass: projection coefficients and norm of the initial vector
+    r      = batched_inner_products<Number>(Q, w, true);
+    norm_v = std::sqrt(std::max(r[n], Number(0.0)));
+    r.resize(n);
+    for(unsigned int j = 0; j < n; ++j)
+      w.add(-r[j], Q[j]);
+
+    // second pass (re-orthogonalization) to retain orthogonality in the presence of round-off
+    std::vector<Number> correction = batched_inner_products<Number>(Q, w, true);
+    Number              norm_w_sqr = correction[n];
+    for(unsigned int j = 0; j < n; ++j)
+    {
+      w.add(-correction[j], Q[j]);
+      r[j] += correction[j];
+      norm_w_sqr -= correction[j] * correction[j];
+    }
+
+    Number const r_nn = std::sqrt(std::max(norm_w_sqr, Number(0.0)));
+
+    // filter linearly dependent columns
+    if(r_nn < eps * norm_v or norm_v == 0.0)
+      return false;
+
+    w *= 1.0 / r_nn;
+    Q.push_back(std::move(w));
+
+    std::vector<Number> column = r;
+    column.push_back(r_nn);
+    R.append_column(column);
+
+    return true;
+  }
+
+  // tolerance for filtering of linearly dependent columns
+  Number const eps;
+
+  std::deque<VectorType>        Q;
+  UpperTriangularMatrix<Number> R;
+
+  // temporary vector for the Givens rotations, kept to avoid reallocation
+  VectorType tmp;
+};
+
+/*
+ *  Matrix has to be upper triangular with d_ii != 0 for all 0 <= i < n
+ */
+template<typename MatrixType, typename Number>
+void
+backward_substitution(MatrixType const &          matrix,
+                      std::vector<Number> &       dst,
+                      std::vector<Number> const & rhs)
+{
+  int const n = dst.size();
+
+  for(int i = n - 1; i >= 0; --i)
+  {
+    double value = rhs[i];
+    for(int j = i + 1; j < n; ++j)
+    {
+      value -= matrix.get(i, j) * dst[j];
+    }
+
+    dst[i] = value / matrix.get(i, i);
+  }
+}
+
+/*
+ *  Solves matrix * X = B for multiple right-hand sides, where the vectors of B are overwritten by
+ *  the solution X. Matrix has to be upper triangular with d_ii != 0 for all 0 <= i < n.
+ */
+template<typename MatrixType, typename VectorType>
+void
+backward_substitution_in_place(MatrixType const & matrix, std::vector<VectorType> & rhs_and_dst)
+{
+  int const n = rhs_and_dst.size();
+
+  for(int i = n - 1; i >= 0; --i)
+  {
+    for(int j = i + 1; j < n; ++j)
+    {
+      rhs_and_dst[i].add(-matrix.get(i, j), rhs_and_dst[j]);
+    }
+
+    rhs_and_dst[i] *= 1.0 / matrix.get(i, i);
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_UTILITIES_QR_DECOMPOSITION_H_ */
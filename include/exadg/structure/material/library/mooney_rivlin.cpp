@@ -0,0 +1,152 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <cmath>
+
+// ExaDG
+#include <exadg/structure/material/library/mooney_rivlin.h>
+#include <exadg/structure/spatial_discretization/operators/continuum_mechanics.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim, typename Number>
+MooneyRivlin<dim, Number>::MooneyRivlin(MooneyRivlinData const & data,
+                                        bool const               large_deformation)
+  : large_deformation(large_deformation), c1(data.c1), c2(data.c2), lambda(data.lambda)
+{
+  AssertThrow(dim == 3 or data.type_two_dim == Type2D::PlaneStrain,
+              dealii::ExcMessage("MooneyRivlin material is only implemented for plane strain."));
+
+  d = 2. * c1 + 4. * c2;
+}
+
+template<int dim, typename Number>
+typename MooneyRivlin<dim, Number>::tensor
+MooneyRivlin<dim, Number>::stress(tensor const &     gradient_displacement,
+                                  unsigned int const cell,
+                                  unsigned int const q) const
+{
+  (void)cell;
+  (void)q;
+
+  if(large_deformation)
+  {
+    tensor const F     = get_F<dim, Number>(gradient_displacement);
+    tensor const C     = transpose(F) * F;
+    tensor const C_inv = invert(C);
+    scalar const log_J = std::log(determinant(F));
+
+    // first invariant of the three-dimensional tensor C (with C_33 = 1 for plane strain)
+    scalar const I_1 = trace(C) + Number(3 - dim);
+
+    // S = (2 c1 + 2 c2 I_1) I - 2 c2 C + (lambda ln(J) - d) C^{-1}
+    tensor       S        = (-2. * c2) * C + (lambda * log_J - d) * C_inv;
+    scalar const diagonal = 2. * c1 + (2. * c2) * I_1;
+    for(unsigned int i = 0; i < dim; ++i)
+      S[i][i] = S[i][i] + diagonal;
+
+    return S;
+  }
+  else
+  {
+    // S = (lambda + 4 c2) tr(E) I + 4 (c1 + c2) E with the linearized strain E
+    tensor S = (2. * (c1 + c2)) * (gradient_displacement + transpose(gradient_displacement));
+
+    scalar const lambda_tr_E = (lambda + 4. * c2) * trace(gradient_displacement);
+    for(unsigned int i = 0; i < dim; ++i)
+      S[i][i] = S[i][i] + lambda_tr_E;
+
+    return S;
+  }
+}
+
+template<int dim, typename Number>
+typename MooneyRivlin<dim, Number>::tensor
+MooneyRivlin<dim, Number>::stress_displacement_derivative(tensor const &     gradient_increment,
+                                                          tensor const &     deformation_gradient,
+                                                          unsigned int const cell,
+                                                          unsigned int const q) const
+{
+  if(not large_deformation)
+    return stress(gradient_increment, cell, q);
+
+  tensor const C_inv = invert(transpose(deformation_gradient) * deformation_gradient);
+  scalar const log_J = std::log(determinant(deformation_gradient));
+
+  // symmetric increment of the Green-Lagrange strain tensor
+  tensor const F_T_delta = transpose(deformation_gradient) * gradient_increment;
+  tensor const delta_E   = 0.5 * (F_T_delta + transpose(F_T_delta));
+
+  // delta S = 4 c2 (tr(delta E) I - delta E) + lambda (C^{-1} : delta E) C^{-1}
+  //           + 2 (d - lambda ln(J)) C^{-1} delta E C^{-1}
+  tensor delta_S = (lambda * scalar_product(C_inv, delta_E)) * C_inv +
+                   (2.0 * (d - lambda * log_J)) * (C_inv * delta_E * C_inv) -
+                   (4. * c2) * delta_E;
+
+  scalar const tr_delta_E = (4. * c2) * trace(delta_E);
+  for(unsigned int i = 0; i < dim; ++i)
+    delta_S[i][i] = delta_S[i][i] + tr_delta_E;
+
+  return delta_S;
+}
+
+template<int dim, typename Number>
+CompactTangent<dim, Number>
+MooneyRivlin<dim, Number>::tangent(tensor const &     deformation_gradient,
+                                   unsigned int const cell,
+                                   unsigned int const q) const
+{
+  (void)cell;
+  (void)q;
+
+  CompactTangent<dim, Number> tangent;
+
+  if(large_deformation)
+  {
+    scalar const log_J = std::log(determinant(deformation_gradient));
+
+    tangent.a                = 4.0 * c2;
+    tangent.b                = -4.0 * c2;
+    tangent.c                = lambda;
+    tangent.d                = 2.0 * (d - lambda * log_J);
+    tangent.C_inv            = invert(transpose(deformation_gradient) * deformation_gradient);
+    tangent.depends_on_C_inv = true;
+  }
+  else
+  {
+    tangent.a = lambda + 4.0 * c2;
+    tangent.b = 4.0 * (c1 + c2);
+  }
+
+  return tangent;
+}
+
+template class MooneyRivlin<2, float>;
+template class MooneyRivlin<2, double>;
+
+template class MooneyRivlin<3, float>;
+template class MooneyRivlin<3, double>;
+
+} // namespace Structure
+} // namespace ExaDG
@@ -0,0 +1,99 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_STRUCTURE_MATERIAL_LIBRARY_MOONEY_RIVLIN_H_
+#define INCLUDE_EXADG_STRUCTURE_MATERIAL_LIBRARY_MOONEY_RIVLIN_H_
+
+// ExaDG
+#include <exadg/structure/material/material.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+struct MooneyRivlinData : public MaterialData
+{
+  MooneyRivlinData(MaterialType const & type,
+                   double const &       c1,
+                   double const &       c2,
+                   double const &       lambda,
+                   Type2D const &       type_two_dim)
+    : MaterialData(type), c1(c1), c2(c2), lambda(lambda), type_two_dim(type_two_dim)
+  {
+  }
+
+  double c1;
+  double c2;
+  double lambda;
+  Type2D type_two_dim;
+};
+
+/*
+ * Compressible Mooney-Rivlin material with strain energy density
+ *
+ *  W = c1 (I_1 - 3) + c2 (I_2 - 3) - d ln(J) + lambda/2 (ln(J))^2 ,  d = 2 c1 + 4 c2 ,
+ *
+ * with the invariants I_1, I_2 of the right Cauchy-Green tensor C = F^T * F and J = det(F). The
+ * 2nd Piola-Kirchhoff stress tensor is
+ *
+ *  S = 2 c1 I + 2 c2 (I_1 I - C) + (lambda ln(J) - d) C^{-1} .
+ *
+ * For c2 = 0, the model reduces to the compressible Neo-Hookean model with mu = 2 c1. For small
+ * deformations, the model reduces to linear elasticity with the Lamee parameters
+ * lambda + 4 c2 and mu = 2 (c1 + c2). In two dimensions, only plane strain is supported.
+ */
+template<int dim, typename Number>
+class MooneyRivlin : public MaterialKernel<dim, Number, MooneyRivlin<dim, Number>>
+{
+public:
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  MooneyRivlin(MooneyRivlinData const & data, bool const large_deformation);
+
+  /*
+   * Quadrature point kernels, see MaterialKernel.
+   */
+  tensor
+  stress(tensor const & gradient_displacement, unsigned int const cell, unsigned int const q) const;
+
+  tensor
+  stress_displacement_derivative(tensor const &     gradient_increment,
+                                 tensor const &     deformation_gradient,
+                                 unsigned int const cell,
+                                 unsigned int const q) const;
+
+  CompactTangent<dim, Number>
+  tangent(tensor const & deformation_gradient, unsigned int const cell, unsigned int const q) const;
+
+private:
+  bool large_deformation;
+
+  Number c1;
+  Number c2;
+  Number d;
+  Number lambda;
+};
+
+} // namespace Structure
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_STRUCTURE_MATERIAL_LIBRARY_MOONEY_RIVLIN_H_ */
@@ -0,0 +1,140 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <cmath>
+
+// ExaDG
+#include <exadg/structure/material/library/neo_hookean.h>
+#include <exadg/structure/spatial_discretization/operators/continuum_mechanics.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+template<int dim, typename Number>
+NeoHookean<dim, Number>::NeoHookean(NeoHookeanData const & data, bool const large_deformation)
+  : large_deformation(large_deformation)
+{
+  AssertThrow(dim == 3 or data.type_two_dim == Type2D::PlaneStrain,
+              dealii::ExcMessage("NeoHookean material is only implemented for plane strain."));
+
+  Number const E  = data.E;
+  Number const nu = data.nu;
+
+  lambda = E * nu / ((1. + nu) * (1. - 2. * nu));
+  mu     = E / (2. * (1. + nu));
+}
+
+template<int dim, typename Number>
+typename NeoHookean<dim, Number>::tensor
+NeoHookean<dim, Number>::stress(tensor const &     gradient_displacement,
+                                unsigned int const cell,
+                                unsigned int const q) const
+{
+  (void)cell;
+  (void)q;
+
+  if(large_deformation)
+  {
+    tensor const F     = get_F<dim, Number>(gradient_displacement);
+    tensor const C_inv = invert(transpose(F) * F);
+    scalar const log_J = std::log(determinant(F));
+
+    // S = mu I + (lambda ln(J) - mu) C^{-1}
+    tensor S = (lambda * log_J - mu) * C_inv;
+    for(unsigned int i = 0; i < dim; ++i)
+      S[i][i] = S[i][i] + mu;
+
+    return S;
+  }
+  else
+  {
+    // S = lambda tr(E) I + 2 mu E with the linearized strain E
+    tensor S = mu * (gradient_displacement + transpose(gradient_displacement));
+
+    scalar const lambda_tr_E = lambda * trace(gradient_displacement);
+    for(unsigned int i = 0; i < dim; ++i)
+      S[i][i] = S[i][i] + lambda_tr_E;
+
+    return S;
+  }
+}
+
+template<int dim, typename Number>
+typename NeoHookean<dim, Number>::tensor
+NeoHookean<dim, Number>::stress_displacement_derivative(tensor const &     gradient_increment,
+                                                        tensor const &     deformation_gradient,
+                                                        unsigned int const cell,
+                                                        unsigned int const q) const
+{
+  if(not large_deformation)
+    return stress(gradient_increment, cell, q);
+
+  tensor const C_inv = invert(transpose(deformation_gradient) * deformation_gradient);
+  scalar const log_J = std::log(determinant(deformation_gradient));
+
+  // symmetric increment of the Green-Lagrange strain tensor
+  tensor const F_T_delta = transpose(deformation_gradient) * gradient_increment;
+  tensor const delta_E   = 0.5 * (F_T_delta + transpose(F_T_delta));
+
+  // delta S = lambda (C^{-1} : delta E) C^{-1} + 2 (mu - lambda ln(J)) C^{-1} delta E C^{-1}
+  return (lambda * scalar_product(C_inv, delta_E)) * C_inv +
+         (2.0 * (mu - lambda * log_J)) * (C_inv * delta_E * C_inv);
+}
+
+template<int dim, typename Number>
+CompactTangent<dim, Number>
+NeoHookean<dim, Number>::tangent(tensor const &     deformation_gradient,
+                                 unsigned int const cell,
+                                 unsigned int const q) const
+{
+  (void)cell;
+  (void)q;
+
+  CompactTangent<dim, Number> tangent;
+
+  if(large_deformation)
+  {
+    scalar const log_J = std::log(determinant(deformation_gradient));
+
+    tangent.c                = lambda;
+    tangent.d                = 2.0 * (mu - lambda * log_J);
+    tangent.C_inv            = invert(transpose(deformation_gradient) * deformation_gradient);
+    tangent.depends_on_C_inv = true;
+  }
+  else
+  {
+    tangent.a = lambda;
+    tangent.b = 2.0 * mu;
+  }
+
+  return tangent;
+}
+
+template class NeoHookean<2, float>;
+template class NeoHookean<2, double>;
+
+template class NeoHookean<3, float>;
+template class NeoHookean<3, double>;
+
+} // namespace Structure
+} // namespace ExaDG
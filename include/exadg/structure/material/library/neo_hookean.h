@@ -0,0 +1,94 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_STRUCTURE_MATERIAL_LIBRARY_NEO_HOOKEAN_H_
+#define INCLUDE_EXADG_STRUCTURE_MATERIAL_LIBRARY_NEO_HOOKEAN_H_
+
+// ExaDG
+#include <exadg/structure/material/material.h>
+
+namespace ExaDG
+{
+namespace Structure
+{
+struct NeoHookeanData : public MaterialData
+{
+  NeoHookeanData(MaterialType const & type,
+                 double const &       E,
+                 double const &       nu,
+                 Type2D const &       type_two_dim)
+    : MaterialData(type), E(E), nu(nu), type_two_dim(type_two_dim)
+  {
+  }
+
+  double E;
+  double nu;
+  Type2D type_two_dim;
+};
+
+/*
+ * Compressible Neo-Hookean material with strain energy density
+ *
+ *  W = mu/2 (I_1 - 3) - mu ln(J) + lambda/2 (ln(J))^2 ,
+ *
+ * with the first invariant I_1 = tr(C) of the right Cauchy-Green tensor C = F^T * F, J = det(F),
+ * and the Lamee parameters lambda and mu. The 2nd Piola-Kirchhoff stress tensor is
+ *
+ *  S = mu (I - C^{-1}) + lambda ln(J) C^{-1} .
+ *
+ * For small deformations, the model reduces to linear elasticity with the same Lamee parameters.
+ * In two dimensions, only plane strain is supported.
+ */
+template<int dim, typename Number>
+class NeoHookean : public MaterialKernel<dim, Number, NeoHookean<dim, Number>>
+{
+public:
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  NeoHookean(NeoHookeanData const & data, bool const large_deformation);
+
+  /*
+   * Quadrature point kernels, see MaterialKernel.
+   */
+  tensor
+  stress(tensor const & gradient_displacement, unsigned int const cell, unsigned int const q) const;
+
+  tensor
+  stress_displacement_derivative(tensor const &     gradient_increment,
+                                 tensor const &     deformation_gradient,
+                                 unsigned int const cell,
+                                 unsigned int const q) const;
+
+  CompactTangent<dim, Number>
+  tangent(tensor const & deformation_gradient, unsigned int const cell, unsigned int const q) const;
+
+private:
+  bool large_deformation;
+
+  Number lambda;
+  Number mu;
+};
+
+} // namespace Structure
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_STRUCTURE_MATERIAL_LIBRARY_NEO_HOOKEAN_H_ */
@@ -148,30 +148,32 @@ StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress_symmetrize(
 {
   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> S;
 
+  // local copies of the factors, since this function may be called by several threads
+  dealii::VectorizedArray<Number> f0_q = f0, f1_q = f1, f2_q = f2;
   if(E_is_variable)
   {
-    f0 = f0_coefficients.get_coefficient_cell(cell, q);
-    f1 = f1_coefficients.get_coefficient_cell(cell, q);
-    f2 = f2_coefficients.get_coefficient_cell(cell, q);
+    f0_q = f0_coefficients.get_coefficient_cell(cell, q);
+    f1_q = f1_coefficients.get_coefficient_cell(cell, q);
+    f2_q = f2_coefficients.get_coefficient_cell(cell, q);
   }
 
   if(dim == 3)
   {
-    S[0][0] = f0 * strain[0][0] + f1 * (strain[1][1] + strain[2][2]);
-    S[1][1] = f0 * strain[1][1] + f1 * (strain[0][0] + strain[2][2]);
-    S[2][2] = f0 * strain[2][2] + f1 * (strain[0][0] + strain[1][1]);
-    S[0][1] = f2 * (strain[0][1] + strain[1][0]);
-    S[1][2] = f2 * (strain[1][2] + strain[2][1]);
-    S[0][2] = f2 * (strain[0][2] + strain[2][0]);
+    S[0][0] = f0_q * strain[0][0] + f1_q * (strain[1][1] + strain[2][2]);
+    S[1][1] = f0_q * strain[1][1] + f1_q * (strain[0][0] + strain[2][2]);
+    S[2][2] = f0_q * strain[2][2] + f1_q * (strain[0][0] + strain[1][1]);
+    S[0][1] = f2_q * (strain[0][1] + strain[1][0]);
+    S[1][2] = f2_q * (strain[1][2] + strain[2][1]);
+    S[0][2] = f2_q * (strain[0][2] + strain[2][0]);
     S[1][0] = S[0][1];
     S[2][1] = S[1][2];
     S[2][0] = S[0][2];
   }
   else
   {
-    S[0][0] = f0 * strain[0][0] + f1 * strain[1][1];
-    S[1][1] = f1 * strain[0][0] + f0 * strain[1][1];
-    S[0][1] = f2 * (strain[0][1] + strain[1][0]);
+    S[0][0] = f0_q * strain[0][0] + f1_q * strain[1][1];
+    S[1][1] = f1_q * strain[0][0] + f0_q * strain[1][1];
+    S[0][1] = f2_q * (strain[0][1] + strain[1][0]);
     S[1][0] = S[0][1];
   }
 
@@ -180,7 +182,7 @@ StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress_symmetrize(
 
 template<int dim, typename Number>
 dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
-StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress(
+StVenantKirchhoff<dim, Number>::stress(
   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
   unsigned int const                                              cell,
   unsigned int const                                              q) const
@@ -198,7 +200,7 @@ StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress(
 
 template<int dim, typename Number>
 dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
-StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress_displacement_derivative(
+StVenantKirchhoff<dim, Number>::stress_displacement_derivative(
   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
   unsigned int const                                              cell,
@@ -210,6 +212,24 @@ StVenantKirchhoff<dim, Number>::second_piola_kirchhoff_stress_displacement_deriv
     transpose(deformation_gradient) * gradient_increment, cell, q));
 }
 
+template<int dim, typename Number>
+CompactTangent<dim, Number>
+StVenantKirchhoff<dim, Number>::tangent(
+  dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+  unsigned int const                                              cell,
+  unsigned int const                                              q) const
+{
+  (void)deformation_gradient;
+
+  // The tangent is the constant elasticity tensor: Sii = f0 * Eii + f1 * sum_{j != i} Ejj gives
+  // a = f1 and b = f0 - f1 = 2 * f2 for the symmetric strain increment.
+  CompactTangent<dim, Number> tangent;
+  tangent.a = E_is_variable ? f1_coefficients.get_coefficient_cell(cell, q) : f1;
+  tangent.b = 2.0 * (E_is_variable ? f2_coefficients.get_coefficient_cell(cell, q) : f2);
+
+  return tangent;
+}
+
 template class StVenantKirchhoff<2, float>;
 template class StVenantKirchhoff<2, double>;
 
@@ -56,7 +56,7 @@ struct StVenantKirchhoffData : public MaterialData
 };
 
 template<int dim, typename Number>
-class StVenantKirchhoff : public Material<dim, Number>
+class StVenantKirchhoff : public MaterialKernel<dim, Number, StVenantKirchhoff<dim, Number>>
 {
 public:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
@@ -69,18 +69,25 @@ public:
                     StVenantKirchhoffData<dim> const &      data,
                     bool const                              large_deformation);
 
+  /*
+   * Quadrature point kernels, see MaterialKernel.
+   */
   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
-  second_piola_kirchhoff_stress(
-    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
-    unsigned int const                                              cell,
-    unsigned int const                                              q) const final;
+  stress(dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
+         unsigned int const                                              cell,
+         unsigned int const                                              q) const;
 
   dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
-  second_piola_kirchhoff_stress_displacement_derivative(
+  stress_displacement_derivative(
     dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
     dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
     unsigned int const                                              cell,
-    unsigned int const                                              q) const final;
+    unsigned int const                                              q) const;
+
+  CompactTangent<dim, Number>
+  tangent(dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
+          unsigned int const                                              cell,
+          unsigned int const                                              q) const;
 
 private:
   /*
@@ -125,9 +132,9 @@ private:
 
   bool large_deformation;
 
-  mutable dealii::VectorizedArray<Number> f0;
-  mutable dealii::VectorizedArray<Number> f1;
-  mutable dealii::VectorizedArray<Number> f2;
+  dealii::VectorizedArray<Number> f0;
+  dealii::VectorizedArray<Number> f1;
+  dealii::VectorizedArray<Number> f2;
 
   // cache coefficients for spatially varying material parameters
   bool                                                          E_is_variable;
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_STRUCTURE_MATERIAL_MATERIAL_H_
 
 // deal.II
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/vectorization.h>
 
@@ -33,10 +34,61 @@ namespace ExaDG
 {
 namespace Structure
 {
+/*
+ * Tangent of a material at the point of linearization in the compact form
+ *
+ *  delta S = a tr(delta E) I + b delta E + c (C^{-1} : delta E) C^{-1} + d C^{-1} delta E C^{-1} ,
+ *
+ * with the increment delta E = sym(F^T Grad(delta d)) of the Green-Lagrange strain tensor and the
+ * inverse C^{-1} of the right Cauchy-Green tensor at the point of linearization. The coefficients
+ * a, b, c, d may vary between quadrature points. The terms involving C^{-1} are only evaluated if
+ * depends_on_C_inv is true.
+ */
+template<int dim, typename Number>
+struct CompactTangent
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+  typedef dealii::Tensor<2, dim, scalar>  tensor;
+
+  CompactTangent()
+    : a(dealii::make_vectorized_array<Number>(0.0)),
+      b(dealii::make_vectorized_array<Number>(0.0)),
+      c(dealii::make_vectorized_array<Number>(0.0)),
+      d(dealii::make_vectorized_array<Number>(0.0)),
+      depends_on_C_inv(false)
+  {
+  }
+
+  /*
+   * Returns the increment of the 2nd Piola-Kirchhoff stress tensor for the (symmetric) increment
+   * "delta_E" of the Green-Lagrange strain tensor.
+   */
+  tensor
+  apply(tensor const & delta_E) const
+  {
+    tensor delta_S = b * delta_E;
+
+    scalar const a_tr_delta_E = a * trace(delta_E);
+    for(unsigned int i = 0; i < dim; ++i)
+      delta_S[i][i] += a_tr_delta_E;
+
+    if(depends_on_C_inv)
+      delta_S += (c * scalar_product(C_inv, delta_E)) * C_inv + d * (C_inv * delta_E * C_inv);
+
+    return delta_S;
+  }
+
+  scalar a, b, c, d;
+  tensor C_inv;
+  bool   depends_on_C_inv;
+};
+
 template<int dim, typename Number>
 class Material
 {
 public:
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
   virtual ~Material()
   {
   }
@@ -45,11 +97,10 @@ public:
    * Evaluate 2nd Piola-Kirchhoff stress tensor given the gradient of the displacement field
    * with respect to the reference configuration (not to be confused with the deformation gradient).
    */
-  virtual dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
-  second_piola_kirchhoff_stress(
-    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_displacement,
-    unsigned int const                                              cell,
-    unsigned int const                                              q) const = 0;
+  virtual tensor
+  second_piola_kirchhoff_stress(tensor const &     gradient_displacement,
+                                unsigned int const cell,
+                                unsigned int const q) const = 0;
 
   /*
    * Evaluate the directional derivative with respect to the displacement of the 2nd Piola-Kirchhoff
@@ -57,12 +108,127 @@ public:
    * configuration "gradient_increment" and deformation gradient at the current linearization point
    * "deformation_gradient".
    */
-  virtual dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+  virtual tensor
+  second_piola_kirchhoff_stress_displacement_derivative(tensor const &     gradient_increment,
+                                                        tensor const &     deformation_gradient,
+                                                        unsigned int const cell,
+                                                        unsigned int const q) const = 0;
+
+  /*
+   * Same as above, but evaluated for all quadrature points of the cell batch "cell" at once. The
+   * index of the array views is the quadrature point index. Operators should prefer these
+   * functions, which require only one virtual function call per cell batch.
+   */
+  virtual void
+  second_piola_kirchhoff_stress(dealii::ArrayView<tensor> const &       stress,
+                                dealii::ArrayView<tensor const> const & gradient_displacement,
+                                unsigned int const                      cell) const = 0;
+
+  virtual void
   second_piola_kirchhoff_stress_displacement_derivative(
-    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & gradient_increment,
-    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> const & deformation_gradient,
-    unsigned int const                                              cell,
-    unsigned int const                                              q) const = 0;
+    dealii::ArrayView<tensor> const &       stress_derivative,
+    dealii::ArrayView<tensor const> const & gradient_increment,
+    dealii::ArrayView<tensor const> const & deformation_gradient,
+    unsigned int const                      cell) const = 0;
+
+  /*
+   * Returns the tangent in the compact form of CompactTangent given the deformation gradient at
+   * the current linearization point "deformation_gradient". Operators that store the point of
+   * linearization in the quadrature points store this tangent as well. They apply it instead of
+   * calling second_piola_kirchhoff_stress_displacement_derivative() in every operator evaluation.
+   */
+  virtual CompactTangent<dim, Number>
+  compact_tangent(tensor const &     deformation_gradient,
+                  unsigned int const cell,
+                  unsigned int const q) const = 0;
+};
+
+/*
+ * Implements the interface of Material for a material model "Kernel" that provides the
+ * (non-virtual) functions
+ *
+ *  tensor stress(tensor const & gradient_displacement, unsigned int cell, unsigned int q) const
+ *
+ *  tensor stress_displacement_derivative(tensor const & gradient_increment,
+ *                                        tensor const & deformation_gradient,
+ *                                        unsigned int cell, unsigned int q) const
+ *
+ *  CompactTangent<dim, Number> tangent(tensor const & deformation_gradient,
+ *                                      unsigned int cell, unsigned int q) const
+ *
+ * Since the type of the material model is known at compile time, the quadrature point kernels are
+ * inlined into the loops over all quadrature points of a cell batch.
+ */
+template<int dim, typename Number, typename Kernel>
+class MaterialKernel : public Material<dim, Number>
+{
+public:
+  typedef typename Material<dim, Number>::tensor tensor;
+
+  tensor
+  second_piola_kirchhoff_stress(tensor const &     gradient_displacement,
+                                unsigned int const cell,
+                                unsigned int const q) const final
+  {
+    return kernel().stress(gradient_displacement, cell, q);
+  }
+
+  tensor
+  second_piola_kirchhoff_stress_displacement_derivative(tensor const &     gradient_increment,
+                                                        tensor const &     deformation_gradient,
+                                                        unsigned int const cell,
+                                                        unsigned int const q) const final
+  {
+    return kernel().stress_displacement_derivative(gradient_increment,
+                                                   deformation_gradient,
+                                                   cell,
+                                                   q);
+  }
+
+  void
+  second_piola_kirchhoff_stress(dealii::ArrayView<tensor> const &       stress,
+                                dealii::ArrayView<tensor const> const & gradient_displacement,
+                                unsigned int const                      cell) const final
+  {
+    AssertDimension(stress.size(), gradient_displacement.size());
+
+    Kernel const & kernel = this->kernel();
+    for(unsigned int q = 0; q < stress.size(); ++q)
+      stress[q] = kernel.stress(gradient_displacement[q], cell, q);
+  }
+
+  void
+  second_piola_kirchhoff_stress_displacement_derivative(
+    dealii::ArrayView<tensor> const &       stress_derivative,
+    dealii::ArrayView<tensor const> const & gradient_increment,
+    dealii::ArrayView<tensor const> const & deformation_gradient,
+    unsigned int const                      cell) const final
+  {
+    AssertDimension(stress_derivative.size(), gradient_increment.size());
+    AssertDimension(stress_derivative.size(), deformation_gradient.size());
+
+    Kernel const & kernel = this->kernel();
+    for(unsigned int q = 0; q < stress_derivative.size(); ++q)
+      stress_derivative[q] = kernel.stress_displacement_derivative(gradient_increment[q],
+                                                                   deformation_gradient[q],
+                                                                   cell,
+                                                                   q);
+  }
+
+  CompactTangent<dim, Number>
+  compact_tangent(tensor const &     deformation_gradient,
+                  unsigned int const cell,
+                  unsigned int const q) const final
+  {
+    return kernel().tangent(deformation_gradient, cell, q);
+  }
+
+private:
+  Kernel const &
+  kernel() const
+  {
+    return static_cast<Kernel const &>(*this);
+  }
 };
 
 } // namespace Structure
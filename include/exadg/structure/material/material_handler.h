@@ -23,9 +23,12 @@
 #define INCLUDE_EXADG_STRUCTURE_MATERIAL_MATERIAL_HANDLER_H_
 
 // deal.II
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
+#include <exadg/structure/material/library/mooney_rivlin.h>
+#include <exadg/structure/material/library/neo_hookean.h>
 #include <exadg/structure/material/library/st_venant_kirchhoff.h>
 #include <exadg/structure/material/material.h>
 #include <exadg/structure/user_interface/material_descriptor.h>
@@ -78,6 +81,19 @@ public:
                    matrix_free, dof_index, quad_index, *data_svk, large_deformation)));
           break;
         }
+        case MaterialType::NeoHookean:
+        {
+          std::shared_ptr<NeoHookeanData> data_nh = std::static_pointer_cast<NeoHookeanData>(data);
+          material_map.insert(Pair(id, new NeoHookean<dim, Number>(*data_nh, large_deformation)));
+          break;
+        }
+        case MaterialType::MooneyRivlin:
+        {
+          std::shared_ptr<MooneyRivlinData> data_mr =
+            std::static_pointer_cast<MooneyRivlinData>(data);
+          material_map.insert(Pair(id, new MooneyRivlin<dim, Number>(*data_mr, large_deformation)));
+          break;
+        }
         default:
         {
           AssertThrow(false, dealii::ExcMessage("Specified material type is not implemented."));
@@ -98,13 +114,14 @@ public:
                   dealii::ExcMessage("You have to categorize cells according to their materials!"));
 #endif
 
-    material = material_map[mid];
+    auto const it = material_map.find(mid);
+    material.get() = (it != material_map.end()) ? it->second : nullptr;
   }
 
   std::shared_ptr<Material<dim, Number>>
   get_material() const
   {
-    return material;
+    return material.get();
   }
 
 private:
@@ -113,8 +130,8 @@ private:
   std::shared_ptr<MaterialDescriptor const> material_descriptor;
   Materials                                 material_map;
 
-  // pointer to material of current cell
-  std::shared_ptr<Material<dim, Number>> material;
+  // pointer to material of current cell, stored per thread for task-parallel matrix-free loops
+  mutable dealii::Threads::ThreadLocalStorage<std::shared_ptr<Material<dim, Number>>> material;
 };
 
 } // namespace Structure
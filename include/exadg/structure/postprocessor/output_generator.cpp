@@ -42,8 +42,7 @@ write_output(OutputDataBase const &          output_data,
              unsigned int const              output_counter,
              MPI_Comm const &                mpi_comm)
 {
-  dealii::DataOutBase::VtkFlags flags;
-  flags.write_higher_order_cells = output_data.write_higher_order;
+  dealii::DataOutBase::VtkFlags const flags = get_vtk_flags(output_data);
 
   dealii::DataOut<dim> data_out;
   data_out.set_flags(flags);
@@ -54,6 +53,7 @@ write_output(OutputDataBase const &          output_data,
 
   data_out.add_data_vector(dof_handler, solution_vector, names, component_interpretation);
 
+  select_cells_for_output(data_out, output_data);
   data_out.build_patches(mapping, output_data.degree, dealii::DataOut<dim>::curved_inner_cells);
 
   data_out.write_vtu_with_pvtu_record(
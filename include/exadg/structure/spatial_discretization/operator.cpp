@@ -230,11 +230,13 @@ Operator<dim, Number>::setup_operators()
   operator_data.large_deformation   = param.large_deformation;
   if(param.large_deformation)
   {
-    operator_data.pull_back_traction = param.pull_back_traction;
+    operator_data.pull_back_traction  = param.pull_back_traction;
+    operator_data.cache_linearization = param.cache_linearization;
   }
   else
   {
-    operator_data.pull_back_traction = false;
+    operator_data.pull_back_traction  = false;
+    operator_data.cache_linearization = false;
   }
 
   if(param.large_deformation)
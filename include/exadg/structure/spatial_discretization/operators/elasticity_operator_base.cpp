@@ -205,6 +205,20 @@ ElasticityOperatorBase<dim, Number>::reinit_cell_derived(IntegratorCell &   inte
   this->material_handler.reinit(*this->matrix_free, cell);
 }
 
+template<int dim, typename Number>
+dealii::ArrayView<typename ElasticityOperatorBase<dim, Number>::tensor>
+ElasticityOperatorBase<dim, Number>::get_scratch_tensors(unsigned int const index,
+                                                         unsigned int const n_q_points) const
+{
+  AssertIndexRange(index, scratch_tensors.get().size());
+
+  dealii::AlignedVector<tensor> & tensors = scratch_tensors.get()[index];
+  if(tensors.size() < n_q_points)
+    tensors.resize(n_q_points);
+
+  return dealii::make_array_view(tensors.begin(), tensors.begin() + n_q_points);
+}
+
 template class ElasticityOperatorBase<2, float>;
 template class ElasticityOperatorBase<2, double>;
 
@@ -22,6 +22,15 @@
 #ifndef INCLUDE_EXADG_STRUCTURE_SPATIAL_DISCRETIZATION_OPERATORS_ELASTICITY_OPERATOR_BASE_H_
 #define INCLUDE_EXADG_STRUCTURE_SPATIAL_DISCRETIZATION_OPERATORS_ELASTICITY_OPERATOR_BASE_H_
 
+// C/C++
+#include <array>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/thread_local_storage.h>
+
+// ExaDG
 #include <exadg/operators/operator_base.h>
 #include <exadg/structure/material/material_handler.h>
 #include <exadg/structure/user_interface/boundary_descriptor.h>
@@ -38,6 +47,7 @@ struct OperatorData : public OperatorBaseData
     : OperatorBaseData(),
       large_deformation(false),
       pull_back_traction(false),
+      cache_linearization(false),
       unsteady(false),
       density(1.0),
       quad_index_gauss_lobatto(0)
@@ -55,6 +65,11 @@ struct OperatorData : public OperatorBaseData
   // is pulled back to the reference configuration, t_0 = da/dA t.
   bool pull_back_traction;
 
+  // This parameter is only relevant for the nonlinear operator with large deformations. When set
+  // to true, the linearized operator stores quantities depending on the point of linearization in
+  // the quadrature points.
+  bool cache_linearization;
+
   // activates mass operator in operator evaluation for unsteady problems
   bool unsteady;
 
@@ -78,6 +93,8 @@ protected:
   typedef typename Base::VectorType      VectorType;
   typedef typename Base::IntegratorFace  IntegratorFace;
 
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
 public:
   ElasticityOperatorBase();
 
@@ -141,11 +158,23 @@ protected:
   void
   reinit_cell_derived(IntegratorCell & integrator, unsigned int const cell) const override;
 
+  /*
+   * Returns the array with index "index" of n_q_points tensors used to evaluate the material for
+   * all quadrature points of a cell batch at once.
+   */
+  dealii::ArrayView<tensor>
+  get_scratch_tensors(unsigned int const index, unsigned int const n_q_points) const;
+
   OperatorData<dim> operator_data;
 
   mutable MaterialHandler<dim, Number> material_handler;
 
   mutable double scaling_factor_mass;
+
+private:
+  // stored per thread for task-parallel matrix-free loops
+  mutable dealii::Threads::ThreadLocalStorage<std::array<dealii::AlignedVector<tensor>, 5>>
+    scratch_tensors;
 };
 
 } // namespace Structure
@@ -33,16 +33,19 @@ LinearOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) const
 {
   std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
 
+  dealii::ArrayView<tensor> const gradient = this->get_scratch_tensors(0, integrator.n_q_points);
+  dealii::ArrayView<tensor> const sigma    = this->get_scratch_tensors(1, integrator.n_q_points);
+
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
-  {
-    // Cauchy stresses, only valid for linear elasticity
-    tensor const sigma =
-      material->second_piola_kirchhoff_stress(integrator.get_gradient(q),
-                                              integrator.get_current_cell_index(),
-                                              q);
+    gradient[q] = integrator.get_gradient(q);
+
+  // Cauchy stresses, only valid for linear elasticity
+  material->second_piola_kirchhoff_stress(sigma, gradient, integrator.get_current_cell_index());
 
+  for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+  {
     // test with gradients
-    integrator.submit_gradient(sigma, q);
+    integrator.submit_gradient(sigma[q], q);
 
     if(this->operator_data.unsteady)
     {
@@ -36,12 +36,30 @@ NonLinearOperator<dim, Number>::initialize(
 {
   Base::initialize(matrix_free, affine_constraints, data);
 
-  integrator_lin = std::make_shared<IntegratorCell>(*this->matrix_free,
-                                                    this->operator_data.dof_index_inhomogeneous,
-                                                    this->operator_data.quad_index);
+  integrator_lin.initialize([this]() {
+    return std::make_shared<IntegratorCell>(*this->matrix_free,
+                                            this->operator_data.dof_index_inhomogeneous,
+                                            this->operator_data.quad_index);
+  });
   // it should not make a difference here whether we use dof_index or dof_index_inhomogeneous
   this->matrix_free->initialize_dof_vector(displacement_lin, this->operator_data.dof_index);
   displacement_lin.update_ghost_values();
+
+  if(this->operator_data.cache_linearization)
+  {
+    deformation_gradient_coefficients.initialize(*this->matrix_free,
+                                                 this->operator_data.quad_index,
+                                                 false,
+                                                 false);
+    stress_coefficients.initialize(*this->matrix_free,
+                                   this->operator_data.quad_index,
+                                   false,
+                                   false);
+    tangent_coefficients.initialize(*this->matrix_free,
+                                    this->operator_data.quad_index,
+                                    false,
+                                    false);
+  }
 }
 
 template<int dim, typename Number>
@@ -90,6 +108,15 @@ NonLinearOperator<dim, Number>::set_solution_linearization(VectorType const & ve
     displacement_lin = vector;
     displacement_lin.update_ghost_values();
 
+    if(this->operator_data.cache_linearization)
+    {
+      VectorType dummy;
+      this->matrix_free->cell_loop(&This::cell_loop_cache_linearization,
+                                   this,
+                                   dummy,
+                                   displacement_lin);
+    }
+
     this->assemble_matrix_if_necessary();
   }
 }
@@ -158,6 +185,8 @@ NonLinearOperator<dim, Number>::cell_loop_valid_deformation(
                             this->operator_data.dof_index_inhomogeneous,
                             this->operator_data.quad_index);
 
+  Number n_invalid = 0.0;
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     reinit_cell_nonlinear(integrator, cell);
@@ -177,10 +206,15 @@ NonLinearOperator<dim, Number>::cell_loop_valid_deformation(
       {
         // if deformation is invalid, add a positive value to dst
         if(det_F[v] <= 0.0)
-          dst += 1.0;
+          n_invalid += 1.0;
       }
     }
   }
+
+  // the loop may be executed by several threads concurrently
+  std::lock_guard<std::mutex> lock(mutex);
+
+  dst += n_invalid;
 }
 
 template<int dim, typename Number>
@@ -239,27 +273,71 @@ NonLinearOperator<dim, Number>::boundary_face_loop_nonlinear(
   }
 }
 
+template<int dim, typename Number>
+void
+NonLinearOperator<dim, Number>::cell_loop_cache_linearization(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  VectorType &                            dst,
+  VectorType const &                      src,
+  Range const &                           range) const
+{
+  (void)dst;
+
+  std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
+
+  IntegratorCell integrator(matrix_free,
+                            this->operator_data.dof_index_inhomogeneous,
+                            this->operator_data.quad_index);
+
+  dealii::ArrayView<tensor> const Grad_d_lin = this->get_scratch_tensors(0, integrator.n_q_points);
+  dealii::ArrayView<tensor> const S_lin      = this->get_scratch_tensors(1, integrator.n_q_points);
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    reinit_cell_nonlinear(integrator, cell);
+
+    integrator.gather_evaluate(src, dealii::EvaluationFlags::gradients);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      Grad_d_lin[q] = integrator.get_gradient(q);
+
+    material->second_piola_kirchhoff_stress(S_lin, Grad_d_lin, cell);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      tensor const F_lin = get_F<dim, Number>(Grad_d_lin[q]);
+
+      deformation_gradient_coefficients.set_coefficient_cell(cell, q, F_lin);
+      stress_coefficients.set_coefficient_cell(cell, q, S_lin[q]);
+      tangent_coefficients.set_coefficient_cell(cell, q, material->compact_tangent(F_lin, cell, q));
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 NonLinearOperator<dim, Number>::do_cell_integral_nonlinear(IntegratorCell & integrator) const
 {
   std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
 
+  dealii::ArrayView<tensor> const Grad_d = this->get_scratch_tensors(0, integrator.n_q_points);
+  dealii::ArrayView<tensor> const S      = this->get_scratch_tensors(1, integrator.n_q_points);
+
+  // material displacement gradient
+  for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    Grad_d[q] = integrator.get_gradient(q);
+
+  // 2nd Piola-Kirchhoff stresses
+  material->second_piola_kirchhoff_stress(S, Grad_d, integrator.get_current_cell_index());
+
   // loop over all quadrature points
   for(unsigned int q = 0; q < integrator.n_q_points; ++q)
   {
-    // material displacement gradient
-    tensor const Grad_d = integrator.get_gradient(q);
-
     // material deformation gradient
-    tensor const F = get_F<dim, Number>(Grad_d);
-
-    // 2nd Piola-Kirchhoff stresses
-    tensor const S =
-      material->second_piola_kirchhoff_stress(Grad_d, integrator.get_current_cell_index(), q);
+    tensor const F = get_F<dim, Number>(Grad_d[q]);
 
     // 1st Piola-Kirchhoff stresses P = F * S
-    tensor const P = F * S;
+    tensor const P = F * S[q];
 
     // Grad_v : P
     integrator.submit_gradient(P, q);
@@ -308,10 +386,15 @@ NonLinearOperator<dim, Number>::reinit_cell_derived(IntegratorCell &   integrato
 {
   Base::reinit_cell_derived(integrator, cell);
 
-  integrator_lin->reinit(cell);
+  if(this->operator_data.cache_linearization)
+    return;
+
+  IntegratorCell & integrator_lin_cell = integrator_lin.get();
+
+  integrator_lin_cell.reinit(cell);
 
-  integrator_lin->read_dof_values(displacement_lin);
-  integrator_lin->evaluate(dealii::EvaluationFlags::gradients);
+  integrator_lin_cell.read_dof_values(displacement_lin);
+  integrator_lin_cell.evaluate(dealii::EvaluationFlags::gradients);
 }
 
 template<int dim, typename Number>
@@ -320,28 +403,62 @@ NonLinearOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) co
 {
   std::shared_ptr<Material<dim, Number>> material = this->material_handler.get_material();
 
-  // loop over all quadrature points
-  for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+  unsigned int const cell       = integrator.get_current_cell_index();
+  unsigned int const n_q_points = integrator.n_q_points;
+
+  dealii::ArrayView<tensor> const Grad_delta = this->get_scratch_tensors(0, n_q_points);
+  dealii::ArrayView<tensor> const F_lin      = this->get_scratch_tensors(1, n_q_points);
+  dealii::ArrayView<tensor> const S_lin      = this->get_scratch_tensors(2, n_q_points);
+  dealii::ArrayView<tensor> const delta_S    = this->get_scratch_tensors(3, n_q_points);
+
+  for(unsigned int q = 0; q < n_q_points; ++q)
+    Grad_delta[q] = integrator.get_gradient(q);
+
+  // deformation gradient and 2nd Piola-Kirchhoff stresses at the point of linearization and
+  // their directional derivative
+  if(this->operator_data.cache_linearization)
+  {
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      F_lin[q] = deformation_gradient_coefficients.get_coefficient_cell(cell, q);
+      S_lin[q] = stress_coefficients.get_coefficient_cell(cell, q);
+
+      // symmetric increment of the Green-Lagrange strain tensor
+      tensor const F_T_delta = transpose(F_lin[q]) * Grad_delta[q];
+      delta_S[q] = tangent_coefficients.get_coefficient_cell(cell, q).apply(
+        0.5 * (F_T_delta + transpose(F_T_delta)));
+    }
+  }
+  else
   {
-    // kinematics
-    tensor const Grad_delta = integrator.get_gradient(q);
+    IntegratorCell const & integrator_lin_cell = integrator_lin.current();
 
-    tensor const Grad_d_lin = integrator_lin->get_gradient(q);
+    dealii::ArrayView<tensor> const Grad_d_lin = this->get_scratch_tensors(4, n_q_points);
+
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      Grad_d_lin[q] = integrator_lin_cell.get_gradient(q);
+      F_lin[q]      = get_F<dim, Number>(Grad_d_lin[q]);
+    }
 
-    tensor const F_lin = get_F<dim, Number>(Grad_d_lin);
+    material->second_piola_kirchhoff_stress(S_lin, Grad_d_lin, cell);
 
-    // 2nd Piola-Kirchhoff stresses
-    tensor const S_lin =
-      material->second_piola_kirchhoff_stress(Grad_d_lin, integrator.get_current_cell_index(), q);
+    material->second_piola_kirchhoff_stress_displacement_derivative(delta_S,
+                                                                    Grad_delta,
+                                                                    F_lin,
+                                                                    cell);
+  }
 
+  // loop over all quadrature points
+  for(unsigned int q = 0; q < n_q_points; ++q)
+  {
     // directional derivative of 1st Piola-Kirchhoff stresses P
 
     // 1. elastic and initial displacement stiffness contributions
-    tensor delta_P = F_lin * material->second_piola_kirchhoff_stress_displacement_derivative(
-                               Grad_delta, F_lin, integrator.get_current_cell_index(), q);
+    tensor delta_P = F_lin[q] * delta_S[q];
 
     // 2. geometric (or initial stress) stiffness contribution
-    delta_P += Grad_delta * S_lin;
+    delta_P += Grad_delta[q] * S_lin[q];
 
     // Grad_v : delta_P
     integrator.submit_gradient(delta_P, q);
@@ -22,6 +22,12 @@
 #ifndef INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_NONLINEAR_OPERATOR_H_
 #define INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_NONLINEAR_OPERATOR_H_
 
+// C/C++
+#include <mutex>
+
+// ExaDG
+#include <exadg/matrix_free/thread_local_data.h>
+#include <exadg/operators/variable_coefficients.h>
 #include <exadg/structure/spatial_discretization/operators/elasticity_operator_base.h>
 
 namespace ExaDG
@@ -121,6 +127,17 @@ private:
                               VectorType const &                      src,
                               Range const &                           range) const;
 
+  /*
+   * Computes the deformation gradient F, the 2nd Piola-Kirchhoff stress tensor S and the material
+   * tangent (see Material::compact_tangent()) at the point of linearization and stores them in the
+   * quadrature points (if cache_linearization is true).
+   */
+  void
+  cell_loop_cache_linearization(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                VectorType &                            dst,
+                                VectorType const &                      src,
+                                Range const &                           range) const;
+
   /*
    * Calculates the integral
    *
@@ -200,8 +217,18 @@ private:
   void
   do_cell_integral(IntegratorCell & integrator) const override;
 
-  mutable std::shared_ptr<IntegratorCell> integrator_lin;
-  mutable VectorType                      displacement_lin;
+  // one integrator per thread for task-parallel matrix-free loops
+  ThreadLocalData<IntegratorCell> integrator_lin;
+  mutable VectorType              displacement_lin;
+
+  // protects the accumulation into the result of evaluate_nonlinear() in task-parallel loops
+  mutable std::mutex mutex;
+
+  // deformation gradient, 2nd Piola-Kirchhoff stress tensor and material tangent at the point of
+  // linearization
+  mutable VariableCoefficients<tensor>                      deformation_gradient_coefficients;
+  mutable VariableCoefficients<tensor>                      stress_coefficients;
+  mutable VariableCoefficients<CompactTangent<dim, Number>> tangent_coefficients;
 };
 
 } // namespace Structure
@@ -56,7 +56,9 @@ enum class Type2D
 enum class MaterialType
 {
   Undefined,
-  StVenantKirchhoff
+  StVenantKirchhoff,
+  NeoHookean,
+  MooneyRivlin
 };
 
 /**************************************************************************************/
@@ -67,6 +67,7 @@ Parameters::Parameters()
     degree(1),
     use_matrix_based_implementation(false),
     sparse_matrix_type(SparseMatrixType::Undefined),
+    cache_linearization(false),
 
     // SOLVER
     newton_solver_data(Newton::SolverData(1e4, 1.e-12, 1.e-6)),
@@ -232,6 +233,9 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
   {
     print_parameter(pcout, "Sparse matrix type", sparse_matrix_type);
   }
+
+  if(large_deformation)
+    print_parameter(pcout, "Cache linearization", cache_linearization);
 }
 
 void
@@ -191,6 +191,13 @@ public:
   // this parameter is only relevant if use_matrix_based_implementation == true
   SparseMatrixType sparse_matrix_type;
 
+  // This parameter is only relevant for the linearized operator with large deformations.
+  // When set to true, the deformation gradient, the 2nd Piola-Kirchhoff stress tensor and the
+  // material tangent at the point of linearization are computed once per linearization and stored
+  // in the quadrature points. The application of the linearized operator then only involves the
+  // displacement increment, at the price of additional memory.
+  bool cache_linearization;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                       SOLVER                                       */
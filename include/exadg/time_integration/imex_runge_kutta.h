@@ -0,0 +1,285 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+
+// C/C++
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/full_matrix.h>
+
+// ExaDG
+#include <exadg/time_integration/explicit_runge_kutta.h>
+
+namespace ExaDG
+{
+/*
+ *  Implicit-explicit (IMEX) Runge-Kutta methods for problems of the form
+ *
+ *    du/dt = f_E(u,t) + f_I(u,t) ,
+ *
+ *  where the non-stiff part f_E is treated explicitly and the stiff part f_I implicitly with a
+ *  diagonally implicit Runge-Kutta method. The methods are taken from
+ *
+ *    Ascher, Ruuth, Spiteri (1997), "Implicit-explicit Runge-Kutta methods for time-dependent
+ *    partial differential equations", Applied Numerical Mathematics 25, pp. 151-167,
+ *
+ *  and are denoted as ARS(s,sigma,p) with s implicit stages, sigma explicit stages and order p.
+ *  The first stage is explicit and the implicit part is L-stable. Both parts are stiffly
+ *  accurate, i.e., the weights equal the last row of the Butcher tables, so that the solution is
+ *  given by the last stage.
+ *
+ *  The underlying operator has to provide the functions
+ *
+ *    evaluate_explicit_terms(dst, src, time)              : dst = f_E(src, time)
+ *    evaluate_implicit_terms(dst, src, time)              : dst = f_I(src, time)
+ *    solve_implicit_terms(dst, rhs, time, scaling_factor) : solve dst - factor f_I(dst) = rhs
+ *
+ *  where the vector dst of solve_implicit_terms() contains the initial guess. The class is
+ *  derived from ExplicitTimeIntegrator in order to be exchangeable with the explicit Runge-Kutta
+ *  methods in the time integrators of the single-field solvers.
+ */
+template<typename Operator, typename VectorType>
+class IMEXRungeKuttaTimeIntegrator : public ExplicitTimeIntegrator<Operator, VectorType>
+{
+public:
+  IMEXRungeKuttaTimeIntegrator(unsigned int const              order_in,
+                               std::shared_ptr<Operator> const operator_in)
+    : ExplicitTimeIntegrator<Operator, VectorType>(operator_in),
+      order(order_in),
+      n_iterations_nonlinear(0),
+      n_iterations_linear(0)
+  {
+    initialize_coeffs();
+  }
+
+  void
+  solve_timestep(VectorType & vec_np,
+                 VectorType & vec_n,
+                 double const time,
+                 double const time_step) final
+  {
+    unsigned int const stages = c.size();
+
+    // Initialize vectors if necessary
+    if(k_explicit.empty() or
+       not(k_explicit[0].partitioners_are_globally_compatible(*vec_n.get_partitioner())))
+    {
+      k_explicit.resize(stages);
+      k_implicit.resize(stages);
+      for(unsigned int s = 0; s < stages; ++s)
+      {
+        k_explicit[s].reinit(vec_n);
+        k_implicit[s].reinit(vec_n);
+      }
+      rhs.reinit(vec_n);
+    }
+
+    n_iterations_nonlinear = 0;
+    n_iterations_linear    = 0;
+
+    for(unsigned int s = 0; s < stages; ++s)
+    {
+      double const time_stage = time + c[s] * time_step;
+
+      // right-hand side of stage s
+      rhs = vec_n;
+      for(unsigned int l = 0; l < s; ++l)
+      {
+        if(A_explicit[s][l] != 0.0)
+          rhs.add(A_explicit[s][l] * time_step, k_explicit[l]);
+        if(A_implicit[s][l] != 0.0)
+          rhs.add(A_implicit[s][l] * time_step, k_implicit[l]);
+      }
+
+      // solution of stage s, stored in vec_np (the last stage is the solution of the time step)
+      if(A_implicit[s][s] != 0.0)
+      {
+        double const scaling_factor = A_implicit[s][s] * time_step;
+
+        // use the right-hand side as initial guess
+        vec_np = rhs;
+
+        auto const iterations =
+          this->underlying_operator->solve_implicit_terms(vec_np, rhs, time_stage, scaling_factor);
+
+        n_iterations_nonlinear += std::get<0>(iterations);
+        n_iterations_linear += std::get<1>(iterations);
+
+        // The implicit term follows from the stage equation, which avoids an evaluation of the
+        // implicit term and is consistent with the (inexact) solution of the stage equation.
+        if(implicit_term_is_needed(s))
+        {
+          k_implicit[s].equ(1.0 / scaling_factor, vec_np);
+          k_implicit[s].add(-1.0 / scaling_factor, rhs);
+        }
+      }
+      else
+      {
+        vec_np = rhs;
+
+        if(implicit_term_is_needed(s))
+          this->underlying_operator->evaluate_implicit_terms(k_implicit[s], vec_np, time_stage);
+      }
+
+      if(explicit_term_is_needed(s))
+        this->underlying_operator->evaluate_explicit_terms(k_explicit[s], vec_np, time_stage);
+    }
+  }
+
+  unsigned int
+  get_order() const final
+  {
+    return order;
+  }
+
+  /*
+   * Returns the number of Newton iterations and the accumulated number of linear iterations of
+   * the last time step.
+   */
+  std::tuple<unsigned int, unsigned int>
+  get_iterations() const
+  {
+    return std::make_tuple(n_iterations_nonlinear, n_iterations_linear);
+  }
+
+private:
+  void
+  initialize_coeffs()
+  {
+    if(order == 2)
+    {
+      /*
+       * ARS(2,2,2)
+       *
+       *  explicit part                       implicit part
+       *
+       *   0    |                              0    |
+       *   g    | g                            g    | 0   g
+       *   1    | d    1-d                     1    | 0   1-g  g
+       *  ---------------------               ---------------------
+       *        | d    1-d   0                      | 0   1-g  g
+       *
+       *  with g = 1 - 1/sqrt(2) and d = 1 - 1/(2g)
+       */
+      double const g = 1.0 - 1.0 / std::sqrt(2.0);
+      double const d = 1.0 - 1.0 / (2.0 * g);
+
+      c = {0.0, g, 1.0};
+
+      A_explicit.reinit(3, 3);
+      A_explicit[1][0] = g;
+      A_explicit[2][0] = d;
+      A_explicit[2][1] = 1.0 - d;
+
+      A_implicit.reinit(3, 3);
+      A_implicit[1][1] = g;
+      A_implicit[2][1] = 1.0 - g;
+      A_implicit[2][2] = g;
+    }
+    else if(order == 3)
+    {
+      /*
+       * ARS(4,4,3)
+       *
+       *  explicit part                                    implicit part
+       *
+       *   0   |                                            0   |
+       *   1/2 | 1/2                                        1/2 | 0  1/2
+       *   2/3 | 11/18  1/18                                2/3 | 0  1/6   1/2
+       *   1/2 | 5/6   -5/6   1/2                           1/2 | 0 -1/2   1/2  1/2
+       *   1   | 1/4    7/4   3/4  -7/4                     1   | 0  3/2  -3/2  1/2  1/2
+       *  ------------------------------------             ---------------------------------
+       *       | 1/4    7/4   3/4  -7/4   0                     | 0  3/2  -3/2  1/2  1/2
+       */
+      c = {0.0, 0.5, 2.0 / 3.0, 0.5, 1.0};
+
+      A_explicit.reinit(5, 5);
+      A_explicit[1][0] = 1.0 / 2.0;
+      A_explicit[2][0] = 11.0 / 18.0;
+      A_explicit[2][1] = 1.0 / 18.0;
+      A_explicit[3][0] = 5.0 / 6.0;
+      A_explicit[3][1] = -5.0 / 6.0;
+      A_explicit[3][2] = 1.0 / 2.0;
+      A_explicit[4][0] = 1.0 / 4.0;
+      A_explicit[4][1] = 7.0 / 4.0;
+      A_explicit[4][2] = 3.0 / 4.0;
+      A_explicit[4][3] = -7.0 / 4.0;
+
+      A_implicit.reinit(5, 5);
+      A_implicit[1][1] = 1.0 / 2.0;
+      A_implicit[2][1] = 1.0 / 6.0;
+      A_implicit[2][2] = 1.0 / 2.0;
+      A_implicit[3][1] = -1.0 / 2.0;
+      A_implicit[3][2] = 1.0 / 2.0;
+      A_implicit[3][3] = 1.0 / 2.0;
+      A_implicit[4][1] = 3.0 / 2.0;
+      A_implicit[4][2] = -3.0 / 2.0;
+      A_implicit[4][3] = 1.0 / 2.0;
+      A_implicit[4][4] = 1.0 / 2.0;
+    }
+    else
+    {
+      AssertThrow(false,
+                  dealii::ExcMessage("IMEX Runge-Kutta method only implemented for order 2, 3."));
+    }
+  }
+
+  // the explicit term of stage s is needed if it contributes to later stages
+  bool
+  explicit_term_is_needed(unsigned int const s) const
+  {
+    for(unsigned int l = s + 1; l < c.size(); ++l)
+      if(A_explicit[l][s] != 0.0)
+        return true;
+
+    return false;
+  }
+
+  // the implicit term of stage s is needed if it contributes to later stages
+  bool
+  implicit_term_is_needed(unsigned int const s) const
+  {
+    for(unsigned int l = s + 1; l < c.size(); ++l)
+      if(A_implicit[l][s] != 0.0)
+        return true;
+
+    return false;
+  }
+
+  unsigned int const order;
+
+  dealii::FullMatrix<double> A_explicit, A_implicit;
+  std::vector<double>        c;
+
+  std::vector<VectorType> k_explicit, k_implicit;
+  VectorType              rhs;
+
+  unsigned int n_iterations_nonlinear, n_iterations_linear;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_ */
@@ -22,6 +22,7 @@
 #ifndef INCLUDE_EXADG_UTILITIES_GENERAL_PARAMETERS_H_
 #define INCLUDE_EXADG_UTILITIES_GENERAL_PARAMETERS_H_
 
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parameter_handler.h>
 
 #include <exadg/utilities/enum_patterns.h>
@@ -58,6 +59,11 @@ struct GeneralParameters
                         "Set to true if the program is run as a test.",
                         dealii::Patterns::Bool(),
                         false);
+      prm.add_parameter("NThreads",
+                        n_threads,
+                        "Number of threads per MPI process (hybrid MPI+threads mode).",
+                        dealii::Patterns::Integer(1),
+                        false);
     }
     prm.leave_subsection();
   }
@@ -67,8 +73,22 @@ struct GeneralParameters
   unsigned int dim = 2;
 
   bool is_test = false;
+
+  // Number of threads per MPI process. If larger than 1, matrix-free loops and vector operations
+  // are parallelized over the threads of each process.
+  unsigned int n_threads = 1;
 };
 
+/*
+ * Limits the number of threads per MPI process to GeneralParameters::n_threads (hybrid
+ * MPI+threads mode). This function has to be called before any matrix-free data is set up.
+ */
+inline void
+set_number_of_threads(GeneralParameters const & general)
+{
+  dealii::MultithreadInfo::set_thread_limit(general.n_threads);
+}
+
 } // namespace ExaDG
 
 
@@ -19,6 +19,7 @@
  *  ______________________________________________________________________
  */
 
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/revision.h>
 
 #include <exadg/utilities/exadg_revision.h>
@@ -51,6 +52,7 @@ print_MPI_info(dealii::ConditionalOStream const & pcout, MPI_Comm const & mpi_co
 {
   pcout << std::endl << "MPI info:" << std::endl << std::endl;
   print_parameter(pcout, "Number of processes", dealii::Utilities::MPI::n_mpi_processes(mpi_comm));
+  print_parameter(pcout, "Number of threads per process", dealii::MultithreadInfo::n_threads());
 }
 
 
@@ -28,6 +28,7 @@
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/base/utilities.h>
 
 // ExaDG
@@ -43,6 +44,10 @@ print_throughput(
 {
   unsigned int N_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
 
+  // in hybrid MPI+threads mode, each MPI process runs on several cores
+  unsigned int const N_threads = dealii::MultithreadInfo::n_threads();
+  unsigned int const N_cores   = N_mpi_processes * N_threads;
+
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
     // clang-format off
@@ -51,6 +56,8 @@ print_throughput(
               << std::endl << std::endl
               << "Operator type: " << operator_type
               << std::endl << std::endl
+              << "MPI processes: " << N_mpi_processes << ", threads per process: " << N_threads
+              << std::endl << std::endl
               << std::setw(5) << std::left << "k"
               << std::setw(15) << std::left << "DoFs"
               << std::setw(15) << std::left << "DoFs/sec"
@@ -64,7 +71,7 @@ print_throughput(
                 << std::scientific << std::setprecision(4)
                 << std::setw(15) << std::left << (double)std::get<1>(*it)
                 << std::setw(15) << std::left << std::get<2>(*it)
-                << std::setw(15) << std::left << std::get<2>(*it)/(double)N_mpi_processes
+                << std::setw(15) << std::left << std::get<2>(*it)/(double)N_cores
                 << std::endl << std::flush;
     }
 
@@ -0,0 +1,229 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/compressible_navier_stokes/spatial_discretization/calculators.h>
+
+// Check the computation of all derived variables in a single loop over the conserved variables.
+// Density, velocity and temperature are linear functions, so that the conserved variables are
+// represented exactly by FE_DGQ(3), and pressure, velocity, temperature, vorticity, divergence and
+// shear rate are polynomials of degree 2 at most. The cell-wise L2-projections therefore reproduce
+// the derived variables exactly.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+unsigned int const degree = 3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const heat_capacity_ratio   = 1.4;
+double const specific_gas_constant = 287.0;
+
+double const tol = 1.e-10;
+
+double
+density(dealii::Point<dim> const & p)
+{
+  return 1.0 + 0.1 * p[0] + 0.2 * p[1];
+}
+
+// the velocity gradient is ((1, -2), (3, 1)), i.e., the vorticity is 5, the divergence is 2 and
+// the shear rate is sqrt(5)
+dealii::Tensor<1, dim>
+velocity(dealii::Point<dim> const & p)
+{
+  dealii::Tensor<1, dim> u;
+  u[0] = 1.0 + p[0] - 2.0 * p[1];
+  u[1] = 0.5 + 3.0 * p[0] + p[1];
+  return u;
+}
+
+double
+temperature(dealii::Point<dim> const & p)
+{
+  return 300.0 + 10.0 * p[0] + 20.0 * p[1];
+}
+
+double
+pressure(dealii::Point<dim> const & p)
+{
+  return specific_gas_constant * density(p) * temperature(p);
+}
+
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    return velocity(p)[component];
+  }
+};
+
+class ConservedVariables : public dealii::Function<dim>
+{
+public:
+  ConservedVariables() : dealii::Function<dim>(dim + 2)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    if(component == 0)
+      return density(p);
+    else if(component <= dim)
+      return density(p) * velocity(p)[component - 1];
+    else
+      return pressure(p) / (heat_capacity_ratio - 1.0) +
+             0.5 * density(p) * velocity(p).norm_square();
+  }
+};
+
+void
+check(std::string const &             name,
+      dealii::DoFHandler<dim> const & dof_handler,
+      dealii::Function<dim> const &   function,
+      VectorType const &              computed)
+{
+  VectorType error(computed);
+  dealii::VectorTools::interpolate(dof_handler, function, error);
+  double const norm = error.linfty_norm();
+  error -= computed;
+
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    std::cout << name << ": " << (error.linfty_norm() < tol * norm ? "ok" : "failed") << std::endl;
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe_all(dealii::FE_DGQ<dim>(degree), dim + 2);
+  dealii::FESystem<dim>   fe_vector(dealii::FE_DGQ<dim>(degree), dim);
+  dealii::FE_DGQ<dim>     fe_scalar(degree);
+  dealii::DoFHandler<dim> dof_handler_all(triangulation);
+  dealii::DoFHandler<dim> dof_handler_vector(triangulation);
+  dealii::DoFHandler<dim> dof_handler_scalar(triangulation);
+  dof_handler_all.distribute_dofs(fe_all);
+  dof_handler_vector.distribute_dofs(fe_vector);
+  dof_handler_scalar.distribute_dofs(fe_scalar);
+
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_values;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     std::vector<dealii::DoFHandler<dim> const *>{&dof_handler_all,
+                                                                  &dof_handler_vector,
+                                                                  &dof_handler_scalar},
+                     std::vector<dealii::AffineConstraints<double> const *>(3, &affine_constraints),
+                     std::vector<dealii::Quadrature<1>>{dealii::QGauss<1>(degree + 1)},
+                     additional_data);
+
+  CompNS::p_u_T_Calculator<dim, double> calculator;
+  calculator.initialize(matrix_free, 0, 1, 2, 0, heat_capacity_ratio, specific_gas_constant);
+
+  VectorType solution;
+  matrix_free.initialize_dof_vector(solution, 0);
+  dealii::VectorTools::interpolate(dof_handler_all, ConservedVariables(), solution);
+
+  VectorType pressure_vector, velocity_vector, temperature_vector, vorticity_vector,
+    divergence_vector, shear_rate_vector;
+  matrix_free.initialize_dof_vector(pressure_vector, 2);
+  matrix_free.initialize_dof_vector(velocity_vector, 1);
+  matrix_free.initialize_dof_vector(temperature_vector, 2);
+  matrix_free.initialize_dof_vector(vorticity_vector, 1);
+  matrix_free.initialize_dof_vector(divergence_vector, 2);
+  matrix_free.initialize_dof_vector(shear_rate_vector, 2);
+
+  CompNS::DerivedVariables<VectorType> derived_variables;
+  derived_variables.pressure    = &pressure_vector;
+  derived_variables.velocity    = &velocity_vector;
+  derived_variables.temperature = &temperature_vector;
+  derived_variables.vorticity   = &vorticity_vector;
+  derived_variables.divergence  = &divergence_vector;
+  derived_variables.shear_rate  = &shear_rate_vector;
+
+  calculator.compute_derived_variables(derived_variables, solution);
+
+  check("Pressure",
+        dof_handler_scalar,
+        dealii::ScalarFunctionFromFunctionObject<dim>(&pressure),
+        pressure_vector);
+  check("Velocity", dof_handler_vector, Velocity(), velocity_vector);
+  check("Temperature",
+        dof_handler_scalar,
+        dealii::ScalarFunctionFromFunctionObject<dim>(&temperature),
+        temperature_vector);
+  check("Vorticity",
+        dof_handler_vector,
+        dealii::ConstantFunction<dim>(std::vector<double>{5.0, 0.0}),
+        vorticity_vector);
+  check("Divergence", dof_handler_scalar, dealii::ConstantFunction<dim>(2.0), divergence_vector);
+  check("Shear rate",
+        dof_handler_scalar,
+        dealii::ConstantFunction<dim>(std::sqrt(5.0)),
+        shear_rate_vector);
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
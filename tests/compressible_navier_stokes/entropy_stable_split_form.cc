@@ -0,0 +1,301 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/compressible_navier_stokes/spatial_discretization/kernels_and_operators.h>
+#include <exadg/matrix_free/integrators.h>
+
+// Check the entropy-stable split form of the convective term for the isentropic vortex on the
+// periodic domain [-10, 10]^2, where the vortex is periodic up to round-off. The residual r of the
+// convective operator is assembled for the nodal values u of the conserved variables on the
+// Gauss-Lobatto points, so that the rate of change of the total entropy is -v^T r with the entropy
+// variables v, and the sums of the residuals of density and energy vanish for a conservative
+// discretization.
+//
+// The interpolated vortex is continuous, so that the Lax-Friedrichs dissipation vanishes and the
+// entropy production of the entropy conservative flux has to be zero up to round-off. The solution
+// is then scaled by a different factor in each cell, which leads to jumps on the faces. Mass and
+// energy are still conserved, and the dissipation has to decrease the total entropy, i.e.,
+// v^T r > 0.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+unsigned int const degree = 3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+// ratio of specific heats
+double const kappa = 1.4;
+
+double const tol = 1.e-10;
+
+class IsentropicVortex : public dealii::Function<dim>
+{
+public:
+  IsentropicVortex() : dealii::Function<dim>(dim + 2)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double const beta = 5.0;
+    double const r2   = p.norm_square();
+
+    double const factor = beta / (2.0 * M_PI) * std::exp(0.5 * (1.0 - r2));
+
+    double const rho =
+      std::pow(1.0 - (kappa - 1.0) / (2.0 * kappa) * factor * factor, 1.0 / (kappa - 1.0));
+    double const u        = 1.0 - factor * p[1];
+    double const v        = 1.0 + factor * p[0];
+    double const pressure = std::pow(rho, kappa);
+
+    if(component == 0)
+      return rho;
+    else if(component == 1)
+      return rho * u;
+    else if(component == 2)
+      return rho * v;
+    else
+      return pressure / (kappa - 1.0) + 0.5 * rho * (u * u + v * v);
+  }
+};
+
+// sums of the residuals of density and energy and of the entropy production v^T r over all nodes,
+// together with the sums of the absolute values as reference
+struct Balance
+{
+  double mass = 0.0, mass_reference = 0.0;
+  double energy = 0.0, energy_reference = 0.0;
+  double entropy = 0.0, entropy_reference = 0.0;
+};
+
+Balance
+compute_balance(dealii::MatrixFree<dim, double> const & matrix_free,
+                VectorType const &                      solution,
+                VectorType const &                      residual)
+{
+  CellIntegrator<dim, dim + 2, double> integrator_solution(matrix_free);
+  CellIntegrator<dim, dim + 2, double> integrator_residual(matrix_free);
+
+  Balance balance;
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    // the values at the quadrature points are the nodal values (collocation)
+    integrator_solution.reinit(cell);
+    integrator_solution.read_dof_values(solution);
+    integrator_solution.evaluate(dealii::EvaluationFlags::values);
+
+    integrator_residual.reinit(cell);
+    integrator_residual.read_dof_values(residual);
+    integrator_residual.evaluate(dealii::EvaluationFlags::values);
+
+    for(unsigned int q = 0; q < integrator_solution.n_q_points; ++q)
+    {
+      auto const u = integrator_solution.get_value(q);
+      auto const r = integrator_residual.get_value(q);
+
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+      {
+        double const rho   = u[0][v];
+        double const rho_E = u[dim + 1][v];
+
+        double momentum_square = 0.0;
+        for(unsigned int d = 0; d < dim; ++d)
+          momentum_square += u[1 + d][v] * u[1 + d][v];
+
+        double const p = (kappa - 1.0) * (rho_E - 0.5 * momentum_square / rho);
+        double const s = std::log(p) - kappa * std::log(rho);
+
+        // entropy variables of the entropy -rho s / (kappa - 1)
+        double entropy =
+          ((kappa - s) / (kappa - 1.0) - 0.5 * momentum_square / (rho * p)) * r[0][v] -
+          rho / p * r[dim + 1][v];
+        for(unsigned int d = 0; d < dim; ++d)
+          entropy += u[1 + d][v] / p * r[1 + d][v];
+
+        balance.mass += r[0][v];
+        balance.mass_reference += std::abs(r[0][v]);
+        balance.energy += r[dim + 1][v];
+        balance.energy_reference += std::abs(r[dim + 1][v]);
+        balance.entropy += entropy;
+        balance.entropy_reference += std::abs(entropy);
+      }
+    }
+  }
+
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  balance.mass              = dealii::Utilities::MPI::sum(balance.mass, comm);
+  balance.mass_reference    = dealii::Utilities::MPI::sum(balance.mass_reference, comm);
+  balance.energy            = dealii::Utilities::MPI::sum(balance.energy, comm);
+  balance.energy_reference  = dealii::Utilities::MPI::sum(balance.energy_reference, comm);
+  balance.entropy           = dealii::Utilities::MPI::sum(balance.entropy, comm);
+  balance.entropy_reference = dealii::Utilities::MPI::sum(balance.entropy_reference, comm);
+
+  return balance;
+}
+
+void
+print_conservation(Balance const & balance)
+{
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  {
+    std::cout << "Mass conservation: "
+              << (std::abs(balance.mass) < tol * balance.mass_reference ? "ok" : "failed")
+              << std::endl;
+    std::cout << "Energy conservation: "
+              << (std::abs(balance.energy) < tol * balance.energy_reference ? "ok" : "failed")
+              << std::endl;
+  }
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation, -10.0, 10.0, true /*colorize*/);
+
+  std::vector<dealii::GridTools::PeriodicFacePair<dealii::Triangulation<dim>::cell_iterator>>
+    periodic_face_pairs;
+  for(unsigned int d = 0; d < dim; ++d)
+    dealii::GridTools::collect_periodic_faces(
+      triangulation, 2 * d, 2 * d + 1, d, periodic_face_pairs);
+  triangulation.add_periodicity(periodic_face_pairs);
+  triangulation.refine_global(3);
+
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(degree), dim + 2);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = dealii::update_gradients | dealii::update_JxW_values |
+                                         dealii::update_quadrature_points | dealii::update_values;
+  additional_data.mapping_update_flags_inner_faces =
+    dealii::update_values | dealii::update_JxW_values | dealii::update_normal_vectors |
+    dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     affine_constraints,
+                     dealii::QGaussLobatto<1>(degree + 1),
+                     additional_data);
+
+  CompNS::ConvectiveOperatorData<dim> data;
+  data.dof_index           = 0;
+  data.quad_index          = 0;
+  data.formulation         = CompNS::ConvectiveFormulation::EntropyStableSplitForm;
+  data.bc                  = std::make_shared<CompNS::BoundaryDescriptor<dim>>();
+  data.heat_capacity_ratio = kappa;
+
+  CompNS::ConvectiveOperator<dim, double> convective_operator;
+  convective_operator.initialize(matrix_free, data);
+
+  VectorType solution, residual;
+  matrix_free.initialize_dof_vector(solution);
+  matrix_free.initialize_dof_vector(residual);
+
+  dealii::VectorTools::interpolate(mapping, dof_handler, IsentropicVortex(), solution);
+
+  // isentropic vortex
+  {
+    convective_operator.evaluate(residual, solution, 0.0);
+
+    Balance const balance = compute_balance(matrix_free, solution, residual);
+
+    if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    {
+      std::cout << "Isentropic vortex" << std::endl;
+      std::cout << "Entropy conservation: "
+                << (std::abs(balance.entropy) < tol * balance.entropy_reference ? "ok" : "failed")
+                << std::endl;
+    }
+    print_conservation(balance);
+  }
+
+  // scale the conserved variables by a factor depending on the cell, which leaves the velocity
+  // unchanged and keeps density and pressure positive
+  {
+    CellIntegrator<dim, dim + 2, double> integrator(matrix_free);
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(solution);
+      for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+        for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+          integrator.begin_dof_values()[i][v] *= 1.0 + 0.1 * ((cell + v) % 3);
+      integrator.set_dof_values(solution);
+    }
+  }
+
+  // discontinuous solution
+  {
+    convective_operator.evaluate(residual, solution, 0.0);
+
+    Balance const balance = compute_balance(matrix_free, solution, residual);
+
+    if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    {
+      std::cout << "Discontinuous solution" << std::endl;
+      std::cout << "Entropy dissipation: "
+                << (balance.entropy > tol * balance.entropy_reference ? "ok" : "failed")
+                << std::endl;
+    }
+    print_conservation(balance);
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
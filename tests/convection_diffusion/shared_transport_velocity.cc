@@ -0,0 +1,107 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#include <algorithm>
+#include <iostream>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <exadg/convection_diffusion/spatial_discretization/interface.h>
+
+// Check that the transport velocity shared by several scalars is interpolated once per evaluation
+// time and recomputed once the velocities or times change
+
+using namespace ExaDG;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const size = 10;
+
+double const tol = 1.e-12;
+
+// returns whether vector = factor * (0, 1, 2, ...)
+bool
+check_values(VectorType const & vector, double const factor)
+{
+  double error = 0.0;
+  for(unsigned int i = 0; i < size; ++i)
+    error = std::max(error, std::abs(vector(i) - factor * i));
+  return error < tol;
+}
+
+void
+test()
+{
+  VectorType velocity_n(size), velocity_nm(size);
+  for(unsigned int i = 0; i < size; ++i)
+  {
+    velocity_n(i)  = 2.0 * i;
+    velocity_nm(i) = 1.0 * i;
+  }
+
+  std::vector<VectorType const *> const velocities = {&velocity_n, &velocity_nm};
+
+  ConvDiff::SharedTransportVelocity<double> shared_velocity;
+  shared_velocity.set_velocities_and_times(velocities, {1.0, 0.0});
+
+  VectorType const & velocity_1 = shared_velocity.get_velocity(0.5, velocity_n);
+  std::cout << "Interpolated velocity: " << (check_values(velocity_1, 1.5) ? "ok" : "failed")
+            << std::endl;
+
+  VectorType const & velocity_2 = shared_velocity.get_velocity(0.5, velocity_n);
+  std::cout << "Same time reuses interpolation: " << (&velocity_1 == &velocity_2 ? "ok" : "failed")
+            << std::endl;
+
+  VectorType const & velocity_3 = shared_velocity.get_velocity(0.25, velocity_n);
+  std::cout << "Different time: "
+            << (&velocity_3 != &velocity_1 and check_values(velocity_3, 1.25) and
+                    check_values(velocity_1, 1.5) ?
+                  "ok" :
+                  "failed")
+            << std::endl;
+
+  // same times again, interpolation remains valid
+  shared_velocity.set_velocities_and_times(velocities, {1.0, 0.0});
+  std::cout << "Same times keep interpolation: "
+            << (&shared_velocity.get_velocity(0.25, velocity_n) == &velocity_3 and
+                    check_values(velocity_3, 1.25) ?
+                  "ok" :
+                  "failed")
+            << std::endl;
+
+  // new times, the interpolation has to be recomputed
+  shared_velocity.set_velocities_and_times(velocities, {1.5, 1.0});
+  std::cout << "New times recompute interpolation: "
+            << (check_values(shared_velocity.get_velocity(0.5, velocity_n), 0.0) ? "ok" : "failed")
+            << std::endl;
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <iostream>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <exadg/solvers_and_preconditioners/utilities/qr_decomposition.h>
+
+// Check incremental update and downdate of the QR-decomposition used by the IQN schemes
+
+using namespace ExaDG;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const size = 100;
+
+double const tol = 1.e-12;
+
+VectorType
+create_column(unsigned int const index)
+{
+  VectorType v(size);
+  for(unsigned int i = 0; i < size; ++i)
+    v(i) = std::sin(0.37 * (i + 1) * (index + 1)) + 0.1 * (index + 1) * std::cos(1.3 * i);
+  return v;
+}
+
+void
+check(QRDecomposition<VectorType, double> const & QR, std::deque<VectorType> const & A)
+{
+  double error_reconstruction = 0.0, error_orthogonality = 0.0;
+
+  for(unsigned int j = 0; j < QR.size(); ++j)
+  {
+    VectorType a = A[j];
+    for(unsigned int i = 0; i <= j; ++i)
+      a.add(-QR.get_R().get(i, j), QR.get_Q()[i]);
+    error_reconstruction = std::max(error_reconstruction, a.l2_norm());
+
+    for(unsigned int i = 0; i < QR.size(); ++i)
+      error_orthogonality =
+        std::max(error_orthogonality,
+                 std::abs(QR.get_Q()[i] * QR.get_Q()[j] - (i == j ? 1.0 : 0.0)));
+  }
+
+  std::cout << "Number of columns: " << QR.size()
+            << ", A = QR: " << (error_reconstruction < tol ? "ok" : "failed")
+            << ", Q^T Q = I: " << (error_orthogonality < tol ? "ok" : "failed") << std::endl;
+}
+
+void
+test()
+{
+  QRDecomposition<VectorType, double> QR;
+  std::deque<VectorType>                   A;
+
+  unsigned int index = 0;
+
+  // append columns
+  for(; index < 5; ++index)
+  {
+    VectorType const v = create_column(index);
+    if(QR.append_column(v))
+      A.push_back(v);
+    check(QR, A);
+  }
+
+  // a linearly dependent column is filtered out
+  VectorType dependent = A[1];
+  dependent.add(2.0, A[3]);
+  std::cout << "Linearly dependent column inserted: " << QR.append_column(dependent) << std::endl;
+  check(QR, A);
+
+  // a linearly dependent column replaces the oldest column involved in the linear dependency
+  std::vector<unsigned int> removed_columns;
+  bool const appended = QR.append_column_and_filter_oldest(dependent, removed_columns);
+  std::cout << "Linearly dependent column appended: " << appended << ", removed columns:";
+  for(unsigned int const m : removed_columns)
+  {
+    std::cout << " " << m;
+    A.erase(A.begin() + m);
+  }
+  std::cout << std::endl;
+  if(appended)
+    A.push_back(dependent);
+  check(QR, A);
+
+  // remove oldest columns
+  for(unsigned int i = 0; i < 2; ++i)
+  {
+    QR.remove_first_column();
+    A.pop_front();
+    check(QR, A);
+  }
+
+  // append again
+  for(; index < 8; ++index)
+  {
+    VectorType const v = create_column(index);
+    if(QR.append_column(v))
+      A.push_back(v);
+    check(QR, A);
+  }
+
+  // remove all columns
+  while(QR.size() > 0)
+  {
+    QR.remove_first_column();
+    A.pop_front();
+    check(QR, A);
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
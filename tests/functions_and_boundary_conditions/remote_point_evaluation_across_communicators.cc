@@ -0,0 +1,153 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#include <iostream>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/functions_and_boundary_conditions/remote_point_evaluation_across_communicators.h>
+
+// Check the exchange of point values between a group of processes owning points and a disjoint
+// group of processes owning the mesh. The last process owns the mesh, all others own points.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+unsigned int const n_points = 5;
+
+double const tol = 1.e-12;
+
+// linear function, which is represented exactly by FE_Q(1)
+double
+function_value(dealii::Point<dim> const & p)
+{
+  return 1.0 + p[0] + 2.0 * p[1];
+}
+
+void
+test()
+{
+  MPI_Comm const     comm    = MPI_COMM_WORLD;
+  unsigned int const rank    = dealii::Utilities::MPI::this_mpi_process(comm);
+  unsigned int const n_ranks = dealii::Utilities::MPI::n_mpi_processes(comm);
+
+  bool const is_point_side = rank + 1 < n_ranks;
+
+  std::vector<dealii::Point<dim>> points;
+  if(is_point_side)
+  {
+    for(unsigned int i = 0; i < n_points; ++i)
+      points.emplace_back(0.1 + 0.2 * i, 0.05 + 0.1 * rank + 0.15 * i);
+  }
+
+  dealii::Triangulation<dim> triangulation;
+  dealii::DoFHandler<dim>    dof_handler(triangulation);
+  dealii::FE_Q<dim>          fe(1);
+  dealii::MappingQ1<dim>     mapping;
+  dealii::Vector<double>     solution;
+  if(not is_point_side)
+  {
+    dealii::GridGenerator::hyper_cube(triangulation);
+    triangulation.refine_global(2);
+    dof_handler.distribute_dofs(fe);
+    solution.reinit(dof_handler.n_dofs());
+    dealii::VectorTools::interpolate(mapping,
+                                     dof_handler,
+                                     dealii::ScalarFunctionFromFunctionObject<dim>(&function_value),
+                                     solution);
+  }
+
+  RemotePointEvaluationAcrossCommunicators<dim> rpe;
+  rpe.reinit(comm,
+             is_point_side,
+             points,
+             is_point_side ? nullptr : &triangulation,
+             is_point_side ? nullptr : &mapping);
+
+  double error_to_mesh = 0.0, error_to_points = 0.0;
+
+  if(is_point_side)
+  {
+    // send the exact values to the mesh side and receive the interpolated values
+    std::vector<double> values(points.size());
+    for(unsigned int i = 0; i < points.size(); ++i)
+      values[i] = function_value(points[i]);
+    rpe.start_send(values);
+
+    std::vector<double> values_received;
+    rpe.receive(values_received);
+
+    AssertThrow(values_received.size() == points.size(), dealii::ExcInternalError());
+    for(unsigned int i = 0; i < points.size(); ++i)
+      error_to_points = std::max(error_to_points, std::abs(values_received[i] - values[i]));
+
+    rpe.finish_send();
+  }
+  else
+  {
+    std::vector<double> const values =
+      dealii::VectorTools::point_values<1>(rpe.get_remote_point_evaluation(),
+                                           dof_handler,
+                                           solution);
+
+    std::vector<double> values_received;
+    rpe.receive(values_received);
+
+    AssertThrow(values_received.size() == values.size(), dealii::ExcInternalError());
+    for(unsigned int i = 0; i < values.size(); ++i)
+      error_to_mesh = std::max(error_to_mesh, std::abs(values_received[i] - values[i]));
+
+    rpe.start_send(values);
+    rpe.finish_send();
+  }
+
+  error_to_mesh   = dealii::Utilities::MPI::max(error_to_mesh, comm);
+  error_to_points = dealii::Utilities::MPI::max(error_to_points, comm);
+
+  if(rank == 0)
+  {
+    std::cout << "Number of processes on point side: " << n_ranks - 1 << std::endl;
+    std::cout << "Values sent to mesh side: " << (error_to_mesh < tol ? "ok" : "failed")
+              << std::endl;
+    std::cout << "Values sent to point side: " << (error_to_points < tol ? "ok" : "failed")
+              << std::endl;
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
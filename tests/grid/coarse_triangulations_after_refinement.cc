@@ -0,0 +1,102 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <iostream>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+
+#include <exadg/grid/grid_utilities.h>
+
+// Check which coarse triangulations for multigrid are kept after adaptive mesh refinement. The
+// unit square with 4 x 4 cells is refined in the cell at the origin, then in the cell at the
+// opposite corner, which leaves all coarse triangulations unchanged, and finally in the cell at the
+// origin once more, which adds a new coarse triangulation on top of the unchanged ones. Kept levels
+// also keep their periodic face pairs, here in x-direction.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation(
+    dealii::Triangulation<dim>::limit_level_difference_at_vertices);
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0, true /* colorize */);
+
+  GridData data;
+  data.triangulation_type = TriangulationType::Serial;
+
+  GridUtilities::PeriodicFacePairs<dim>                          periodic_face_pairs;
+  std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> coarse_triangulations;
+  std::vector<GridUtilities::PeriodicFacePairs<dim>>             coarse_periodic_face_pairs;
+
+  dealii::GridTools::collect_periodic_faces(triangulation, 0, 1, 0, periodic_face_pairs);
+  triangulation.refine_global(2);
+
+  std::vector<dealii::Point<dim>> const refinement_points = {dealii::Point<dim>(0.01, 0.01),
+                                                             dealii::Point<dim>(0.99, 0.99),
+                                                             dealii::Point<dim>(0.01, 0.01)};
+
+  for(dealii::Point<dim> const & point : refinement_points)
+  {
+    for(auto const & cell : triangulation.active_cell_iterators())
+      if(cell->point_inside(point))
+        cell->set_refine_flag();
+    triangulation.execute_coarsening_and_refinement();
+
+    std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> const coarse_triangulations_old =
+      coarse_triangulations;
+
+    GridUtilities::create_coarse_triangulations_after_coarsening_and_refinement(
+      triangulation,
+      periodic_face_pairs,
+      coarse_triangulations,
+      coarse_periodic_face_pairs,
+      data,
+      true /*amr_preserves_boundary_cells*/);
+
+    std::cout << "Number of active cells: " << triangulation.n_active_cells() << std::endl;
+    for(unsigned int level = 0; level < coarse_triangulations.size(); ++level)
+    {
+      bool const kept = level < coarse_triangulations_old.size() and
+                        coarse_triangulations[level] == coarse_triangulations_old[level];
+
+      std::cout << "  Coarse level " << level << " with "
+                << coarse_triangulations[level]->n_active_cells() << " cells and "
+                << coarse_periodic_face_pairs[level].size()
+                << " periodic face pairs: " << (kept ? "kept" : "new") << std::endl;
+    }
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
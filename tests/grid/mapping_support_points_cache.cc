@@ -0,0 +1,121 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <exadg/grid/mapping_support_points_cache.h>
+
+// Check that the cached mapping of a curved geometry coincides with the original mapping, both
+// when the support points are computed and written to the cache file and when they are read from
+// the cache file. After refinement of the mesh, the cache file is outdated and the support points
+// are computed again. The same holds if the manifolds change while the vertices remain the same.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+double const tol = 1.e-12;
+
+// maximum distance between the points mapped by both mappings
+double
+compute_difference(dealii::Mapping<dim> const &       mapping,
+                   dealii::Mapping<dim> const &       mapping_cache,
+                   dealii::Triangulation<dim> const & triangulation)
+{
+  std::vector<dealii::Point<dim>> const unit_points = {dealii::Point<dim>(0.1, 0.3),
+                                                       dealii::Point<dim>(0.5, 0.5),
+                                                       dealii::Point<dim>(0.9, 0.2)};
+
+  double difference = 0.0;
+  for(auto const & cell : triangulation.active_cell_iterators())
+    for(dealii::Point<dim> const & p : unit_points)
+      difference = std::max(difference,
+                            mapping.transform_unit_to_real_cell(cell, p).distance(
+                              mapping_cache.transform_unit_to_real_cell(cell, p)));
+
+  return difference;
+}
+
+void
+test()
+{
+  std::string const file_name = "mapping_cache";
+
+  // remove the cache file of previous runs of this test
+  std::remove((file_name + ".0").c_str());
+
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_ball(triangulation);
+  triangulation.refine_global(1);
+
+  dealii::MappingQ<dim> mapping(3);
+
+  for(std::string const stage : {"computing", "reading"})
+  {
+    auto const mapping_cache =
+      GridUtilities::create_mapping_q_cache(mapping, triangulation, file_name);
+
+    double const difference = compute_difference(mapping, *mapping_cache, triangulation);
+
+    std::cout << "Mapping after " << stage << " support points: "
+              << (difference < tol ? "ok" : "failed") << std::endl;
+  }
+
+  triangulation.refine_global(1);
+
+  auto const mapping_cache =
+    GridUtilities::create_mapping_q_cache(mapping, triangulation, file_name);
+
+  double const difference = compute_difference(mapping, *mapping_cache, triangulation);
+
+  std::cout << "Mapping after refinement: " << (difference < tol ? "ok" : "failed") << std::endl;
+
+  // the vertices remain the same, but the support points of the mapping are now computed by
+  // linear interpolation of the vertices
+  triangulation.set_all_manifold_ids(dealii::numbers::flat_manifold_id);
+
+  auto const mapping_cache_flat =
+    GridUtilities::create_mapping_q_cache(mapping, triangulation, file_name);
+
+  double const difference_flat = compute_difference(mapping, *mapping_cache_flat, triangulation);
+
+  std::cout << "Mapping after changing the manifolds: " << (difference_flat < tol ? "ok" : "failed")
+            << std::endl;
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
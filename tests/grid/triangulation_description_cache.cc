@@ -0,0 +1,163 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <exadg/grid/grid_utilities.h>
+
+// Check that a fully-distributed triangulation read from the cache file coincides with the
+// triangulation created from the serial triangulation, and that a triangulation with periodic
+// faces is rejected before the cache file is written.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+unsigned int const n_refine_global = 3;
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  GridData data;
+  data.triangulation_type = TriangulationType::FullyDistributed;
+  data.partitioning_type  = PartitioningType::z_order;
+
+  unsigned int n_serial_grids = 0;
+
+  auto const lambda_create_triangulation =
+    [&](dealii::Triangulation<dim> &            tria,
+        GridUtilities::PeriodicFacePairs<dim> & periodic_face_pairs,
+        unsigned int const                      global_refinements,
+        std::vector<unsigned int> const & /*vector_local_refinements*/) {
+      ++n_serial_grids;
+
+      dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0, true /*colorize*/);
+      if(data.triangulation_cache_file == "grid_cache_periodic")
+      {
+        dealii::GridTools::collect_periodic_faces(tria, 0, 1, 0, periodic_face_pairs);
+        tria.add_periodicity(periodic_face_pairs);
+      }
+      tria.refine_global(global_refinements);
+    };
+
+  // centers of the locally owned cells
+  auto const get_cell_centers = [](dealii::Triangulation<dim> const & tria) {
+    std::vector<dealii::Point<dim>> centers;
+    for(auto const & cell : tria.active_cell_iterators())
+      if(cell->is_locally_owned())
+        centers.push_back(cell->center());
+    return centers;
+  };
+
+  // remove the cache files of previous runs of this test
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+  {
+    for(std::string const name : {"grid_cache", "grid_cache_periodic"})
+      std::remove(
+        GridUtilities::get_triangulation_cache_file_name(name, n_refine_global, {}, false).c_str());
+  }
+  MPI_Barrier(comm);
+
+  data.triangulation_cache_file = "grid_cache";
+
+  std::vector<std::vector<dealii::Point<dim>>> cell_centers;
+  for(unsigned int run = 0; run < 2; ++run)
+  {
+    n_serial_grids = 0;
+
+    std::shared_ptr<dealii::Triangulation<dim>> triangulation;
+    GridUtilities::PeriodicFacePairs<dim>       periodic_face_pairs;
+    GridUtilities::create_triangulation<dim>(triangulation,
+                                             periodic_face_pairs,
+                                             comm,
+                                             data,
+                                             false /*construct_multigrid_hierarchy*/,
+                                             lambda_create_triangulation,
+                                             n_refine_global,
+                                             {} /*vector_local_refinements*/);
+
+    cell_centers.push_back(get_cell_centers(*triangulation));
+
+    unsigned int const n_serial_grids_global = dealii::Utilities::MPI::sum(n_serial_grids, comm);
+    if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    {
+      std::cout << "Number of cells: " << triangulation->n_global_active_cells() << std::endl;
+      std::cout << "Read from cache: " << (n_serial_grids_global == 0 ? "yes" : "no") << std::endl;
+    }
+  }
+
+  bool const cells_coincide = dealii::Utilities::MPI::min(
+    static_cast<unsigned int>(cell_centers[0] == cell_centers[1]), comm);
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    std::cout << "Locally owned cells: " << (cells_coincide ? "ok" : "failed") << std::endl;
+
+  // periodic faces
+  data.triangulation_cache_file = "grid_cache_periodic";
+
+  bool rejected = false;
+  try
+  {
+    std::shared_ptr<dealii::Triangulation<dim>> triangulation;
+    GridUtilities::PeriodicFacePairs<dim>       periodic_face_pairs;
+    GridUtilities::create_triangulation<dim>(triangulation,
+                                             periodic_face_pairs,
+                                             comm,
+                                             data,
+                                             false /*construct_multigrid_hierarchy*/,
+                                             lambda_create_triangulation,
+                                             n_refine_global,
+                                             {} /*vector_local_refinements*/);
+  }
+  catch(std::exception const &)
+  {
+    rejected = true;
+  }
+
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+  {
+    std::string const file_name = GridUtilities::get_triangulation_cache_file_name(
+      data.triangulation_cache_file, n_refine_global, {}, false);
+
+    std::cout << "Periodic faces rejected: " << (rejected ? "yes" : "no") << std::endl;
+    std::cout << "Cache file with periodic faces written: "
+              << (std::ifstream(file_name).good() ? "yes" : "no") << std::endl;
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
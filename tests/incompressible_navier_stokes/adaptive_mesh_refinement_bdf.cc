@@ -0,0 +1,316 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <exadg/incompressible_navier_stokes/postprocessor/postprocessor.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operator_dual_splitting.h>
+#include <exadg/incompressible_navier_stokes/time_integration/time_int_bdf_dual_splitting.h>
+
+// Check adaptive mesh refinement in the middle of a simulation with the dual splitting scheme of
+// second order. One simulation refines the cells in the left half of the unit square after the
+// time integrator has been set up, the other simulation starts on the refined mesh. The BDF
+// history of velocity and pressure, the convective terms at previous instants of time, which are
+// extrapolated in the next time step, and the velocity divergence after the penalty projection of
+// the transferred velocities have to coincide. The velocity is divergence-free and, like the
+// pressure, contained in the finite element spaces on both meshes, so that neither the transfer nor
+// the penalty projection may change it.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const tol = 1.e-10;
+
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double const factor = 1.0 + this->get_time();
+
+    return component == 0 ? factor * p[0] * p[0] : -2.0 * factor * p[0] * p[1];
+  }
+};
+
+class Pressure : public dealii::Function<dim>
+{
+public:
+  double
+  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  {
+    return (1.0 + this->get_time()) * (p[0] - p[1]);
+  }
+};
+
+// gives access to the convective terms at previous instants of time
+class TimeIntegrator : public IncNS::TimeIntBDFDualSplitting<dim, double>
+{
+public:
+  using IncNS::TimeIntBDFDualSplitting<dim, double>::TimeIntBDFDualSplitting;
+
+  std::vector<VectorType> const &
+  get_convective_terms() const
+  {
+    return this->vec_convective_term;
+  }
+};
+
+struct Simulation
+{
+  std::shared_ptr<Grid<dim>>                                 grid;
+  std::shared_ptr<IncNS::OperatorDualSplitting<dim, double>> pde_operator;
+  std::shared_ptr<IncNS::PostProcessor<dim, double>>         postprocessor;
+  std::shared_ptr<TimeIntegrator>                            time_integrator;
+};
+
+void
+flag_cells_left_half(dealii::Triangulation<dim> & triangulation)
+{
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned() and cell->center()[0] < 0.5)
+      cell->set_refine_flag();
+}
+
+Simulation
+run(IncNS::Parameters const &                             param,
+    std::shared_ptr<dealii::Mapping<dim> const>           mapping,
+    std::shared_ptr<IncNS::BoundaryDescriptor<dim> const> boundary_descriptor,
+    std::shared_ptr<IncNS::FieldFunctions<dim> const>     field_functions,
+    bool const                                            refine_mid_run,
+    MPI_Comm const &                                      comm)
+{
+  Simulation simulation;
+
+  simulation.grid = std::make_shared<Grid<dim>>();
+  simulation.grid->triangulation =
+    std::make_shared<dealii::parallel::distributed::Triangulation<dim>>(comm);
+
+  dealii::Triangulation<dim> & triangulation = *simulation.grid->triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  if(not refine_mid_run)
+  {
+    flag_cells_left_half(triangulation);
+    triangulation.execute_coarsening_and_refinement();
+  }
+
+  simulation.pde_operator =
+    std::make_shared<IncNS::OperatorDualSplitting<dim, double>>(simulation.grid,
+                                                                mapping,
+                                                                nullptr /* multigrid_mappings */,
+                                                                boundary_descriptor,
+                                                                field_functions,
+                                                                param,
+                                                                "fluid",
+                                                                comm);
+  simulation.pde_operator->setup();
+
+  simulation.postprocessor =
+    std::make_shared<IncNS::PostProcessor<dim, double>>(IncNS::PostProcessorData<dim>(), comm);
+  simulation.postprocessor->setup(*simulation.pde_operator);
+
+  simulation.time_integrator = std::make_shared<TimeIntegrator>(simulation.pde_operator,
+                                                                nullptr /* helpers_ale */,
+                                                                simulation.postprocessor,
+                                                                param,
+                                                                comm,
+                                                                true /* is_test */);
+  simulation.time_integrator->setup(false /* do_restart */);
+
+  // same sequence of calls as in IncNS::Driver::do_adaptive_refinement()
+  if(refine_mid_run)
+  {
+    flag_cells_left_half(triangulation);
+    triangulation.prepare_coarsening_and_refinement();
+
+    simulation.time_integrator->prepare_coarsening_and_refinement();
+
+    triangulation.execute_coarsening_and_refinement();
+
+    simulation.pde_operator->setup_after_coarsening_and_refinement();
+    simulation.postprocessor->setup_after_coarsening_and_refinement();
+
+    simulation.time_integrator->interpolate_after_coarsening_and_refinement();
+  }
+
+  return simulation;
+}
+
+// maximum difference of two vectors with the same parallel layout
+double
+compute_difference(VectorType const & vector_1, VectorType const & vector_2)
+{
+  AssertThrow(vector_1.locally_owned_size() == vector_2.locally_owned_size(),
+              dealii::ExcMessage("Vectors have different sizes."));
+
+  double difference = 0.0;
+  for(unsigned int i = 0; i < vector_1.locally_owned_size(); ++i)
+    difference =
+      std::max(difference, std::abs(vector_1.local_element(i) - vector_2.local_element(i)));
+
+  return dealii::Utilities::MPI::max(difference, vector_1.get_mpi_communicator());
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  IncNS::Parameters param;
+  param.problem_type                = IncNS::ProblemType::Unsteady;
+  param.equation_type               = IncNS::EquationType::NavierStokes;
+  param.formulation_viscous_term    = IncNS::FormulationViscousTerm::LaplaceFormulation;
+  param.formulation_convective_term = IncNS::FormulationConvectiveTerm::ConvectiveFormulation;
+  param.start_time                  = 0.0;
+  param.end_time                    = 1.0;
+  param.viscosity                   = 1.e-2;
+  param.solver_type                 = IncNS::SolverType::Unsteady;
+
+  param.temporal_discretization       = IncNS::TemporalDiscretization::BDFDualSplittingScheme;
+  param.treatment_of_convective_term  = IncNS::TreatmentOfConvectiveTerm::Explicit;
+  param.calculation_of_time_step_size = IncNS::TimeStepCalculation::UserSpecified;
+  param.time_step_size                = 0.1;
+  param.order_time_integrator         = 2;
+  param.start_with_low_order          = false;
+
+  param.grid.triangulation_type              = TriangulationType::Distributed;
+  param.degree_u                             = 2;
+  param.enable_adaptivity                    = true;
+  param.IP_formulation_viscous               = IncNS::InteriorPenaltyFormulation::SIPG;
+  param.continuity_penalty_use_boundary_data = true;
+  param.preconditioner_pressure_poisson      = IncNS::PreconditionerPressurePoisson::PointJacobi;
+  param.solver_data_projection               = SolverData(1000, 1.e-14, 1.e-12);
+
+  std::shared_ptr<IncNS::BoundaryDescriptor<dim>> boundary_descriptor =
+    std::make_shared<IncNS::BoundaryDescriptor<dim>>();
+  boundary_descriptor->velocity->dirichlet_bc.insert({0, std::make_shared<Velocity>()});
+  boundary_descriptor->pressure->neumann_bc.insert(0);
+
+  std::shared_ptr<IncNS::FieldFunctions<dim>> field_functions =
+    std::make_shared<IncNS::FieldFunctions<dim>>();
+  field_functions->initial_solution_velocity    = std::make_shared<Velocity>();
+  field_functions->initial_solution_pressure    = std::make_shared<Pressure>();
+  field_functions->analytical_solution_pressure = std::make_shared<Pressure>();
+  field_functions->right_hand_side = std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+
+  std::shared_ptr<dealii::Mapping<dim> const> mapping = std::make_shared<dealii::MappingQ<dim>>(1);
+
+  // suppress the output of the setup
+  std::ostringstream     setup_output;
+  std::streambuf * const cout_buffer = std::cout.rdbuf(setup_output.rdbuf());
+
+  param.check(dealii::ConditionalOStream(std::cout, false));
+
+  Simulation const reference =
+    run(param, mapping, boundary_descriptor, field_functions, false /* refine_mid_run */, comm);
+  Simulation const refined =
+    run(param, mapping, boundary_descriptor, field_functions, true /* refine_mid_run */, comm);
+
+  std::cout.rdbuf(cout_buffer);
+
+  std::vector<VectorType const *> velocities, velocities_reference, pressures, pressures_reference;
+  std::vector<double>             times, times_reference;
+  refined.time_integrator->get_velocities_and_times(velocities, times);
+  reference.time_integrator->get_velocities_and_times(velocities_reference, times_reference);
+  refined.time_integrator->get_pressures_and_times(pressures, times);
+  reference.time_integrator->get_pressures_and_times(pressures_reference, times_reference);
+
+  std::vector<VectorType> const & convective_terms =
+    refined.time_integrator->get_convective_terms();
+  std::vector<VectorType> const & convective_terms_reference =
+    reference.time_integrator->get_convective_terms();
+
+  AssertThrow(velocities.size() == param.order_time_integrator and
+                convective_terms.size() == param.order_time_integrator,
+              dealii::ExcMessage("Unexpected number of vectors in the BDF history."));
+
+  bool velocity_ok = true, pressure_ok = true, convective_term_ok = true, divergence_ok = true;
+  for(unsigned int i = 0; i < velocities.size(); ++i)
+  {
+    double const norm_velocity = velocities_reference[i]->linfty_norm();
+
+    velocity_ok = velocity_ok and times[i] == times_reference[i] and
+                  compute_difference(*velocities[i], *velocities_reference[i]) <
+                    tol * norm_velocity;
+
+    pressure_ok =
+      pressure_ok and compute_difference(*pressures[i], *pressures_reference[i]) <
+                        tol * pressures_reference[i]->linfty_norm();
+
+    convective_term_ok =
+      convective_term_ok and
+      compute_difference(convective_terms[i], convective_terms_reference[i]) <
+        tol * convective_terms_reference[i].linfty_norm();
+
+    VectorType divergence, divergence_reference;
+    refined.pde_operator->initialize_vector_pressure(divergence);
+    reference.pde_operator->initialize_vector_pressure(divergence_reference);
+    refined.pde_operator->evaluate_velocity_divergence_term(divergence, *velocities[i], times[i]);
+    reference.pde_operator->evaluate_velocity_divergence_term(divergence_reference,
+                                                              *velocities_reference[i],
+                                                              times_reference[i]);
+
+    divergence_ok = divergence_ok and divergence.linfty_norm() < tol * norm_velocity and
+                    compute_difference(divergence, divergence_reference) < tol * norm_velocity;
+  }
+
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+  {
+    std::cout << "Number of cells: " << refined.grid->triangulation->n_global_active_cells()
+              << std::endl;
+    std::cout << "BDF history of the velocity: " << (velocity_ok ? "ok" : "failed") << std::endl;
+    std::cout << "BDF history of the pressure: " << (pressure_ok ? "ok" : "failed") << std::endl;
+    std::cout << "Convective terms: " << (convective_term_ok ? "ok" : "failed") << std::endl;
+    std::cout << "Divergence after penalty projection: " << (divergence_ok ? "ok" : "failed")
+              << std::endl;
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
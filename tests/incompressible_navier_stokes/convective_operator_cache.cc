@@ -0,0 +1,213 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/convective_operator.h>
+
+// Check that the linearized convective operator gives the same result if the linearization
+// velocity (and the grid velocity in case of ALE) is cached in the quadrature points as if it is
+// evaluated in every operator application. Both the operator application and the diagonal are
+// compared for the divergence formulation, the convective formulation and the convective
+// formulation with ALE.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+unsigned int const degree = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const tol = 1.e-12;
+
+class Field : public dealii::Function<dim>
+{
+public:
+  Field(double const shift) : dealii::Function<dim>(dim), shift(shift)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    return component == 0 ? std::sin(p[0] + shift) * std::cos(2.0 * p[1]) :
+                            std::cos(3.0 * p[0]) * std::sin(p[1] - shift) + shift;
+  }
+
+private:
+  double const shift;
+};
+
+void
+apply_linearized_operator(VectorType &                            dst,
+                          VectorType &                            diagonal,
+                          dealii::MatrixFree<dim, double> const & matrix_free,
+                          VectorType const &                      linearization,
+                          VectorType const &                      grid_velocity,
+                          VectorType const &                      src,
+                          IncNS::FormulationConvectiveTerm const  formulation,
+                          bool const                              ale,
+                          bool const                              cache)
+{
+  IncNS::Operators::ConvectiveKernelData kernel_data;
+  kernel_data.formulation         = formulation;
+  kernel_data.temporal_treatment  = IncNS::TreatmentOfConvectiveTerm::Implicit;
+  kernel_data.upwind_factor       = 1.0;
+  kernel_data.ale                 = ale;
+  kernel_data.cache_linearization = cache;
+
+  std::shared_ptr<IncNS::Operators::ConvectiveKernel<dim, double>> kernel =
+    std::make_shared<IncNS::Operators::ConvectiveKernel<dim, double>>();
+  kernel->reinit(matrix_free, kernel_data, 0, 0, true /* use_own_velocity_storage */);
+
+  std::shared_ptr<IncNS::BoundaryDescriptorU<dim>> bc =
+    std::make_shared<IncNS::BoundaryDescriptorU<dim>>();
+  bc->dirichlet_bc.insert({0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)});
+
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  IncNS::ConvectiveOperatorData<dim> data;
+  data.kernel_data          = kernel_data;
+  data.dof_index            = 0;
+  data.quad_index           = 0;
+  data.quad_index_nonlinear = 0;
+  data.bc                   = bc;
+
+  IncNS::ConvectiveOperator<dim, double> convective_operator;
+  convective_operator.initialize(matrix_free, affine_constraints, data, kernel);
+
+  convective_operator.set_velocity_copy(linearization);
+  if(ale)
+    kernel->set_grid_velocity_ptr(grid_velocity);
+
+  convective_operator.apply(dst, src);
+  convective_operator.calculate_diagonal(diagonal);
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(degree), dim);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  MappingFlags const flags = IncNS::Operators::ConvectiveKernel<dim, double>::get_mapping_flags();
+
+  dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    flags.cells | dealii::update_values | dealii::update_quadrature_points;
+  additional_data.mapping_update_flags_inner_faces =
+    flags.inner_faces | dealii::update_values | dealii::update_quadrature_points;
+  additional_data.mapping_update_flags_boundary_faces =
+    flags.boundary_faces | dealii::update_values | dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, affine_constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  VectorType linearization, grid_velocity, src;
+  matrix_free.initialize_dof_vector(linearization);
+  matrix_free.initialize_dof_vector(grid_velocity);
+  matrix_free.initialize_dof_vector(src);
+  dealii::VectorTools::interpolate(mapping, dof_handler, Field(0.5), linearization);
+  dealii::VectorTools::interpolate(mapping, dof_handler, Field(-0.2), grid_velocity);
+  dealii::VectorTools::interpolate(mapping, dof_handler, Field(1.0), src);
+
+  auto const check = [&](std::string const &                    name,
+                         IncNS::FormulationConvectiveTerm const formulation,
+                         bool const                             ale) {
+    VectorType dst, dst_cache, diagonal, diagonal_cache;
+    matrix_free.initialize_dof_vector(dst);
+    matrix_free.initialize_dof_vector(dst_cache);
+    matrix_free.initialize_dof_vector(diagonal);
+    matrix_free.initialize_dof_vector(diagonal_cache);
+
+    apply_linearized_operator(
+      dst, diagonal, matrix_free, linearization, grid_velocity, src, formulation, ale, false);
+    apply_linearized_operator(dst_cache,
+                              diagonal_cache,
+                              matrix_free,
+                              linearization,
+                              grid_velocity,
+                              src,
+                              formulation,
+                              ale,
+                              true);
+
+    double const norm_dst      = dst.linfty_norm();
+    double const norm_diagonal = diagonal.linfty_norm();
+    dst_cache -= dst;
+    diagonal_cache -= diagonal;
+
+    if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    {
+      std::cout << name << ", apply: "
+                << (dst_cache.linfty_norm() < tol * norm_dst ? "ok" : "failed") << std::endl;
+      std::cout << name << ", diagonal: "
+                << (diagonal_cache.linfty_norm() < tol * norm_diagonal ? "ok" : "failed")
+                << std::endl;
+    }
+  };
+
+  check("Divergence formulation", IncNS::FormulationConvectiveTerm::DivergenceFormulation, false);
+  check("Convective formulation", IncNS::FormulationConvectiveTerm::ConvectiveFormulation, false);
+  check("Convective formulation with ALE",
+        IncNS::FormulationConvectiveTerm::ConvectiveFormulation,
+        true);
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,218 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#include <algorithm>
+#include <iostream>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <exadg/functions_and_boundary_conditions/separable_function.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/weak_boundary_conditions.h>
+
+// Check that the precomputed data of separable Dirichlet boundary conditions gives the same
+// boundary values as the evaluation of a generic dealii::Function
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+double const tol = 1.e-12;
+
+template<int dim>
+class SpatialPart : public dealii::Function<dim>
+{
+public:
+  SpatialPart() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    if(component == 0)
+      return std::sin(p[0]) * p[1];
+    else
+      return p[0] * p[0];
+  }
+};
+
+class TemporalPart : public dealii::Function<1>
+{
+public:
+  double
+  value(dealii::Point<1> const & p, unsigned int const /*component*/ = 0) const final
+  {
+    return 1.0 + p[0] * p[0];
+  }
+};
+
+// the same function as SeparableFunction(SpatialPart, TemporalPart) without using its structure
+template<int dim>
+class GenericFunction : public dealii::Function<dim>
+{
+public:
+  GenericFunction() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    double const t = this->get_time();
+    return spatial_part.value(p, component) * (1.0 + t * t);
+  }
+
+private:
+  SpatialPart<dim> spatial_part;
+};
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0, true /* colorize */);
+  triangulation.refine_global(2);
+
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(2), dim);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags_inner_faces = dealii::update_values;
+  additional_data.mapping_update_flags_boundary_faces =
+    dealii::update_values | dealii::update_quadrature_points;
+
+  std::vector<dealii::Quadrature<1>> const quadratures = {dealii::QGauss<1>(3),
+                                                           dealii::QGauss<1>(4)};
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     std::vector<dealii::DoFHandler<dim> const *>{&dof_handler},
+                     std::vector<dealii::AffineConstraints<double> const *>{&constraints},
+                     quadratures,
+                     additional_data);
+
+  // boundaries 0 and 2 are separable, boundaries 1 and 3 use other functions
+  auto separable = std::make_shared<BoundaryDescriptorU<dim>>();
+  auto generic   = std::make_shared<BoundaryDescriptorU<dim>>();
+  for(dealii::types::boundary_id const id : {0, 2})
+  {
+    separable->dirichlet_bc[id] =
+      std::make_shared<SeparableFunction<dim>>(std::make_shared<SpatialPart<dim>>(),
+                                               std::make_shared<TemporalPart>());
+    generic->dirichlet_bc[id] = std::make_shared<GenericFunction<dim>>();
+  }
+  for(dealii::types::boundary_id const id : {1, 3})
+  {
+    separable->dirichlet_bc[id] = std::make_shared<dealii::Functions::ConstantFunction<dim>>(
+      std::vector<double>{1.0, 2.0});
+    generic->dirichlet_bc[id] = separable->dirichlet_bc[id];
+  }
+
+  auto container = std::make_shared<ContainerSeparableData<1, dim>>();
+  container->setup(matrix_free, 0, {0, 1}, separable->dirichlet_bc);
+  separable->set_dirichlet_separable_data(container);
+
+  unsigned int n_cached_faces = 0, n_faces = 0;
+  double       error          = 0.0;
+
+  // evaluate at an earlier time again to check that the time factor is recomputed
+  for(double const time : {0.3, 0.7, 0.3})
+  {
+    for(unsigned int quad_index = 0; quad_index < quadratures.size(); ++quad_index)
+    {
+      FaceIntegrator<dim, dim, double> integrator(matrix_free, true, 0, quad_index);
+
+      unsigned int const begin = matrix_free.n_inner_face_batches();
+      unsigned int const end   = begin + matrix_free.n_boundary_face_batches();
+      for(unsigned int face = begin; face < end; ++face)
+      {
+        integrator.reinit(face);
+
+        dealii::types::boundary_id const boundary_id = matrix_free.get_boundary_id(face);
+
+        ++n_faces;
+        if(container->is_cached(integrator))
+          ++n_cached_faces;
+
+        for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        {
+          // the interior value is zero for the inhomogeneous operator
+          dealii::Tensor<1, dim, dealii::VectorizedArray<double>> value_m;
+
+          auto const value_separable =
+            IncNS::calculate_exterior_value<dim, double>(value_m,
+                                                         q,
+                                                         integrator,
+                                                         OperatorType::inhomogeneous,
+                                                         IncNS::BoundaryTypeU::Dirichlet,
+                                                         boundary_id,
+                                                         separable,
+                                                         time);
+
+          auto const value_generic =
+            IncNS::calculate_exterior_value<dim, double>(value_m,
+                                                         q,
+                                                         integrator,
+                                                         OperatorType::inhomogeneous,
+                                                         IncNS::BoundaryTypeU::Dirichlet,
+                                                         boundary_id,
+                                                         generic,
+                                                         time);
+
+          for(unsigned int d = 0; d < dim; ++d)
+            for(unsigned int v = 0; v < dealii::VectorizedArray<double>::size(); ++v)
+              error = std::max(error, std::abs(value_separable[d][v] - value_generic[d][v]));
+        }
+      }
+    }
+  }
+
+  std::cout << "Precomputed data on part of the boundary: "
+            << (n_cached_faces > 0 and n_cached_faces < n_faces ? "ok" : "failed") << std::endl;
+  std::cout << "Boundary values agree with generic function: " << (error < tol ? "ok" : "failed")
+            << std::endl;
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include <exadg/operators/cell_cost_model.h>
+
+// Check the cell costs of the cost model with given costs for boundary faces and faces with hanging
+// nodes on the unit square with 4 x 4 cells, where the cell in the corner at the origin is refined
+// once. The 15 coarse cells have 14 boundary faces and 2 faces with hanging nodes, and the 4 fine
+// cells have 4 boundary faces and 4 faces with hanging nodes. The triangulation is repartitioned
+// according to the costs, so that the costs of the processes differ by at most the cost of a cell.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+double const tol = 1.e-12;
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned() and cell->center().norm() < 0.25)
+      cell->set_refine_flag();
+  triangulation.execute_coarsening_and_refinement();
+
+  CellCostModelData data;
+  data.use_cell_weights   = true;
+  data.calibrate          = false;
+  data.cost_boundary_face = 0.5;
+  data.cost_hanging_face  = 0.25;
+
+  CellCostModel<dim> cell_cost_model(data);
+  cell_cost_model.attach(triangulation);
+  triangulation.repartition();
+
+  double cost = 0.0, max_cost_cell = 0.0;
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+    {
+      cost += cell_cost_model.get_cost(cell);
+      max_cost_cell = std::max(max_cost_cell, cell_cost_model.get_cost(cell));
+    }
+  }
+
+  double const total_cost = dealii::Utilities::MPI::sum(cost, comm);
+  max_cost_cell           = dealii::Utilities::MPI::max(max_cost_cell, comm);
+
+  double const average_cost = total_cost / dealii::Utilities::MPI::n_mpi_processes(comm);
+  double const imbalance =
+    dealii::Utilities::MPI::max(std::abs(cost - average_cost), comm) - max_cost_cell;
+
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+  {
+    std::cout << "Number of cells: " << triangulation.n_global_active_cells() << std::endl;
+    std::cout << "Total cost: " << (std::abs(total_cost - 29.5) < tol ? "ok" : "failed")
+              << std::endl;
+    std::cout << "Balanced partition: " << (imbalance < tol ? "ok" : "failed") << std::endl;
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/operators/error_indicators.h>
+
+// Check the matrix-free error indicators.
+//
+// Face jump: the function x^2 is interpolated with FE_DGQ(1) on the unit square with 8 x 8 cells
+// of size h, which gives a continuous solution whose x-derivative jumps by 2h across the 56
+// interior faces normal to the x-axis. Each of these faces contributes h * h * (2h)^2 to both
+// adjacent cells, so that the sum of the squared indicators is 448 h^4. In parallel, this also
+// checks the contributions of faces at processor boundaries to the cells on the other process.
+//
+// Modal decay: polynomials of known degree are interpolated with FE_DGQ(3) on the unit square,
+// where the Legendre polynomials of deal.II are orthonormal. A polynomial of degree 2 has no energy
+// in the highest modes, and the sums of two orthonormal modes with one of them of degree 3 in some
+// direction have half of their energy in the highest modes.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const tol = 1.e-6;
+
+void
+test_face_jump_indicator()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(3);
+
+  dealii::FE_DGQ<dim>     fe(1);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags_inner_faces =
+    get_mapping_flags_face_jump_indicator().inner_faces;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, affine_constraints, dealii::QGauss<1>(2), additional_data);
+
+  VectorType solution;
+  matrix_free.initialize_dof_vector(solution);
+  dealii::VectorTools::interpolate(mapping,
+                                   dof_handler,
+                                   dealii::ScalarFunctionFromFunctionObject<dim>(
+                                     [](dealii::Point<dim> const & p) { return p[0] * p[0]; }),
+                                   solution);
+
+  dealii::Vector<float> const indicator =
+    compute_face_jump_indicator<dim, 1, double>(matrix_free, affine_constraints, 0, 0, solution);
+
+  double sum = 0.0;
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->is_locally_owned())
+      sum += indicator[cell->active_cell_index()] * indicator[cell->active_cell_index()];
+  sum = dealii::Utilities::MPI::sum(sum, comm);
+
+  double const h = 1.0 / 8.0;
+
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    std::cout << "Face jump indicator: "
+              << (std::abs(sum - 448.0 * std::pow(h, 4)) < tol ? "ok" : "failed") << std::endl;
+}
+
+void
+test_modal_decay_indicator(std::string const &                                       name,
+                           std::function<double(dealii::Point<dim> const &)> const & function,
+                           double const                                              fraction)
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation);
+
+  dealii::FE_DGQ<dim>     fe(3);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping, dof_handler, affine_constraints, dealii::QGauss<1>(4));
+
+  VectorType solution;
+  matrix_free.initialize_dof_vector(solution);
+  dealii::VectorTools::interpolate(mapping,
+                                   dof_handler,
+                                   dealii::ScalarFunctionFromFunctionObject<dim>(function),
+                                   solution);
+
+  dealii::Vector<float> const indicator =
+    compute_modal_decay_indicator<dim, 1, double>(matrix_free, affine_constraints, 0, 0, solution);
+
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    std::cout << "Modal decay indicator, " << name << ": "
+              << (std::abs(indicator[0] - fraction) < tol ? "ok" : "failed") << std::endl;
+}
+
+void
+test()
+{
+  test_face_jump_indicator();
+
+  dealii::Polynomials::Legendre<double> const legendre_1(1), legendre_2(2), legendre_3(3);
+
+  test_modal_decay_indicator(
+    "degree 2",
+    [](dealii::Point<dim> const & p) { return p[0] * p[0] + p[0] * p[1] + p[1] * p[1]; },
+    0.0);
+  test_modal_decay_indicator(
+    "degree 3 in x",
+    [&](dealii::Point<dim> const & p) { return 1.0 + legendre_3.value(p[0]); },
+    0.5);
+  test_modal_decay_indicator(
+    "degree 3 in y",
+    [&](dealii::Point<dim> const & p) {
+      return legendre_1.value(p[0]) * legendre_2.value(p[1]) + legendre_3.value(p[1]);
+    },
+    0.5);
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cmath>
+#include <iostream>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+
+// Check that the DG Laplace operator gives the same result if the matrix-free loops are executed
+// by several threads (partition_partition) as in the serial case. The penalty parameter of the
+// interior penalty method is set per face and must not be shared between the threads.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const tol = 1.e-12;
+
+typedef dealii::MatrixFree<dim, double>::AdditionalData::TasksParallelScheme TasksParallelScheme;
+
+void
+apply_laplace_operator(VectorType &                    dst,
+                       dealii::DoFHandler<dim> const & dof_handler,
+                       TasksParallelScheme const       scheme)
+{
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  MappingFlags const flags = Poisson::Operators::LaplaceKernel<dim, double>::get_mapping_flags(
+    true /*interior faces*/, true /*boundary faces*/);
+
+  dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme               = scheme;
+  additional_data.tasks_block_size                    = 1;
+  additional_data.mapping_update_flags                = flags.cells;
+  additional_data.mapping_update_flags_inner_faces    = flags.inner_faces;
+  additional_data.mapping_update_flags_boundary_faces = flags.boundary_faces;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     dof_handler,
+                     affine_constraints,
+                     dealii::QGauss<1>(dof_handler.get_fe().degree + 1),
+                     additional_data);
+
+  std::shared_ptr<Poisson::BoundaryDescriptor<0, dim>> bc =
+    std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  bc->dirichlet_bc.insert({0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)});
+
+  Poisson::LaplaceOperatorData<0, dim> data;
+  data.bc = bc;
+
+  Poisson::LaplaceOperator<dim, double, 1> laplace_operator;
+  laplace_operator.initialize(matrix_free, affine_constraints, data);
+
+  VectorType src;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  for(unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = std::sin(1.0 + i);
+
+  laplace_operator.apply(dst, src);
+}
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(4);
+
+  dealii::FE_DGQ<dim>     fe(3);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  VectorType dst_serial, dst_threads;
+  apply_laplace_operator(dst_serial,
+                         dof_handler,
+                         dealii::MatrixFree<dim, double>::AdditionalData::none);
+  apply_laplace_operator(dst_threads,
+                         dof_handler,
+                         dealii::MatrixFree<dim, double>::AdditionalData::partition_partition);
+
+  double const norm = dst_serial.l2_norm();
+  dst_threads -= dst_serial;
+
+  std::cout << "Laplace operator with partition_partition: "
+            << (dst_threads.l2_norm() < tol * norm ? "ok" : "failed") << std::endl;
+}
+
+int
+main(int argc, char * argv[])
+{
+  // use several threads for the task-parallel matrix-free loops
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 4);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/postprocessor/cached_point_evaluation.h>
+
+// Check the values and gradients of a quadratic function computed by CachedPointEvaluation at
+// points along lines. The points lie on faces and vertices of the mesh, i.e., they are found in
+// several cells, and each process evaluates different points. The mesh is refined globally after
+// the first evaluation, which requires the points to be located again.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const tol = 1.e-10;
+
+class Solution : public dealii::Function<dim>
+{
+public:
+  double
+  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  {
+    return 1.0 + p[0] * p[0] + p[0] * p[1];
+  }
+
+  dealii::Tensor<1, dim>
+  gradient(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  {
+    dealii::Tensor<1, dim> gradient;
+    gradient[0] = 2.0 * p[0] + p[1];
+    gradient[1] = p[0];
+    return gradient;
+  }
+};
+
+void
+test()
+{
+  MPI_Comm const     comm = MPI_COMM_WORLD;
+  unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(comm);
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  dealii::FE_Q<dim>       fe(2);
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+
+  // points along a line at a face of the initial mesh, the line differs between the processes
+  std::vector<dealii::Point<dim>> points;
+  for(unsigned int i = 0; i <= 10; ++i)
+    points.emplace_back(0.1 * i, 0.25 * (1 + rank % 3));
+
+  CachedPointEvaluation<dim> point_evaluation;
+  point_evaluation.reinit(points, triangulation, mapping);
+
+  Solution solution;
+
+  for(unsigned int cycle = 0; cycle < 2; ++cycle)
+  {
+    if(cycle == 1)
+      triangulation.refine_global(1);
+
+    dof_handler.distribute_dofs(fe);
+
+    dealii::IndexSet relevant_dofs;
+    dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, relevant_dofs);
+    VectorType vector(dof_handler.locally_owned_dofs(), relevant_dofs, comm);
+    dealii::VectorTools::interpolate(mapping, dof_handler, solution, vector);
+
+    std::vector<double> const values =
+      point_evaluation.evaluate_values<1, double>(dof_handler, vector);
+    std::vector<dealii::Tensor<1, dim>> const gradients =
+      point_evaluation.evaluate_gradients<1, double>(dof_handler, vector);
+
+    AssertThrow(values.size() == points.size() and gradients.size() == points.size(),
+                dealii::ExcInternalError());
+
+    double error_values = 0.0, error_gradients = 0.0;
+    for(unsigned int i = 0; i < points.size(); ++i)
+    {
+      error_values = std::max(error_values, std::abs(values[i] - solution.value(points[i], 0)));
+      error_gradients =
+        std::max(error_gradients, (gradients[i] - solution.gradient(points[i], 0)).norm());
+    }
+
+    error_values    = dealii::Utilities::MPI::max(error_values, comm);
+    error_gradients = dealii::Utilities::MPI::max(error_gradients, comm);
+
+    if(rank == 0)
+    {
+      std::cout << "Number of cells: " << triangulation.n_global_active_cells() << std::endl;
+      std::cout << "Values: " << (error_values < tol ? "ok" : "failed") << std::endl;
+      std::cout << "Gradients: " << (error_gradients < tol ? "ok" : "failed") << std::endl;
+    }
+  }
+
+  // the local ranges of all processes cover all points exactly once
+  unsigned int const n_points_total = 10;
+
+  std::pair<unsigned int, unsigned int> const range =
+    CachedPointEvaluation<dim>::get_local_range(n_points_total, comm);
+
+  std::vector<std::pair<unsigned int, unsigned int>> const ranges =
+    dealii::Utilities::MPI::all_gather(comm, range);
+
+  bool ranges_are_valid = ranges.front().first == 0 and ranges.back().second == n_points_total;
+  for(unsigned int p = 1; p < ranges.size(); ++p)
+    ranges_are_valid = ranges_are_valid and ranges[p].first == ranges[p - 1].second;
+
+  if(rank == 0)
+    std::cout << "Local ranges: " << (ranges_are_valid ? "ok" : "failed") << std::endl;
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
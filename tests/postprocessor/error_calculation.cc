@@ -0,0 +1,162 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#include <iostream>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/postprocessor/error_calculation.h>
+
+// Check the errors computed by the matrix-free implementation of ErrorCalculator for polynomial
+// solutions on the unit square, for which the integrals are computed exactly:
+//
+// u = x y:      ||u||_L2 = 1/3, |u|_H1 = sqrt(2/3)
+// u = (x y, x): ||u||_L2 = 2/3, |u|_H1 = sqrt(5/3)
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+class Solution : public dealii::Function<dim>
+{
+public:
+  Solution(unsigned int const n_components) : dealii::Function<dim>(n_components)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    if(component == 0)
+      return p[0] * p[1];
+    else
+      return p[0];
+  }
+
+  dealii::Tensor<1, dim>
+  gradient(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    dealii::Tensor<1, dim> gradient;
+    if(component == 0)
+    {
+      gradient[0] = p[1];
+      gradient[1] = p[0];
+    }
+    else
+    {
+      gradient[0] = 1.0;
+    }
+    return gradient;
+  }
+};
+
+/*
+ * Evaluates the error of the solution vector that interpolates factor * u.
+ */
+void
+evaluate_error(ErrorCalculator<dim, double> &  error_calculator,
+               dealii::DoFHandler<dim> const & dof_handler,
+               dealii::Mapping<dim> const &    mapping,
+               double const                    factor)
+{
+  VectorType solution(dof_handler.n_dofs());
+  dealii::VectorTools::interpolate(mapping,
+                                   dof_handler,
+                                   Solution(dof_handler.get_fe().n_components()),
+                                   solution);
+  solution *= factor;
+
+  error_calculator.evaluate(solution, 0.0, true);
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(2);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  // scalar field, the error of a zero solution is the norm of u
+  dealii::FE_DGQ<dim>     fe_scalar(1);
+  dealii::DoFHandler<dim> dof_handler_scalar(triangulation);
+  dof_handler_scalar.distribute_dofs(fe_scalar);
+
+  ErrorCalculationData<dim> data;
+  data.analytical_solution         = std::make_shared<Solution>(1);
+  data.calculate_relative_errors   = false;
+  data.calculate_H1_seminorm_error = true;
+  data.name                        = "scalar (absolute)";
+
+  ErrorCalculator<dim, double> error_scalar(comm);
+  error_scalar.setup(dof_handler_scalar, mapping, data);
+  evaluate_error(error_scalar, dof_handler_scalar, mapping, 0.0);
+
+  // relative errors, u is contained in the finite element space
+  data.calculate_relative_errors = true;
+  data.name                      = "scalar (relative)";
+
+  ErrorCalculator<dim, double> error_scalar_relative(comm);
+  error_scalar_relative.setup(dof_handler_scalar, mapping, data);
+  evaluate_error(error_scalar_relative, dof_handler_scalar, mapping, 0.5);
+
+  // vectorial field
+  dealii::FESystem<dim>   fe_vector(dealii::FE_DGQ<dim>(1), dim);
+  dealii::DoFHandler<dim> dof_handler_vector(triangulation);
+  dof_handler_vector.distribute_dofs(fe_vector);
+
+  data.analytical_solution       = std::make_shared<Solution>(dim);
+  data.calculate_relative_errors = false;
+  data.name                      = "vector (absolute)";
+
+  ErrorCalculator<dim, double> error_vector(comm);
+  error_vector.setup(dof_handler_vector, mapping, data);
+  evaluate_error(error_vector, dof_handler_vector, mapping, 0.0);
+
+  // the matrix-free data of the calculators is rebuilt after the mesh has changed
+  triangulation.refine_global(1);
+  dof_handler_scalar.distribute_dofs(fe_scalar);
+  evaluate_error(error_scalar, dof_handler_scalar, mapping, 0.0);
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
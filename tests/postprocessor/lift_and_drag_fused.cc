@@ -0,0 +1,206 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#include <fstream>
+#include <iostream>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/postprocessor/fused_integral_evaluation.h>
+#include <exadg/postprocessor/lift_and_drag_calculation.h>
+
+// Check that the lift and drag force computed in the fused postprocessing loop agrees with the
+// force computed by the loop of LiftAndDragCalculator, and that a calculator using a different
+// quadrature rule than the fused loop is not registered and computes the force on its own.
+//
+// For u = (x y, x^2 - y), p = 1 + x, and viscosity nu = 1/2, the force on the boundary x = 0 of
+// the unit square is (nu - 1, 0).
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+// the coefficients are written to file with 12 digits
+double const tol = 1.e-10;
+
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    if(component == 0)
+      return p[0] * p[1];
+    else
+      return p[0] * p[0] - p[1];
+  }
+};
+
+class Pressure : public dealii::Function<dim>
+{
+public:
+  double
+  value(dealii::Point<dim> const & p, unsigned int const /*component*/ = 0) const final
+  {
+    return 1.0 + p[0];
+  }
+};
+
+// returns the drag coefficient of the first time step written to a file of LiftAndDragCalculator
+double
+read_drag(std::string const & filename)
+{
+  std::ifstream file(filename);
+  AssertThrow(file, dealii::ExcMessage("Could not read from file."));
+
+  std::string header;
+  for(unsigned int i = 0; i < 4; ++i)
+    file >> header;
+
+  double time, drag;
+  file >> time >> drag;
+
+  return drag;
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0, true /* colorize */);
+  triangulation.refine_global(2);
+
+  dealii::FESystem<dim>   fe_velocity(dealii::FE_DGQ<dim>(2), dim);
+  dealii::FE_DGQ<dim>     fe_pressure(1);
+  dealii::DoFHandler<dim> dof_handler_velocity(triangulation);
+  dealii::DoFHandler<dim> dof_handler_pressure(triangulation);
+  dof_handler_velocity.distribute_dofs(fe_velocity);
+  dof_handler_pressure.distribute_dofs(fe_pressure);
+
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+  additional_data.mapping_update_flags_inner_faces =
+    dealii::update_values | dealii::update_JxW_values | dealii::update_normal_vectors;
+  additional_data.mapping_update_flags_boundary_faces =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_normal_vectors |
+    dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping,
+                     std::vector<dealii::DoFHandler<dim> const *>{&dof_handler_velocity,
+                                                                  &dof_handler_pressure},
+                     std::vector<dealii::AffineConstraints<double> const *>{&constraints,
+                                                                            &constraints},
+                     std::vector<dealii::Quadrature<1>>{dealii::QGauss<1>(3), dealii::QGauss<1>(4)},
+                     additional_data);
+
+  VectorType velocity, pressure;
+  matrix_free.initialize_dof_vector(velocity, 0);
+  matrix_free.initialize_dof_vector(pressure, 1);
+  dealii::VectorTools::interpolate(mapping, dof_handler_velocity, Velocity(), velocity);
+  dealii::VectorTools::interpolate(mapping, dof_handler_pressure, Pressure(), pressure);
+
+  LiftAndDragData data;
+  data.viscosity    = 0.5;
+  data.boundary_IDs = {0};
+
+  FusedIntegralEvaluator<dim, double> evaluator(comm);
+  evaluator.setup(matrix_free, 0, 1, 0);
+
+  // same quadrature rule as the evaluator
+  LiftAndDragData data_fused = data;
+  data_fused.filename_drag   = "drag_fused";
+  data_fused.filename_lift   = "lift_fused";
+
+  LiftAndDragCalculator<dim, double> calculator_fused(comm);
+  calculator_fused.setup(dof_handler_velocity, matrix_free, 0, 1, 0, data_fused);
+  unsigned int const kernel_fused = calculator_fused.register_fused_integrals(evaluator);
+
+  // different quadrature rule than the evaluator
+  LiftAndDragData data_own_loop = data;
+  data_own_loop.filename_drag   = "drag_own_loop";
+  data_own_loop.filename_lift   = "lift_own_loop";
+
+  LiftAndDragCalculator<dim, double> calculator_own_loop(comm);
+  calculator_own_loop.setup(dof_handler_velocity, matrix_free, 0, 1, 1, data_own_loop);
+  unsigned int const kernel_own_loop = calculator_own_loop.register_fused_integrals(evaluator);
+
+  std::cout << "Same quadrature registered: "
+            << (kernel_fused != dealii::numbers::invalid_unsigned_int ? "ok" : "failed")
+            << std::endl;
+  std::cout << "Different quadrature not registered: "
+            << (kernel_own_loop == dealii::numbers::invalid_unsigned_int ? "ok" : "failed")
+            << std::endl;
+
+  evaluator.set_active(kernel_fused, true);
+  evaluator.evaluate(velocity, pressure);
+
+  std::cout << "Fused loop evaluated: "
+            << (evaluator.has_results(kernel_fused, velocity) ? "ok" : "failed") << std::endl;
+
+  calculator_fused.evaluate(velocity, pressure, 0.0);
+  calculator_own_loop.evaluate(velocity, pressure, 0.0);
+
+  double const drag_exact = data.viscosity - 1.0;
+
+  double const drag_fused    = read_drag(data.directory + data_fused.filename_drag);
+  double const drag_own_loop = read_drag(data.directory + data_own_loop.filename_drag);
+
+  std::cout << "Drag of fused loop: " << (std::abs(drag_fused - drag_exact) < tol ? "ok" : "failed")
+            << std::endl;
+  std::cout << "Drag of own loop: "
+            << (std::abs(drag_own_loop - drag_exact) < tol ? "ok" : "failed") << std::endl;
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,221 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <hdf5.h>
+
+#include <exadg/incompressible_navier_stokes/postprocessor/pointwise_output_generator.h>
+
+// Check the pointwise output of velocity and pressure for several samples of a time-dependent
+// solution, which is represented exactly by the finite element spaces. The samples are buffered
+// and written in chunks of two samples, and the last sample is written when the output generator
+// is destroyed. The datasets are read back from the HDF5 file.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const n_samples = 5;
+
+double const tol = 1.e-12;
+
+double
+velocity_value(dealii::Point<dim> const & p, unsigned int const component, double const t)
+{
+  return component == 0 ? t * (1.0 + p[0]) : t * p[1];
+}
+
+double
+pressure_value(dealii::Point<dim> const & p, double const t)
+{
+  return t + p[0] * p[1];
+}
+
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    return velocity_value(p, component, this->get_time());
+  }
+};
+
+class Pressure : public dealii::Function<dim>
+{
+public:
+  double
+  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  {
+    return pressure_value(p, this->get_time());
+  }
+};
+
+// reads a dataset of size n_rows x n_samples
+std::vector<double>
+read_dataset(hid_t const file, std::string const & name, unsigned int const n_rows)
+{
+  hid_t const dataset   = H5Dopen2(file, ("PhysicalInformation/" + name).c_str(), H5P_DEFAULT);
+  hid_t const dataspace = H5Dget_space(dataset);
+
+  hsize_t dims[2];
+  H5Sget_simple_extent_dims(dataspace, dims, nullptr);
+  AssertThrow(dims[0] == n_rows and dims[1] == n_samples,
+              dealii::ExcMessage("Dataset " + name + " has wrong size."));
+
+  std::vector<double> values(n_rows * n_samples);
+  H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, values.data());
+
+  H5Sclose(dataspace);
+  H5Dclose(dataset);
+
+  return values;
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe_velocity(dealii::FE_DGQ<dim>(1), dim);
+  dealii::FE_DGQ<dim>     fe_pressure(1);
+  dealii::DoFHandler<dim> dof_handler_velocity(triangulation);
+  dealii::DoFHandler<dim> dof_handler_pressure(triangulation);
+  dof_handler_velocity.distribute_dofs(fe_velocity);
+  dof_handler_pressure.distribute_dofs(fe_pressure);
+
+  dealii::IndexSet relevant_dofs_velocity, relevant_dofs_pressure;
+  dealii::DoFTools::extract_locally_relevant_dofs(dof_handler_velocity, relevant_dofs_velocity);
+  dealii::DoFTools::extract_locally_relevant_dofs(dof_handler_pressure, relevant_dofs_pressure);
+
+  VectorType velocity(dof_handler_velocity.locally_owned_dofs(), relevant_dofs_velocity, comm);
+  VectorType pressure(dof_handler_pressure.locally_owned_dofs(), relevant_dofs_pressure, comm);
+
+  // the points lie in the interior of cells
+  std::vector<dealii::Point<dim>> const points = {dealii::Point<dim>(0.1, 0.2),
+                                                  dealii::Point<dim>(0.4, 0.9),
+                                                  dealii::Point<dim>(0.7, 0.3)};
+
+  IncNS::PointwiseOutputData<dim> data;
+  data.time_control_data.is_active        = true;
+  data.time_control_data.start_time       = 0.0;
+  data.time_control_data.end_time         = n_samples;
+  data.time_control_data.trigger_interval = 1.0;
+  data.directory                          = "output/";
+  data.filename                           = "pointwise_output";
+  data.evaluation_points                  = points;
+  data.write_velocity                     = true;
+  data.write_pressure                     = true;
+  data.n_samples_per_flush                = 2;
+
+  {
+    IncNS::PointwiseOutputGenerator<dim, double> pointwise_output_generator(comm);
+    pointwise_output_generator.setup(dof_handler_velocity, dof_handler_pressure, mapping, data);
+
+    Velocity velocity_function;
+    Pressure pressure_function;
+    for(unsigned int sample = 0; sample < n_samples; ++sample)
+    {
+      double const time = 1.0 + sample;
+
+      velocity_function.set_time(time);
+      pressure_function.set_time(time);
+      dealii::VectorTools::interpolate(mapping, dof_handler_velocity, velocity_function, velocity);
+      dealii::VectorTools::interpolate(mapping, dof_handler_pressure, pressure_function, pressure);
+      velocity.update_ghost_values();
+      pressure.update_ghost_values();
+
+      pointwise_output_generator.evaluate(velocity, pressure, time, true /*unsteady*/);
+    }
+  }
+
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+  {
+    hid_t const file = H5Fopen("output/pointwise_output.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+    AssertThrow(file >= 0, dealii::ExcMessage("Could not open file."));
+
+    std::vector<double> const time            = read_dataset(file, "Time", 1);
+    std::vector<double> const velocity0       = read_dataset(file, "Velocity0", points.size());
+    std::vector<double> const velocity1       = read_dataset(file, "Velocity1", points.size());
+    std::vector<double> const pressure_values = read_dataset(file, "Pressure", points.size());
+
+    H5Fclose(file);
+
+    // the datasets have the layout (point, sample)
+    double error_time = 0.0, error_velocity = 0.0, error_pressure = 0.0;
+    for(unsigned int sample = 0; sample < n_samples; ++sample)
+    {
+      double const t = 1.0 + sample;
+
+      error_time = std::max(error_time, std::abs(time[sample] - t));
+      for(unsigned int i = 0; i < points.size(); ++i)
+      {
+        unsigned int const index = i * n_samples + sample;
+        error_velocity =
+          std::max({error_velocity,
+                    std::abs(velocity0[index] - velocity_value(points[i], 0, t)),
+                    std::abs(velocity1[index] - velocity_value(points[i], 1, t))});
+        error_pressure =
+          std::max(error_pressure, std::abs(pressure_values[index] - pressure_value(points[i], t)));
+      }
+    }
+
+    std::cout << "Time: " << (error_time < tol ? "ok" : "failed") << std::endl;
+    std::cout << "Velocity: " << (error_velocity < tol ? "ok" : "failed") << std::endl;
+    std::cout << "Pressure: " << (error_pressure < tol ? "ok" : "failed") << std::endl;
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <iostream>
+#include <set>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/data_out.h>
+
+#include <exadg/postprocessor/output_data_base.h>
+#include <exadg/postprocessor/write_output.h>
+
+// Check the selection of cells for reduced output and of boundary faces for surface output on the
+// unit square with 8 x 8 cells. The slice x = 0.3 cuts one column of cells, the slice y = 0.5
+// touches two rows of cells, and the box [0.6, 0.7] x [0.6, 0.7] intersects 2 x 2 cells, which are
+// already selected by the second slice except for two of them. The boundary with ID 1 (x = 1)
+// consists of 8 faces.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0, true /*colorize*/);
+  triangulation.refine_global(3);
+
+  OutputDataBase output_data;
+  output_data.slices.push_back(OutputSlice{{0.3, 0.0}, {1.0, 0.0}});
+  output_data.slices.push_back(OutputSlice{{0.0, 0.5}, {0.0, -2.0}});
+  output_data.boxes.push_back(OutputBox{{0.6, 0.6}, {0.7, 0.7}});
+
+  dealii::DataOut<dim> data_out;
+  data_out.attach_triangulation(triangulation);
+  select_cells_for_output(data_out, output_data);
+
+  auto const & [first_cell, next_cell] = data_out.get_cell_selection();
+
+  unsigned int n_selected_cells = 0;
+  for(auto cell = first_cell(triangulation); cell != triangulation.end();
+      cell      = next_cell(triangulation, cell))
+    ++n_selected_cells;
+
+  DataOutBoundaryFaces<dim> data_out_faces({1});
+  data_out_faces.attach_triangulation(triangulation);
+
+  unsigned int n_selected_faces = 0;
+  for(auto face = data_out_faces.first_face(); face.first != triangulation.end();
+      face      = data_out_faces.next_face(face))
+    ++n_selected_faces;
+
+  DataOutBoundaryFaces<dim> data_out_all_faces(std::set<dealii::types::boundary_id>{});
+  data_out_all_faces.attach_triangulation(triangulation);
+
+  unsigned int n_boundary_faces = 0;
+  for(auto face = data_out_all_faces.first_face(); face.first != triangulation.end();
+      face      = data_out_all_faces.next_face(face))
+    ++n_boundary_faces;
+
+  n_selected_cells = dealii::Utilities::MPI::sum(n_selected_cells, comm);
+  n_selected_faces = dealii::Utilities::MPI::sum(n_selected_faces, comm);
+  n_boundary_faces = dealii::Utilities::MPI::sum(n_boundary_faces, comm);
+
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+  {
+    std::cout << "Number of selected cells: " << n_selected_cells << std::endl;
+    std::cout << "Number of faces with boundary ID 1: " << n_selected_faces << std::endl;
+    std::cout << "Number of boundary faces: " << n_boundary_faces << std::endl;
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/postprocessor/statistics_manager.h>
+
+// Check the turbulent channel statistics for two samples of the velocity field
+// u = s (1 - y^2, y / 2, 0) with s = 1 and s = 2 on the channel [0,1] x [-1,1] x [0,1]. The
+// velocity is contained in the finite element space, so the statistics at the sampling planes are
+// <u> = 3/2 (1 - y^2), <v> = 3/4 y, rms(u') = 1/2 |1 - y^2|, rms(v) = sqrt(5/2) |y| / 2 and
+// <u'v'> = 5/4 y (1 - y^2).
+
+using namespace ExaDG;
+
+unsigned int const dim = 3;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+// the statistics are written to file with 8 significant digits
+double const tol = 1.e-6;
+
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity(double const scaling) : dealii::Function<dim>(dim), scaling(scaling)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    if(component == 0)
+      return scaling * (1.0 - p[1] * p[1]);
+    else if(component == 1)
+      return scaling * 0.5 * p[1];
+    else
+      return 0.0;
+  }
+
+private:
+  double const scaling;
+};
+
+// maps the reference coordinate in [0,1] to the y-coordinate of the channel
+double
+grid_transform(double const & eta)
+{
+  return 2.0 * eta - 1.0;
+}
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_rectangle(triangulation,
+                                         dealii::Point<dim>(0.0, -1.0, 0.0),
+                                         dealii::Point<dim>(1.0, 1.0, 1.0));
+  triangulation.refine_global(1);
+
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(2), dim);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  TurbulentChannelData data;
+  data.filename = "statistics_manager";
+
+  TimeControlDataStatistics & time_control_data = data.time_control_data_statistics;
+  time_control_data.time_control_data.is_active                = true;
+  time_control_data.time_control_data.trigger_every_time_steps = 1;
+  time_control_data.write_preliminary_results_every_nth_time_step = 1;
+
+  StatisticsManager<dim, double> statistics(dof_handler, mapping);
+  statistics.setup(&grid_transform, data);
+
+  for(double const scaling : {1.0, 2.0})
+  {
+    VectorType velocity(dof_handler.n_dofs());
+    dealii::VectorTools::interpolate(mapping, dof_handler, Velocity(scaling), velocity);
+    statistics.evaluate(velocity, true);
+  }
+
+  statistics.write_output();
+
+  // read the statistics from file and compare with the exact values
+  std::ifstream file(data.directory + data.filename + ".flow_statistics");
+  AssertThrow(file, dealii::ExcMessage("Could not read from file."));
+
+  std::string line;
+  while(std::getline(file, line) and line.find("  y") != 0)
+  {
+  }
+
+  unsigned int n_planes = 0;
+  double       error    = 0.0;
+  while(std::getline(file, line))
+  {
+    std::istringstream stream(line);
+    double             y, u, v, w, rms_u, rms_v, rms_w, uv;
+    stream >> y >> u >> v >> w >> rms_u >> rms_v >> rms_w >> uv;
+
+    double const f = 1.0 - y * y;
+
+    std::vector<double> const errors = {u - 1.5 * f,
+                                        v - 0.75 * y,
+                                        w,
+                                        rms_u - 0.5 * std::abs(f),
+                                        rms_v - std::sqrt(2.5) * 0.5 * std::abs(y),
+                                        rms_w,
+                                        uv - 1.25 * y * f};
+    for(double const e : errors)
+      error = std::max(error, std::abs(e));
+    ++n_planes;
+  }
+
+  std::cout << "Number of sampling planes: " << n_planes << std::endl;
+  std::cout << "Statistics: " << (error < tol ? "ok" : "failed") << std::endl;
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cmath>
+#include <iostream>
+
+#include <deal.II/base/mpi.h>
+
+#include <exadg/postprocessor/spectral_analysis/setup.h>
+#include <exadg/postprocessor/spectral_analysis/spectrum.h>
+
+// Check the energy spectrum of a velocity field consisting of one Fourier mode per component,
+// u_d = cos(2 pi k_d x_{d+1} / N) with k_d = d + 1 and the coordinate index taken modulo dim, on
+// N^dim equidistant points. Each component contributes the energy 1/4 to the bin k_d, and the
+// energy computed in physical space and in spectral space has to coincide (Parseval). The
+// distribution of the data among the processes must not affect the results.
+
+using namespace ExaDG;
+
+unsigned int const n_cells = 4;
+
+unsigned int const n_points_per_cell = 2;
+
+double const tol = 1.e-12;
+
+void
+test(int const dim)
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealspectrum::Setup setup(comm);
+  setup.init(dim, n_cells, n_points_per_cell, n_points_per_cell);
+
+  dealspectrum::SpectralAnalysis fftw(comm, setup);
+  fftw.init();
+
+  int const N = n_cells * n_points_per_cell;
+
+  int y_start, y_end, z_start, z_end;
+  fftw.get_local_range_real(y_start, y_end, z_start, z_end);
+
+  for(int d = 0; d < dim; ++d)
+  {
+    double * u = fftw.get_real(d);
+    for(int z = z_start, i = 0; z < z_end; ++z)
+      for(int y = y_start; y < y_end; ++y)
+        for(int x = 0; x < N; ++x, ++i)
+        {
+          int const coordinates[3] = {x, y, z};
+          u[i] = std::cos(2.0 * M_PI * (d + 1) * coordinates[(d + 1) % dim] / N);
+        }
+  }
+
+  fftw.execute();
+  fftw.calculate_energy();
+  fftw.calculate_energy_spectrum();
+
+  double *K, *E, *C;
+  double  e_d, e_s;
+
+  int const n_bins = fftw.get_results(K, E, C, e_d, e_s);
+
+  // the results are only available on the first process
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+  {
+    double error_spectrum = 0.0;
+    for(int k = 0; k < n_bins; ++k)
+    {
+      double const E_exact = (k >= 1 and k <= dim) ? 0.25 : 0.0;
+      error_spectrum       = std::max(error_spectrum, std::abs(E[k] - E_exact));
+    }
+
+    std::cout << "Dimension: " << dim << std::endl;
+    std::cout << "Energy in physical space: "
+              << (std::abs(e_d - 0.25 * dim) < tol ? "ok" : "failed") << std::endl;
+    std::cout << "Energy in spectral space: " << (std::abs(e_s - e_d) < tol ? "ok" : "failed")
+              << std::endl;
+    std::cout << "Energy spectrum: " << (error_spectrum < tol ? "ok" : "failed") << std::endl;
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test(2);
+  test(3);
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <exadg/structure/material/library/mooney_rivlin.h>
+#include <exadg/structure/material/library/neo_hookean.h>
+#include <exadg/structure/material/library/st_venant_kirchhoff.h>
+
+// Check that the directional derivative of the 2nd Piola-Kirchhoff stress implemented by the
+// material models is consistent with the stress, by comparing it to the central difference
+//
+//   (S(H + eps * Delta) - S(H - eps * Delta)) / (2 eps)
+//
+// for a displacement gradient H and an increment Delta, which differ between the lanes of the
+// vectorized arrays. The error of the central difference is of order eps^2.
+
+using namespace ExaDG;
+
+double const eps = 1.e-5;
+
+double const tol = 1.e-7;
+
+template<int dim>
+void
+check(std::string const & name, Structure::Material<dim, double> const & material)
+{
+  typedef typename Structure::Material<dim, double>::tensor tensor;
+
+  tensor H, Delta, F;
+  for(unsigned int v = 0; v < dealii::VectorizedArray<double>::size(); ++v)
+  {
+    for(unsigned int i = 0; i < dim; ++i)
+    {
+      for(unsigned int j = 0; j < dim; ++j)
+      {
+        H[i][j][v]     = 0.2 * std::sin(1.0 + i + 2.0 * j + 0.7 * v);
+        Delta[i][j][v] = std::cos(2.0 + 3.0 * i + j + 0.3 * v);
+      }
+    }
+  }
+
+  F = H;
+  for(unsigned int d = 0; d < dim; ++d)
+    F[d][d] += 1.0;
+
+  dealii::VectorizedArray<double> const epsilon = dealii::make_vectorized_array(eps);
+
+  tensor const derivative =
+    material.second_piola_kirchhoff_stress_displacement_derivative(Delta, F, 0, 0);
+  tensor const difference = (material.second_piola_kirchhoff_stress(H + epsilon * Delta, 0, 0) -
+                             material.second_piola_kirchhoff_stress(H - epsilon * Delta, 0, 0)) *
+                            (0.5 / epsilon);
+
+  double error = 0.0;
+  for(unsigned int v = 0; v < dealii::VectorizedArray<double>::size(); ++v)
+  {
+    double error_lane = 0.0, norm_lane = 0.0;
+    for(unsigned int i = 0; i < dim; ++i)
+    {
+      for(unsigned int j = 0; j < dim; ++j)
+      {
+        error_lane += std::pow(derivative[i][j][v] - difference[i][j][v], 2);
+        norm_lane += std::pow(derivative[i][j][v], 2);
+      }
+    }
+    error = std::max(error, std::sqrt(error_lane / norm_lane));
+  }
+
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    std::cout << "dim = " << dim << ", " << name << ": " << (error < tol ? "ok" : "failed")
+              << std::endl;
+}
+
+template<int dim>
+void
+test()
+{
+  double const E = 100.0, nu = 0.3;
+
+  // the MatrixFree object is only used for a variable Young's modulus
+  dealii::MatrixFree<dim, double> matrix_free;
+
+  for(bool const large_deformation : {false, true})
+  {
+    std::string const suffix = large_deformation ? ", large deformation" : ", small deformation";
+
+    Structure::StVenantKirchhoffData<dim> const st_venant_kirchhoff_data(
+      Structure::MaterialType::StVenantKirchhoff, E, nu, Structure::Type2D::PlaneStrain);
+    check<dim>("St. Venant-Kirchhoff" + suffix,
+               Structure::StVenantKirchhoff<dim, double>(
+                 matrix_free, 0, 0, st_venant_kirchhoff_data, large_deformation));
+
+    Structure::NeoHookeanData const neo_hookean_data(Structure::MaterialType::NeoHookean,
+                                                     E,
+                                                     nu,
+                                                     Structure::Type2D::PlaneStrain);
+    check<dim>("Neo-Hookean" + suffix,
+               Structure::NeoHookean<dim, double>(neo_hookean_data, large_deformation));
+
+    Structure::MooneyRivlinData const mooney_rivlin_data(
+      Structure::MaterialType::MooneyRivlin, 20.0, 10.0, 60.0, Structure::Type2D::PlaneStrain);
+    check<dim>("Mooney-Rivlin" + suffix,
+               Structure::MooneyRivlin<dim, double>(mooney_rivlin_data, large_deformation));
+  }
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test<2>();
+  test<3>();
+
+  return 0;
+}
@@ -0,0 +1,200 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <exadg/structure/material/library/mooney_rivlin.h>
+#include <exadg/structure/material/library/neo_hookean.h>
+#include <exadg/structure/material/library/st_venant_kirchhoff.h>
+#include <exadg/structure/spatial_discretization/operators/nonlinear_operator.h>
+
+// Check that the linearized operator of nonlinear elasticity gives the same result if the
+// deformation gradient, the 2nd Piola-Kirchhoff stress and the material tangent at the point of
+// linearization are cached in the quadrature points as if they are computed in every operator
+// application. Both the operator application and the diagonal are compared for all material
+// models.
+
+using namespace ExaDG;
+
+unsigned int const dim = 2;
+
+unsigned int const degree = 2;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+double const tol = 1.e-12;
+
+class Displacement : public dealii::Function<dim>
+{
+public:
+  Displacement(double const amplitude) : dealii::Function<dim>(dim), amplitude(amplitude)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    return component == 0 ? amplitude * std::sin(p[0] + 0.3) * std::cos(2.0 * p[1]) :
+                            amplitude * (std::cos(3.0 * p[0]) * std::sin(p[1]) + p[0] * p[1]);
+  }
+
+private:
+  double const amplitude;
+};
+
+void
+apply_linearized_operator(VectorType &                                     dst,
+                          VectorType &                                     diagonal,
+                          dealii::MatrixFree<dim, double> const &          matrix_free,
+                          std::shared_ptr<Structure::MaterialData> const & material_data,
+                          VectorType const &                               linearization,
+                          VectorType const &                               src,
+                          bool const                                       cache)
+{
+  std::shared_ptr<Structure::BoundaryDescriptor<dim>> bc =
+    std::make_shared<Structure::BoundaryDescriptor<dim>>();
+  bc->neumann_bc.insert({0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)});
+
+  std::shared_ptr<Structure::MaterialDescriptor> material_descriptor =
+    std::make_shared<Structure::MaterialDescriptor>();
+  material_descriptor->insert({0, material_data});
+
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  Structure::OperatorData<dim> data;
+  data.dof_index               = 0;
+  data.dof_index_inhomogeneous = 0;
+  data.quad_index              = 0;
+  data.bc                      = bc;
+  data.material_descriptor     = material_descriptor;
+  data.large_deformation       = true;
+  data.cache_linearization     = cache;
+
+  Structure::NonLinearOperator<dim, double> nonlinear_operator;
+  nonlinear_operator.initialize(matrix_free, affine_constraints, data);
+
+  nonlinear_operator.set_solution_linearization(linearization);
+
+  nonlinear_operator.apply(dst, src);
+  nonlinear_operator.calculate_diagonal(diagonal);
+}
+
+void
+test()
+{
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> triangulation(comm);
+  dealii::GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(2);
+
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe(dealii::FE_Q<dim>(degree), dim);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<double> affine_constraints;
+  affine_constraints.close();
+
+  MappingFlags const flags = Structure::ElasticityOperatorBase<dim, double>::get_mapping_flags();
+
+  dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags                = flags.cells;
+  additional_data.mapping_update_flags_boundary_faces = flags.boundary_faces;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, affine_constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  // moderate deformation with J > 0
+  VectorType linearization, src;
+  matrix_free.initialize_dof_vector(linearization);
+  matrix_free.initialize_dof_vector(src);
+  dealii::VectorTools::interpolate(mapping, dof_handler, Displacement(0.1), linearization);
+  dealii::VectorTools::interpolate(mapping, dof_handler, Displacement(1.0), src);
+
+  auto const check = [&](std::string const &                              name,
+                         std::shared_ptr<Structure::MaterialData> const & material_data) {
+    VectorType dst, dst_cache, diagonal, diagonal_cache;
+    matrix_free.initialize_dof_vector(dst);
+    matrix_free.initialize_dof_vector(dst_cache);
+    matrix_free.initialize_dof_vector(diagonal);
+    matrix_free.initialize_dof_vector(diagonal_cache);
+
+    apply_linearized_operator(dst, diagonal, matrix_free, material_data, linearization, src, false);
+    apply_linearized_operator(
+      dst_cache, diagonal_cache, matrix_free, material_data, linearization, src, true);
+
+    double const norm_dst      = dst.linfty_norm();
+    double const norm_diagonal = diagonal.linfty_norm();
+    dst_cache -= dst;
+    diagonal_cache -= diagonal;
+
+    if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    {
+      std::cout << name << ", apply: "
+                << (dst_cache.linfty_norm() < tol * norm_dst ? "ok" : "failed") << std::endl;
+      std::cout << name << ", diagonal: "
+                << (diagonal_cache.linfty_norm() < tol * norm_diagonal ? "ok" : "failed")
+                << std::endl;
+    }
+  };
+
+  check("St. Venant-Kirchhoff (plane strain)",
+        std::make_shared<Structure::StVenantKirchhoffData<dim>>(
+          Structure::MaterialType::StVenantKirchhoff, 100.0, 0.3, Structure::Type2D::PlaneStrain));
+  check("St. Venant-Kirchhoff (plane stress)",
+        std::make_shared<Structure::StVenantKirchhoffData<dim>>(
+          Structure::MaterialType::StVenantKirchhoff, 100.0, 0.3, Structure::Type2D::PlaneStress));
+  check("Neo-Hookean",
+        std::make_shared<Structure::NeoHookeanData>(
+          Structure::MaterialType::NeoHookean, 100.0, 0.3, Structure::Type2D::PlaneStrain));
+  check("Mooney-Rivlin",
+        std::make_shared<Structure::MooneyRivlinData>(
+          Structure::MaterialType::MooneyRivlin, 20.0, 10.0, 60.0, Structure::Type2D::PlaneStrain));
+}
+
+int
+main(int argc, char * argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test();
+
+  return 0;
+}